@@ -75,12 +75,20 @@ void usage_fprint(
 	fprintf( stream, "Use fsntfsinfo to determine information about a Windows NT\n"
 	                 " File System (NTFS) volume.\n\n" );
 
-	fprintf( stream, "Usage: fsntfsinfo [ -B bodyfile ] [ -E mft_entry_index ] [ -F path ]\n"
-	                 "                  [ -o offset ] [ -hHUvV ] source\n\n" );
+	fprintf( stream, "Usage: fsntfsinfo [ -B bodyfile ] [ -d digest_types ]\n"
+	                 "                  [ -D hash_file ] [ -E mft_entry_index ]\n"
+	                 "                  [ -F path ] [ -o offset ] [ -hHUvV ] source\n\n" );
 
 	fprintf( stream, "\tsource: the source file or device\n\n" );
 
 	fprintf( stream, "\t-B:     output file system information as a bodyfile\n" );
+	fprintf( stream, "\t-d:     calculate digest (hash) types of a file entry to include\n"
+	                 "\t        in the bodyfile, options: md5, sha1, sha256\n"
+	                 "\t        the MD5 hash is stored in the MD5 column, the SHA1 and\n"
+	                 "\t        SHA256 hashes are stored in the hash file\n" );
+	fprintf( stream, "\t-D:     output the SHA1 and SHA256 hashes of the bodyfile entries\n"
+	                 "\t        to a hash file, required for the sha1 and sha256\n"
+	                 "\t        digest types\n" );
 	fprintf( stream, "\t-E:     show information about a specific MFT entry index\n"
 	                 "\t        or \"all\".\n" );
 	fprintf( stream, "\t-F:     show information about a specific file entry path.\n" );
@@ -146,7 +154,9 @@ int main( int argc, char * const argv[] )
 {
 	libcerror_error_t *error                   = NULL;
 	system_character_t *option_bodyfile        = NULL;
+	system_character_t *option_digest_types    = NULL;
 	system_character_t *option_file_entry      = NULL;
+	system_character_t *option_hash_file       = NULL;
 	system_character_t *option_mft_entry_index = NULL;
 	system_character_t *option_volume_offset   = NULL;
 	system_character_t *source                 = NULL;
@@ -191,7 +201,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = fsntfstools_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "B:E:F:hHo:UvV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "B:d:D:E:F:hHo:UvV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -212,6 +222,16 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'd':
+				option_digest_types = optarg;
+
+				break;
+
+			case (system_integer_t) 'D':
+				option_hash_file = optarg;
+
+				break;
+
 			case (system_integer_t) 'E':
 				option_mode            = FSNTFSINFO_MODE_MFT_ENTRY;
 				option_mft_entry_index = optarg;
@@ -301,6 +321,60 @@ int main( int argc, char * const argv[] )
 
 			goto on_error;
 		}
+		if( option_digest_types != NULL )
+		{
+			result = info_handle_set_digest_types(
+			          fsntfsinfo_info_handle,
+			          option_digest_types,
+			          &error );
+
+			if( result == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to set digest types.\n" );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				fprintf(
+				 stderr,
+				 "Unsupported digest types.\n" );
+
+				goto on_error;
+			}
+		}
+		/* The SHA1 and SHA256 hashes are not stored in the bodyfile, since it has
+		 * a single hash column
+		 */
+		if( ( ( fsntfsinfo_info_handle->calculate_sha1 != 0 )
+		  || ( fsntfsinfo_info_handle->calculate_sha256 != 0 ) )
+		 && ( option_hash_file == NULL ) )
+		{
+			fprintf(
+			 stderr,
+			 "Missing hash file for SHA1 and SHA256 digest types.\n" );
+
+			usage_fprint(
+			 stdout );
+
+			goto on_error;
+		}
+		if( option_hash_file != NULL )
+		{
+			if( info_handle_set_hash_file(
+			     fsntfsinfo_info_handle,
+			     option_hash_file,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to set hash file.\n" );
+
+				goto on_error;
+			}
+		}
 	}
 	if( option_volume_offset != NULL )
 	{
@@ -36,6 +36,7 @@
 #include "fsntfstools_libfsntfs.h"
 #include "fsntfstools_libfusn.h"
 #include "fsntfstools_libfwnt.h"
+#include "fsntfstools_libhmac.h"
 #include "fsntfstools_libuna.h"
 #include "fsntfstools_output.h"
 
@@ -206,6 +207,11 @@ void fsntfstools_output_version_detailed_fprint(
 	 ", libfusn %s",
 	 LIBFUSN_VERSION_STRING );
 
+	fprintf(
+	 stream,
+	 ", libhmac %s",
+	 LIBHMAC_VERSION_STRING );
+
 	fprintf(
 	 stream,
 	 ", libfwnt %s",
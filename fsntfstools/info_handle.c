@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <file_stream.h>
 #include <memory.h>
 #include <narrow_string.h>
@@ -27,15 +28,18 @@
 #include <types.h>
 #include <wide_string.h>
 
+#include "digest_hash.h"
 #include "fsntfstools_libbfio.h"
 #include "fsntfstools_libcerror.h"
 #include "fsntfstools_libclocale.h"
 #include "fsntfstools_libcnotify.h"
+#include "fsntfstools_libcthreads.h"
 #include "fsntfstools_libfdatetime.h"
 #include "fsntfstools_libfguid.h"
 #include "fsntfstools_libfwnt.h"
 #include "fsntfstools_libfsntfs.h"
 #include "fsntfstools_libfusn.h"
+#include "fsntfstools_libhmac.h"
 #include "fsntfstools_libuna.h"
 #include "info_handle.h"
 
@@ -62,7 +66,14 @@ int libfsntfs_mft_metadata_file_open_file_io_handle(
 
 #endif /* !defined( LIBFSNTFS_HAVE_BFIO ) */
 
-#define INFO_HANDLE_NOTIFY_STREAM	stdout
+#define INFO_HANDLE_NOTIFY_STREAM		stdout
+
+#define INFO_HANDLE_HASH_CHUNK_SIZE		( 4 * 1024 * 1024 )
+#define INFO_HANDLE_NUMBER_OF_HASH_CHUNKS	4
+
+/* Sparse data is hashed from this buffer instead of being read
+ */
+static const uint8_t info_handle_sparse_data[ 65536 ] = { 0 };
 
 /* Copies a string of a decimal value to a 64-bit value
  * Returns 1 if successful or -1 on error
@@ -524,6 +535,22 @@ int info_handle_free(
 			}
 			( *info_handle )->bodyfile_stream = NULL;
 		}
+		if( ( *info_handle )->hash_file_stream != NULL )
+		{
+			if( file_stream_close(
+			     ( *info_handle )->hash_file_stream ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close hash file stream.",
+				 function );
+
+				result = -1;
+			}
+			( *info_handle )->hash_file_stream = NULL;
+		}
 		if( ( *info_handle )->input_volume != NULL )
 		{
 			if( libfsntfs_volume_free(
@@ -684,6 +711,209 @@ int info_handle_set_bodyfile(
 	return( 1 );
 }
 
+/* Sets the hash file
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_set_hash_file(
+     info_handle_t *info_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_set_hash_file";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->hash_file_stream != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid info handle - hash file stream value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	info_handle->hash_file_stream = file_stream_open_wide(
+	                                 filename,
+	                                 L"wb" );
+#else
+	info_handle->hash_file_stream = file_stream_open(
+	                                 filename,
+	                                 "wb" );
+#endif
+	if( info_handle->hash_file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open hash file stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the digest types
+ * The string contains a comma separated list of: md5, sha1 and sha256
+ * Returns 1 if successful, 0 if unsupported values or -1 on error
+ */
+int info_handle_set_digest_types(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function    = "info_handle_set_digest_types";
+	size_t segment_length    = 0;
+	size_t segment_start     = 0;
+	size_t string_index      = 0;
+	size_t string_length     = 0;
+	uint8_t calculate_md5    = 0;
+	uint8_t calculate_sha1   = 0;
+	uint8_t calculate_sha256 = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	for( string_index = 0;
+	     string_index <= string_length;
+	     string_index++ )
+	{
+		if( ( string_index < string_length )
+		 && ( string[ string_index ] != (system_character_t) ',' ) )
+		{
+			continue;
+		}
+		segment_length = string_index - segment_start;
+
+		if( segment_length == 3 )
+		{
+			if( system_string_compare(
+			     &( string[ segment_start ] ),
+			     _SYSTEM_STRING( "md5" ),
+			     3 ) == 0 )
+			{
+				calculate_md5 = 1;
+			}
+			else
+			{
+				return( 0 );
+			}
+		}
+		else if( segment_length == 4 )
+		{
+			if( system_string_compare(
+			     &( string[ segment_start ] ),
+			     _SYSTEM_STRING( "sha1" ),
+			     4 ) == 0 )
+			{
+				calculate_sha1 = 1;
+			}
+			else
+			{
+				return( 0 );
+			}
+		}
+		else if( segment_length == 5 )
+		{
+			if( system_string_compare(
+			     &( string[ segment_start ] ),
+			     _SYSTEM_STRING( "sha-1" ),
+			     5 ) == 0 )
+			{
+				calculate_sha1 = 1;
+			}
+			else
+			{
+				return( 0 );
+			}
+		}
+		else if( segment_length == 6 )
+		{
+			if( system_string_compare(
+			     &( string[ segment_start ] ),
+			     _SYSTEM_STRING( "sha256" ),
+			     6 ) == 0 )
+			{
+				calculate_sha256 = 1;
+			}
+			else
+			{
+				return( 0 );
+			}
+		}
+		else if( segment_length == 7 )
+		{
+			if( system_string_compare(
+			     &( string[ segment_start ] ),
+			     _SYSTEM_STRING( "sha-256" ),
+			     7 ) == 0 )
+			{
+				calculate_sha256 = 1;
+			}
+			else
+			{
+				return( 0 );
+			}
+		}
+		else
+		{
+			return( 0 );
+		}
+		segment_start = string_index + 1;
+	}
+	info_handle->calculate_md5    = calculate_md5;
+	info_handle->calculate_sha1   = calculate_sha1;
+	info_handle->calculate_sha256 = calculate_sha256;
+
+	return( 1 );
+}
+
 /* Sets the volume offset
  * Returns 1 if successful or -1 on error
  */
@@ -5155,7 +5385,6 @@ int info_handle_bodyfile_file_name_attribute_fprint(
 	 (double) ( modification_time - 116444736000000000L ) / 10000000,
 	 (double) ( entry_modification_time - 116444736000000000L ) / 10000000,
 	 (double) ( creation_time - 116444736000000000L ) / 10000000 );
-
 	return( 1 );
 }
 
@@ -5375,137 +5604,1406 @@ int info_handle_bodyfile_index_root_attribute_fprint(
 	 (double) ( modification_time - 116444736000000000L ) / 10000000,
 	 (double) ( entry_modification_time - 116444736000000000L ) / 10000000,
 	 (double) ( creation_time - 116444736000000000L ) / 10000000 );
-
 	return( 1 );
 }
 
-/* Prints a file entry value to a bodyfile
- * Returns 1 if successful, 0 if not or -1 on error
+/* Creates a hash chunk
+ * Make sure the value hash_chunk is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
  */
-int info_handle_bodyfile_file_entry_value_fprint(
-     info_handle_t *info_handle,
-     libfsntfs_file_entry_t *file_entry,
-     libfsntfs_data_stream_t *alternate_data_stream,
-     const system_character_t *path,
-     const system_character_t *file_entry_name,
-     const system_character_t *data_stream_name,
+int info_handle_hash_chunk_initialize(
+     info_handle_hash_chunk_t **hash_chunk,
+     size_t data_size,
      libcerror_error_t **error )
 {
-	char file_mode_string[ 13 ]      = { '-', '/', '-', 'r', 'w', 'x', 'r', 'w', 'x', 'r', 'w', 'x', 0 };
+	static char *function = "info_handle_hash_chunk_initialize";
 
-	static char *function            = "info_handle_bodyfile_file_entry_value_fprint";
-	size64_t size                    = 0;
-	uint64_t access_time             = 0;
-	uint64_t creation_time           = 0;
-	uint64_t entry_modification_time = 0;
-	uint64_t file_reference          = 0;
-	uint64_t modification_time       = 0;
-	uint32_t file_attribute_flags    = 0;
-	uint32_t group_identifier        = 0;
-	uint32_t owner_identifier        = 0;
-	int result                       = 0;
-
-	if( info_handle == NULL )
+	if( hash_chunk == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid info handle.",
+		 "%s: invalid hash chunk.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfsntfs_file_entry_get_file_reference(
-	     file_entry,
-	     &file_reference,
-	     error ) != 1 )
+	if( *hash_chunk != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file reference.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid hash chunk value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfsntfs_file_entry_get_creation_time(
-	     file_entry,
-	     &creation_time,
-	     error ) != 1 )
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve creation time.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfsntfs_file_entry_get_modification_time(
-	     file_entry,
-	     &modification_time,
-	     error ) != 1 )
+	*hash_chunk = memory_allocate_structure(
+	               info_handle_hash_chunk_t );
+
+	if( *hash_chunk == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve modification time.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash chunk.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libfsntfs_file_entry_get_access_time(
-	     file_entry,
-	     &access_time,
-	     error ) != 1 )
+	if( memory_set(
+	     *hash_chunk,
+	     0,
+	     sizeof( info_handle_hash_chunk_t ) ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve access time.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash chunk.",
 		 function );
 
+		memory_free(
+		 *hash_chunk );
+
+		*hash_chunk = NULL;
+
 		return( -1 );
 	}
-	if( libfsntfs_file_entry_get_entry_modification_time(
-	     file_entry,
-	     &entry_modification_time,
-	     error ) != 1 )
+	( *hash_chunk )->data = (uint8_t *) memory_allocate(
+	                                     sizeof( uint8_t ) * data_size );
+
+	if( ( *hash_chunk )->data == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve entry modification time.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libfsntfs_file_entry_get_file_attribute_flags(
-	     file_entry,
-	     &file_attribute_flags,
-	     error ) != 1 )
+	return( 1 );
+
+on_error:
+	if( *hash_chunk != NULL )
+	{
+		memory_free(
+		 *hash_chunk );
+
+		*hash_chunk = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a hash chunk
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_hash_chunk_free(
+     info_handle_hash_chunk_t **hash_chunk,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_hash_chunk_free";
+
+	if( hash_chunk == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file attribute flags.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash chunk.",
 		 function );
 
 		return( -1 );
 	}
-	if( alternate_data_stream != NULL )
+	if( *hash_chunk != NULL )
 	{
-		if( libfsntfs_data_stream_get_size(
-		     alternate_data_stream,
-		     &size,
-		     error ) != 1 )
+		memory_free(
+		 ( *hash_chunk )->data );
+
+		memory_free(
+		 *hash_chunk );
+
+		*hash_chunk = NULL;
+	}
+	return( 1 );
+}
+
+/* Updates the context of a digest hash with data
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_digest_hash_update(
+     info_handle_t *info_handle,
+     int digest_type,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_digest_hash_update";
+	int result            = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	switch( digest_type )
+	{
+		case INFO_HANDLE_DIGEST_TYPE_MD5:
+			result = libhmac_md5_update(
+			          info_handle->md5_context,
+			          data,
+			          data_size,
+			          error );
+			break;
+
+		case INFO_HANDLE_DIGEST_TYPE_SHA1:
+			result = libhmac_sha1_update(
+			          info_handle->sha1_context,
+			          data,
+			          data_size,
+			          error );
+			break;
+
+		case INFO_HANDLE_DIGEST_TYPE_SHA256:
+			result = libhmac_sha256_update(
+			          info_handle->sha256_context,
+			          data,
+			          data_size,
+			          error );
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported digest type: %d.",
+			 function,
+			 digest_type );
+
+			return( -1 );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update digest hash: %d context.",
+		 function,
+		 digest_type );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Updates the context of a digest hash with the data of a hash chunk
+ * Sparse chunks are hashed from a buffer of 0-byte values so that their data does not need to be read
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_hash_chunk_update(
+     info_handle_t *info_handle,
+     info_handle_hash_chunk_t *hash_chunk,
+     int digest_type,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_hash_chunk_update";
+	size_t data_offset    = 0;
+	size_t update_size    = 0;
+
+	if( hash_chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_chunk->is_sparse == 0 )
+	{
+		if( info_handle_digest_hash_update(
+		     info_handle,
+		     digest_type,
+		     hash_chunk->data,
+		     hash_chunk->data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update digest hash.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	while( data_offset < hash_chunk->data_size )
+	{
+		update_size = hash_chunk->data_size - data_offset;
+
+		if( update_size > sizeof( info_handle_sparse_data ) )
+		{
+			update_size = sizeof( info_handle_sparse_data );
+		}
+		if( info_handle_digest_hash_update(
+		     info_handle,
+		     digest_type,
+		     info_handle_sparse_data,
+		     update_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update digest hash.",
+			 function );
+
+			return( -1 );
+		}
+		data_offset += update_size;
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Hashes a chunk on the thread of a digest hash
+ * The chunk is returned to the queue of available chunks after all digest hashes have been updated with it
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_hash_chunk_process(
+     info_handle_t *info_handle,
+     info_handle_hash_chunk_t *hash_chunk,
+     int digest_type )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "info_handle_hash_chunk_process";
+	int result               = 1;
+
+	if( info_handle == NULL )
+	{
+		return( -1 );
+	}
+	if( hash_chunk == NULL )
+	{
+		return( -1 );
+	}
+	if( info_handle->hash_chunk_result == 1 )
+	{
+		if( info_handle_hash_chunk_update(
+		     info_handle,
+		     hash_chunk,
+		     digest_type,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to hash chunk.",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+
+			info_handle->hash_chunk_result = -1;
+
+			result = -1;
+		}
+	}
+	if( libcthreads_mutex_grab(
+	     info_handle->hash_chunks_mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab hash chunks mutex.",
+		 function );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+
+		info_handle->hash_chunk_result = -1;
+
+		return( -1 );
+	}
+	hash_chunk->number_of_pending_digest_hashes -= 1;
+
+	/* The chunk is always returned to the queue otherwise the reader blocks
+	 */
+	if( hash_chunk->number_of_pending_digest_hashes == 0 )
+	{
+		if( libcthreads_queue_push(
+		     info_handle->hash_chunks_queue,
+		     (intptr_t *) hash_chunk,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push hash chunk onto queue.",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+
+			info_handle->hash_chunk_result = -1;
+
+			result = -1;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     info_handle->hash_chunks_mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release hash chunks mutex.",
+		 function );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+
+		info_handle->hash_chunk_result = -1;
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Hashes a chunk on the MD5 thread
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_hash_chunk_md5_callback(
+     info_handle_hash_chunk_t *hash_chunk,
+     info_handle_t *info_handle )
+{
+	return( info_handle_hash_chunk_process(
+	         info_handle,
+	         hash_chunk,
+	         INFO_HANDLE_DIGEST_TYPE_MD5 ) );
+}
+
+/* Hashes a chunk on the SHA1 thread
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_hash_chunk_sha1_callback(
+     info_handle_hash_chunk_t *hash_chunk,
+     info_handle_t *info_handle )
+{
+	return( info_handle_hash_chunk_process(
+	         info_handle,
+	         hash_chunk,
+	         INFO_HANDLE_DIGEST_TYPE_SHA1 ) );
+}
+
+/* Hashes a chunk on the SHA256 thread
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_hash_chunk_sha256_callback(
+     info_handle_hash_chunk_t *hash_chunk,
+     info_handle_t *info_handle )
+{
+	return( info_handle_hash_chunk_process(
+	         info_handle,
+	         hash_chunk,
+	         INFO_HANDLE_DIGEST_TYPE_SHA256 ) );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Calculates the digest hashes of the default data stream or an alternate data stream of a file entry
+ * When multi-threading support is available every digest hash is calculated on its own thread
+ * so that reading the next chunk overlaps with hashing the previous ones
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_calculate_digest_hashes(
+     info_handle_t *info_handle,
+     libfsntfs_file_entry_t *file_entry,
+     libfsntfs_data_stream_t *alternate_data_stream,
+     char *md5_string,
+     size_t md5_string_size,
+     char *sha1_string,
+     size_t sha1_string_size,
+     char *sha256_string,
+     size_t sha256_string_size,
+     libcerror_error_t **error )
+{
+	uint8_t calculate_digest_hashes[ INFO_HANDLE_NUMBER_OF_DIGEST_TYPES ];
+	uint8_t md5_hash[ LIBHMAC_MD5_HASH_SIZE ];
+	uint8_t sha1_hash[ LIBHMAC_SHA1_HASH_SIZE ];
+	uint8_t sha256_hash[ LIBHMAC_SHA256_HASH_SIZE ];
+
+	info_handle_hash_chunk_t *hash_chunk = NULL;
+	static char *function                = "info_handle_calculate_digest_hashes";
+	size64_t data_size                   = 0;
+	size_t chunk_data_size               = INFO_HANDLE_HASH_CHUNK_SIZE;
+	ssize_t read_count                   = 0;
+	off64_t data_offset                  = 0;
+	int digest_type                      = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *hash_thread_pools[ INFO_HANDLE_NUMBER_OF_DIGEST_TYPES ] = { NULL, NULL, NULL };
+
+	int (*hash_chunk_callback)( intptr_t *, void * )                                   = NULL;
+	int hash_chunk_index                                                               = 0;
+	int number_of_hash_thread_pools                                                    = 0;
+#endif
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( info_handle->calculate_md5 == 0 )
+	 && ( info_handle->calculate_sha1 == 0 )
+	 && ( info_handle->calculate_sha256 == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid info handle - missing digest types.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->md5_context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid info handle - MD5 context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->sha1_context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid info handle - SHA1 context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->sha256_context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid info handle - SHA256 context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	calculate_digest_hashes[ INFO_HANDLE_DIGEST_TYPE_MD5 ]    = info_handle->calculate_md5;
+	calculate_digest_hashes[ INFO_HANDLE_DIGEST_TYPE_SHA1 ]   = info_handle->calculate_sha1;
+	calculate_digest_hashes[ INFO_HANDLE_DIGEST_TYPE_SHA256 ] = info_handle->calculate_sha256;
+
+	if( alternate_data_stream != NULL )
+	{
+		if( libfsntfs_data_stream_get_size(
+		     alternate_data_stream,
+		     &data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( libfsntfs_file_entry_get_size(
+		     file_entry,
+		     &data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( info_handle->calculate_md5 != 0 )
+	{
+		if( libhmac_md5_initialize(
+		     &( info_handle->md5_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize MD5 context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( info_handle->calculate_sha1 != 0 )
+	{
+		if( libhmac_sha1_initialize(
+		     &( info_handle->sha1_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize SHA1 context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( info_handle->calculate_sha256 != 0 )
+	{
+		if( libhmac_sha256_initialize(
+		     &( info_handle->sha256_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize SHA256 context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	info_handle->hash_chunk_result = 1;
+
+	if( data_size < (size64_t) chunk_data_size )
+	{
+		chunk_data_size = (size_t) data_size;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* Only use the hash threads if there is more than a single chunk to read
+	 */
+	if( data_size > (size64_t) INFO_HANDLE_HASH_CHUNK_SIZE )
+	{
+		if( libcthreads_mutex_initialize(
+		     &( info_handle->hash_chunks_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize hash chunks mutex.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_queue_initialize(
+		     &( info_handle->hash_chunks_queue ),
+		     INFO_HANDLE_NUMBER_OF_HASH_CHUNKS,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize hash chunks queue.",
+			 function );
+
+			goto on_error;
+		}
+		for( hash_chunk_index = 0;
+		     hash_chunk_index < INFO_HANDLE_NUMBER_OF_HASH_CHUNKS;
+		     hash_chunk_index++ )
+		{
+			if( info_handle_hash_chunk_initialize(
+			     &hash_chunk,
+			     chunk_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create hash chunk: %d.",
+				 function,
+				 hash_chunk_index );
+
+				goto on_error;
+			}
+			if( libcthreads_queue_push(
+			     info_handle->hash_chunks_queue,
+			     (intptr_t *) hash_chunk,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push hash chunk: %d onto queue.",
+				 function,
+				 hash_chunk_index );
+
+				goto on_error;
+			}
+			hash_chunk = NULL;
+		}
+		/* Every digest hash has its own thread so that the chunks are hashed in order
+		 */
+		for( digest_type = 0;
+		     digest_type < INFO_HANDLE_NUMBER_OF_DIGEST_TYPES;
+		     digest_type++ )
+		{
+			if( calculate_digest_hashes[ digest_type ] == 0 )
+			{
+				continue;
+			}
+			switch( digest_type )
+			{
+				case INFO_HANDLE_DIGEST_TYPE_MD5:
+					hash_chunk_callback = (int (*)(intptr_t *, void *)) &info_handle_hash_chunk_md5_callback;
+					break;
+
+				case INFO_HANDLE_DIGEST_TYPE_SHA1:
+					hash_chunk_callback = (int (*)(intptr_t *, void *)) &info_handle_hash_chunk_sha1_callback;
+					break;
+
+				case INFO_HANDLE_DIGEST_TYPE_SHA256:
+					hash_chunk_callback = (int (*)(intptr_t *, void *)) &info_handle_hash_chunk_sha256_callback;
+					break;
+			}
+			if( libcthreads_thread_pool_create(
+			     &( hash_thread_pools[ digest_type ] ),
+			     NULL,
+			     1,
+			     INFO_HANDLE_NUMBER_OF_HASH_CHUNKS,
+			     hash_chunk_callback,
+			     (void *) info_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create hash thread pool: %d.",
+				 function,
+				 digest_type );
+
+				goto on_error;
+			}
+			number_of_hash_thread_pools++;
+		}
+	}
+	else
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+	if( chunk_data_size > 0 )
+	{
+		if( info_handle_hash_chunk_initialize(
+		     &hash_chunk,
+		     chunk_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create hash chunk.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	while( (size64_t) data_offset < data_size )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( number_of_hash_thread_pools > 0 )
+		{
+			if( libcthreads_queue_pop(
+			     info_handle->hash_chunks_queue,
+			     (intptr_t **) &hash_chunk,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to pop hash chunk from queue.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#endif
+		/* Sparse chunks are not read and only their size is returned
+		 */
+		if( alternate_data_stream != NULL )
+		{
+			read_count = libfsntfs_data_stream_read_chunk_at_offset(
+			              alternate_data_stream,
+			              hash_chunk->data,
+			              chunk_data_size,
+			              data_offset,
+			              &( hash_chunk->is_sparse ),
+			              error );
+		}
+		else
+		{
+			read_count = libfsntfs_file_entry_read_chunk_at_offset(
+			              file_entry,
+			              hash_chunk->data,
+			              chunk_data_size,
+			              data_offset,
+			              &( hash_chunk->is_sparse ),
+			              error );
+		}
+		if( read_count <= 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunk at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 data_offset,
+			 data_offset );
+
+			goto on_error;
+		}
+		hash_chunk->data_size = (size_t) read_count;
+		data_offset          += read_count;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( number_of_hash_thread_pools > 0 )
+		{
+			/* The chunk is owned by the reader until it is pushed onto the thread pools
+			 * hence the number of pending digest hashes can be set without holding the mutex
+			 */
+			hash_chunk->number_of_pending_digest_hashes = number_of_hash_thread_pools;
+
+			for( digest_type = 0;
+			     digest_type < INFO_HANDLE_NUMBER_OF_DIGEST_TYPES;
+			     digest_type++ )
+			{
+				if( hash_thread_pools[ digest_type ] == NULL )
+				{
+					continue;
+				}
+				if( libcthreads_thread_pool_push(
+				     hash_thread_pools[ digest_type ],
+				     (intptr_t *) hash_chunk,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to push hash chunk onto thread pool: %d.",
+					 function,
+					 digest_type );
+
+					goto on_error;
+				}
+			}
+			hash_chunk = NULL;
+		}
+		else
+#endif
+		for( digest_type = 0;
+		     digest_type < INFO_HANDLE_NUMBER_OF_DIGEST_TYPES;
+		     digest_type++ )
+		{
+			if( calculate_digest_hashes[ digest_type ] == 0 )
+			{
+				continue;
+			}
+			if( info_handle_hash_chunk_update(
+			     info_handle,
+			     hash_chunk,
+			     digest_type,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to hash chunk.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_hash_thread_pools > 0 )
+	{
+		for( digest_type = 0;
+		     digest_type < INFO_HANDLE_NUMBER_OF_DIGEST_TYPES;
+		     digest_type++ )
+		{
+			if( hash_thread_pools[ digest_type ] == NULL )
+			{
+				continue;
+			}
+			if( libcthreads_thread_pool_join(
+			     &( hash_thread_pools[ digest_type ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join hash thread pool: %d.",
+				 function,
+				 digest_type );
+
+				goto on_error;
+			}
+		}
+		if( libcthreads_queue_free(
+		     &( info_handle->hash_chunks_queue ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &info_handle_hash_chunk_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free hash chunks queue.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_mutex_free(
+		     &( info_handle->hash_chunks_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free hash chunks mutex.",
+			 function );
+
+			goto on_error;
+		}
+		if( info_handle->hash_chunk_result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to hash chunks.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	if( hash_chunk != NULL )
+	{
+		if( info_handle_hash_chunk_free(
+		     &hash_chunk,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free hash chunk.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( info_handle->md5_context != NULL )
+	{
+		if( libhmac_md5_finalize(
+		     info_handle->md5_context,
+		     md5_hash,
+		     LIBHMAC_MD5_HASH_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize MD5 context.",
+			 function );
+
+			goto on_error;
+		}
+		if( libhmac_md5_free(
+		     &( info_handle->md5_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free MD5 context.",
+			 function );
+
+			goto on_error;
+		}
+		if( digest_hash_copy_to_string(
+		     md5_hash,
+		     LIBHMAC_MD5_HASH_SIZE,
+		     md5_string,
+		     md5_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set MD5 hash string.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( info_handle->sha1_context != NULL )
+	{
+		if( libhmac_sha1_finalize(
+		     info_handle->sha1_context,
+		     sha1_hash,
+		     LIBHMAC_SHA1_HASH_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize SHA1 context.",
+			 function );
+
+			goto on_error;
+		}
+		if( libhmac_sha1_free(
+		     &( info_handle->sha1_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free SHA1 context.",
+			 function );
+
+			goto on_error;
+		}
+		if( digest_hash_copy_to_string(
+		     sha1_hash,
+		     LIBHMAC_SHA1_HASH_SIZE,
+		     sha1_string,
+		     sha1_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set SHA1 hash string.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( info_handle->sha256_context != NULL )
+	{
+		if( libhmac_sha256_finalize(
+		     info_handle->sha256_context,
+		     sha256_hash,
+		     LIBHMAC_SHA256_HASH_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize SHA256 context.",
+			 function );
+
+			goto on_error;
+		}
+		if( libhmac_sha256_free(
+		     &( info_handle->sha256_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free SHA256 context.",
+			 function );
+
+			goto on_error;
+		}
+		if( digest_hash_copy_to_string(
+		     sha256_hash,
+		     LIBHMAC_SHA256_HASH_SIZE,
+		     sha256_string,
+		     sha256_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set SHA256 hash string.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	for( digest_type = 0;
+	     digest_type < INFO_HANDLE_NUMBER_OF_DIGEST_TYPES;
+	     digest_type++ )
+	{
+		if( hash_thread_pools[ digest_type ] != NULL )
+		{
+			libcthreads_thread_pool_join(
+			 &( hash_thread_pools[ digest_type ] ),
+			 NULL );
+		}
+	}
+	if( info_handle->hash_chunks_queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &( info_handle->hash_chunks_queue ),
+		 (int (*)(intptr_t **, libcerror_error_t **)) &info_handle_hash_chunk_free,
+		 NULL );
+	}
+	if( info_handle->hash_chunks_mutex != NULL )
+	{
+		libcthreads_mutex_free(
+		 &( info_handle->hash_chunks_mutex ),
+		 NULL );
+	}
+#endif
+	/* A chunk that was not pushed onto all the thread pools is not returned to the queue
+	 */
+	if( hash_chunk != NULL )
+	{
+		info_handle_hash_chunk_free(
+		 &hash_chunk,
+		 NULL );
+	}
+	if( info_handle->sha256_context != NULL )
+	{
+		libhmac_sha256_free(
+		 &( info_handle->sha256_context ),
+		 NULL );
+	}
+	if( info_handle->sha1_context != NULL )
+	{
+		libhmac_sha1_free(
+		 &( info_handle->sha1_context ),
+		 NULL );
+	}
+	if( info_handle->md5_context != NULL )
+	{
+		libhmac_md5_free(
+		 &( info_handle->md5_context ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Prints the SHA1 and SHA256 digest hashes of a bodyfile entry to the hash file
+ * The columns are the calculated digest hashes followed by the name of the bodyfile entry
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_hash_file_digest_hashes_fprint(
+     info_handle_t *info_handle,
+     const system_character_t *path,
+     const system_character_t *file_entry_name,
+     const system_character_t *data_stream_name,
+     const char *sha1_string,
+     const char *sha256_string,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_hash_file_digest_hashes_fprint";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( sha1_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SHA1 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( sha256_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SHA256 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->hash_file_stream == NULL )
+	{
+		return( 1 );
+	}
+	/* Colums in the hash file
+	 * [SHA1|][SHA256|]name
+	 */
+	if( info_handle->calculate_sha1 != 0 )
+	{
+		fprintf(
+		 info_handle->hash_file_stream,
+		 "%s|",
+		 sha1_string );
+	}
+	if( info_handle->calculate_sha256 != 0 )
+	{
+		fprintf(
+		 info_handle->hash_file_stream,
+		 "%s|",
+		 sha256_string );
+	}
+	if( path != NULL )
+	{
+		fprintf(
+		 info_handle->hash_file_stream,
+		 "%" PRIs_SYSTEM "",
+		 path );
+	}
+	if( file_entry_name != NULL )
+	{
+		fprintf(
+		 info_handle->hash_file_stream,
+		 "%" PRIs_SYSTEM "",
+		 file_entry_name );
+	}
+	if( data_stream_name != NULL )
+	{
+		fprintf(
+		 info_handle->hash_file_stream,
+		 ":%" PRIs_SYSTEM "",
+		 data_stream_name );
+	}
+	fprintf(
+	 info_handle->hash_file_stream,
+	 "\n" );
+
+	return( 1 );
+}
+
+/* Prints a file entry value to a bodyfile
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int info_handle_bodyfile_file_entry_value_fprint(
+     info_handle_t *info_handle,
+     libfsntfs_file_entry_t *file_entry,
+     libfsntfs_data_stream_t *alternate_data_stream,
+     const system_character_t *path,
+     const system_character_t *file_entry_name,
+     const system_character_t *data_stream_name,
+     libcerror_error_t **error )
+{
+	char file_mode_string[ 13 ]      = { '-', '/', '-', 'r', 'w', 'x', 'r', 'w', 'x', 'r', 'w', 'x', 0 };
+	char md5_string[ 33 ]            = { '0', 0 };
+	char sha1_string[ 41 ]           = { '0', 0 };
+	char sha256_string[ 65 ]         = { '0', 0 };
+
+	static char *function            = "info_handle_bodyfile_file_entry_value_fprint";
+	size64_t size                    = 0;
+	uint64_t access_time             = 0;
+	uint64_t creation_time           = 0;
+	uint64_t entry_modification_time = 0;
+	uint64_t file_reference          = 0;
+	uint64_t modification_time       = 0;
+	uint32_t file_attribute_flags    = 0;
+	uint32_t group_identifier        = 0;
+	uint32_t owner_identifier        = 0;
+	uint8_t has_digest_hashes        = 0;
+	int result                       = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsntfs_file_entry_get_file_reference(
+	     file_entry,
+	     &file_reference,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file reference.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsntfs_file_entry_get_creation_time(
+	     file_entry,
+	     &creation_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve creation time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsntfs_file_entry_get_modification_time(
+	     file_entry,
+	     &modification_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve modification time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsntfs_file_entry_get_access_time(
+	     file_entry,
+	     &access_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve access time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsntfs_file_entry_get_entry_modification_time(
+	     file_entry,
+	     &entry_modification_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry modification time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsntfs_file_entry_get_file_attribute_flags(
+	     file_entry,
+	     &file_attribute_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file attribute flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( alternate_data_stream != NULL )
+	{
+		if( libfsntfs_data_stream_get_size(
+		     alternate_data_stream,
+		     &size,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -5566,12 +7064,66 @@ int info_handle_bodyfile_file_entry_value_fprint(
 		file_mode_string[ 7 ]  = '-';
 		file_mode_string[ 10 ] = '-';
 	}
+	if( ( ( info_handle->calculate_md5 != 0 )
+	  || ( info_handle->calculate_sha1 != 0 )
+	  || ( info_handle->calculate_sha256 != 0 ) )
+	 && ( file_mode_string[ 0 ] != 'd' ) )
+	{
+		if( alternate_data_stream != NULL )
+		{
+			result = 1;
+		}
+		else
+		{
+			result = libfsntfs_file_entry_has_default_data_stream(
+			          file_entry,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine if file entry has default data stream.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( result != 0 )
+		{
+			if( info_handle_calculate_digest_hashes(
+			     info_handle,
+			     file_entry,
+			     alternate_data_stream,
+			     md5_string,
+			     33,
+			     sha1_string,
+			     41,
+			     sha256_string,
+			     65,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to calculate digest hashes.",
+				 function );
+
+				return( -1 );
+			}
+			has_digest_hashes = 1;
+		}
+	}
 	/* Colums in a Sleuthkit 3.x and later bodyfile
 	 * MD5|name|inode|mode_as_string|UID|GID|size|atime|mtime|ctime|crtime
 	 */
 	fprintf(
 	 info_handle->bodyfile_stream,
-	 "0|" );
+	 "%s|",
+	 md5_string );
 
 	if( path != NULL )
 	{
@@ -5610,6 +7162,27 @@ int info_handle_bodyfile_file_entry_value_fprint(
 	 (double) ( entry_modification_time - 116444736000000000L ) / 10000000,
 	 (double) ( creation_time - 116444736000000000L ) / 10000000 );
 
+	if( has_digest_hashes != 0 )
+	{
+		if( info_handle_hash_file_digest_hashes_fprint(
+		     info_handle,
+		     path,
+		     file_entry_name,
+		     data_stream_name,
+		     sha1_string,
+		     sha256_string,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print digest hashes.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	return( 1 );
 }
 
@@ -8017,7 +9590,8 @@ int info_handle_usn_change_journal_fprint(
 	libfusn_record_t *usn_record                       = NULL;
 	uint8_t *buffer                                    = NULL;
 	static char *function                              = "info_handle_usn_change_journal_fprint";
-	size_t journal_block_size                          = 0x1000;
+	size_t buffer_offset                               = 0;
+	size_t buffer_size                                 = 4 * 1024 * 1024;
 	ssize_t read_count                                 = 0;
 	uint32_t usn_record_size                           = 0;
 
@@ -8040,19 +9614,6 @@ int info_handle_usn_change_journal_fprint(
 	 info_handle->notify_stream,
 	 "USN change journal: \\$Extend\\$UsnJrnl\n\n" );
 
-/* TODO get journal block size from USN change journal */
-	if( ( journal_block_size == 0 )
-	 || ( journal_block_size > (size_t) SSIZE_MAX ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid journal block size value out of bounds.",
-		 function );
-
-		goto on_error;
-	}
 	if( libfsntfs_volume_get_usn_change_journal(
 	     info_handle->input_volume,
 	     &usn_change_journal,
@@ -8068,7 +9629,7 @@ int info_handle_usn_change_journal_fprint(
 		goto on_error;
 	}
 	buffer = (uint8_t *) memory_allocate(
-	                      sizeof( uint8_t ) * journal_block_size );
+	                      sizeof( uint8_t ) * buffer_size );
 
 	if( buffer == NULL )
 	{
@@ -8083,10 +9644,10 @@ int info_handle_usn_change_journal_fprint(
 	}
 	do
 	{
-		read_count = libfsntfs_usn_change_journal_read_usn_record(
+		read_count = libfsntfs_usn_change_journal_read_usn_records(
 			      usn_change_journal,
 			      buffer,
-			      journal_block_size,
+			      buffer_size,
 			      error );
 
 		if( read_count < 0 )
@@ -8095,13 +9656,31 @@ int info_handle_usn_change_journal_fprint(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read USN record data.",
+			 "%s: unable to read USN records data.",
 			 function );
 
 			goto on_error;
 		}
-		else if( read_count > 0 )
+		buffer_offset = 0;
+
+		while( ( buffer_offset + 4 ) <= (size_t) read_count )
 		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( buffer[ buffer_offset ] ),
+			 usn_record_size );
+
+			if( ( usn_record_size == 0 )
+			 || ( (size_t) usn_record_size > ( (size_t) read_count - buffer_offset ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid USN record size value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
 			if( libfusn_record_initialize(
 			     &usn_record,
 			     error ) != 1 )
@@ -8117,8 +9696,8 @@ int info_handle_usn_change_journal_fprint(
 			}
 			if( libfusn_record_copy_from_byte_stream(
 			     usn_record,
-			     buffer,
-			     read_count,
+			     &( buffer[ buffer_offset ] ),
+			     (size_t) usn_record_size,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -8130,20 +9709,6 @@ int info_handle_usn_change_journal_fprint(
 
 				goto on_error;
 			}
-			if( libfusn_record_get_size(
-			     usn_record,
-			     &usn_record_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve USN record size.",
-				 function );
-
-				goto on_error;
-			}
 			if( info_handle_usn_record_fprint(
 			     info_handle,
 			     usn_record,
@@ -8171,6 +9736,7 @@ int info_handle_usn_change_journal_fprint(
 
 				goto on_error;
 			}
+			buffer_offset += usn_record_size;
 		}
 	}
 	while( read_count > 0 );
@@ -28,13 +28,45 @@
 
 #include "fsntfstools_libbfio.h"
 #include "fsntfstools_libcerror.h"
+#include "fsntfstools_libcthreads.h"
 #include "fsntfstools_libfsntfs.h"
 #include "fsntfstools_libfusn.h"
+#include "fsntfstools_libhmac.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+enum INFO_HANDLE_DIGEST_TYPES
+{
+	INFO_HANDLE_DIGEST_TYPE_MD5		= 0,
+	INFO_HANDLE_DIGEST_TYPE_SHA1		= 1,
+	INFO_HANDLE_DIGEST_TYPE_SHA256		= 2
+};
+
+#define INFO_HANDLE_NUMBER_OF_DIGEST_TYPES	3
+
+typedef struct info_handle_hash_chunk info_handle_hash_chunk_t;
+
+struct info_handle_hash_chunk
+{
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* Value to indicate the chunk is sparse
+	 */
+	uint8_t is_sparse;
+
+	/* The number of digest hashes that still need to be updated with the chunk
+	 */
+	int number_of_pending_digest_hashes;
+};
+
 typedef struct info_handle info_handle_t;
 
 struct info_handle
@@ -63,6 +95,49 @@ struct info_handle
 	 */
 	FILE *bodyfile_stream;
 
+	/* The hash file output stream, which contains the SHA1 and SHA256 hashes
+	 * of the bodyfile entries
+	 */
+	FILE *hash_file_stream;
+
+	/* Value to indicate if the MD5 hash should be calculated
+	 */
+	uint8_t calculate_md5;
+
+	/* Value to indicate if the SHA1 hash should be calculated
+	 */
+	uint8_t calculate_sha1;
+
+	/* Value to indicate if the SHA256 hash should be calculated
+	 */
+	uint8_t calculate_sha256;
+
+	/* The MD5 context
+	 */
+	libhmac_md5_context_t *md5_context;
+
+	/* The SHA1 context
+	 */
+	libhmac_sha1_context_t *sha1_context;
+
+	/* The SHA256 context
+	 */
+	libhmac_sha256_context_t *sha256_context;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The queue of hash chunks available for reading
+	 */
+	libcthreads_queue_t *hash_chunks_queue;
+
+	/* The mutex that protects the number of pending digest hashes of the hash chunks
+	 */
+	libcthreads_mutex_t *hash_chunks_mutex;
+#endif
+
+	/* Value to indicate if hashing a chunk failed
+	 */
+	int hash_chunk_result;
+
 	/* The notification output stream
 	 */
 	FILE *notify_stream;
@@ -95,6 +170,16 @@ int info_handle_set_bodyfile(
      const system_character_t *filename,
      libcerror_error_t **error );
 
+int info_handle_set_hash_file(
+     info_handle_t *info_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int info_handle_set_digest_types(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
 int info_handle_set_volume_offset(
      info_handle_t *info_handle,
      const system_character_t *string,
@@ -207,6 +292,70 @@ int info_handle_bodyfile_index_root_attribute_fprint(
      size_t attribute_name_size,
      libcerror_error_t **error );
 
+int info_handle_hash_chunk_initialize(
+     info_handle_hash_chunk_t **hash_chunk,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int info_handle_hash_chunk_free(
+     info_handle_hash_chunk_t **hash_chunk,
+     libcerror_error_t **error );
+
+int info_handle_digest_hash_update(
+     info_handle_t *info_handle,
+     int digest_type,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int info_handle_hash_chunk_update(
+     info_handle_t *info_handle,
+     info_handle_hash_chunk_t *hash_chunk,
+     int digest_type,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int info_handle_hash_chunk_process(
+     info_handle_t *info_handle,
+     info_handle_hash_chunk_t *hash_chunk,
+     int digest_type );
+
+int info_handle_hash_chunk_md5_callback(
+     info_handle_hash_chunk_t *hash_chunk,
+     info_handle_t *info_handle );
+
+int info_handle_hash_chunk_sha1_callback(
+     info_handle_hash_chunk_t *hash_chunk,
+     info_handle_t *info_handle );
+
+int info_handle_hash_chunk_sha256_callback(
+     info_handle_hash_chunk_t *hash_chunk,
+     info_handle_t *info_handle );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int info_handle_calculate_digest_hashes(
+     info_handle_t *info_handle,
+     libfsntfs_file_entry_t *file_entry,
+     libfsntfs_data_stream_t *alternate_data_stream,
+     char *md5_string,
+     size_t md5_string_size,
+     char *sha1_string,
+     size_t sha1_string_size,
+     char *sha256_string,
+     size_t sha256_string_size,
+     libcerror_error_t **error );
+
+int info_handle_hash_file_digest_hashes_fprint(
+     info_handle_t *info_handle,
+     const system_character_t *path,
+     const system_character_t *file_entry_name,
+     const system_character_t *data_stream_name,
+     const char *sha1_string,
+     const char *sha256_string,
+     libcerror_error_t **error );
+
 int info_handle_bodyfile_file_entry_value_fprint(
      info_handle_t *info_handle,
      libfsntfs_file_entry_t *file_entry,
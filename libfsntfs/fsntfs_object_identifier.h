@@ -58,6 +58,34 @@ struct fsntfs_object_identifier
 	uint8_t birth_droid_domain_identifier[ 16 ];
 };
 
+typedef struct fsntfs_object_identifier_index_value fsntfs_object_identifier_index_value_t;
+
+struct fsntfs_object_identifier_index_value
+{
+	/* The file reference
+	 * Consists of 8 bytes
+	 */
+	uint8_t file_reference[ 8 ];
+
+	/* The birth droid volume identifier
+	 * Consists of 16 bytes
+	 * Contains a GUID
+	 */
+	uint8_t birth_droid_volume_identifier[ 16 ];
+
+	/* The birth droid file identifier
+	 * Consists of 16 bytes
+	 * Contains a GUID
+	 */
+	uint8_t birth_droid_file_identifier[ 16 ];
+
+	/* The birth droid domain identifier
+	 * Consists of 16 bytes
+	 * Contains a GUID
+	 */
+	uint8_t birth_droid_domain_identifier[ 16 ];
+};
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,89 @@
+/*
+ * The NTFS quota ($Quota) definition
+ *
+ * Copyright (C) 2010-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _FSNTFS_QUOTA_H )
+#define _FSNTFS_QUOTA_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct fsntfs_quota_owner_index_value fsntfs_quota_owner_index_value_t;
+
+struct fsntfs_quota_owner_index_value
+{
+	/* The owner identifier
+	 * Consists of 4 bytes
+	 */
+	uint8_t owner_identifier[ 4 ];
+};
+
+typedef struct fsntfs_quota_control_entry fsntfs_quota_control_entry_t;
+
+struct fsntfs_quota_control_entry
+{
+	/* The version
+	 * Consists of 4 bytes
+	 */
+	uint8_t version[ 4 ];
+
+	/* The flags
+	 * Consists of 4 bytes
+	 */
+	uint8_t flags[ 4 ];
+
+	/* The number of bytes used
+	 * Consists of 8 bytes
+	 */
+	uint8_t bytes_used[ 8 ];
+
+	/* The change time
+	 * Consists of 8 bytes
+	 * Contains a filetime
+	 */
+	uint8_t change_time[ 8 ];
+
+	/* The warning limit
+	 * Consists of 8 bytes
+	 */
+	uint8_t warning_limit[ 8 ];
+
+	/* The hard limit
+	 * Consists of 8 bytes
+	 */
+	uint8_t hard_limit[ 8 ];
+
+	/* The exceeded time
+	 * Consists of 8 bytes
+	 * Contains a filetime
+	 */
+	uint8_t exceeded_time[ 8 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _FSNTFS_QUOTA_H ) */
+
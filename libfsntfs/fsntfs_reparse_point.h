@@ -49,6 +49,21 @@ struct fsntfs_reparse_point
 	uint8_t padding1[ 2 ];
 };
 
+typedef struct fsntfs_reparse_point_index_key fsntfs_reparse_point_index_key_t;
+
+struct fsntfs_reparse_point_index_key
+{
+	/* The tag (type and flags)
+	 * Consists of 4 bytes
+	 */
+	uint8_t tag[ 4 ];
+
+	/* The file reference
+	 * Consists of 8 bytes
+	 */
+	uint8_t file_reference[ 8 ];
+};
+
 typedef struct fsntfs_mount_point_reparse_data fsntfs_mount_point_reparse_data_t;
 
 struct fsntfs_mount_point_reparse_data
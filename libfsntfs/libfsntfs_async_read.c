@@ -0,0 +1,265 @@
+/*
+ * Asynchronous read functions
+ *
+ * Copyright (C) 2010-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsntfs_async_read.h"
+#include "libfsntfs_file_entry.h"
+#include "libfsntfs_libcerror.h"
+#include "libfsntfs_libcnotify.h"
+#include "libfsntfs_types.h"
+#include "libfsntfs_unused.h"
+
+/* Creates an asynchronous read
+ * Make sure the value async_read is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_async_read_initialize(
+     libfsntfs_async_read_t **async_read,
+     libfsntfs_file_entry_t *file_entry,
+     void *buffer,
+     size_t buffer_size,
+     off64_t offset,
+     void (*callback_function)(
+            libfsntfs_file_entry_t *file_entry,
+            void *buffer,
+            ssize_t read_count,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_async_read_initialize";
+
+	if( async_read == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid asynchronous read.",
+		 function );
+
+		return( -1 );
+	}
+	if( *async_read != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid asynchronous read value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+	*async_read = memory_allocate_structure(
+	               libfsntfs_async_read_t );
+
+	if( *async_read == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create asynchronous read.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *async_read,
+	     0,
+	     sizeof( libfsntfs_async_read_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear asynchronous read.",
+		 function );
+
+		goto on_error;
+	}
+	( *async_read )->file_entry        = file_entry;
+	( *async_read )->buffer            = buffer;
+	( *async_read )->buffer_size       = buffer_size;
+	( *async_read )->offset            = offset;
+	( *async_read )->callback_function = callback_function;
+	( *async_read )->callback_data     = callback_data;
+
+	return( 1 );
+
+on_error:
+	if( *async_read != NULL )
+	{
+		memory_free(
+		 *async_read );
+
+		*async_read = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an asynchronous read
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_async_read_free(
+     libfsntfs_async_read_t **async_read,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_async_read_free";
+
+	if( async_read == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid asynchronous read.",
+		 function );
+
+		return( -1 );
+	}
+	if( *async_read != NULL )
+	{
+		/* The file entry, buffer and callback data are not managed by the asynchronous read
+		 */
+		memory_free(
+		 *async_read );
+
+		*async_read = NULL;
+	}
+	return( 1 );
+}
+
+/* Executes an asynchronous read
+ * Reads the data, passes the result to the callback function and frees the asynchronous read
+ * This function is used both on the calling thread and as the thread pool callback
+ * The callback function receives a read count of -1 if the data could not be read
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_async_read_execute(
+     libfsntfs_async_read_t *async_read,
+     void *arguments LIBFSNTFS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	ssize_t read_count       = 0;
+
+	LIBFSNTFS_UNREFERENCED_PARAMETER( arguments )
+
+	if( async_read == NULL )
+	{
+		return( -1 );
+	}
+	read_count = libfsntfs_file_entry_read_buffer_at_offset(
+	              async_read->file_entry,
+	              async_read->buffer,
+	              async_read->buffer_size,
+	              async_read->offset,
+	              &error );
+
+	if( read_count == -1 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+	}
+	async_read->callback_function(
+	 async_read->file_entry,
+	 async_read->buffer,
+	 read_count,
+	 async_read->callback_data );
+
+	if( libfsntfs_async_read_free(
+	     &async_read,
+	     &error ) != 1 )
+	{
+		libcerror_error_free(
+		 &error );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,97 @@
+/*
+ * Asynchronous read functions
+ *
+ * Copyright (C) 2010-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSNTFS_ASYNC_READ_H )
+#define _LIBFSNTFS_ASYNC_READ_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsntfs_libcerror.h"
+#include "libfsntfs_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsntfs_async_read libfsntfs_async_read_t;
+
+/* A read of the default data stream of a file entry that is completed by a callback function
+ */
+struct libfsntfs_async_read
+{
+	/* The file entry
+	 */
+	libfsntfs_file_entry_t *file_entry;
+
+	/* The buffer
+	 */
+	void *buffer;
+
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The offset
+	 */
+	off64_t offset;
+
+	/* The callback function
+	 */
+	void (*callback_function)(
+	       libfsntfs_file_entry_t *file_entry,
+	       void *buffer,
+	       ssize_t read_count,
+	       void *callback_data );
+
+	/* The callback data
+	 */
+	void *callback_data;
+};
+
+int libfsntfs_async_read_initialize(
+     libfsntfs_async_read_t **async_read,
+     libfsntfs_file_entry_t *file_entry,
+     void *buffer,
+     size_t buffer_size,
+     off64_t offset,
+     void (*callback_function)(
+            libfsntfs_file_entry_t *file_entry,
+            void *buffer,
+            ssize_t read_count,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libfsntfs_async_read_free(
+     libfsntfs_async_read_t **async_read,
+     libcerror_error_t **error );
+
+int libfsntfs_async_read_execute(
+     libfsntfs_async_read_t *async_read,
+     void *arguments );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSNTFS_ASYNC_READ_H ) */
+
@@ -0,0 +1,1459 @@
+/*
+ * Bulk read functions
+ *
+ * Copyright (C) 2010-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libfsntfs_bulk_read.h"
+#include "libfsntfs_data_extent.h"
+#include "libfsntfs_definitions.h"
+#include "libfsntfs_file_entry.h"
+#include "libfsntfs_io_handle.h"
+#include "libfsntfs_libbfio.h"
+#include "libfsntfs_libcdata.h"
+#include "libfsntfs_libcerror.h"
+#include "libfsntfs_libcnotify.h"
+#include "libfsntfs_mft_attribute.h"
+#include "libfsntfs_mft_entry.h"
+#include "libfsntfs_read_queue.h"
+#include "libfsntfs_read_thread_pool.h"
+
+/* Creates a bulk read
+ * The end of file callback function is optional
+ * Make sure the value bulk_read is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_bulk_read_initialize(
+     libfsntfs_bulk_read_t **bulk_read,
+     libfsntfs_io_handle_t *io_handle,
+     int (*callback_function)(
+            uint64_t mft_entry_index,
+            off64_t data_offset,
+            const uint8_t *data,
+            size_t data_size,
+            void *callback_data ),
+     int (*end_of_file_callback_function)(
+            uint64_t mft_entry_index,
+            size64_t data_size,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_bulk_read_initialize";
+
+	if( bulk_read == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bulk read.",
+		 function );
+
+		return( -1 );
+	}
+	if( *bulk_read != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid bulk read value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+	*bulk_read = memory_allocate_structure(
+	              libfsntfs_bulk_read_t );
+
+	if( *bulk_read == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create bulk read.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *bulk_read,
+	     0,
+	     sizeof( libfsntfs_bulk_read_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear bulk read.",
+		 function );
+
+		memory_free(
+		 *bulk_read );
+
+		*bulk_read = NULL;
+
+		return( -1 );
+	}
+	( *bulk_read )->buffer = (uint8_t *) memory_allocate(
+	                                      sizeof( uint8_t ) * LIBFSNTFS_BULK_READ_BUFFER_SIZE );
+
+	if( ( *bulk_read )->buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsntfs_read_queue_initialize(
+	     &( ( *bulk_read )->read_queue ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read queue.",
+		 function );
+
+		goto on_error;
+	}
+	( *bulk_read )->io_handle                     = io_handle;
+	( *bulk_read )->buffer_size                   = LIBFSNTFS_BULK_READ_BUFFER_SIZE;
+	( *bulk_read )->callback_function             = callback_function;
+	( *bulk_read )->end_of_file_callback_function = end_of_file_callback_function;
+	( *bulk_read )->callback_data                 = callback_data;
+
+	return( 1 );
+
+on_error:
+	if( *bulk_read != NULL )
+	{
+		if( ( *bulk_read )->buffer != NULL )
+		{
+			memory_free(
+			 ( *bulk_read )->buffer );
+		}
+		memory_free(
+		 *bulk_read );
+
+		*bulk_read = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a bulk read
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_bulk_read_free(
+     libfsntfs_bulk_read_t **bulk_read,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_bulk_read_free";
+	int result            = 1;
+
+	if( bulk_read == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bulk read.",
+		 function );
+
+		return( -1 );
+	}
+	if( *bulk_read != NULL )
+	{
+		/* The io_handle reference is freed elsewhere
+		 */
+		if( libfsntfs_read_queue_free(
+		     &( ( *bulk_read )->read_queue ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read queue.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *bulk_read )->files != NULL )
+		{
+			memory_free(
+			 ( *bulk_read )->files );
+		}
+		if( ( *bulk_read )->ranges != NULL )
+		{
+			memory_free(
+			 ( *bulk_read )->ranges );
+		}
+		memory_free(
+		 ( *bulk_read )->buffer );
+
+		memory_free(
+		 *bulk_read );
+
+		*bulk_read = NULL;
+	}
+	return( result );
+}
+
+/* Passes the end of a data stream to the end of file callback function, if set
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_bulk_read_end_of_file(
+     libfsntfs_bulk_read_t *bulk_read,
+     uint64_t mft_entry_index,
+     size64_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_bulk_read_end_of_file";
+
+	if( bulk_read == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bulk read.",
+		 function );
+
+		return( -1 );
+	}
+	if( bulk_read->end_of_file_callback_function == NULL )
+	{
+		return( 1 );
+	}
+	if( bulk_read->end_of_file_callback_function(
+	     mft_entry_index,
+	     data_size,
+	     bulk_read->callback_data ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+		 "%s: end of file callback function failed for MFT entry: %" PRIu64 ".",
+		 function,
+		 mft_entry_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a range of a data stream
+ * A volume offset of -1 indicates the range is filled with 0-byte values
+ * The ranges of a data stream must be appended consecutively, they are
+ * tracked as one file that ends when the data of all its ranges was passed
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_bulk_read_append_range(
+     libfsntfs_bulk_read_t *bulk_read,
+     uint64_t mft_entry_index,
+     off64_t data_offset,
+     off64_t volume_offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	libfsntfs_bulk_read_file_t *file    = NULL;
+	libfsntfs_bulk_read_file_t *files   = NULL;
+	libfsntfs_bulk_read_range_t *range  = NULL;
+	libfsntfs_bulk_read_range_t *ranges = NULL;
+	static char *function               = "libfsntfs_bulk_read_append_range";
+	size_t files_size                   = 0;
+	size_t ranges_size                  = 0;
+	int maximum_number_of_files         = 0;
+	int maximum_number_of_ranges        = 0;
+
+	if( bulk_read == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bulk read.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_offset < -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid volume offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > (size64_t) INT64_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( bulk_read->number_of_ranges >= bulk_read->maximum_number_of_ranges )
+	{
+		if( bulk_read->maximum_number_of_ranges > ( INT_MAX - 256 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid bulk read - maximum number of ranges value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		maximum_number_of_ranges = bulk_read->maximum_number_of_ranges + 256;
+
+		ranges_size = sizeof( libfsntfs_bulk_read_range_t ) * maximum_number_of_ranges;
+
+		if( ranges_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid ranges size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		ranges = (libfsntfs_bulk_read_range_t *) memory_reallocate(
+		                                          bulk_read->ranges,
+		                                          ranges_size );
+
+		if( ranges == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize ranges.",
+			 function );
+
+			return( -1 );
+		}
+		bulk_read->ranges                   = ranges;
+		bulk_read->maximum_number_of_ranges = maximum_number_of_ranges;
+	}
+	if( bulk_read->number_of_files > 0 )
+	{
+		file = &( bulk_read->files[ bulk_read->number_of_files - 1 ] );
+
+		if( file->mft_entry_index != mft_entry_index )
+		{
+			file = NULL;
+		}
+	}
+	if( file == NULL )
+	{
+		if( bulk_read->number_of_files >= bulk_read->maximum_number_of_files )
+		{
+			if( bulk_read->maximum_number_of_files > ( INT_MAX - 256 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid bulk read - maximum number of files value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			maximum_number_of_files = bulk_read->maximum_number_of_files + 256;
+
+			files_size = sizeof( libfsntfs_bulk_read_file_t ) * maximum_number_of_files;
+
+			if( files_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid files size value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			files = (libfsntfs_bulk_read_file_t *) memory_reallocate(
+			                                        bulk_read->files,
+			                                        files_size );
+
+			if( files == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize files.",
+				 function );
+
+				return( -1 );
+			}
+			bulk_read->files                   = files;
+			bulk_read->maximum_number_of_files = maximum_number_of_files;
+		}
+		file = &( bulk_read->files[ bulk_read->number_of_files ] );
+
+		file->mft_entry_index = mft_entry_index;
+		file->data_size       = 0;
+		file->remaining_size  = 0;
+
+		bulk_read->number_of_files += 1;
+	}
+	file->data_size      += size;
+	file->remaining_size += size;
+
+	range = &( bulk_read->ranges[ bulk_read->number_of_ranges ] );
+
+	range->mft_entry_index = mft_entry_index;
+	range->data_offset     = data_offset;
+	range->volume_offset   = volume_offset;
+	range->size            = size;
+	range->file_index      = bulk_read->number_of_files - 1;
+
+	bulk_read->number_of_ranges += 1;
+
+	return( 1 );
+}
+
+/* Appends the ranges of the default data stream (nameless $DATA attribute) of a MFT entry
+ * Resident data is passed to the callback function directly, as is the end of
+ * a data stream without non-resident data
+ * Returns 1 if successful, 0 if the data stream cannot be read by its extents or -1 on error
+ */
+int libfsntfs_bulk_read_append_mft_entry(
+     libfsntfs_bulk_read_t *bulk_read,
+     uint64_t mft_entry_index,
+     libfsntfs_mft_entry_t *mft_entry,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *extents_array      = NULL;
+	libfsntfs_data_extent_t *data_extent = NULL;
+	uint8_t *resident_data               = NULL;
+	static char *function                = "libfsntfs_bulk_read_append_mft_entry";
+	size64_t data_size                   = 0;
+	size64_t extent_size                 = 0;
+	size64_t valid_data_size             = 0;
+	size_t resident_data_size            = 0;
+	off64_t data_offset                  = 0;
+	off64_t extent_offset                = 0;
+	uint32_t extent_flags                = 0;
+	uint16_t data_flags                  = 0;
+	int extent_index                     = 0;
+	int number_of_extents                = 0;
+
+	if( bulk_read == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bulk read.",
+		 function );
+
+		return( -1 );
+	}
+	if( bulk_read->callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid bulk read - missing callback function.",
+		 function );
+
+		return( -1 );
+	}
+	if( mft_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MFT entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( mft_entry->data_attribute == NULL )
+	{
+		if( libfsntfs_bulk_read_end_of_file(
+		     bulk_read,
+		     mft_entry_index,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to pass end of file of MFT entry: %" PRIu64 ".",
+			 function,
+			 mft_entry_index );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
+	/* The data of a WOF compressed data stream is stored in the WofCompressedData
+	 * alternate data stream and needs to be decompressed
+	 */
+	if( mft_entry->wof_compressed_data_attribute != NULL )
+	{
+		return( 0 );
+	}
+	if( libfsntfs_mft_attribute_get_data_flags(
+	     mft_entry->data_attribute,
+	     &data_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data flags.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( data_flags & LIBFSNTFS_ATTRIBUTE_FLAG_COMPRESSION_MASK ) != 0 )
+	{
+		return( 0 );
+	}
+	if( libfsntfs_mft_attribute_get_data_size(
+	     mft_entry->data_attribute,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data size.",
+		 function );
+
+		goto on_error;
+	}
+	if( data_size == 0 )
+	{
+		if( libfsntfs_bulk_read_end_of_file(
+		     bulk_read,
+		     mft_entry_index,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to pass end of file of MFT entry: %" PRIu64 ".",
+			 function,
+			 mft_entry_index );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
+	if( libfsntfs_mft_attribute_get_data(
+	     mft_entry->data_attribute,
+	     &resident_data,
+	     &resident_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve resident data.",
+		 function );
+
+		goto on_error;
+	}
+	if( resident_data != NULL )
+	{
+		if( data_size != (size64_t) resident_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: unsupported resident data size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( bulk_read->callback_function(
+		     mft_entry_index,
+		     0,
+		     resident_data,
+		     resident_data_size,
+		     bulk_read->callback_data ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: callback function failed for MFT entry: %" PRIu64 ".",
+			 function,
+			 mft_entry_index );
+
+			goto on_error;
+		}
+		if( libfsntfs_bulk_read_end_of_file(
+		     bulk_read,
+		     mft_entry_index,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to pass end of file of MFT entry: %" PRIu64 ".",
+			 function,
+			 mft_entry_index );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
+	if( libfsntfs_mft_attribute_get_valid_data_size(
+	     mft_entry->data_attribute,
+	     &valid_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve valid data size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( valid_data_size == 0 )
+	 || ( valid_data_size > data_size ) )
+	{
+		valid_data_size = data_size;
+	}
+	if( libfsntfs_mft_attribute_get_data_extents_array(
+	     mft_entry->data_attribute,
+	     bulk_read->io_handle,
+	     &extents_array,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create extents array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_get_number_of_entries(
+	     extents_array,
+	     &number_of_extents,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of extents.",
+		 function );
+
+		goto on_error;
+	}
+	for( extent_index = 0;
+	     extent_index < number_of_extents;
+	     extent_index++ )
+	{
+		if( (size64_t) data_offset >= data_size )
+		{
+			break;
+		}
+		if( libcdata_array_get_entry_by_index(
+		     extents_array,
+		     extent_index,
+		     (intptr_t **) &data_extent,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent: %d.",
+			 function,
+			 extent_index );
+
+			goto on_error;
+		}
+		if( libfsntfs_data_extent_get_values(
+		     data_extent,
+		     &extent_offset,
+		     &extent_size,
+		     &extent_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent: %d values.",
+			 function,
+			 extent_index );
+
+			goto on_error;
+		}
+		if( extent_size > ( data_size - (size64_t) data_offset ) )
+		{
+			extent_size = data_size - (size64_t) data_offset;
+		}
+		if( ( extent_flags & LIBFSNTFS_EXTENT_FLAG_IS_SPARSE ) != 0 )
+		{
+			extent_offset = -1;
+		}
+		/* The part of the extent beyond the valid data size is read as 0-byte values
+		 */
+		else if( ( (size64_t) data_offset + extent_size ) > valid_data_size )
+		{
+			if( (size64_t) data_offset < valid_data_size )
+			{
+				if( libfsntfs_bulk_read_append_range(
+				     bulk_read,
+				     mft_entry_index,
+				     data_offset,
+				     extent_offset,
+				     valid_data_size - (size64_t) data_offset,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append range of extent: %d.",
+					 function,
+					 extent_index );
+
+					goto on_error;
+				}
+				extent_size -= valid_data_size - (size64_t) data_offset;
+				data_offset  = (off64_t) valid_data_size;
+			}
+			extent_offset = -1;
+		}
+		if( extent_size > 0 )
+		{
+			if( libfsntfs_bulk_read_append_range(
+			     bulk_read,
+			     mft_entry_index,
+			     data_offset,
+			     extent_offset,
+			     extent_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append range of extent: %d.",
+				 function,
+				 extent_index );
+
+				goto on_error;
+			}
+		}
+		data_offset += (off64_t) extent_size;
+	}
+	/* Data that is not covered by the extents is read as 0-byte values
+	 */
+	if( (size64_t) data_offset < data_size )
+	{
+		if( libfsntfs_bulk_read_append_range(
+		     bulk_read,
+		     mft_entry_index,
+		     data_offset,
+		     -1,
+		     data_size - (size64_t) data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append range beyond extents.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcdata_array_free(
+	     &extents_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsntfs_data_extent_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free extents array.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( extents_array != NULL )
+	{
+		libcdata_array_free(
+		 &extents_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsntfs_data_extent_free,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Compares two ranges by their volume offset
+ * Ranges that are filled with 0-byte values are sorted first
+ * Returns -1 if the first range is less than the second, 0 if equal or 1 if greater
+ */
+int libfsntfs_bulk_read_range_compare(
+     const void *first_range,
+     const void *second_range )
+{
+	const libfsntfs_bulk_read_range_t *first  = (const libfsntfs_bulk_read_range_t *) first_range;
+	const libfsntfs_bulk_read_range_t *second = (const libfsntfs_bulk_read_range_t *) second_range;
+
+	if( first->volume_offset < second->volume_offset )
+	{
+		return( -1 );
+	}
+	else if( first->volume_offset > second->volume_offset )
+	{
+		return( 1 );
+	}
+	if( first->mft_entry_index < second->mft_entry_index )
+	{
+		return( -1 );
+	}
+	else if( first->mft_entry_index > second->mft_entry_index )
+	{
+		return( 1 );
+	}
+	if( first->data_offset < second->data_offset )
+	{
+		return( -1 );
+	}
+	else if( first->data_offset > second->data_offset )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Passes the data of the ranges that was read into the buffer to the callback function
+ * The end of file callback function is called after the last data of a file was passed
+ * The range index and offset are updated to the first range that was not passed
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_bulk_read_pass_buffer(
+     libfsntfs_bulk_read_t *bulk_read,
+     size_t buffer_size,
+     int *range_index,
+     size64_t *range_offset,
+     libcerror_error_t **error )
+{
+	libfsntfs_bulk_read_file_t *file   = NULL;
+	libfsntfs_bulk_read_range_t *range = NULL;
+	static char *function              = "libfsntfs_bulk_read_pass_buffer";
+	size_t buffer_offset               = 0;
+	size_t data_size                   = 0;
+
+	if( bulk_read == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bulk read.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > bulk_read->buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range index.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range offset.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_offset < buffer_size )
+	{
+		if( ( *range_index < 0 )
+		 || ( *range_index >= bulk_read->number_of_ranges ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid range index value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		range = &( bulk_read->ranges[ *range_index ] );
+
+		if( ( range->file_index < 0 )
+		 || ( range->file_index >= bulk_read->number_of_files ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid range: %d - file index value out of bounds.",
+			 function,
+			 *range_index );
+
+			return( -1 );
+		}
+		file = &( bulk_read->files[ range->file_index ] );
+
+		data_size = buffer_size - buffer_offset;
+
+		if( (size64_t) data_size > ( range->size - *range_offset ) )
+		{
+			data_size = (size_t) ( range->size - *range_offset );
+		}
+		if( bulk_read->callback_function(
+		     range->mft_entry_index,
+		     range->data_offset + (off64_t) *range_offset,
+		     &( bulk_read->buffer[ buffer_offset ] ),
+		     data_size,
+		     bulk_read->callback_data ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: callback function failed for MFT entry: %" PRIu64 ".",
+			 function,
+			 range->mft_entry_index );
+
+			return( -1 );
+		}
+		buffer_offset += data_size;
+		*range_offset += data_size;
+
+		if( (size64_t) data_size > file->remaining_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid file: %d - remaining size value out of bounds.",
+			 function,
+			 range->file_index );
+
+			return( -1 );
+		}
+		file->remaining_size -= data_size;
+
+		if( file->remaining_size == 0 )
+		{
+			if( libfsntfs_bulk_read_end_of_file(
+			     bulk_read,
+			     file->mft_entry_index,
+			     file->data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to pass end of file of MFT entry: %" PRIu64 ".",
+				 function,
+				 file->mft_entry_index );
+
+				return( -1 );
+			}
+		}
+
+		if( *range_offset >= range->size )
+		{
+			*range_index += 1;
+			*range_offset = 0;
+		}
+	}
+	return( 1 );
+}
+
+/* Reads the ranges in the order of their volume offset
+ * Physically contiguous ranges are combined into reads of up to
+ * LIBFSNTFS_BULK_READ_MAXIMUM_REQUEST_SIZE bytes that are kept in flight
+ * together by the read queue, for every LIBFSNTFS_BULK_READ_BUFFER_SIZE bytes
+ * The data is passed to the callback function in the same order, hence the data
+ * of a fragmented or sparse file can be passed out of order. The end of file
+ * callback function is called once the data of all ranges of a file was passed
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_bulk_read_read(
+     libfsntfs_bulk_read_t *bulk_read,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libfsntfs_bulk_read_range_t *range = NULL;
+	uint8_t *request_data              = NULL;
+	static char *function              = "libfsntfs_bulk_read_read";
+	size64_t pass_range_offset         = 0;
+	size64_t range_offset              = 0;
+	size_t buffer_offset               = 0;
+	size_t read_size                   = 0;
+	size_t request_size                = 0;
+	off64_t request_offset             = 0;
+	off64_t volume_offset              = 0;
+	int pass_range_index               = 0;
+	int range_index                    = 0;
+	int result                         = 0;
+
+	if( bulk_read == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bulk read.",
+		 function );
+
+		return( -1 );
+	}
+	if( bulk_read->number_of_ranges == 0 )
+	{
+		return( 1 );
+	}
+	qsort(
+	 bulk_read->ranges,
+	 (size_t) bulk_read->number_of_ranges,
+	 sizeof( libfsntfs_bulk_read_range_t ),
+	 &libfsntfs_bulk_read_range_compare );
+
+	/* The ranges that are filled with 0-byte values are sorted first
+	 * and do not require reading
+	 */
+	while( range_index < bulk_read->number_of_ranges )
+	{
+		range = &( bulk_read->ranges[ range_index ] );
+
+		if( range->volume_offset >= 0 )
+		{
+			break;
+		}
+		if( buffer_offset == 0 )
+		{
+			if( memory_set(
+			     bulk_read->buffer,
+			     0,
+			     bulk_read->buffer_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear buffer.",
+				 function );
+
+				return( -1 );
+			}
+			buffer_offset = bulk_read->buffer_size;
+		}
+		read_size = bulk_read->buffer_size;
+
+		if( (size64_t) read_size > ( range->size - range_offset ) )
+		{
+			read_size = (size_t) ( range->size - range_offset );
+		}
+		if( libfsntfs_bulk_read_pass_buffer(
+		     bulk_read,
+		     read_size,
+		     &range_index,
+		     &range_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to pass 0-byte values of range: %d.",
+			 function,
+			 range_index );
+
+			return( -1 );
+		}
+	}
+	buffer_offset     = 0;
+	pass_range_index  = range_index;
+	pass_range_offset = range_offset;
+
+	while( range_index < bulk_read->number_of_ranges )
+	{
+		range = &( bulk_read->ranges[ range_index ] );
+
+		read_size = bulk_read->buffer_size - buffer_offset;
+
+		if( (size64_t) read_size > ( range->size - range_offset ) )
+		{
+			read_size = (size_t) ( range->size - range_offset );
+		}
+		volume_offset = range->volume_offset + (off64_t) range_offset;
+
+		/* Extend the current request if the range continues where it ends
+		 */
+		if( ( request_size > 0 )
+		 && ( volume_offset == ( request_offset + (off64_t) request_size ) )
+		 && ( request_size < LIBFSNTFS_BULK_READ_MAXIMUM_REQUEST_SIZE ) )
+		{
+			if( read_size > ( LIBFSNTFS_BULK_READ_MAXIMUM_REQUEST_SIZE - request_size ) )
+			{
+				read_size = LIBFSNTFS_BULK_READ_MAXIMUM_REQUEST_SIZE - request_size;
+			}
+			request_size += read_size;
+		}
+		else
+		{
+			if( request_size > 0 )
+			{
+				if( libfsntfs_read_queue_append_request(
+				     bulk_read->read_queue,
+				     request_offset,
+				     request_data,
+				     request_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append read request at offset: %" PRIi64 ".",
+					 function,
+					 request_offset );
+
+					goto on_error;
+				}
+			}
+			if( read_size > LIBFSNTFS_BULK_READ_MAXIMUM_REQUEST_SIZE )
+			{
+				read_size = LIBFSNTFS_BULK_READ_MAXIMUM_REQUEST_SIZE;
+			}
+			request_offset = volume_offset;
+			request_data   = &( bulk_read->buffer[ buffer_offset ] );
+			request_size   = read_size;
+		}
+		buffer_offset += read_size;
+		range_offset  += read_size;
+
+		if( range_offset >= range->size )
+		{
+			range_index += 1;
+			range_offset = 0;
+		}
+		if( ( buffer_offset < bulk_read->buffer_size )
+		 && ( range_index < bulk_read->number_of_ranges ) )
+		{
+			continue;
+		}
+		if( libfsntfs_read_queue_append_request(
+		     bulk_read->read_queue,
+		     request_offset,
+		     request_data,
+		     request_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append read request at offset: %" PRIi64 ".",
+			 function,
+			 request_offset );
+
+			goto on_error;
+		}
+		request_size = 0;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+		if( bulk_read->io_handle->read_thread_pool != NULL )
+		{
+			result = libfsntfs_read_thread_pool_read(
+			          bulk_read->io_handle->read_thread_pool,
+			          bulk_read->read_queue,
+			          error );
+		}
+		else
+#endif
+		{
+			result = libfsntfs_read_queue_read(
+			          bulk_read->read_queue,
+			          file_io_handle,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsntfs_read_queue_empty(
+		     bulk_read->read_queue,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to empty read queue.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsntfs_bulk_read_pass_buffer(
+		     bulk_read,
+		     buffer_offset,
+		     &pass_range_index,
+		     &pass_range_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to pass data of range: %d.",
+			 function,
+			 pass_range_index );
+
+			return( -1 );
+		}
+		buffer_offset = 0;
+	}
+	return( 1 );
+
+on_error:
+	libfsntfs_read_queue_empty(
+	 bulk_read->read_queue,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Reads the default data stream (nameless $DATA attribute) of a file entry in order
+ * This function is used for data streams that cannot be read by their extents
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_bulk_read_read_file_entry(
+     libfsntfs_bulk_read_t *bulk_read,
+     uint64_t mft_entry_index,
+     libfsntfs_file_entry_t *file_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_bulk_read_read_file_entry";
+	size64_t data_size    = 0;
+	ssize_t read_count    = 0;
+	off64_t data_offset   = 0;
+	size_t read_size      = 0;
+
+	if( bulk_read == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bulk read.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsntfs_file_entry_get_size(
+	     file_entry,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size.",
+		 function );
+
+		return( -1 );
+	}
+	while( (size64_t) data_offset < data_size )
+	{
+		read_size = bulk_read->buffer_size;
+
+		if( (size64_t) read_size > ( data_size - (size64_t) data_offset ) )
+		{
+			read_size = (size_t) ( data_size - (size64_t) data_offset );
+		}
+		read_count = libfsntfs_file_entry_read_buffer_at_offset(
+		              file_entry,
+		              bulk_read->buffer,
+		              read_size,
+		              data_offset,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data at offset: %" PRIi64 ".",
+			 function,
+			 data_offset );
+
+			return( -1 );
+		}
+		if( bulk_read->callback_function(
+		     mft_entry_index,
+		     data_offset,
+		     bulk_read->buffer,
+		     read_size,
+		     bulk_read->callback_data ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: callback function failed for MFT entry: %" PRIu64 ".",
+			 function,
+			 mft_entry_index );
+
+			return( -1 );
+		}
+		data_offset += (off64_t) read_size;
+	}
+	if( libfsntfs_bulk_read_end_of_file(
+	     bulk_read,
+	     mft_entry_index,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to pass end of file of MFT entry: %" PRIu64 ".",
+		 function,
+		 mft_entry_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
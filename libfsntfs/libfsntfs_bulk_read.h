@@ -0,0 +1,220 @@
+/*
+ * Bulk read functions
+ *
+ * Copyright (C) 2010-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSNTFS_BULK_READ_H )
+#define _LIBFSNTFS_BULK_READ_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsntfs_io_handle.h"
+#include "libfsntfs_libbfio.h"
+#include "libfsntfs_libcerror.h"
+#include "libfsntfs_mft_entry.h"
+#include "libfsntfs_read_queue.h"
+#include "libfsntfs_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsntfs_bulk_read_range libfsntfs_bulk_read_range_t;
+
+/* A range of the default data stream of a file entry
+ */
+struct libfsntfs_bulk_read_range
+{
+	/* The MFT entry index
+	 */
+	uint64_t mft_entry_index;
+
+	/* The offset of the range in the data stream
+	 */
+	off64_t data_offset;
+
+	/* The offset of the range in the volume or -1 if the range is filled with 0-byte values
+	 */
+	off64_t volume_offset;
+
+	/* The size
+	 */
+	size64_t size;
+
+	/* The index of the file in the files array
+	 */
+	int file_index;
+};
+
+typedef struct libfsntfs_bulk_read_file libfsntfs_bulk_read_file_t;
+
+/* The default data stream of a file entry of which ranges are read
+ */
+struct libfsntfs_bulk_read_file
+{
+	/* The MFT entry index
+	 */
+	uint64_t mft_entry_index;
+
+	/* The data size
+	 */
+	size64_t data_size;
+
+	/* The size of the data that has not been passed to the callback function
+	 */
+	size64_t remaining_size;
+};
+
+typedef struct libfsntfs_bulk_read libfsntfs_bulk_read_t;
+
+/* A read of the default data streams of multiple file entries in the order
+ * in which their data is stored in the volume
+ */
+struct libfsntfs_bulk_read
+{
+	/* The IO handle
+	 */
+	libfsntfs_io_handle_t *io_handle;
+
+	/* The ranges
+	 */
+	libfsntfs_bulk_read_range_t *ranges;
+
+	/* The number of ranges
+	 */
+	int number_of_ranges;
+
+	/* The maximum number of ranges
+	 */
+	int maximum_number_of_ranges;
+
+	/* The files
+	 */
+	libfsntfs_bulk_read_file_t *files;
+
+	/* The number of files
+	 */
+	int number_of_files;
+
+	/* The maximum number of files
+	 */
+	int maximum_number_of_files;
+
+	/* The buffer
+	 */
+	uint8_t *buffer;
+
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The read queue
+	 */
+	libfsntfs_read_queue_t *read_queue;
+
+	/* The callback function
+	 */
+	int (*callback_function)(
+	       uint64_t mft_entry_index,
+	       off64_t data_offset,
+	       const uint8_t *data,
+	       size_t data_size,
+	       void *callback_data );
+
+	/* The end of file callback function
+	 */
+	int (*end_of_file_callback_function)(
+	       uint64_t mft_entry_index,
+	       size64_t data_size,
+	       void *callback_data );
+
+	/* The callback data
+	 */
+	void *callback_data;
+};
+
+int libfsntfs_bulk_read_initialize(
+     libfsntfs_bulk_read_t **bulk_read,
+     libfsntfs_io_handle_t *io_handle,
+     int (*callback_function)(
+            uint64_t mft_entry_index,
+            off64_t data_offset,
+            const uint8_t *data,
+            size_t data_size,
+            void *callback_data ),
+     int (*end_of_file_callback_function)(
+            uint64_t mft_entry_index,
+            size64_t data_size,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libfsntfs_bulk_read_free(
+     libfsntfs_bulk_read_t **bulk_read,
+     libcerror_error_t **error );
+
+int libfsntfs_bulk_read_end_of_file(
+     libfsntfs_bulk_read_t *bulk_read,
+     uint64_t mft_entry_index,
+     size64_t data_size,
+     libcerror_error_t **error );
+
+int libfsntfs_bulk_read_append_range(
+     libfsntfs_bulk_read_t *bulk_read,
+     uint64_t mft_entry_index,
+     off64_t data_offset,
+     off64_t volume_offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+int libfsntfs_bulk_read_append_mft_entry(
+     libfsntfs_bulk_read_t *bulk_read,
+     uint64_t mft_entry_index,
+     libfsntfs_mft_entry_t *mft_entry,
+     libcerror_error_t **error );
+
+int libfsntfs_bulk_read_range_compare(
+     const void *first_range,
+     const void *second_range );
+
+int libfsntfs_bulk_read_pass_buffer(
+     libfsntfs_bulk_read_t *bulk_read,
+     size_t buffer_size,
+     int *range_index,
+     size64_t *range_offset,
+     libcerror_error_t **error );
+
+int libfsntfs_bulk_read_read(
+     libfsntfs_bulk_read_t *bulk_read,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libfsntfs_bulk_read_read_file_entry(
+     libfsntfs_bulk_read_t *bulk_read,
+     uint64_t mft_entry_index,
+     libfsntfs_file_entry_t *file_entry,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSNTFS_BULK_READ_H ) */
+
@@ -24,12 +24,13 @@
 #include <types.h>
 
 #include "libfsntfs_buffer_data_handle.h"
-#include "libfsntfs_cluster_block_data.h"
 #include "libfsntfs_cluster_block_stream.h"
 #include "libfsntfs_compressed_block_data_handle.h"
 #include "libfsntfs_compressed_data_handle.h"
 #include "libfsntfs_definitions.h"
+#include "libfsntfs_extent_data_handle.h"
 #include "libfsntfs_io_handle.h"
+#include "libfsntfs_libbfio.h"
 #include "libfsntfs_libcerror.h"
 #include "libfsntfs_libfcache.h"
 #include "libfsntfs_libfdata.h"
@@ -139,6 +140,8 @@ on_error:
 }
 
 /* Creates cluster block stream from data runs
+ * The data runs are mapped by a single segment of which the extent data handle
+ * looks up the extents using the offsets of the extents
  * Make sure the value data_stream is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
  */
@@ -149,20 +152,12 @@ int libfsntfs_cluster_block_stream_initialize_from_data_runs(
      size64_t data_size,
      libcerror_error_t **error )
 {
-	libfdata_stream_t *safe_data_stream          = NULL;
-	libfsntfs_data_run_t *data_run               = NULL;
-	static char *function                        = "libfsntfs_cluster_block_stream_initialize_from_data_runs";
-	size64_t attribute_data_vcn_size             = 0;
-	size64_t data_segment_size                   = 0;
-	size64_t valid_data_size                     = 0;
-	off64_t attribute_data_vcn_offset            = 0;
-	off64_t calculated_attribute_data_vcn_offset = 0;
-	off64_t data_segment_offset                  = 0;
-	uint16_t attribute_data_flags                = 0;
-	int attribute_index                          = 0;
-	int data_run_index                           = 0;
-	int number_of_data_runs                      = 0;
-	int segment_index                            = 0;
+	libfdata_stream_t *safe_data_stream         = NULL;
+	libfsntfs_extent_data_handle_t *data_handle = NULL;
+	static char *function                       = "libfsntfs_cluster_block_stream_initialize_from_data_runs";
+	size64_t mapped_size                        = 0;
+	uint16_t attribute_data_flags               = 0;
+	int segment_index                           = 0;
 
 	if( cluster_block_stream == NULL )
 	{
@@ -197,55 +192,72 @@ int libfsntfs_cluster_block_stream_initialize_from_data_runs(
 
 		return( -1 );
 	}
-	if( libfsntfs_mft_attribute_get_valid_data_size(
+	if( libfsntfs_mft_attribute_get_data_flags(
 	     data_attribute,
-	     &valid_data_size,
+	     &attribute_data_flags,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve valid data size",
+		 "%s: unable to retrieve attribute data flags.",
 		 function );
 
 		goto on_error;
 	}
-	if( libfsntfs_mft_attribute_get_data_flags(
-	     data_attribute,
-	     &attribute_data_flags,
+	if( ( attribute_data_flags & LIBFSNTFS_ATTRIBUTE_FLAG_COMPRESSION_MASK ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compressed attribute data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsntfs_extent_data_handle_initialize(
+	     &data_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve attribute data flags.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data handle.",
 		 function );
 
 		goto on_error;
 	}
-	if( ( attribute_data_flags & LIBFSNTFS_ATTRIBUTE_FLAG_COMPRESSION_MASK ) != 0 )
+	if( libfsntfs_extent_data_handle_append_data_runs(
+	     data_handle,
+	     io_handle,
+	     data_attribute,
+	     data_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported compressed attribute data.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append data runs to data handle.",
 		 function );
 
 		goto on_error;
 	}
+	mapped_size = data_handle->data_size;
+
 	if( libfdata_stream_initialize(
 	     &safe_data_stream,
+	     (intptr_t *) data_handle,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsntfs_extent_data_handle_free,
 	     NULL,
 	     NULL,
+	     (ssize_t (*)(intptr_t *, intptr_t *, int, int, uint8_t *, size_t, uint32_t, uint8_t, libcerror_error_t **)) &libfsntfs_extent_data_handle_read_segment_data,
 	     NULL,
-	     NULL,
-	     (ssize_t (*)(intptr_t *, intptr_t *, int, int, uint8_t *, size_t, uint32_t, uint8_t, libcerror_error_t **)) &libfsntfs_cluster_block_data_read_segment_data,
-	     NULL,
-	     (off64_t (*)(intptr_t *, intptr_t *, int, int, off64_t, libcerror_error_t **)) &libfsntfs_cluster_block_data_seek_segment_offset,
-	     0,
+	     (off64_t (*)(intptr_t *, intptr_t *, int, int, off64_t, libcerror_error_t **)) &libfsntfs_extent_data_handle_seek_segment_offset,
+	     LIBFDATA_DATA_HANDLE_FLAG_MANAGED,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -257,198 +269,24 @@ int libfsntfs_cluster_block_stream_initialize_from_data_runs(
 
 		goto on_error;
 	}
-	if( valid_data_size > 0 )
-	{
-		while( data_attribute != NULL )
-		{
-			if( libfsntfs_mft_attribute_get_data_vcn_range(
-			     data_attribute,
-			     (uint64_t *) &attribute_data_vcn_offset,
-			     (uint64_t *) &attribute_data_vcn_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve attribute data VCN range.",
-				 function );
-
-				goto on_error;
-			}
-			if( attribute_data_vcn_size != 0xffffffffffffffffULL )
-			{
-				if( (uint64_t) attribute_data_vcn_offset > (uint64_t) ( ( INT64_MAX / io_handle->cluster_block_size ) - 1 ) )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-					 "%s: invalid attribute data first VCN value out of bounds.",
-					 function );
-
-					goto on_error;
-				}
-				if( attribute_data_vcn_size > (size64_t) ( ( INT64_MAX / io_handle->cluster_block_size ) - 1 ) )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-					 "%s: invalid attribute data last VCN value out of bounds.",
-					 function );
-
-					goto on_error;
-				}
-				if( attribute_data_vcn_offset > (off64_t) attribute_data_vcn_size )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-					 "%s: invalid attribute data first VCN value exceeds last VCN value.",
-					 function );
-
-					goto on_error;
-				}
-				attribute_data_vcn_size   += 1;
-				attribute_data_vcn_size   -= attribute_data_vcn_offset;
-				attribute_data_vcn_offset *= io_handle->cluster_block_size;
-				attribute_data_vcn_size   *= io_handle->cluster_block_size;
-
-				if( ( calculated_attribute_data_vcn_offset != 0 )
-				 && ( calculated_attribute_data_vcn_offset != attribute_data_vcn_offset ) )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-					 "%s: invalid attribute data VCN offset value out of bounds.",
-					 function );
-
-					goto on_error;
-				}
-				calculated_attribute_data_vcn_offset = attribute_data_vcn_offset + (off64_t) attribute_data_vcn_size;
-			}
-			if( libfsntfs_mft_attribute_get_number_of_data_runs(
-			     data_attribute,
-			     &number_of_data_runs,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve attribute: %d number of data runs.",
-				 function,
-				 attribute_index );
-
-				goto on_error;
-			}
-			for( data_run_index = 0;
-			     data_run_index < number_of_data_runs;
-			     data_run_index++ )
-			{
-				if( libfsntfs_mft_attribute_get_data_run_by_index(
-				     data_attribute,
-				     data_run_index,
-				     &data_run,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve attribute: %d data run: %d.",
-					 function,
-					 attribute_index,
-					 data_run_index );
-
-					goto on_error;
-				}
-				if( data_run == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-					 "%s: missing attribute: %d data run: %d.",
-					 function,
-					 attribute_index,
-					 data_run_index );
-
-					goto on_error;
-				}
-				if( data_run->size > ( valid_data_size - data_segment_offset ) )
-				{
-					data_segment_size = valid_data_size - data_segment_offset;
-				}
-				else
-				{
-					data_segment_size = data_run->size;
-				}
-				if( libfdata_stream_append_segment(
-				     safe_data_stream,
-				     &segment_index,
-				     0,
-				     data_run->start_offset,
-				     data_segment_size,
-				     data_run->range_flags,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-					 "%s: unable to append attribute: %d data run: %d data stream segment.",
-					 function,
-					 attribute_index,
-					 data_run_index );
-
-					goto on_error;
-				}
-				data_segment_offset += data_segment_size;
-
-				if( (size64_t) data_segment_offset >= valid_data_size )
-				{
-					break;
-				}
-			}
-			attribute_index++;
-
-			if( libfsntfs_mft_attribute_get_next_attribute(
-			     data_attribute,
-			     &data_attribute,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve next MFT attribute: %d.",
-				 function,
-				 attribute_index );
+	data_handle = NULL;
 
-				goto on_error;
-			}
-		}
-	}
-	if( (size64_t) data_segment_offset < data_size )
+	if( mapped_size > 0 )
 	{
 		if( libfdata_stream_append_segment(
 		     safe_data_stream,
 		     &segment_index,
 		     0,
 		     0,
-		     data_size - data_segment_offset,
-		     LIBFDATA_RANGE_FLAG_IS_SPARSE,
+		     mapped_size,
+		     0,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append sparse data stream segment.",
+			 "%s: unable to append data stream segment.",
 			 function );
 
 			goto on_error;
@@ -465,6 +303,12 @@ on_error:
 		 &safe_data_stream,
 		 NULL );
 	}
+	if( data_handle != NULL )
+	{
+		libfsntfs_extent_data_handle_free(
+		 &data_handle,
+		 NULL );
+	}
 	return( -1 );
 }
 
@@ -617,6 +461,7 @@ on_error:
  */
 int libfsntfs_cluster_block_stream_initialize_from_compressed_stream(
      libfdata_stream_t **cluster_block_stream,
+     libfsntfs_io_handle_t *io_handle,
      libfdata_stream_t *compressed_data_stream,
      libfsntfs_mft_attribute_t *data_attribute,
      uint32_t compression_method,
@@ -640,6 +485,17 @@ int libfsntfs_cluster_block_stream_initialize_from_compressed_stream(
 
 		return( -1 );
 	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
 	if( libfsntfs_mft_attribute_get_data_size(
 	     data_attribute,
 	     &data_size,
@@ -688,6 +544,8 @@ int libfsntfs_cluster_block_stream_initialize_from_compressed_stream(
 
 		goto on_error;
 	}
+	data_handle->io_handle = io_handle;
+
 	if( libfdata_stream_initialize(
 	     &safe_data_stream,
 	     (intptr_t *) data_handle,
@@ -910,6 +768,7 @@ int libfsntfs_cluster_block_stream_initialize(
 	{
 		if( libfsntfs_cluster_block_stream_initialize_from_compressed_stream(
 		     cluster_block_stream,
+		     io_handle,
 		     safe_cluster_block_stream,
 		     data_attribute,
 		     compression_method,
@@ -937,3 +796,460 @@ on_error:
 	return( -1 );
 }
 
+/* Creates an extents index of the data runs of a data attribute
+ * The extents index maps the data onto the same extents as the cluster block stream created from the data runs
+ * Make sure the value extents_index is referencing, is set to NULL
+ * Returns 1 if successful, 0 if the data is resident or compressed or -1 on error
+ */
+int libfsntfs_cluster_block_stream_initialize_extents_index(
+     libfsntfs_extent_data_handle_t **extents_index,
+     libfsntfs_io_handle_t *io_handle,
+     libfsntfs_mft_attribute_t *data_attribute,
+     libcerror_error_t **error )
+{
+	libfsntfs_extent_data_handle_t *safe_extents_index = NULL;
+	uint8_t *resident_data                             = NULL;
+	static char *function                              = "libfsntfs_cluster_block_stream_initialize_extents_index";
+	size64_t data_size                                 = 0;
+	size_t resident_data_size                          = 0;
+	uint16_t data_flags                                = 0;
+
+	if( extents_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extents index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *extents_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid extents index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsntfs_mft_attribute_get_data_size(
+	     data_attribute,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data size",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsntfs_mft_attribute_get_data(
+	     data_attribute,
+	     &resident_data,
+	     &resident_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve resident data from attribute.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsntfs_mft_attribute_get_data_flags(
+	     data_attribute,
+	     &data_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data flags from attribute.",
+		 function );
+
+		goto on_error;
+	}
+	/* The extents of compressed data do not map onto the uncompressed data
+	 */
+	if( ( resident_data != NULL )
+	 || ( data_size == 0 )
+	 || ( ( data_flags & LIBFSNTFS_ATTRIBUTE_FLAG_COMPRESSION_MASK ) != 0 ) )
+	{
+		return( 0 );
+	}
+	if( libfsntfs_extent_data_handle_initialize(
+	     &safe_extents_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create extents index.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsntfs_extent_data_handle_append_data_runs(
+	     safe_extents_index,
+	     io_handle,
+	     data_attribute,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append data runs to extents index.",
+		 function );
+
+		goto on_error;
+	}
+	*extents_index = safe_extents_index;
+
+	return( 1 );
+
+on_error:
+	if( safe_extents_index != NULL )
+	{
+		libfsntfs_extent_data_handle_free(
+		 &safe_extents_index,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads a chunk of data at a specific offset from a cluster block stream
+ * The chunk ends at the next multiple of the buffer size or where a sparse range starts or ends
+ * The extents index is used to determine the sparse ranges, if NULL the data is always read
+ * If the chunk is sparse the buffer is not filled and the chunk consists of 0-byte values
+ * Returns the size of the chunk, 0 if no more data or -1 on error
+ */
+ssize_t libfsntfs_cluster_block_stream_read_chunk_at_offset(
+         libfdata_stream_t *cluster_block_stream,
+         libbfio_handle_t *file_io_handle,
+         libfsntfs_extent_data_handle_t *extents_index,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         uint8_t *is_sparse,
+         libcerror_error_t **error )
+{
+	static char *function      = "libfsntfs_cluster_block_stream_read_chunk_at_offset";
+	size64_t extent_size       = 0;
+	size64_t stream_size       = 0;
+	size_t chunk_size          = 0;
+	ssize_t read_count         = 0;
+	off64_t extent_offset      = 0;
+	uint32_t extent_flags      = 0;
+	uint8_t safe_is_sparse     = 0;
+	int extent_index           = 0;
+	int result                 = 0;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( is_sparse == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid is sparse.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_stream_get_size(
+	     cluster_block_stream,
+	     &stream_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cluster block stream size.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) offset >= stream_size )
+	{
+		*is_sparse = 0;
+
+		return( 0 );
+	}
+	chunk_size = buffer_size - (size_t) ( (size64_t) offset % buffer_size );
+
+	if( (size64_t) chunk_size > ( stream_size - (size64_t) offset ) )
+	{
+		chunk_size = (size_t) ( stream_size - (size64_t) offset );
+	}
+	if( extents_index != NULL )
+	{
+		/* The data beyond the valid data size is mapped as a sparse extent
+		 */
+		result = libfsntfs_extent_data_handle_get_extent_at_offset(
+		          extents_index,
+		          offset,
+		          &extent_index,
+		          &extent_offset,
+		          &extent_size,
+		          &extent_flags,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			extent_size -= (size64_t) ( offset - extent_offset );
+
+			if( (size64_t) chunk_size > extent_size )
+			{
+				chunk_size = (size_t) extent_size;
+			}
+			if( ( extent_flags & LIBFSNTFS_EXTENT_FLAG_IS_SPARSE ) != 0 )
+			{
+				safe_is_sparse = 1;
+			}
+		}
+	}
+	if( safe_is_sparse == 0 )
+	{
+		if( libfdata_stream_seek_offset(
+		     cluster_block_stream,
+		     offset,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek offset: %" PRIi64 " in cluster block stream.",
+			 function,
+			 offset );
+
+			return( -1 );
+		}
+		read_count = libfdata_stream_read_buffer(
+		              cluster_block_stream,
+		              (intptr_t *) file_io_handle,
+		              buffer,
+		              chunk_size,
+		              0,
+		              error );
+
+		if( read_count != (ssize_t) chunk_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunk at offset: %" PRIi64 " from cluster block stream.",
+			 function,
+			 offset );
+
+			return( -1 );
+		}
+	}
+	*is_sparse = safe_is_sparse;
+
+	return( (ssize_t) chunk_size );
+}
+
+/* Determines the offset of the first data or sparse range at or after a specific offset in a cluster block stream
+ * The extents index is used to determine the sparse ranges, if NULL the stream consists of data only
+ * The end of the stream is considered the start of a sparse range and an offset at or beyond
+ * the end of the stream is returned unchanged
+ * Returns the offset if successful or -1 on error
+ */
+off64_t libfsntfs_cluster_block_stream_get_range_offset(
+         libfdata_stream_t *cluster_block_stream,
+         libfsntfs_extent_data_handle_t *extents_index,
+         off64_t offset,
+         uint8_t range_is_sparse,
+         libcerror_error_t **error )
+{
+	static char *function    = "libfsntfs_cluster_block_stream_get_range_offset";
+	size64_t extent_size     = 0;
+	size64_t stream_size     = 0;
+	off64_t extent_offset    = 0;
+	uint32_t extent_flags    = 0;
+	uint8_t extent_is_sparse = 0;
+	int extent_index         = 0;
+	int number_of_extents    = 0;
+	int result               = 0;
+
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_stream_get_size(
+	     cluster_block_stream,
+	     &stream_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cluster block stream size.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) offset >= stream_size )
+	{
+		return( offset );
+	}
+	if( extents_index == NULL )
+	{
+		if( range_is_sparse != 0 )
+		{
+			return( (off64_t) stream_size );
+		}
+		return( offset );
+	}
+	/* The data beyond the valid data size is mapped as a sparse extent
+	 */
+	result = libfsntfs_extent_data_handle_get_extent_at_offset(
+	          extents_index,
+	          offset,
+	          &extent_index,
+	          &extent_offset,
+	          &extent_size,
+	          &extent_flags,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve extent at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libfsntfs_extent_data_handle_get_number_of_extents(
+		     extents_index,
+		     &number_of_extents,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of extents.",
+			 function );
+
+			return( -1 );
+		}
+		while( (size64_t) extent_offset < stream_size )
+		{
+			extent_is_sparse = (uint8_t) ( ( extent_flags & LIBFSNTFS_EXTENT_FLAG_IS_SPARSE ) != 0 );
+
+			if( extent_is_sparse == ( range_is_sparse != 0 ) )
+			{
+				if( offset < extent_offset )
+				{
+					return( extent_offset );
+				}
+				return( offset );
+			}
+			extent_index++;
+
+			if( extent_index >= number_of_extents )
+			{
+				break;
+			}
+			if( libfsntfs_extent_data_handle_get_extent_by_index(
+			     extents_index,
+			     extent_index,
+			     &extent_offset,
+			     &extent_size,
+			     &extent_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve extent: %d.",
+				 function,
+				 extent_index );
+
+				return( -1 );
+			}
+		}
+	}
+	return( (off64_t) stream_size );
+}
+
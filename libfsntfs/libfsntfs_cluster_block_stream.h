@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfsntfs_extent_data_handle.h"
 #include "libfsntfs_io_handle.h"
 #include "libfsntfs_libbfio.h"
 #include "libfsntfs_libcerror.h"
@@ -58,6 +59,7 @@ int libfsntfs_cluster_block_stream_initialize_from_compressed_data_runs(
 
 int libfsntfs_cluster_block_stream_initialize_from_compressed_stream(
      libfdata_stream_t **cluster_block_stream,
+     libfsntfs_io_handle_t *io_handle,
      libfdata_stream_t *compressed_data_stream,
      libfsntfs_mft_attribute_t *data_attribute,
      uint32_t compression_method,
@@ -71,6 +73,29 @@ int libfsntfs_cluster_block_stream_initialize(
      uint32_t compression_method,
      libcerror_error_t **error );
 
+int libfsntfs_cluster_block_stream_initialize_extents_index(
+     libfsntfs_extent_data_handle_t **extents_index,
+     libfsntfs_io_handle_t *io_handle,
+     libfsntfs_mft_attribute_t *data_attribute,
+     libcerror_error_t **error );
+
+ssize_t libfsntfs_cluster_block_stream_read_chunk_at_offset(
+         libfdata_stream_t *cluster_block_stream,
+         libbfio_handle_t *file_io_handle,
+         libfsntfs_extent_data_handle_t *extents_index,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         uint8_t *is_sparse,
+         libcerror_error_t **error );
+
+off64_t libfsntfs_cluster_block_stream_get_range_offset(
+         libfdata_stream_t *cluster_block_stream,
+         libfsntfs_extent_data_handle_t *extents_index,
+         off64_t offset,
+         uint8_t range_is_sparse,
+         libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -33,6 +33,7 @@
 #include "libfsntfs_libcerror.h"
 #include "libfsntfs_libfdata.h"
 #include "libfsntfs_mft_attribute.h"
+#include "libfsntfs_statistics.h"
 #include "libfsntfs_unused.h"
 
 /* Creates a compressed block vector
@@ -238,6 +239,7 @@ int libfsntfs_compressed_block_vector_read_element_data(
 	uint8_t *compressed_data                                             = NULL;
 	static char *function                                                = "libfsntfs_compressed_block_vector_read_element_data";
 	ssize_t read_count                                                   = 0;
+	uint64_t start_timestamp                                             = 0;
 	int result                                                           = 0;
 
 	LIBFSNTFS_UNREFERENCED_PARAMETER( element_data_file_index )
@@ -345,6 +347,19 @@ int libfsntfs_compressed_block_vector_read_element_data(
 	}
 	if( ( range_flags & LIBFDATA_RANGE_FLAG_IS_COMPRESSED ) != 0 )
 	{
+		if( libfsntfs_statistics_start_timing(
+		     &start_timestamp,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to start decompression timing.",
+			 function );
+
+			goto on_error;
+		}
 		result = libfsntfs_decompress_data(
 		          compressed_data,
 		          (size_t) compressed_block_size,
@@ -364,6 +379,29 @@ int libfsntfs_compressed_block_vector_read_element_data(
 
 			goto on_error;
 		}
+		if( data_handle->io_handle != NULL )
+		{
+			libfsntfs_statistics_add_value(
+			 data_handle->io_handle->statistics,
+			 LIBFSNTFS_STATISTICS_VALUE_COMPRESSED_BYTES_READ,
+			 compressed_block_size );
+
+			if( libfsntfs_statistics_add_decompression_time(
+			     data_handle->io_handle->statistics,
+			     LIBFSNTFS_COMPRESSION_METHOD_LZNT1,
+			     start_timestamp,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to add decompression time to statistics.",
+				 function );
+
+				goto on_error;
+			}
+		}
 		memory_free(
 		 compressed_data );
 
@@ -31,6 +31,7 @@
 #include "libfsntfs_libcerror.h"
 #include "libfsntfs_libcnotify.h"
 #include "libfsntfs_libfdata.h"
+#include "libfsntfs_statistics.h"
 #include "libfsntfs_unused.h"
 
 /* Creates compressed data handle
@@ -530,6 +531,7 @@ ssize_t libfsntfs_compressed_data_handle_read_segment_data(
 	off64_t data_stream_offset        = 0;
 	off64_t uncompressed_block_offset = 0;
 	uint64_t compressed_block_index   = 0;
+	uint64_t start_timestamp          = 0;
 
 	LIBFSNTFS_UNREFERENCED_PARAMETER( file_io_handle )
 	LIBFSNTFS_UNREFERENCED_PARAMETER( segment_file_index )
@@ -683,6 +685,19 @@ ssize_t libfsntfs_compressed_data_handle_read_segment_data(
 					 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 				}
 #endif
+				if( libfsntfs_statistics_start_timing(
+				     &start_timestamp,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to start decompression timing.",
+					 function );
+
+					return( -1 );
+				}
 				if( libfsntfs_decompress_data(
 				     data_handle->compressed_segment_data,
 				     (size_t) read_count,
@@ -700,6 +715,29 @@ ssize_t libfsntfs_compressed_data_handle_read_segment_data(
 
 					return( -1 );
 				}
+				if( data_handle->io_handle != NULL )
+				{
+					libfsntfs_statistics_add_value(
+					 data_handle->io_handle->statistics,
+					 LIBFSNTFS_STATISTICS_VALUE_COMPRESSED_BYTES_READ,
+					 (uint64_t) read_count );
+
+					if( libfsntfs_statistics_add_decompression_time(
+					     data_handle->io_handle->statistics,
+					     (uint32_t) data_handle->compression_method,
+					     start_timestamp,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+						 "%s: unable to add decompression time to statistics.",
+						 function );
+
+						return( -1 );
+					}
+				}
 				uncompressed_block_offset = ( compressed_block_index + 1 ) * data_handle->compression_unit_size;
 
 				if( ( (size64_t) uncompressed_block_offset < data_handle->uncompressed_data_size )
@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfsntfs_io_handle.h"
 #include "libfsntfs_libbfio.h"
 #include "libfsntfs_libcerror.h"
 #include "libfsntfs_libfdata.h"
@@ -80,6 +81,10 @@ struct libfsntfs_compressed_data_handle
 	/* The compression unit size
 	 */
 	size_t compression_unit_size;
+
+	/* The IO handle, which is used to maintain the statistics
+	 */
+	libfsntfs_io_handle_t *io_handle;
 };
 
 int libfsntfs_compressed_data_handle_initialize(
@@ -576,6 +576,7 @@ int libfsntfs_compression_unit_data_handle_initialize(
 		goto on_error;
 	}
 	( *data_handle )->compression_unit_size = compression_unit_size;
+	( *data_handle )->io_handle             = io_handle;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -45,6 +45,10 @@ struct libfsntfs_compression_unit_data_handle
 	/* The compression unit size
 	 */
 	size_t compression_unit_size;
+
+	/* The IO handle, which is used to maintain the statistics
+	 */
+	libfsntfs_io_handle_t *io_handle;
 };
 
 int libfsntfs_compression_unit_data_handle_initialize(
@@ -254,9 +254,10 @@ ssize_t libfsntfs_data_run_read_data(
 			 function );
 		}
 #endif
-		data_run->start_offset = 0;
-		data_run->size         = 0;
-		data_run->range_flags  = 0;
+		data_run->start_offset             = 0;
+		data_run->number_of_cluster_blocks = 0;
+		data_run->size                     = 0;
+		data_run->range_flags              = 0;
 
 		return( 1 );
 	}
@@ -307,7 +308,8 @@ ssize_t libfsntfs_data_run_read_data(
 		data_run->start_offset         = (off64_t) ( data_run->cluster_block_number * io_handle->cluster_block_size );
 		data_run->range_flags          = 0;
 	}
-	data_run->size = (size64_t) ( number_of_cluster_blocks * io_handle->cluster_block_size );
+	data_run->number_of_cluster_blocks = number_of_cluster_blocks;
+	data_run->size                     = (size64_t) ( number_of_cluster_blocks * io_handle->cluster_block_size );
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -36,10 +36,18 @@ typedef struct libfsntfs_data_run libfsntfs_data_run_t;
 
 struct libfsntfs_data_run
 {
+	/* The virtual cluster number (VCN) of the first cluster block
+	 */
+	uint64_t vcn;
+
 	/* The cluster block number
 	 */
 	uint64_t cluster_block_number;
 
+	/* The number of cluster blocks
+	 */
+	uint64_t number_of_cluster_blocks;
+
 	/* The start offset
 	 */
 	off64_t start_offset;
@@ -130,6 +130,21 @@ int libfsntfs_data_stream_initialize(
 
 		goto on_error;
 	}
+	if( libfsntfs_cluster_block_stream_initialize_extents_index(
+	     &( internal_data_stream->extents_index ),
+	     io_handle,
+	     data_attribute,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create extents index.",
+		 function );
+
+		goto on_error;
+	}
 	if( libfsntfs_cluster_block_stream_initialize(
 	     &( internal_data_stream->data_cluster_block_stream ),
 	     io_handle,
@@ -178,6 +193,12 @@ on_error:
 			 &( internal_data_stream->data_cluster_block_stream ),
 			 NULL );
 		}
+		if( internal_data_stream->extents_index != NULL )
+		{
+			libfsntfs_extent_data_handle_free(
+			 &( internal_data_stream->extents_index ),
+			 NULL );
+		}
 		if( internal_data_stream->extents_array != NULL )
 		{
 			libcdata_array_free(
@@ -265,6 +286,22 @@ int libfsntfs_data_stream_free(
 
 			result = -1;
 		}
+		if( internal_data_stream->extents_index != NULL )
+		{
+			if( libfsntfs_extent_data_handle_free(
+			     &( internal_data_stream->extents_index ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free extents index.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 internal_data_stream );
 	}
@@ -742,17 +779,22 @@ ssize_t libfsntfs_data_stream_read_buffer_at_offset(
 	return( read_count );
 }
 
-/* Seeks a certain offset
- * Returns the offset if seek is successful or -1 on error
+/* Reads a chunk of data at a specific offset
+ * The chunk ends at the next multiple of the buffer size or where a sparse range starts or ends
+ * If the chunk is sparse the buffer is not filled and the chunk consists of 0-byte values
+ * Returns the size of the chunk, 0 if no more data or -1 on error
  */
-off64_t libfsntfs_data_stream_seek_offset(
+ssize_t libfsntfs_data_stream_read_chunk_at_offset(
          libfsntfs_data_stream_t *data_stream,
+         void *buffer,
+         size_t buffer_size,
          off64_t offset,
-         int whence,
+         uint8_t *is_sparse,
          libcerror_error_t **error )
 {
 	libfsntfs_internal_data_stream_t *internal_data_stream = NULL;
-	static char *function                                  = "libfsntfs_data_stream_seek_offset";
+	static char *function                                  = "libfsntfs_data_stream_read_chunk_at_offset";
+	ssize_t read_count                                     = 0;
 
 	if( data_stream == NULL )
 	{
@@ -782,22 +824,129 @@ off64_t libfsntfs_data_stream_seek_offset(
 		return( -1 );
 	}
 #endif
-	offset = libfdata_stream_seek_offset(
-	          internal_data_stream->data_cluster_block_stream,
-	          offset,
-	          whence,
-	          error );
+	read_count = libfsntfs_cluster_block_stream_read_chunk_at_offset(
+	              internal_data_stream->data_cluster_block_stream,
+	              internal_data_stream->file_io_handle,
+	              internal_data_stream->extents_index,
+	              (uint8_t *) buffer,
+	              buffer_size,
+	              offset,
+	              is_sparse,
+	              error );
 
-	if( offset == -1 )
+	if( read_count < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset in data cluster block stream.",
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read chunk from data cluster block stream.",
+		 function );
+
+		read_count = -1;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_data_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		offset = -1;
+		return( -1 );
+	}
+#endif
+	return( read_count );
+}
+
+/* Seeks a certain offset
+ * Whence can be SEEK_SET, SEEK_CUR, SEEK_END, LIBFSNTFS_SEEK_DATA or LIBFSNTFS_SEEK_HOLE
+ * LIBFSNTFS_SEEK_DATA and LIBFSNTFS_SEEK_HOLE seek the start of the first data or sparse range
+ * at or after the offset, or the end of the data if there is none
+ * An offset at or beyond the end of the data is kept
+ * Returns the offset if seek is successful or -1 on error
+ */
+off64_t libfsntfs_data_stream_seek_offset(
+         libfsntfs_data_stream_t *data_stream,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	libfsntfs_internal_data_stream_t *internal_data_stream = NULL;
+	static char *function                                  = "libfsntfs_data_stream_seek_offset";
+
+	if( data_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data stream.",
+		 function );
+
+		return( -1 );
+	}
+	internal_data_stream = (libfsntfs_internal_data_stream_t *) data_stream;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_data_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( whence == LIBFSNTFS_SEEK_DATA )
+	 || ( whence == LIBFSNTFS_SEEK_HOLE ) )
+	{
+		offset = libfsntfs_cluster_block_stream_get_range_offset(
+		          internal_data_stream->data_cluster_block_stream,
+		          internal_data_stream->extents_index,
+		          offset,
+		          (uint8_t) ( whence == LIBFSNTFS_SEEK_HOLE ),
+		          error );
+
+		if( offset == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine range offset in data cluster block stream.",
+			 function );
+		}
+		whence = SEEK_SET;
+	}
+	if( offset != -1 )
+	{
+		offset = libfdata_stream_seek_offset(
+		          internal_data_stream->data_cluster_block_stream,
+		          offset,
+		          whence,
+		          error );
+
+		if( offset == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek offset in data cluster block stream.",
+			 function );
+
+			offset = -1;
+		}
 	}
 #if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
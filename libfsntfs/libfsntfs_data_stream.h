@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfsntfs_extent_data_handle.h"
 #include "libfsntfs_extern.h"
 #include "libfsntfs_io_handle.h"
 #include "libfsntfs_libbfio.h"
@@ -55,6 +56,10 @@ struct libfsntfs_internal_data_stream
 	 */
 	libcdata_array_t *extents_array;
 
+	/* The extents index
+	 */
+	libfsntfs_extent_data_handle_t *extents_index;
+
 	/* The $DATA attribute cluster block stream
 	 */
 	libfdata_stream_t *data_cluster_block_stream;
@@ -119,6 +124,15 @@ ssize_t libfsntfs_data_stream_read_buffer_at_offset(
          off64_t offset,
          libcerror_error_t **error );
 
+LIBFSNTFS_EXTERN \
+ssize_t libfsntfs_data_stream_read_chunk_at_offset(
+         libfsntfs_data_stream_t *data_stream,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         uint8_t *is_sparse,
+         libcerror_error_t **error );
+
 LIBFSNTFS_EXTERN \
 off64_t libfsntfs_data_stream_seek_offset(
          libfsntfs_data_stream_t *data_stream,
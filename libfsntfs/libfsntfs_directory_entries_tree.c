@@ -491,6 +491,7 @@ int libfsntfs_directory_entries_tree_read_from_index_node(
 	uint32_t index_value_flags           = 0;
 	int index_value_entry                = 0;
 	int is_allocated                     = 0;
+	int number_of_cache_entries          = 0;
 	int number_of_index_values           = 0;
 	int result                           = 0;
 
@@ -554,11 +555,22 @@ int libfsntfs_directory_entries_tree_read_from_index_node(
 		goto on_error;
 	}
 	/* Use a local cache to prevent cache invalidation of index node
-	 * when reading sub nodes.
+	 * when reading sub nodes. The cache is sized to hold the sub nodes
+	 * of the index node so that they can be prefetched.
 	 */
+	number_of_cache_entries = number_of_index_values;
+
+	if( number_of_cache_entries < 1 )
+	{
+		number_of_cache_entries = 1;
+	}
+	else if( number_of_cache_entries > LIBFSNTFS_MAXIMUM_CACHE_ENTRIES_INDEX_NODES )
+	{
+		number_of_cache_entries = LIBFSNTFS_MAXIMUM_CACHE_ENTRIES_INDEX_NODES;
+	}
 	if( libfcache_cache_initialize(
 	     &sub_node_cache,
-	     1,
+	     number_of_cache_entries,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -570,6 +582,22 @@ int libfsntfs_directory_entries_tree_read_from_index_node(
 
 		goto on_error;
 	}
+	if( libfsntfs_index_prefetch_sub_nodes(
+	     directory_entries_tree->i30_index,
+	     file_io_handle,
+	     sub_node_cache,
+	     index_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to prefetch sub nodes.",
+		 function );
+
+		goto on_error;
+	}
 	for( index_value_entry = 0;
 	     index_value_entry < number_of_index_values;
 	     index_value_entry++ )
@@ -0,0 +1,1059 @@
+/*
+ * The extent data handle functions
+ *
+ * Copyright (C) 2010-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsntfs_data_extent.h"
+#include "libfsntfs_data_run.h"
+#include "libfsntfs_definitions.h"
+#include "libfsntfs_extent_data_handle.h"
+#include "libfsntfs_io_handle.h"
+#include "libfsntfs_libbfio.h"
+#include "libfsntfs_libcerror.h"
+#include "libfsntfs_libfdata.h"
+#include "libfsntfs_mft_attribute.h"
+#include "libfsntfs_statistics.h"
+#include "libfsntfs_unused.h"
+
+/* Creates an extent data handle
+ * Make sure the value data_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_extent_data_handle_initialize(
+     libfsntfs_extent_data_handle_t **data_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_extent_data_handle_initialize";
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*data_handle = memory_allocate_structure(
+	                libfsntfs_extent_data_handle_t );
+
+	if( *data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *data_handle,
+	     0,
+	     sizeof( libfsntfs_extent_data_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *data_handle != NULL )
+	{
+		memory_free(
+		 *data_handle );
+
+		*data_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an extent data handle
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_extent_data_handle_free(
+     libfsntfs_extent_data_handle_t **data_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_extent_data_handle_free";
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_handle != NULL )
+	{
+		if( ( *data_handle )->extent_offsets != NULL )
+		{
+			memory_free(
+			 ( *data_handle )->extent_offsets );
+		}
+		if( ( *data_handle )->extents != NULL )
+		{
+			memory_free(
+			 ( *data_handle )->extents );
+		}
+		memory_free(
+		 *data_handle );
+
+		*data_handle = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends an extent
+ * The extent start offset is the offset of the extent data in the file system
+ * Extents of size 0 are ignored
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_extent_data_handle_append_extent(
+     libfsntfs_extent_data_handle_t *data_handle,
+     off64_t extent_start_offset,
+     size64_t extent_size,
+     uint32_t extent_flags,
+     libcerror_error_t **error )
+{
+	libfsntfs_data_extent_t *extents = NULL;
+	off64_t *extent_offsets          = NULL;
+	static char *function            = "libfsntfs_extent_data_handle_append_extent";
+	int maximum_number_of_extents    = 0;
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_start_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid extent start offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_size > ( (size64_t) INT64_MAX - data_handle->data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid extent size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_size == 0 )
+	{
+		return( 1 );
+	}
+	if( data_handle->number_of_extents >= data_handle->maximum_number_of_extents )
+	{
+		if( data_handle->maximum_number_of_extents == 0 )
+		{
+			maximum_number_of_extents = 16;
+		}
+		else if( data_handle->maximum_number_of_extents <= ( INT_MAX / 2 ) )
+		{
+			maximum_number_of_extents = data_handle->maximum_number_of_extents * 2;
+		}
+		if( ( maximum_number_of_extents <= data_handle->number_of_extents )
+		 || ( (size_t) maximum_number_of_extents > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsntfs_data_extent_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid maximum number of extents value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		extents = (libfsntfs_data_extent_t *) memory_reallocate(
+		                                       data_handle->extents,
+		                                       sizeof( libfsntfs_data_extent_t ) * maximum_number_of_extents );
+
+		if( extents == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize extents.",
+			 function );
+
+			return( -1 );
+		}
+		data_handle->extents = extents;
+
+		extent_offsets = (off64_t *) memory_reallocate(
+		                              data_handle->extent_offsets,
+		                              sizeof( off64_t ) * maximum_number_of_extents );
+
+		if( extent_offsets == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize extent offsets.",
+			 function );
+
+			return( -1 );
+		}
+		data_handle->extent_offsets            = extent_offsets;
+		data_handle->maximum_number_of_extents = maximum_number_of_extents;
+	}
+	data_handle->extents[ data_handle->number_of_extents ].start_offset = extent_start_offset;
+	data_handle->extents[ data_handle->number_of_extents ].size         = extent_size;
+	data_handle->extents[ data_handle->number_of_extents ].range_flags  = extent_flags;
+
+	data_handle->extent_offsets[ data_handle->number_of_extents ] = (off64_t) data_handle->data_size;
+
+	data_handle->number_of_extents += 1;
+	data_handle->data_size         += extent_size;
+
+	return( 1 );
+}
+
+/* Appends the extents defined by the data runs of a (chain of) non-resident MFT attribute(s)
+ * The extents are limited to the valid data size and a sparse extent is appended up to the data size
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_extent_data_handle_append_data_runs(
+     libfsntfs_extent_data_handle_t *data_handle,
+     libfsntfs_io_handle_t *io_handle,
+     libfsntfs_mft_attribute_t *data_attribute,
+     size64_t data_size,
+     libcerror_error_t **error )
+{
+	libfsntfs_data_run_t *data_run               = NULL;
+	static char *function                        = "libfsntfs_extent_data_handle_append_data_runs";
+	size64_t attribute_data_vcn_size             = 0;
+	size64_t extent_size                         = 0;
+	size64_t valid_data_size                     = 0;
+	off64_t attribute_data_vcn_offset            = 0;
+	off64_t calculated_attribute_data_vcn_offset = 0;
+	off64_t extent_offset                        = 0;
+	int attribute_index                          = 0;
+	int data_run_index                           = 0;
+	int number_of_data_runs                      = 0;
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->cluster_block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - cluster block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The IO handle is retained to maintain the statistics
+	 */
+	data_handle->io_handle = io_handle;
+
+	if( libfsntfs_mft_attribute_get_valid_data_size(
+	     data_attribute,
+	     &valid_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve valid data size",
+		 function );
+
+		return( -1 );
+	}
+	if( data_handle->number_of_extents != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data handle - extents value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( valid_data_size > 0 )
+	{
+		while( data_attribute != NULL )
+		{
+			if( libfsntfs_mft_attribute_get_data_vcn_range(
+			     data_attribute,
+			     (uint64_t *) &attribute_data_vcn_offset,
+			     (uint64_t *) &attribute_data_vcn_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve attribute data VCN range.",
+				 function );
+
+				return( -1 );
+			}
+			if( attribute_data_vcn_size != 0xffffffffffffffffULL )
+			{
+				if( (uint64_t) attribute_data_vcn_offset > (uint64_t) ( ( INT64_MAX / io_handle->cluster_block_size ) - 1 ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid attribute data first VCN value out of bounds.",
+					 function );
+
+					return( -1 );
+				}
+				if( attribute_data_vcn_size > (size64_t) ( ( INT64_MAX / io_handle->cluster_block_size ) - 1 ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid attribute data last VCN value out of bounds.",
+					 function );
+
+					return( -1 );
+				}
+				if( attribute_data_vcn_offset > (off64_t) attribute_data_vcn_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid attribute data first VCN value exceeds last VCN value.",
+					 function );
+
+					return( -1 );
+				}
+				attribute_data_vcn_size   += 1;
+				attribute_data_vcn_size   -= attribute_data_vcn_offset;
+				attribute_data_vcn_offset *= io_handle->cluster_block_size;
+				attribute_data_vcn_size   *= io_handle->cluster_block_size;
+
+				if( ( calculated_attribute_data_vcn_offset != 0 )
+				 && ( calculated_attribute_data_vcn_offset != attribute_data_vcn_offset ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid attribute data VCN offset value out of bounds.",
+					 function );
+
+					return( -1 );
+				}
+				calculated_attribute_data_vcn_offset = attribute_data_vcn_offset + (off64_t) attribute_data_vcn_size;
+			}
+			if( libfsntfs_mft_attribute_get_number_of_data_runs(
+			     data_attribute,
+			     &number_of_data_runs,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve attribute: %d number of data runs.",
+				 function,
+				 attribute_index );
+
+				return( -1 );
+			}
+			for( data_run_index = 0;
+			     data_run_index < number_of_data_runs;
+			     data_run_index++ )
+			{
+				if( libfsntfs_mft_attribute_get_data_run_by_index(
+				     data_attribute,
+				     data_run_index,
+				     &data_run,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve attribute: %d data run: %d.",
+					 function,
+					 attribute_index,
+					 data_run_index );
+
+					return( -1 );
+				}
+
+				if( data_run->size > ( valid_data_size - extent_offset ) )
+				{
+					extent_size = valid_data_size - extent_offset;
+				}
+				else
+				{
+					extent_size = data_run->size;
+				}
+				if( libfsntfs_extent_data_handle_append_extent(
+				     data_handle,
+				     data_run->start_offset,
+				     extent_size,
+				     data_run->range_flags,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append attribute: %d data run: %d extent.",
+					 function,
+					 attribute_index,
+					 data_run_index );
+
+					return( -1 );
+				}
+				extent_offset += extent_size;
+
+				if( (size64_t) extent_offset >= valid_data_size )
+				{
+					break;
+				}
+			}
+			if( (size64_t) extent_offset >= valid_data_size )
+			{
+				break;
+			}
+			attribute_index++;
+
+			if( libfsntfs_mft_attribute_get_next_attribute(
+			     data_attribute,
+			     &data_attribute,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve next MFT attribute: %d.",
+				 function,
+				 attribute_index );
+
+				return( -1 );
+			}
+		}
+	}
+	if( (size64_t) extent_offset < data_size )
+	{
+		if( libfsntfs_extent_data_handle_append_extent(
+		     data_handle,
+		     0,
+		     data_size - extent_offset,
+		     LIBFDATA_RANGE_FLAG_IS_SPARSE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append sparse extent.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of extents
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_extent_data_handle_get_number_of_extents(
+     libfsntfs_extent_data_handle_t *data_handle,
+     int *number_of_extents,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_extent_data_handle_get_number_of_extents";
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_extents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of extents.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_extents = data_handle->number_of_extents;
+
+	return( 1 );
+}
+
+/* Retrieves a specific extent
+ * The extent offset is the offset of the extent in the data
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_extent_data_handle_get_extent_by_index(
+     libfsntfs_extent_data_handle_t *data_handle,
+     int extent_index,
+     off64_t *extent_offset,
+     size64_t *extent_size,
+     uint32_t *extent_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_extent_data_handle_get_extent_by_index";
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( extent_index < 0 )
+	 || ( extent_index >= data_handle->number_of_extents ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid extent index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent size.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent flags.",
+		 function );
+
+		return( -1 );
+	}
+	*extent_offset = data_handle->extent_offsets[ extent_index ];
+	*extent_size   = data_handle->extents[ extent_index ].size;
+	*extent_flags  = data_handle->extents[ extent_index ].range_flags;
+
+	return( 1 );
+}
+
+/* Retrieves the index of the extent that contains a specific offset
+ * The extent of the previous lookup and the one that follows it are checked first,
+ * otherwise the extent offsets are searched using a binary search
+ * Returns 1 if successful, 0 if the offset is beyond the last extent or -1 on error
+ */
+int libfsntfs_extent_data_handle_get_extent_index_at_offset(
+     libfsntfs_extent_data_handle_t *data_handle,
+     off64_t offset,
+     int *extent_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_extent_data_handle_get_extent_index_at_offset";
+	int lower_index       = 0;
+	int middle_index      = 0;
+	int safe_extent_index = 0;
+	int upper_index       = 0;
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent index.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) offset >= data_handle->data_size )
+	{
+		return( 0 );
+	}
+	safe_extent_index = data_handle->last_extent_index;
+
+	if( ( safe_extent_index < 0 )
+	 || ( safe_extent_index >= data_handle->number_of_extents )
+	 || ( offset < data_handle->extent_offsets[ safe_extent_index ] ) )
+	{
+		safe_extent_index = -1;
+	}
+	else if( (size64_t) ( offset - data_handle->extent_offsets[ safe_extent_index ] ) >= data_handle->extents[ safe_extent_index ].size )
+	{
+		/* Sequential access typically continues in the next extent
+		 */
+		safe_extent_index += 1;
+
+		if( ( safe_extent_index >= data_handle->number_of_extents )
+		 || ( (size64_t) ( offset - data_handle->extent_offsets[ safe_extent_index ] ) >= data_handle->extents[ safe_extent_index ].size ) )
+		{
+			safe_extent_index = -1;
+		}
+	}
+	if( safe_extent_index == -1 )
+	{
+		/* Find the last extent that starts at or before the offset
+		 */
+		lower_index = 0;
+		upper_index = data_handle->number_of_extents;
+
+		while( ( upper_index - lower_index ) > 1 )
+		{
+			middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+			if( offset < data_handle->extent_offsets[ middle_index ] )
+			{
+				upper_index = middle_index;
+			}
+			else
+			{
+				lower_index = middle_index;
+			}
+		}
+		safe_extent_index = lower_index;
+	}
+	data_handle->last_extent_index = safe_extent_index;
+
+	*extent_index = safe_extent_index;
+
+	return( 1 );
+}
+
+/* Retrieves the extent that contains a specific offset
+ * Returns 1 if successful, 0 if the offset is beyond the last extent or -1 on error
+ */
+int libfsntfs_extent_data_handle_get_extent_at_offset(
+     libfsntfs_extent_data_handle_t *data_handle,
+     off64_t offset,
+     int *extent_index,
+     off64_t *extent_offset,
+     size64_t *extent_size,
+     uint32_t *extent_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_extent_data_handle_get_extent_at_offset";
+	int safe_extent_index = 0;
+	int result            = 0;
+
+	if( extent_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent index.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsntfs_extent_data_handle_get_extent_index_at_offset(
+	          data_handle,
+	          offset,
+	          &safe_extent_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve extent index at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libfsntfs_extent_data_handle_get_extent_by_index(
+		     data_handle,
+		     safe_extent_index,
+		     extent_offset,
+		     extent_size,
+		     extent_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent: %d.",
+			 function,
+			 safe_extent_index );
+
+			return( -1 );
+		}
+		*extent_index = safe_extent_index;
+	}
+	return( result );
+}
+
+/* Reads data from the current offset into a buffer
+ * Callback for the data stream
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsntfs_extent_data_handle_read_segment_data(
+         libfsntfs_extent_data_handle_t *data_handle,
+         libbfio_handle_t *file_io_handle,
+         int segment_index LIBFSNTFS_ATTRIBUTE_UNUSED,
+         int segment_file_index LIBFSNTFS_ATTRIBUTE_UNUSED,
+         uint8_t *segment_data,
+         size_t segment_data_size,
+         uint32_t segment_flags LIBFSNTFS_ATTRIBUTE_UNUSED,
+         uint8_t read_flags LIBFSNTFS_ATTRIBUTE_UNUSED,
+         libcerror_error_t **error )
+{
+	libfsntfs_data_extent_t *extent = NULL;
+	static char *function           = "libfsntfs_extent_data_handle_read_segment_data";
+	size64_t extent_relative_offset = 0;
+	size_t read_size                = 0;
+	size_t segment_data_offset      = 0;
+	ssize_t read_count              = 0;
+	int extent_index                = 0;
+	int result                      = 0;
+
+	LIBFSNTFS_UNREFERENCED_PARAMETER( segment_index )
+	LIBFSNTFS_UNREFERENCED_PARAMETER( segment_file_index )
+	LIBFSNTFS_UNREFERENCED_PARAMETER( segment_flags )
+	LIBFSNTFS_UNREFERENCED_PARAMETER( read_flags )
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_handle->current_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data handle - current offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment data.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid segment data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( segment_data_size > 0 )
+	{
+		result = libfsntfs_extent_data_handle_get_extent_index_at_offset(
+		          data_handle,
+		          data_handle->current_offset,
+		          &extent_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent index at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 data_handle->current_offset,
+			 data_handle->current_offset );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		extent = &( data_handle->extents[ extent_index ] );
+
+		extent_relative_offset = (size64_t) ( data_handle->current_offset - data_handle->extent_offsets[ extent_index ] );
+
+		if( ( extent->size - extent_relative_offset ) > (size64_t) segment_data_size )
+		{
+			read_size = segment_data_size;
+		}
+		else
+		{
+			read_size = (size_t) ( extent->size - extent_relative_offset );
+		}
+		if( ( extent->range_flags & LIBFDATA_RANGE_FLAG_IS_SPARSE ) != 0 )
+		{
+			if( memory_set(
+			     &( segment_data[ segment_data_offset ] ),
+			     0,
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear segment data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			if( libbfio_handle_seek_offset(
+			     file_io_handle,
+			     extent->start_offset + (off64_t) extent_relative_offset,
+			     SEEK_SET,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_SEEK_FAILED,
+				 "%s: unable to seek extent: %d offset: %" PRIu64 ".",
+				 function,
+				 extent_index,
+				 extent_relative_offset );
+
+				return( -1 );
+			}
+			read_count = libbfio_handle_read_buffer(
+			              file_io_handle,
+			              &( segment_data[ segment_data_offset ] ),
+			              read_size,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read extent: %d data.",
+				 function,
+				 extent_index );
+
+				return( -1 );
+			}
+			if( data_handle->io_handle != NULL )
+			{
+				libfsntfs_statistics_add_value(
+				 data_handle->io_handle->statistics,
+				 LIBFSNTFS_STATISTICS_VALUE_DATA_BYTES_READ,
+				 (uint64_t) read_count );
+			}
+		}
+		segment_data_offset += read_size;
+		segment_data_size   -= read_size;
+
+		data_handle->current_offset += read_size;
+	}
+	return( (ssize_t) segment_data_offset );
+}
+
+/* Seeks a certain offset of the data
+ * Callback for the data stream
+ * Returns the offset if seek is successful or -1 on error
+ */
+off64_t libfsntfs_extent_data_handle_seek_segment_offset(
+         libfsntfs_extent_data_handle_t *data_handle,
+         intptr_t *file_io_handle LIBFSNTFS_ATTRIBUTE_UNUSED,
+         int segment_index LIBFSNTFS_ATTRIBUTE_UNUSED,
+         int segment_file_index LIBFSNTFS_ATTRIBUTE_UNUSED,
+         off64_t segment_offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_extent_data_handle_seek_segment_offset";
+
+	LIBFSNTFS_UNREFERENCED_PARAMETER( file_io_handle )
+	LIBFSNTFS_UNREFERENCED_PARAMETER( segment_index )
+	LIBFSNTFS_UNREFERENCED_PARAMETER( segment_file_index )
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	data_handle->current_offset = segment_offset;
+
+	return( segment_offset );
+}
+
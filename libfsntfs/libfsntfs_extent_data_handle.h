@@ -0,0 +1,149 @@
+/*
+ * The extent data handle functions
+ *
+ * Copyright (C) 2010-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSNTFS_EXTENT_DATA_HANDLE_H )
+#define _LIBFSNTFS_EXTENT_DATA_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsntfs_data_extent.h"
+#include "libfsntfs_io_handle.h"
+#include "libfsntfs_libbfio.h"
+#include "libfsntfs_libcerror.h"
+#include "libfsntfs_mft_attribute.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsntfs_extent_data_handle libfsntfs_extent_data_handle_t;
+
+struct libfsntfs_extent_data_handle
+{
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* The data size
+	 */
+	size64_t data_size;
+
+	/* The extents
+	 */
+	libfsntfs_data_extent_t *extents;
+
+	/* The offsets of the extents in the data, which are the prefix sums of the extent sizes
+	 */
+	off64_t *extent_offsets;
+
+	/* The number of extents
+	 */
+	int number_of_extents;
+
+	/* The maximum number of extents
+	 */
+	int maximum_number_of_extents;
+
+	/* The index of the extent of the last lookup, used as a hint for sequential access
+	 */
+	int last_extent_index;
+
+	/* The IO handle, which is set when the data runs are appended
+	 */
+	libfsntfs_io_handle_t *io_handle;
+};
+
+int libfsntfs_extent_data_handle_initialize(
+     libfsntfs_extent_data_handle_t **data_handle,
+     libcerror_error_t **error );
+
+int libfsntfs_extent_data_handle_free(
+     libfsntfs_extent_data_handle_t **data_handle,
+     libcerror_error_t **error );
+
+int libfsntfs_extent_data_handle_append_extent(
+     libfsntfs_extent_data_handle_t *data_handle,
+     off64_t extent_start_offset,
+     size64_t extent_size,
+     uint32_t extent_flags,
+     libcerror_error_t **error );
+
+int libfsntfs_extent_data_handle_append_data_runs(
+     libfsntfs_extent_data_handle_t *data_handle,
+     libfsntfs_io_handle_t *io_handle,
+     libfsntfs_mft_attribute_t *data_attribute,
+     size64_t data_size,
+     libcerror_error_t **error );
+
+int libfsntfs_extent_data_handle_get_number_of_extents(
+     libfsntfs_extent_data_handle_t *data_handle,
+     int *number_of_extents,
+     libcerror_error_t **error );
+
+int libfsntfs_extent_data_handle_get_extent_by_index(
+     libfsntfs_extent_data_handle_t *data_handle,
+     int extent_index,
+     off64_t *extent_offset,
+     size64_t *extent_size,
+     uint32_t *extent_flags,
+     libcerror_error_t **error );
+
+int libfsntfs_extent_data_handle_get_extent_index_at_offset(
+     libfsntfs_extent_data_handle_t *data_handle,
+     off64_t offset,
+     int *extent_index,
+     libcerror_error_t **error );
+
+int libfsntfs_extent_data_handle_get_extent_at_offset(
+     libfsntfs_extent_data_handle_t *data_handle,
+     off64_t offset,
+     int *extent_index,
+     off64_t *extent_offset,
+     size64_t *extent_size,
+     uint32_t *extent_flags,
+     libcerror_error_t **error );
+
+ssize_t libfsntfs_extent_data_handle_read_segment_data(
+         libfsntfs_extent_data_handle_t *data_handle,
+         libbfio_handle_t *file_io_handle,
+         int segment_index,
+         int segment_file_index,
+         uint8_t *segment_data,
+         size_t segment_data_size,
+         uint32_t segment_flags,
+         uint8_t read_flags,
+         libcerror_error_t **error );
+
+off64_t libfsntfs_extent_data_handle_seek_segment_offset(
+         libfsntfs_extent_data_handle_t *data_handle,
+         intptr_t *file_io_handle,
+         int segment_index,
+         int segment_file_index,
+         off64_t segment_offset,
+         libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSNTFS_EXTENT_DATA_HANDLE_H ) */
+
@@ -23,6 +23,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfsntfs_async_read.h"
 #include "libfsntfs_attribute.h"
 #include "libfsntfs_cluster_block_stream.h"
 #include "libfsntfs_data_extent.h"
@@ -60,15 +61,14 @@ int libfsntfs_file_entry_initialize(
      uint8_t flags,
      libcerror_error_t **error )
 {
-	libfsntfs_attribute_t *reparse_point_attribute           = NULL;
-	libfsntfs_internal_file_entry_t *internal_file_entry     = NULL;
-	libfsntfs_mft_attribute_t *data_extents_attribute        = NULL;
-	libfsntfs_mft_attribute_t *wof_compressed_data_attribute = NULL;
-	libfsntfs_mft_entry_t *mft_entry                         = NULL;
-	static char *function                                    = "libfsntfs_file_entry_initialize";
-	uint64_t base_record_file_reference                      = 0;
-	uint32_t compression_method                              = 0;
-	int result                                               = 0;
+	libfsntfs_internal_file_entry_t *internal_file_entry = NULL;
+	libfsntfs_mft_entry_t *mft_entry                     = NULL;
+	uint8_t *resident_data                               = NULL;
+	static char *function                                = "libfsntfs_file_entry_initialize";
+	size64_t data_size                                   = 0;
+	size_t resident_data_size                            = 0;
+	uint64_t base_record_file_reference                  = 0;
+	int result                                           = 0;
 
 	if( file_entry == NULL )
 	{
@@ -145,7 +145,9 @@ int libfsntfs_file_entry_initialize(
 
 		return( -1 );
 	}
-	if( libfsntfs_file_system_get_mft_entry_by_index_no_cache(
+	/* The file entry shares the parsed MFT entry with the MFT entry cache
+	 */
+	if( libfsntfs_file_system_get_shared_mft_entry_by_index(
 	     file_system,
 	     file_io_handle,
 	     mft_entry_index,
@@ -192,124 +194,58 @@ int libfsntfs_file_entry_initialize(
 
 			goto on_error;
 		}
-		if( ( result == 1 )
-		 && ( base_record_file_reference == 0 ) )
+	}
+	/* The directory entries tree and the data extents are only read for a base record
+	 * and are read on first use, so that file entries remain cheap to create
+	 */
+	if( ( result != 1 )
+	 || ( base_record_file_reference != 0 ) )
+	{
+		internal_file_entry->directory_entries_tree_read = 1;
+		internal_file_entry->data_extents_read           = 1;
+	}
+	else if( ( mft_entry->data_attribute != NULL )
+	      && ( mft_entry->wof_compressed_data_attribute == NULL ) )
+	{
+		if( libfsntfs_mft_attribute_get_data_size(
+		     mft_entry->data_attribute,
+		     &data_size,
+		     error ) != 1 )
 		{
-			if( mft_entry->has_i30_index != 0 )
-			{
-				if( libfsntfs_directory_entries_tree_initialize(
-				     &( internal_file_entry->directory_entries_tree ),
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to create directory entries tree.",
-					 function );
-
-					goto on_error;
-				}
-				if( libfsntfs_directory_entries_tree_read_from_i30_index(
-				     internal_file_entry->directory_entries_tree,
-				     io_handle,
-				     file_io_handle,
-				     mft_entry,
-				     flags,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_READ_FAILED,
-					 "%s: unable to read MFT entry: %" PRIu32 " directory entries tree.",
-					 function,
-					 mft_entry->index );
-
-					goto on_error;
-				}
-			}
-			if( mft_entry->data_attribute != NULL )
-			{
-				if( mft_entry->wof_compressed_data_attribute != NULL )
-				{
-					result = libfsntfs_internal_file_entry_get_reparse_point_attribute(
-						  internal_file_entry,
-						  mft_entry,
-						  &reparse_point_attribute,
-						  error );
-
-					if( result == -1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-						 "%s: unable to retrieve reparse point attribute.",
-						 function );
-
-						goto on_error;
-					}
-					else if( result != 0 )
-					{
-						if( libfsntfs_reparse_point_attribute_get_compression_method(
-						     reparse_point_attribute,
-						     &compression_method,
-						     error ) != 1 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-							 "%s: unable to retrieve compression method from $REPARSE_POINT attribute.",
-							 function );
-
-							goto on_error;
-						}
-						wof_compressed_data_attribute = mft_entry->wof_compressed_data_attribute;
-					}
-				}
-				if( wof_compressed_data_attribute == NULL )
-				{
-					data_extents_attribute = mft_entry->data_attribute;
-				}
-				else
-				{
-					data_extents_attribute = wof_compressed_data_attribute;
-				}
-				if( libfsntfs_mft_attribute_get_data_extents_array(
-				     data_extents_attribute,
-				     io_handle,
-				     &( internal_file_entry->extents_array ),
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to create extents array.",
-					 function );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data size.",
+			 function );
 
-					goto on_error;
-				}
-				if( libfsntfs_cluster_block_stream_initialize(
-				     &( internal_file_entry->data_cluster_block_stream ),
-				     io_handle,
-				     mft_entry->data_attribute,
-				     wof_compressed_data_attribute,
-				     compression_method,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to create data cluster block stream.",
-					 function );
+			goto on_error;
+		}
+		if( libfsntfs_mft_attribute_get_data(
+		     mft_entry->data_attribute,
+		     &resident_data,
+		     &resident_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve resident data.",
+			 function );
 
-					goto on_error;
-				}
-			}
+			goto on_error;
+		}
+		/* Resident and empty data is read directly from the shared MFT entry
+		 * without creating a data cluster block stream
+		 */
+		if( ( ( resident_data != NULL )
+		  || ( data_size == 0 ) )
+		 && ( data_size == (size64_t) resident_data_size ) )
+		{
+			internal_file_entry->resident_data      = resident_data;
+			internal_file_entry->resident_data_size = resident_data_size;
+			internal_file_entry->use_resident_data  = 1;
 		}
 	}
 #if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
@@ -348,25 +284,6 @@ on_error:
 	}
 	if( internal_file_entry != NULL )
 	{
-		if( internal_file_entry->data_cluster_block_stream != NULL )
-		{
-			libfdata_stream_free(
-			 &( internal_file_entry->data_cluster_block_stream ),
-			 NULL );
-		}
-		if( internal_file_entry->directory_entries_tree != NULL )
-		{
-			libfsntfs_directory_entries_tree_free(
-			 &( internal_file_entry->directory_entries_tree ),
-			 NULL );
-		}
-		if( internal_file_entry->extents_array != NULL )
-		{
-			libcdata_array_free(
-			 &( internal_file_entry->extents_array ),
-			 (int (*)(intptr_t **, libcerror_error_t **)) &libfsntfs_data_extent_free,
-			 NULL );
-		}
 		memory_free(
 		 internal_file_entry );
 	}
@@ -466,6 +383,22 @@ int libfsntfs_file_entry_free(
 
 			result = -1;
 		}
+		if( internal_file_entry->extents_index != NULL )
+		{
+			if( libfsntfs_extent_data_handle_free(
+			     &( internal_file_entry->extents_index ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free extents index.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( internal_file_entry->security_descriptor_values != NULL )
 		{
 			if( libfsntfs_security_descriptor_values_free(
@@ -1156,19 +1089,17 @@ int libfsntfs_internal_file_entry_get_standard_information_attribute(
 	return( 1 );
 }
 
-/* Retrieves the file reference
+/* Reads the directory entries tree from the $I30 index on first use
+ * The caller is responsible for holding the read/write lock for writing
  * Returns 1 if successful or -1 on error
  */
-int libfsntfs_file_entry_get_file_reference(
-     libfsntfs_file_entry_t *file_entry,
-     uint64_t *file_reference,
+int libfsntfs_internal_file_entry_read_directory_entries_tree(
+     libfsntfs_internal_file_entry_t *internal_file_entry,
      libcerror_error_t **error )
 {
-	libfsntfs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                                = "libfsntfs_file_entry_get_file_reference";
-	int result                                           = 1;
+	static char *function = "libfsntfs_internal_file_entry_read_directory_entries_tree";
 
-	if( file_entry == NULL )
+	if( internal_file_entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1179,99 +1110,86 @@ int libfsntfs_file_entry_get_file_reference(
 
 		return( -1 );
 	}
-	internal_file_entry = (libfsntfs_internal_file_entry_t *) file_entry;
-
-	if( file_reference == NULL )
+	if( internal_file_entry->mft_entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file reference.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing MFT entry.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file_entry->read_write_lock,
-	     error ) != 1 )
+	if( internal_file_entry->directory_entries_tree_read != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
-		 function );
-
-		return( -1 );
+		return( 1 );
 	}
-#endif
-	if( internal_file_entry->directory_entry != NULL )
+	if( internal_file_entry->mft_entry->has_i30_index != 0 )
 	{
-		if( libfsntfs_directory_entry_get_file_reference(
-		     internal_file_entry->directory_entry,
-		     file_reference,
+		if( libfsntfs_directory_entries_tree_initialize(
+		     &( internal_file_entry->directory_entries_tree ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve reference from directory entry.",
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create directory entries tree.",
 			 function );
 
-			result = -1;
+			goto on_error;
 		}
-	}
-	else
-	{
-		if( libfsntfs_mft_entry_get_file_reference(
+		if( libfsntfs_directory_entries_tree_read_from_i30_index(
+		     internal_file_entry->directory_entries_tree,
+		     internal_file_entry->io_handle,
+		     internal_file_entry->file_io_handle,
 		     internal_file_entry->mft_entry,
-		     file_reference,
+		     internal_file_entry->flags,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve file reference from MFT entry.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read MFT entry: %" PRIu32 " directory entries tree.",
+			 function,
+			 internal_file_entry->mft_entry->index );
 
-			result = -1;
+			goto on_error;
 		}
 	}
-#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file_entry->read_write_lock,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
+	internal_file_entry->directory_entries_tree_read = 1;
 
-		return( -1 );
+	return( 1 );
+
+on_error:
+	if( internal_file_entry->directory_entries_tree != NULL )
+	{
+		libfsntfs_directory_entries_tree_free(
+		 &( internal_file_entry->directory_entries_tree ),
+		 NULL );
 	}
-#endif
-	return( result );
+	return( -1 );
 }
 
-/* Retrieves the base record file reference
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Reads the data extents array and creates the data cluster block stream on first use
+ * The caller is responsible for holding the read/write lock for writing
+ * Returns 1 if successful or -1 on error
  */
-int libfsntfs_file_entry_get_base_record_file_reference(
-     libfsntfs_file_entry_t *file_entry,
-     uint64_t *file_reference,
+int libfsntfs_internal_file_entry_read_data_extents(
+     libfsntfs_internal_file_entry_t *internal_file_entry,
      libcerror_error_t **error )
 {
-	libfsntfs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                                = "libfsntfs_file_entry_get_base_record_file_reference";
-	int result                                           = 1;
+	libfsntfs_attribute_t *reparse_point_attribute           = NULL;
+	libfsntfs_mft_attribute_t *data_extents_attribute        = NULL;
+	libfsntfs_mft_attribute_t *wof_compressed_data_attribute = NULL;
+	libfsntfs_mft_entry_t *mft_entry                         = NULL;
+	static char *function                                    = "libfsntfs_internal_file_entry_read_data_extents";
+	uint32_t compression_method                              = 0;
+	int result                                               = 0;
 
-	if( file_entry == NULL )
+	if( internal_file_entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1282,71 +1200,165 @@ int libfsntfs_file_entry_get_base_record_file_reference(
 
 		return( -1 );
 	}
-	internal_file_entry = (libfsntfs_internal_file_entry_t *) file_entry;
-
-#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file_entry->read_write_lock,
-	     error ) != 1 )
+	if( internal_file_entry->mft_entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing MFT entry.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	result = libfsntfs_mft_entry_get_base_record_file_reference(
-	          internal_file_entry->mft_entry,
-	          file_reference,
-	          error );
-
-	if( result == -1 )
+	if( internal_file_entry->data_extents_read != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve base record file reference from MFT entry.",
-		 function );
-
-		result = -1;
+		return( 1 );
 	}
-#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file_entry->read_write_lock,
-	     error ) != 1 )
+	mft_entry = internal_file_entry->mft_entry;
+
+	if( mft_entry->data_attribute != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
+		if( mft_entry->wof_compressed_data_attribute != NULL )
+		{
+			result = libfsntfs_internal_file_entry_get_reparse_point_attribute(
+				  internal_file_entry,
+				  mft_entry,
+				  &reparse_point_attribute,
+				  error );
 
-		return( -1 );
-	}
-#endif
-	return( result );
-}
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve reparse point attribute.",
+				 function );
 
-/* Retrieves the parent file reference
- * This value is retrieved from the directory entry $FILE_NAME attribute
- * Returns 1 if successful, 0 if not available or -1 on error
- */
-int libfsntfs_file_entry_get_parent_file_reference(
-     libfsntfs_file_entry_t *file_entry,
-     uint64_t *parent_file_reference,
-     libcerror_error_t **error )
-{
-	libfsntfs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                                = "libfsntfs_file_entry_get_parent_file_reference";
-	int result                                           = 1;
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				if( libfsntfs_reparse_point_attribute_get_compression_method(
+				     reparse_point_attribute,
+				     &compression_method,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve compression method from $REPARSE_POINT attribute.",
+					 function );
 
-	if( file_entry == NULL )
+					goto on_error;
+				}
+				wof_compressed_data_attribute = mft_entry->wof_compressed_data_attribute;
+			}
+		}
+		if( wof_compressed_data_attribute == NULL )
+		{
+			data_extents_attribute = mft_entry->data_attribute;
+		}
+		else
+		{
+			data_extents_attribute = wof_compressed_data_attribute;
+		}
+		if( libfsntfs_mft_attribute_get_data_extents_array(
+		     data_extents_attribute,
+		     internal_file_entry->io_handle,
+		     &( internal_file_entry->extents_array ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create extents array.",
+			 function );
+
+			goto on_error;
+		}
+		/* The extents of a WOF compressed data stream do not map onto the uncompressed data
+		 */
+		if( wof_compressed_data_attribute == NULL )
+		{
+			if( libfsntfs_cluster_block_stream_initialize_extents_index(
+			     &( internal_file_entry->extents_index ),
+			     internal_file_entry->io_handle,
+			     mft_entry->data_attribute,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create extents index.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libfsntfs_cluster_block_stream_initialize(
+		     &( internal_file_entry->data_cluster_block_stream ),
+		     internal_file_entry->io_handle,
+		     mft_entry->data_attribute,
+		     wof_compressed_data_attribute,
+		     compression_method,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create data cluster block stream.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_file_entry->data_extents_read = 1;
+
+	return( 1 );
+
+on_error:
+	if( internal_file_entry->data_cluster_block_stream != NULL )
+	{
+		libfdata_stream_free(
+		 &( internal_file_entry->data_cluster_block_stream ),
+		 NULL );
+	}
+	if( internal_file_entry->extents_index != NULL )
+	{
+		libfsntfs_extent_data_handle_free(
+		 &( internal_file_entry->extents_index ),
+		 NULL );
+	}
+	if( internal_file_entry->extents_array != NULL )
+	{
+		libcdata_array_free(
+		 &( internal_file_entry->extents_array ),
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsntfs_data_extent_free,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads data at the current offset from the resident data of the default data stream
+ * The caller is responsible for holding the read/write lock for writing
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsntfs_internal_file_entry_read_resident_data(
+         libfsntfs_internal_file_entry_t *internal_file_entry,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_internal_file_entry_read_resident_data";
+	size_t read_size      = 0;
+
+	if( internal_file_entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1357,67 +1369,148 @@ int libfsntfs_file_entry_get_parent_file_reference(
 
 		return( -1 );
 	}
-	internal_file_entry = (libfsntfs_internal_file_entry_t *) file_entry;
-
-#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file_entry->read_write_lock,
-	     error ) != 1 )
+	if( internal_file_entry->resident_data_offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file entry - resident data offset value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	if( libfsntfs_directory_entry_get_parent_file_reference(
-	     internal_file_entry->directory_entry,
-	     parent_file_reference,
-	     error ) != 1 )
+	if( buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve parent reference from directory entry.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
 		 function );
 
-		result = -1;
+		return( -1 );
 	}
-#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file_entry->read_write_lock,
-	     error ) != 1 )
+	if( buffer_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	return( result );
+	if( (size64_t) internal_file_entry->resident_data_offset >= (size64_t) internal_file_entry->resident_data_size )
+	{
+		return( 0 );
+	}
+	read_size = internal_file_entry->resident_data_size - (size_t) internal_file_entry->resident_data_offset;
+
+	if( read_size > buffer_size )
+	{
+		read_size = buffer_size;
+	}
+	if( memory_copy(
+	     buffer,
+	     &( internal_file_entry->resident_data[ internal_file_entry->resident_data_offset ] ),
+	     read_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy resident data.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry->resident_data_offset += (off64_t) read_size;
+
+	return( (ssize_t) read_size );
 }
 
-/* Retrieves the parent file reference for a specific $FILE_NAME attribute
+/* Seeks a certain offset in the resident data of the default data stream
+ * The caller is responsible for holding the read/write lock for writing
+ * Returns the offset if seek is successful or -1 on error
+ */
+off64_t libfsntfs_internal_file_entry_seek_resident_data_offset(
+         libfsntfs_internal_file_entry_t *internal_file_entry,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_internal_file_entry_seek_resident_data_offset";
+
+	if( internal_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET )
+	 && ( whence != LIBFSNTFS_SEEK_DATA )
+	 && ( whence != LIBFSNTFS_SEEK_HOLE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += internal_file_entry->resident_data_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) internal_file_entry->resident_data_size;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Resident data has no sparse ranges other than the one at the end of the data
+	 * and an offset at or beyond the end of the data is kept
+	 */
+	if( ( whence == LIBFSNTFS_SEEK_HOLE )
+	 && ( (size64_t) offset < internal_file_entry->resident_data_size ) )
+	{
+		offset = (off64_t) internal_file_entry->resident_data_size;
+	}
+	internal_file_entry->resident_data_offset = offset;
+
+	return( offset );
+}
+
+/* Retrieves the file reference
  * Returns 1 if successful or -1 on error
  */
-int libfsntfs_file_entry_get_parent_file_reference_by_attribute_index(
+int libfsntfs_file_entry_get_file_reference(
      libfsntfs_file_entry_t *file_entry,
-     int attribute_index,
-     uint64_t *parent_file_reference,
+     uint64_t *file_reference,
      libcerror_error_t **error )
 {
-	libfsntfs_attribute_t *attribute                     = NULL;
 	libfsntfs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                                = "libfsntfs_file_entry_get_parent_file_reference_by_attribute_index";
+	static char *function                                = "libfsntfs_file_entry_get_file_reference";
 	int result                                           = 1;
 
 	if( file_entry == NULL )
@@ -1433,6 +1526,17 @@ int libfsntfs_file_entry_get_parent_file_reference_by_attribute_index(
 	}
 	internal_file_entry = (libfsntfs_internal_file_entry_t *) file_entry;
 
+	if( file_reference == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file reference.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file_entry->read_write_lock,
@@ -1448,36 +1552,39 @@ int libfsntfs_file_entry_get_parent_file_reference_by_attribute_index(
 		return( -1 );
 	}
 #endif
-	if( libfsntfs_internal_file_entry_get_attribute_by_index(
-	     internal_file_entry,
-	     internal_file_entry->mft_entry,
-	     attribute_index,
-	     &attribute,
-	     error ) != 1 )
+	if( internal_file_entry->directory_entry != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve attribute: %d.",
-		 function,
-		 attribute_index );
+		if( libfsntfs_directory_entry_get_file_reference(
+		     internal_file_entry->directory_entry,
+		     file_reference,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve reference from directory entry.",
+			 function );
 
-		result = -1;
+			result = -1;
+		}
 	}
-	else if( libfsntfs_file_name_attribute_get_parent_file_reference(
-	          attribute,
-	          parent_file_reference,
-	          error ) != 1 )
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve parent reference from $FILE_NAME attribute.",
-		 function );
+		if( libfsntfs_mft_entry_get_file_reference(
+		     internal_file_entry->mft_entry,
+		     file_reference,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file reference from MFT entry.",
+			 function );
 
-		result = -1;
+			result = -1;
+		}
 	}
 #if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
@@ -1497,16 +1604,16 @@ int libfsntfs_file_entry_get_parent_file_reference_by_attribute_index(
 	return( result );
 }
 
-/* Retrieves the journal sequence number
- * Returns 1 if successful or -1 on error
+/* Retrieves the base record file reference
+ * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libfsntfs_file_entry_get_journal_sequence_number(
+int libfsntfs_file_entry_get_base_record_file_reference(
      libfsntfs_file_entry_t *file_entry,
-     uint64_t *journal_sequence_number,
+     uint64_t *file_reference,
      libcerror_error_t **error )
 {
 	libfsntfs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                                = "libfsntfs_file_entry_get_journal_sequence_number";
+	static char *function                                = "libfsntfs_file_entry_get_base_record_file_reference";
 	int result                                           = 1;
 
 	if( file_entry == NULL )
@@ -1537,8 +1644,246 @@ int libfsntfs_file_entry_get_journal_sequence_number(
 		return( -1 );
 	}
 #endif
-	if( libfsntfs_mft_entry_get_journal_sequence_number(
-	     internal_file_entry->mft_entry,
+	result = libfsntfs_mft_entry_get_base_record_file_reference(
+	          internal_file_entry->mft_entry,
+	          file_reference,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve base record file reference from MFT entry.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the parent file reference
+ * This value is retrieved from the directory entry $FILE_NAME attribute
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsntfs_file_entry_get_parent_file_reference(
+     libfsntfs_file_entry_t *file_entry,
+     uint64_t *parent_file_reference,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                                = "libfsntfs_file_entry_get_parent_file_reference";
+	int result                                           = 1;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsntfs_internal_file_entry_t *) file_entry;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsntfs_directory_entry_get_parent_file_reference(
+	     internal_file_entry->directory_entry,
+	     parent_file_reference,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve parent reference from directory entry.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the parent file reference for a specific $FILE_NAME attribute
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_file_entry_get_parent_file_reference_by_attribute_index(
+     libfsntfs_file_entry_t *file_entry,
+     int attribute_index,
+     uint64_t *parent_file_reference,
+     libcerror_error_t **error )
+{
+	libfsntfs_attribute_t *attribute                     = NULL;
+	libfsntfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                                = "libfsntfs_file_entry_get_parent_file_reference_by_attribute_index";
+	int result                                           = 1;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsntfs_internal_file_entry_t *) file_entry;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsntfs_internal_file_entry_get_attribute_by_index(
+	     internal_file_entry,
+	     internal_file_entry->mft_entry,
+	     attribute_index,
+	     &attribute,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve attribute: %d.",
+		 function,
+		 attribute_index );
+
+		result = -1;
+	}
+	else if( libfsntfs_file_name_attribute_get_parent_file_reference(
+	          attribute,
+	          parent_file_reference,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve parent reference from $FILE_NAME attribute.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the journal sequence number
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_file_entry_get_journal_sequence_number(
+     libfsntfs_file_entry_t *file_entry,
+     uint64_t *journal_sequence_number,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                                = "libfsntfs_file_entry_get_journal_sequence_number";
+	int result                                           = 1;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsntfs_internal_file_entry_t *) file_entry;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsntfs_mft_entry_get_journal_sequence_number(
+	     internal_file_entry->mft_entry,
 	     journal_sequence_number,
 	     error ) != 1 )
 	{
@@ -5366,7 +5711,7 @@ int libfsntfs_file_entry_get_number_of_sub_file_entries(
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -5374,13 +5719,26 @@ int libfsntfs_file_entry_get_number_of_sub_file_entries(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( internal_file_entry->directory_entries_tree != NULL )
+	if( libfsntfs_internal_file_entry_read_directory_entries_tree(
+	     internal_file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read directory entries tree.",
+		 function );
+
+		result = -1;
+	}
+	else if( internal_file_entry->directory_entries_tree != NULL )
 	{
 		if( libfsntfs_directory_entries_tree_get_number_of_entries(
 		     internal_file_entry->directory_entries_tree,
@@ -5398,7 +5756,7 @@ int libfsntfs_file_entry_get_number_of_sub_file_entries(
 		}
 	}
 #if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_release_for_write(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -5406,7 +5764,7 @@ int libfsntfs_file_entry_get_number_of_sub_file_entries(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
@@ -5432,6 +5790,7 @@ int libfsntfs_file_entry_get_sub_file_entry_by_index(
 	libfsntfs_internal_file_entry_t *internal_file_entry = NULL;
 	static char *function                                = "libfsntfs_file_entry_get_sub_file_entry_by_index";
 	uint64_t mft_entry_index                             = 0;
+	int result                                           = 0;
 
 	if( file_entry == NULL )
 	{
@@ -5466,6 +5825,55 @@ int libfsntfs_file_entry_get_sub_file_entry_by_index(
 		 "%s: invalid sub file entry value already set.",
 		 function );
 
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfsntfs_internal_file_entry_read_directory_entries_tree(
+	          internal_file_entry,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read directory entries tree.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result != 1 )
+	{
 		return( -1 );
 	}
 /* TODO add thread lock suport */
@@ -5585,6 +5993,55 @@ int libfsntfs_file_entry_get_sub_file_entry_by_utf8_name(
 		 "%s: invalid sub file entry value already set.",
 		 function );
 
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfsntfs_internal_file_entry_read_directory_entries_tree(
+	          internal_file_entry,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read directory entries tree.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result != 1 )
+	{
 		return( -1 );
 	}
 /* TODO add thread lock suport */
@@ -5709,6 +6166,55 @@ int libfsntfs_file_entry_get_sub_file_entry_by_utf16_name(
 		 "%s: invalid sub file entry value already set.",
 		 function );
 
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfsntfs_internal_file_entry_read_directory_entries_tree(
+	          internal_file_entry,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read directory entries tree.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result != 1 )
+	{
 		return( -1 );
 	}
 /* TODO add thread lock suport */
@@ -5770,31 +6276,451 @@ int libfsntfs_file_entry_get_sub_file_entry_by_utf16_name(
 		 function,
 		 mft_entry_index );
 
-		goto on_error;
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( sub_directory_entry != NULL )
+	{
+		libfsntfs_directory_entry_free(
+		 &sub_directory_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads data at the current offset from the default data stream (nameless $DATA attribute)
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsntfs_file_entry_read_buffer(
+         libfsntfs_file_entry_t *file_entry,
+         void *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libfsntfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                                = "libfsntfs_file_entry_read_buffer";
+	ssize_t read_count                                   = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsntfs_internal_file_entry_t *) file_entry;
+
+	if( internal_file_entry->data_attribute == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing data attribute.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file_entry->use_resident_data != 0 )
+	{
+		read_count = libfsntfs_internal_file_entry_read_resident_data(
+		              internal_file_entry,
+		              (uint8_t *) buffer,
+		              buffer_size,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from resident data.",
+			 function );
+
+			read_count = -1;
+		}
+	}
+	else if( libfsntfs_internal_file_entry_read_data_extents(
+	          internal_file_entry,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data extents.",
+		 function );
+
+		read_count = -1;
+	}
+	else
+	{
+		read_count = libfdata_stream_read_buffer(
+		              internal_file_entry->data_cluster_block_stream,
+		              (intptr_t *) internal_file_entry->file_io_handle,
+		              buffer,
+		              buffer_size,
+		              0,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from data cluster block stream.",
+			 function );
+
+			read_count = -1;
+		}
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+}
+
+/* Reads data at a specific offset from the default data stream (nameless $DATA attribute)
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsntfs_file_entry_read_buffer_at_offset(
+         libfsntfs_file_entry_t *file_entry,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libfsntfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                                = "libfsntfs_file_entry_read_buffer_at_offset";
+	ssize_t read_count                                   = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsntfs_internal_file_entry_t *) file_entry;
+
+	if( internal_file_entry->data_attribute == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing data attribute.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file_entry->use_resident_data != 0 )
+	{
+		if( libfsntfs_internal_file_entry_seek_resident_data_offset(
+		     internal_file_entry,
+		     offset,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek offset in resident data.",
+			 function );
+
+			read_count = -1;
+		}
+		else
+		{
+			read_count = libfsntfs_internal_file_entry_read_resident_data(
+			              internal_file_entry,
+			              (uint8_t *) buffer,
+			              buffer_size,
+			              error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read from resident data.",
+				 function );
+
+				read_count = -1;
+			}
+		}
+	}
+	else if( libfsntfs_internal_file_entry_read_data_extents(
+	          internal_file_entry,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data extents.",
+		 function );
+
+		read_count = -1;
+	}
+	else
+	{
+		if( libfdata_stream_seek_offset(
+		     internal_file_entry->data_cluster_block_stream,
+		     offset,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek offset in data cluster block stream.",
+			 function );
+
+			read_count = -1;
+		}
+		else
+		{
+			read_count = libfdata_stream_read_buffer(
+			              internal_file_entry->data_cluster_block_stream,
+			              (intptr_t *) internal_file_entry->file_io_handle,
+			              buffer,
+			              buffer_size,
+			              0,
+			              error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read from data cluster block stream.",
+				 function );
+
+				read_count = -1;
+			}
+		}
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+}
+
+/* Reads data at a specific offset from the default data stream (nameless $DATA attribute)
+ * without blocking the calling thread
+ * The read is executed by a thread pool of the volume, which is created on first use with
+ * the number of read threads of the volume. Reads of the same file entry are executed one
+ * after the other, reads of different file entries run concurrently.
+ * The callback function is called with the number of bytes read, or -1 on error, from the
+ * thread that executed the read. The file entry and buffer must remain available until
+ * the callback function has been called. Closing the volume waits for pending reads.
+ * The current offset of the file entry is changed by the read.
+ * Without multi-threading support the read is executed on the calling thread and the
+ * callback function is called before this function returns
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_file_entry_read_buffer_at_offset_async(
+     libfsntfs_file_entry_t *file_entry,
+     void *buffer,
+     size_t buffer_size,
+     off64_t offset,
+     void (*callback_function)(
+            libfsntfs_file_entry_t *file_entry,
+            void *buffer,
+            ssize_t read_count,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libfsntfs_async_read_t *async_read                   = NULL;
+	libfsntfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                                = "libfsntfs_file_entry_read_buffer_at_offset_async";
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsntfs_internal_file_entry_t *) file_entry;
+
+	if( internal_file_entry->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file_entry->data_attribute == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing data attribute.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsntfs_async_read_initialize(
+	     &async_read,
+	     file_entry,
+	     buffer,
+	     buffer_size,
+	     offset,
+	     callback_function,
+	     callback_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create asynchronous read.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libfsntfs_file_system_push_async_read(
+	     internal_file_entry->file_system,
+	     internal_file_entry->io_handle->number_of_read_threads,
+	     async_read,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push asynchronous read.",
+		 function );
+
+		goto on_error;
+	}
+#else
+	if( libfsntfs_async_read_execute(
+	     async_read,
+	     NULL ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to execute asynchronous read.",
+		 function );
+
+		return( -1 );
 	}
+#endif /* defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT ) */
+
 	return( 1 );
 
 on_error:
-	if( sub_directory_entry != NULL )
+	if( async_read != NULL )
 	{
-		libfsntfs_directory_entry_free(
-		 &sub_directory_entry,
+		libfsntfs_async_read_free(
+		 &async_read,
 		 NULL );
 	}
 	return( -1 );
 }
 
-/* Reads data at the current offset from the default data stream (nameless $DATA attribute)
- * Returns the number of bytes read or -1 on error
+/* Reads a chunk of data at a specific offset from the default data stream (nameless $DATA attribute)
+ * The chunk ends at the next multiple of the buffer size or where a sparse range starts or ends
+ * If the chunk is sparse the buffer is not filled and the chunk consists of 0-byte values
+ * Returns the size of the chunk, 0 if no more data or -1 on error
  */
-ssize_t libfsntfs_file_entry_read_buffer(
+ssize_t libfsntfs_file_entry_read_chunk_at_offset(
          libfsntfs_file_entry_t *file_entry,
          void *buffer,
          size_t buffer_size,
+         off64_t offset,
+         uint8_t *is_sparse,
          libcerror_error_t **error )
 {
 	libfsntfs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                                = "libfsntfs_file_entry_read_buffer";
+	static char *function                                = "libfsntfs_file_entry_read_chunk_at_offset";
+	size_t chunk_size                                    = 0;
 	ssize_t read_count                                   = 0;
 
 	if( file_entry == NULL )
@@ -5821,92 +6747,47 @@ ssize_t libfsntfs_file_entry_read_buffer(
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_file_entry->read_write_lock,
-	     error ) != 1 )
+	if( buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	read_count = libfdata_stream_read_buffer(
-	              internal_file_entry->data_cluster_block_stream,
-	              (intptr_t *) internal_file_entry->file_io_handle,
-	              buffer,
-	              buffer_size,
-	              0,
-	              error );
-
-	if( read_count < 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read from data cluster block stream.",
-		 function );
-
-		read_count = -1;
-	}
-#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_file_entry->read_write_lock,
-	     error ) != 1 )
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) SSIZE_MAX ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	return( read_count );
-}
-
-/* Reads data at a specific offset from the default data stream (nameless $DATA attribute)
- * Returns the number of bytes read or -1 on error
- */
-ssize_t libfsntfs_file_entry_read_buffer_at_offset(
-         libfsntfs_file_entry_t *file_entry,
-         void *buffer,
-         size_t buffer_size,
-         off64_t offset,
-         libcerror_error_t **error )
-{
-	libfsntfs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                                = "libfsntfs_file_entry_read_buffer_at_offset";
-	ssize_t read_count                                   = 0;
-
-	if( file_entry == NULL )
+	if( offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file entry.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file_entry = (libfsntfs_internal_file_entry_t *) file_entry;
-
-	if( internal_file_entry->data_attribute == NULL )
+	if( is_sparse == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file entry - missing data attribute.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid is sparse.",
 		 function );
 
 		return( -1 );
@@ -5926,29 +6807,70 @@ ssize_t libfsntfs_file_entry_read_buffer_at_offset(
 		return( -1 );
 	}
 #endif
-	if( libfdata_stream_seek_offset(
-	     internal_file_entry->data_cluster_block_stream,
-	     offset,
-	     SEEK_SET,
-	     error ) == -1 )
+	if( internal_file_entry->use_resident_data != 0 )
+	{
+		*is_sparse = 0;
+		chunk_size = buffer_size - (size_t) ( (size64_t) offset % buffer_size );
+
+		if( libfsntfs_internal_file_entry_seek_resident_data_offset(
+		     internal_file_entry,
+		     offset,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek offset in resident data.",
+			 function );
+
+			read_count = -1;
+		}
+		else
+		{
+			read_count = libfsntfs_internal_file_entry_read_resident_data(
+			              internal_file_entry,
+			              (uint8_t *) buffer,
+			              chunk_size,
+			              error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read from resident data.",
+				 function );
+
+				read_count = -1;
+			}
+		}
+	}
+	else if( libfsntfs_internal_file_entry_read_data_extents(
+	          internal_file_entry,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset in data cluster block stream.",
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data extents.",
 		 function );
 
 		read_count = -1;
 	}
 	else
 	{
-		read_count = libfdata_stream_read_buffer(
+		read_count = libfsntfs_cluster_block_stream_read_chunk_at_offset(
 		              internal_file_entry->data_cluster_block_stream,
-		              (intptr_t *) internal_file_entry->file_io_handle,
-		              buffer,
+		              internal_file_entry->file_io_handle,
+		              internal_file_entry->extents_index,
+		              (uint8_t *) buffer,
 		              buffer_size,
-		              0,
+		              offset,
+		              is_sparse,
 		              error );
 
 		if( read_count < 0 )
@@ -5957,7 +6879,7 @@ ssize_t libfsntfs_file_entry_read_buffer_at_offset(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read from data cluster block stream.",
+			 "%s: unable to read chunk from data cluster block stream.",
 			 function );
 
 			read_count = -1;
@@ -5982,6 +6904,10 @@ ssize_t libfsntfs_file_entry_read_buffer_at_offset(
 }
 
 /* Seeks a certain offset in the default data stream (nameless $DATA attribute)
+ * Whence can be SEEK_SET, SEEK_CUR, SEEK_END, LIBFSNTFS_SEEK_DATA or LIBFSNTFS_SEEK_HOLE
+ * LIBFSNTFS_SEEK_DATA and LIBFSNTFS_SEEK_HOLE seek the start of the first data or sparse range
+ * at or after the offset, or the end of the data if there is none
+ * An offset at or beyond the end of the data is kept
  * Returns the offset if seek is successful or -1 on error
  */
 off64_t libfsntfs_file_entry_seek_offset(
@@ -6032,23 +6958,83 @@ off64_t libfsntfs_file_entry_seek_offset(
 		return( -1 );
 	}
 #endif
-	offset = libfdata_stream_seek_offset(
-	          internal_file_entry->data_cluster_block_stream,
-	          offset,
-	          whence,
-	          error );
+	if( internal_file_entry->use_resident_data != 0 )
+	{
+		offset = libfsntfs_internal_file_entry_seek_resident_data_offset(
+		          internal_file_entry,
+		          offset,
+		          whence,
+		          error );
+
+		if( offset == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek offset in resident data.",
+			 function );
 
-	if( offset == -1 )
+			offset = -1;
+		}
+	}
+	else if( libfsntfs_internal_file_entry_read_data_extents(
+	          internal_file_entry,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset in data cluster block stream.",
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data extents.",
 		 function );
 
 		offset = -1;
 	}
+	else
+	{
+		if( ( whence == LIBFSNTFS_SEEK_DATA )
+		 || ( whence == LIBFSNTFS_SEEK_HOLE ) )
+		{
+			offset = libfsntfs_cluster_block_stream_get_range_offset(
+			          internal_file_entry->data_cluster_block_stream,
+			          internal_file_entry->extents_index,
+			          offset,
+			          (uint8_t) ( whence == LIBFSNTFS_SEEK_HOLE ),
+			          error );
+
+			if( offset == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine range offset in data cluster block stream.",
+				 function );
+			}
+			whence = SEEK_SET;
+		}
+		if( offset != -1 )
+		{
+			offset = libfdata_stream_seek_offset(
+			          internal_file_entry->data_cluster_block_stream,
+			          offset,
+			          whence,
+			          error );
+
+			if( offset == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_SEEK_FAILED,
+				 "%s: unable to seek offset in data cluster block stream.",
+				 function );
+
+				offset = -1;
+			}
+		}
+	}
 #if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_file_entry->read_write_lock,
@@ -6118,10 +7104,20 @@ int libfsntfs_file_entry_get_offset(
 		return( -1 );
 	}
 #endif
-	if( libfdata_stream_get_offset(
-	     internal_file_entry->data_cluster_block_stream,
-	     offset,
-	     error ) != 1 )
+	/* The data cluster block stream is created on first read or seek
+	 */
+	if( internal_file_entry->use_resident_data != 0 )
+	{
+		*offset = internal_file_entry->resident_data_offset;
+	}
+	else if( internal_file_entry->data_extents_read == 0 )
+	{
+		*offset = 0;
+	}
+	else if( libfdata_stream_get_offset(
+	          internal_file_entry->data_cluster_block_stream,
+	          offset,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -6202,7 +7198,30 @@ int libfsntfs_file_entry_get_size(
 		return( -1 );
 	}
 #endif
-	if( internal_file_entry->data_cluster_block_stream != NULL )
+	/* The size of the data cluster block stream is the data size of the $DATA attribute
+	 * so there is no need to read the data extents to determine the size
+	 */
+	if( internal_file_entry->data_extents_read == 0 )
+	{
+		if( internal_file_entry->data_attribute != NULL )
+		{
+			if( libfsntfs_mft_attribute_get_data_size(
+			     internal_file_entry->data_attribute,
+			     &safe_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve data attribute data size.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+	else if( internal_file_entry->data_cluster_block_stream != NULL )
 	{
 		if( libfdata_stream_get_size(
 		     internal_file_entry->data_cluster_block_stream,
@@ -6279,7 +7298,7 @@ int libfsntfs_file_entry_get_number_of_extents(
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -6287,31 +7306,47 @@ int libfsntfs_file_entry_get_number_of_extents(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( internal_file_entry->extents_array != NULL )
+	if( libfsntfs_internal_file_entry_read_data_extents(
+	     internal_file_entry,
+	     error ) != 1 )
 	{
-		if( libcdata_array_get_number_of_entries(
-		     internal_file_entry->extents_array,
-		     &safe_number_of_extents,
-		     error ) != 1 )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data extents.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		if( internal_file_entry->extents_array != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of extents.",
-			 function );
+			if( libcdata_array_get_number_of_entries(
+			     internal_file_entry->extents_array,
+			     &safe_number_of_extents,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of extents.",
+				 function );
 
-			result = -1;
+				result = -1;
+			}
 		}
 	}
 #if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_release_for_write(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -6319,7 +7354,7 @@ int libfsntfs_file_entry_get_number_of_extents(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
@@ -6362,7 +7397,7 @@ int libfsntfs_file_entry_get_extent_by_index(
 	internal_file_entry = (libfsntfs_internal_file_entry_t *) file_entry;
 
 #if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -6370,47 +7405,63 @@ int libfsntfs_file_entry_get_extent_by_index(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( libcdata_array_get_entry_by_index(
-	     internal_file_entry->extents_array,
-	     extent_index,
-	     (intptr_t **) &data_extent,
+	if( libfsntfs_internal_file_entry_read_data_extents(
+	     internal_file_entry,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve extent: %d.",
-		 function,
-		 extent_index );
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data extents.",
+		 function );
 
 		result = -1;
 	}
-	else if( libfsntfs_data_extent_get_values(
-	          data_extent,
-	          extent_offset,
-	          extent_size,
-	          extent_flags,
-	          error ) != 1 )
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve extent: %d values.",
-		 function,
-		 extent_index );
+		if( libcdata_array_get_entry_by_index(
+		     internal_file_entry->extents_array,
+		     extent_index,
+		     (intptr_t **) &data_extent,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent: %d.",
+			 function,
+			 extent_index );
 
-		result = -1;
+			result = -1;
+		}
+		else if( libfsntfs_data_extent_get_values(
+		          data_extent,
+		          extent_offset,
+		          extent_size,
+		          extent_flags,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent: %d values.",
+			 function,
+			 extent_index );
+
+			result = -1;
+		}
 	}
 #if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_release_for_write(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -6418,7 +7469,7 @@ int libfsntfs_file_entry_get_extent_by_index(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
@@ -27,6 +27,7 @@
 
 #include "libfsntfs_directory_entries_tree.h"
 #include "libfsntfs_directory_entry.h"
+#include "libfsntfs_extent_data_handle.h"
 #include "libfsntfs_extern.h"
 #include "libfsntfs_io_handle.h"
 #include "libfsntfs_file_system.h"
@@ -86,6 +87,10 @@ struct libfsntfs_internal_file_entry
 	 */
 	libcdata_array_t *extents_array;
 
+	/* The extents index of the default data stream
+	 */
+	libfsntfs_extent_data_handle_t *extents_index;
+
 	/* The attributes array
 	 */
 	libcdata_array_t *attributes_array;
@@ -106,6 +111,30 @@ struct libfsntfs_internal_file_entry
 	 */
 	libfdata_stream_t *data_cluster_block_stream;
 
+	/* The resident data of the default (nameless) $DATA attribute
+	 */
+	uint8_t *resident_data;
+
+	/* The resident data size
+	 */
+	size_t resident_data_size;
+
+	/* The current offset in the resident data
+	 */
+	off64_t resident_data_offset;
+
+	/* Value to indicate the directory entries tree was read
+	 */
+	uint8_t directory_entries_tree_read;
+
+	/* Value to indicate the data extents array and cluster block stream were read
+	 */
+	uint8_t data_extents_read;
+
+	/* Value to indicate the default data stream is read directly from the resident data
+	 */
+	uint8_t use_resident_data;
+
 	/* The flags
 	 */
 	uint8_t flags;
@@ -170,6 +199,26 @@ int libfsntfs_internal_file_entry_get_standard_information_attribute(
      libfsntfs_attribute_t **attribute,
      libcerror_error_t **error );
 
+int libfsntfs_internal_file_entry_read_directory_entries_tree(
+     libfsntfs_internal_file_entry_t *internal_file_entry,
+     libcerror_error_t **error );
+
+int libfsntfs_internal_file_entry_read_data_extents(
+     libfsntfs_internal_file_entry_t *internal_file_entry,
+     libcerror_error_t **error );
+
+ssize_t libfsntfs_internal_file_entry_read_resident_data(
+         libfsntfs_internal_file_entry_t *internal_file_entry,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+off64_t libfsntfs_internal_file_entry_seek_resident_data_offset(
+         libfsntfs_internal_file_entry_t *internal_file_entry,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
 LIBFSNTFS_EXTERN \
 int libfsntfs_file_entry_get_file_reference(
      libfsntfs_file_entry_t *file_entry,
@@ -483,6 +532,29 @@ ssize_t libfsntfs_file_entry_read_buffer_at_offset(
          off64_t offset,
          libcerror_error_t **error );
 
+LIBFSNTFS_EXTERN \
+int libfsntfs_file_entry_read_buffer_at_offset_async(
+     libfsntfs_file_entry_t *file_entry,
+     void *buffer,
+     size_t buffer_size,
+     off64_t offset,
+     void (*callback_function)(
+            libfsntfs_file_entry_t *file_entry,
+            void *buffer,
+            ssize_t read_count,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+ssize_t libfsntfs_file_entry_read_chunk_at_offset(
+         libfsntfs_file_entry_t *file_entry,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         uint8_t *is_sparse,
+         libcerror_error_t **error );
+
 LIBFSNTFS_EXTERN \
 off64_t libfsntfs_file_entry_seek_offset(
          libfsntfs_file_entry_t *file_entry,
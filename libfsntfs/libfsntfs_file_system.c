@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfsntfs_async_read.h"
 #include "libfsntfs_cluster_block.h"
 #include "libfsntfs_cluster_block_vector.h"
 #include "libfsntfs_definitions.h"
@@ -40,6 +41,7 @@
 #include "libfsntfs_path_hint.h"
 #include "libfsntfs_security_descriptor_index.h"
 #include "libfsntfs_security_descriptor_values.h"
+#include "libfsntfs_statistics.h"
 
 /* Creates a file system
  * Make sure the value file_system is referencing, is set to NULL
@@ -158,6 +160,24 @@ int libfsntfs_file_system_free(
 	if( *file_system != NULL )
 	{
 #if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+		/* Wait for the pending asynchronous reads before the data they depend on is freed
+		 */
+		if( ( *file_system )->async_read_thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_join(
+			     &( ( *file_system )->async_read_thread_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join asynchronous read thread pool.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( libcthreads_read_write_lock_free(
 		     &( ( *file_system )->read_write_lock ),
 		     error ) != 1 )
@@ -1351,16 +1371,17 @@ int libfsntfs_file_system_get_number_of_mft_entries(
 }
 
 /* Retrieves the MFT entry for a specific index
+ * This function creates new MFT entry
  * Returns 1 if successful or -1 on error
  */
-int libfsntfs_file_system_get_mft_entry_by_index(
+int libfsntfs_file_system_get_mft_entry_by_index_no_cache(
      libfsntfs_file_system_t *file_system,
      libbfio_handle_t *file_io_handle,
      uint64_t mft_entry_index,
      libfsntfs_mft_entry_t **mft_entry,
      libcerror_error_t **error )
 {
-	static char *function = "libfsntfs_file_system_get_mft_entry_by_index";
+	static char *function = "libfsntfs_file_system_get_mft_entry_by_index_no_cache";
 
 	if( file_system == NULL )
 	{
@@ -1373,7 +1394,7 @@ int libfsntfs_file_system_get_mft_entry_by_index(
 
 		return( -1 );
 	}
-	if( libfsntfs_mft_get_mft_entry_by_index(
+	if( libfsntfs_mft_get_mft_entry_by_index_no_cache(
 	     file_system->mft,
 	     file_io_handle,
 	     mft_entry_index,
@@ -1393,18 +1414,21 @@ int libfsntfs_file_system_get_mft_entry_by_index(
 	return( 1 );
 }
 
-/* Retrieves the MFT entry for a specific index
- * This function creates new MFT entry
+/* Retrieves a shared reference to a cached MFT entry for a specific index
+ * The MFT entry is shared with the MFT entry cache and must not be modified,
+ * the reference must be released with libfsntfs_mft_entry_free
  * Returns 1 if successful or -1 on error
  */
-int libfsntfs_file_system_get_mft_entry_by_index_no_cache(
+int libfsntfs_file_system_get_shared_mft_entry_by_index(
      libfsntfs_file_system_t *file_system,
      libbfio_handle_t *file_io_handle,
      uint64_t mft_entry_index,
      libfsntfs_mft_entry_t **mft_entry,
      libcerror_error_t **error )
 {
-	static char *function = "libfsntfs_file_system_get_mft_entry_by_index_no_cache";
+	libfsntfs_mft_entry_t *safe_mft_entry = NULL;
+	static char *function                 = "libfsntfs_file_system_get_shared_mft_entry_by_index";
+	int result                            = 1;
 
 	if( file_system == NULL )
 	{
@@ -1417,11 +1441,39 @@ int libfsntfs_file_system_get_mft_entry_by_index_no_cache(
 
 		return( -1 );
 	}
-	if( libfsntfs_mft_get_mft_entry_by_index_no_cache(
+	if( mft_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MFT entry.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     file_system->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* The reference is added while the MFT entry cannot be evicted from the cache
+	 */
+	if( libfsntfs_mft_get_mft_entry_by_index(
 	     file_system->mft,
 	     file_io_handle,
 	     mft_entry_index,
-	     mft_entry,
+	     &safe_mft_entry,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1432,9 +1484,48 @@ int libfsntfs_file_system_get_mft_entry_by_index_no_cache(
 		 function,
 		 mft_entry_index );
 
+		result = -1;
+	}
+	else if( libfsntfs_mft_entry_add_reference(
+	          safe_mft_entry,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to add reference to MFT entry: %" PRIi64 ".",
+		 function,
+		 mft_entry_index );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     file_system->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		if( result == 1 )
+		{
+			libfsntfs_mft_entry_free(
+			 &safe_mft_entry,
+			 NULL );
+		}
 		return( -1 );
 	}
-	return( 1 );
+#endif
+	if( result == 1 )
+	{
+		*mft_entry = safe_mft_entry;
+	}
+	return( result );
 }
 
 /* Retrieves the security descriptor for a specific identifier
@@ -1558,7 +1649,10 @@ int libfsntfs_file_system_get_path_hint(
 	}
 	mft_entry_index = file_reference & 0xffffffffffffUL;
 
-	if( libfsntfs_file_system_get_mft_entry_by_index(
+	/* A reference to the MFT entry is held since retrieving the path hint
+	 * of the parent can evict the MFT entry from the cache
+	 */
+	if( libfsntfs_file_system_get_shared_mft_entry_by_index(
 	     file_system,
 	     file_io_handle,
 	     mft_entry_index,
@@ -1608,17 +1702,37 @@ int libfsntfs_file_system_get_path_hint(
 
 			goto on_error;
 		}
-		else if( result != 0 )
+		else if( result == 0 )
 		{
-			return( 0 );
-		}
-		/* The sequence number is updated when the MFT entry is deleted
-		 */
-		sequence_number           = (uint16_t) ( file_reference >> 48 );
-		mft_entry_sequence_number = (uint16_t) ( mft_entry_file_reference >> 48 );
+			/* The sequence number is updated when the MFT entry is deleted
+			 */
+			sequence_number           = (uint16_t) ( file_reference >> 48 );
+			mft_entry_sequence_number = (uint16_t) ( mft_entry_file_reference >> 48 );
 
-		if( sequence_number != ( mft_entry_sequence_number - 1 ) )
+			if( sequence_number == ( mft_entry_sequence_number - 1 ) )
+			{
+				result = 1;
+			}
+		}
+		else
 		{
+			result = 0;
+		}
+		if( result == 0 )
+		{
+			if( libfsntfs_mft_entry_free(
+			     &mft_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release MFT entry.",
+				 function );
+
+				goto on_error;
+			}
 			return( 0 );
 		}
 	}
@@ -1658,6 +1772,11 @@ int libfsntfs_file_system_get_path_hint(
 	}
 	else if( result == 0 )
 	{
+		libfsntfs_statistics_add_value(
+		 file_system->mft->io_handle->statistics,
+		 LIBFSNTFS_STATISTICS_VALUE_PATH_HINT_CACHE_MISSES,
+		 1 );
+
 		if( libfsntfs_mft_entry_get_number_of_attributes(
 		     mft_entry,
 		     &number_of_attributes,
@@ -1944,6 +2063,13 @@ int libfsntfs_file_system_get_path_hint(
 			}
 		}
 	}
+	else
+	{
+		libfsntfs_statistics_add_value(
+		 file_system->mft->io_handle->statistics,
+		 LIBFSNTFS_STATISTICS_VALUE_PATH_HINT_CACHE_HITS,
+		 1 );
+	}
 	if( libfsntfs_path_hint_free(
 	     &lookup_path_hint,
 	     error ) != 1 )
@@ -1957,6 +2083,19 @@ int libfsntfs_file_system_get_path_hint(
 
 		goto on_error;
 	}
+	if( libfsntfs_mft_entry_free(
+	     &mft_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release MFT entry.",
+		 function );
+
+		goto on_error;
+	}
 	return( result );
 
 on_error:
@@ -1978,6 +2117,249 @@ on_error:
 		 &lookup_path_hint,
 		 NULL );
 	}
+	if( mft_entry != NULL )
+	{
+		libfsntfs_mft_entry_free(
+		 &mft_entry,
+		 NULL );
+	}
 	return( -1 );
 }
 
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+
+/* Pushes an asynchronous read onto the asynchronous read thread pool
+ * The thread pool is created on first use with the number of threads, it is joined
+ * when the file system is freed
+ * Blocks if the maximum number of pending asynchronous reads has been reached
+ * On success the thread pool takes over the management of the asynchronous read
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_file_system_push_async_read(
+     libfsntfs_file_system_t *file_system,
+     int number_of_threads,
+     libfsntfs_async_read_t *async_read,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_file_system_push_async_read";
+	int result            = 1;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( async_read == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid asynchronous read.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_read_write_lock_grab_for_write(
+	     file_system->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->async_read_thread_pool == NULL )
+	{
+		if( libcthreads_thread_pool_create(
+		     &( file_system->async_read_thread_pool ),
+		     NULL,
+		     number_of_threads,
+		     LIBFSNTFS_MAXIMUM_NUMBER_OF_PENDING_ASYNC_READS,
+		     (int (*)(intptr_t *, void *)) &libfsntfs_async_read_execute,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create asynchronous read thread pool.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libcthreads_read_write_lock_release_for_write(
+	     file_system->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+	if( result != 1 )
+	{
+		return( -1 );
+	}
+	/* The lock is held for reading while pushing, which can block while the thread pool
+	 * is full, so that the thread pool cannot be joined and freed during the push
+	 */
+	if( libcthreads_read_write_lock_grab_for_read(
+	     file_system->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->async_read_thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file system - missing asynchronous read thread pool.",
+		 function );
+
+		result = -1;
+	}
+	else if( libcthreads_thread_pool_push(
+	          file_system->async_read_thread_pool,
+	          (intptr_t *) async_read,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push asynchronous read onto thread pool.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_read_write_lock_release_for_read(
+	     file_system->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Waits for the pending asynchronous reads to complete
+ * The thread pool is detached from the file system while the lock is held for writing,
+ * hence no push onto the thread pool is in progress. It is joined without holding
+ * the lock, so that the asynchronous reads can still access the file system
+ * A subsequent asynchronous read creates a new thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_file_system_join_async_reads(
+     libfsntfs_file_system_t *file_system,
+     libcerror_error_t **error )
+{
+	libcthreads_thread_pool_t *thread_pool = NULL;
+	static char *function                  = "libfsntfs_file_system_join_async_reads";
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_read_write_lock_grab_for_write(
+	     file_system->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+	thread_pool = file_system->async_read_thread_pool;
+
+	file_system->async_read_thread_pool = NULL;
+
+	if( libcthreads_read_write_lock_release_for_write(
+	     file_system->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		file_system->async_read_thread_pool = thread_pool;
+
+		return( -1 );
+	}
+	if( thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join asynchronous read thread pool.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT ) */
+
@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfsntfs_async_read.h"
 #include "libfsntfs_io_handle.h"
 #include "libfsntfs_libbfio.h"
 #include "libfsntfs_libcdata.h"
@@ -60,6 +61,10 @@ struct libfsntfs_file_system
 	libcdata_btree_t *path_hints_tree;
 
 #if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	/* The thread pool that executes the asynchronous reads
+	 */
+	libcthreads_thread_pool_t *async_read_thread_pool;
+
 	/* The read/write lock
 	 */
 	libcthreads_read_write_lock_t *read_write_lock;
@@ -99,14 +104,14 @@ int libfsntfs_file_system_get_number_of_mft_entries(
      uint64_t *number_of_mft_entries,
      libcerror_error_t **error );
 
-int libfsntfs_file_system_get_mft_entry_by_index(
+int libfsntfs_file_system_get_mft_entry_by_index_no_cache(
      libfsntfs_file_system_t *file_system,
      libbfio_handle_t *file_io_handle,
      uint64_t mft_entry_index,
      libfsntfs_mft_entry_t **mft_entry,
      libcerror_error_t **error );
 
-int libfsntfs_file_system_get_mft_entry_by_index_no_cache(
+int libfsntfs_file_system_get_shared_mft_entry_by_index(
      libfsntfs_file_system_t *file_system,
      libbfio_handle_t *file_io_handle,
      uint64_t mft_entry_index,
@@ -128,6 +133,20 @@ int libfsntfs_file_system_get_path_hint(
      int recursion_depth,
      libcerror_error_t **error );
 
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+
+int libfsntfs_file_system_push_async_read(
+     libfsntfs_file_system_t *file_system,
+     int number_of_threads,
+     libfsntfs_async_read_t *async_read,
+     libcerror_error_t **error );
+
+int libfsntfs_file_system_join_async_reads(
+     libfsntfs_file_system_t *file_system,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT ) */
+
 #if defined( __cplusplus )
 }
 #endif
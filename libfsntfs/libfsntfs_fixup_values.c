@@ -192,3 +192,88 @@ int libfsntfs_fixup_values_apply(
 	return( 1 );
 }
 
+/* Verifies that the fix-up placeholders in the data match the fix-up placeholder value
+ * This function should be called before the fix-up values are applied
+ * Returns 1 if the fix-up placeholders match, 0 if not or -1 on error
+ */
+int libfsntfs_fixup_values_verify(
+     const uint8_t *data,
+     size_t data_size,
+     uint16_t fixup_values_offset,
+     uint16_t number_of_fixup_values,
+     libcerror_error_t **error )
+{
+	static char *function           = "libfsntfs_fixup_values_verify";
+	size_t data_offset              = 0;
+	size_t fixup_placeholder_offset = 0;
+	size_t fixup_values_size        = 0;
+	uint16_t fixup_value_index      = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( fixup_values_offset >= data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid fix-up values offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	fixup_values_size = 2 + ( (size_t) number_of_fixup_values * 2 );
+
+	if( ( number_of_fixup_values == 0 )
+	 || ( fixup_values_size > ( data_size - fixup_values_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of fix-up values value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	fixup_placeholder_offset = (size_t) fixup_values_offset;
+	data_offset              = 510;
+
+	for( fixup_value_index = 0;
+	     fixup_value_index < number_of_fixup_values;
+	     fixup_value_index++ )
+	{
+		if( ( data_offset + 1 ) >= data_size )
+		{
+			break;
+		}
+		if( ( data[ data_offset ] != data[ fixup_placeholder_offset ] )
+		 || ( data[ data_offset + 1 ] != data[ fixup_placeholder_offset + 1 ] ) )
+		{
+			return( 0 );
+		}
+		data_offset += 512;
+	}
+	return( 1 );
+}
+
@@ -38,6 +38,13 @@ int libfsntfs_fixup_values_apply(
      uint16_t number_of_fixup_values,
      libcerror_error_t **error );
 
+int libfsntfs_fixup_values_verify(
+     const uint8_t *data,
+     size_t data_size,
+     uint16_t fixup_values_offset,
+     uint16_t number_of_fixup_values,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
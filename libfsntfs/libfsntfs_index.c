@@ -42,6 +42,9 @@
 #include "libfsntfs_libuna.h"
 #include "libfsntfs_mft_attribute.h"
 #include "libfsntfs_mft_entry.h"
+#include "libfsntfs_read_queue.h"
+#include "libfsntfs_read_thread_pool.h"
+#include "libfsntfs_statistics.h"
 #include "libfsntfs_unused.h"
 
 #include "fsntfs_index.h"
@@ -1087,6 +1090,11 @@ int libfsntfs_index_get_sub_node(
 	}
 #endif /* defined( HAVE_PROFILER ) */
 
+	libfsntfs_statistics_add_value(
+	 index->io_handle->statistics,
+	 LIBFSNTFS_STATISTICS_VALUE_INDEX_NODE_LOOKUPS,
+	 1 );
+
 	if( libfdata_vector_get_element_value_at_offset(
 	     index->index_entry_vector,
 	     (intptr_t *) file_io_handle,
@@ -1134,3 +1142,629 @@ int libfsntfs_index_get_sub_node(
 	return( 1 );
 }
 
+/* Prefetches the allocated sub nodes of an index node into the index node cache
+ * Physically contiguous index entries are read with a single read
+ * Sub nodes that share a cache entry with another sub node of the index node
+ * and sub nodes that cannot be prefetched are left to be read on demand
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_index_prefetch_sub_nodes(
+     libfsntfs_index_t *index,
+     libbfio_handle_t *file_io_handle,
+     libfcache_cache_t *index_node_cache,
+     libfsntfs_index_node_t *index_node,
+     libcerror_error_t **error )
+{
+	libfsntfs_index_entry_t *index_entry = NULL;
+	libfsntfs_index_value_t *index_value = NULL;
+	libfsntfs_read_queue_t *read_queue   = NULL;
+	uint8_t *index_entries_data          = NULL;
+	off64_t *index_entry_offsets         = NULL;
+	int *cache_entry_counts              = NULL;
+	int *element_indexes                 = NULL;
+	static char *function                = "libfsntfs_index_prefetch_sub_nodes";
+	size64_t segment_size                = 0;
+	size_t index_entries_data_size       = 0;
+	size_t read_size                     = 0;
+	off64_t element_offset               = 0;
+	off64_t index_entry_offset           = 0;
+	off64_t segment_offset               = 0;
+	off64_t stream_offset                = 0;
+	uint32_t index_entry_size            = 0;
+	uint32_t segment_flags               = 0;
+	int cache_entry_index                = 0;
+	int element_index                    = 0;
+	int entry_index                      = 0;
+	int first_entry_index                = 0;
+	int index_value_entry                = 0;
+	int is_allocated                     = 0;
+	int last_entry_index                 = 0;
+	int number_of_cache_entries          = 0;
+	int number_of_index_values           = 0;
+	int number_of_prefetch_sub_nodes     = 0;
+	int number_of_segments               = 0;
+	int number_of_sub_nodes              = 0;
+	int result                           = 0;
+	int segment_file_index               = 0;
+	int segment_index                    = 0;
+	int sub_node_index                   = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( index->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( index->index_entry_vector == NULL )
+	{
+		return( 1 );
+	}
+	index_entry_size = index->io_handle->index_entry_size;
+
+	if( ( index_entry_size == 0 )
+	 || ( index_entry_size > MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid index - invalid IO handle - index entry size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_cache_get_number_of_entries(
+	     index_node_cache,
+	     &number_of_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of cache entries.",
+		 function );
+
+		goto on_error;
+	}
+	/* A single cache entry cannot hold more than the sub node being read
+	 */
+	if( number_of_cache_entries < 2 )
+	{
+		return( 1 );
+	}
+	if( libfsntfs_index_node_get_number_of_values(
+	     index_node,
+	     &number_of_index_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of values from index node.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_index_values < 2 )
+	{
+		return( 1 );
+	}
+	if( libfdata_vector_get_number_of_segments(
+	     index->index_entry_vector,
+	     &number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of index entry vector segments.",
+		 function );
+
+		goto on_error;
+	}
+	cache_entry_counts = (int *) memory_allocate(
+	                              sizeof( int ) * number_of_cache_entries );
+
+	if( cache_entry_counts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cache entry counts.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     cache_entry_counts,
+	     0,
+	     sizeof( int ) * number_of_cache_entries ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear cache entry counts.",
+		 function );
+
+		goto on_error;
+	}
+	index_entry_offsets = (off64_t *) memory_allocate(
+	                                   sizeof( off64_t ) * number_of_index_values );
+
+	if( index_entry_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index entry offsets.",
+		 function );
+
+		goto on_error;
+	}
+	element_indexes = (int *) memory_allocate(
+	                           sizeof( int ) * number_of_index_values );
+
+	if( element_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create element indexes.",
+		 function );
+
+		goto on_error;
+	}
+	/* Determine the physical offsets of the allocated sub nodes and
+	 * the number of sub nodes that map onto each cache entry
+	 */
+	for( index_value_entry = 0;
+	     index_value_entry < number_of_index_values;
+	     index_value_entry++ )
+	{
+		if( libfsntfs_index_node_get_value_by_index(
+		     index_node,
+		     index_value_entry,
+		     &index_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d from index node.",
+			 function,
+			 index_value_entry );
+
+			goto on_error;
+		}
+		if( ( index_value->flags & LIBFSNTFS_INDEX_VALUE_FLAG_HAS_SUB_NODE ) != 0 )
+		{
+			if( index_value->sub_node_vcn > (uint64_t) INT_MAX )
+			{
+				continue;
+			}
+			is_allocated = libfsntfs_index_sub_node_is_allocated(
+			                index,
+			                (int) index_value->sub_node_vcn,
+			                error );
+
+			if( is_allocated == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine if sub node with VCN: %d is allocated.",
+				 function,
+				 (int) index_value->sub_node_vcn );
+
+				goto on_error;
+			}
+			else if( is_allocated == 0 )
+			{
+				continue;
+			}
+			element_offset = (off64_t) ( index_value->sub_node_vcn * index->io_handle->cluster_block_size ) / index_entry_size;
+
+			if( element_offset > (off64_t) INT_MAX )
+			{
+				continue;
+			}
+			element_index  = (int) element_offset;
+			element_offset = (off64_t) element_index * index_entry_size;
+			stream_offset  = 0;
+
+			/* The cache stores an element in cache entry: element index % number of cache entries
+			 */
+			cache_entry_index = element_index % number_of_cache_entries;
+
+			cache_entry_counts[ cache_entry_index ] += 1;
+
+			for( segment_index = 0;
+			     segment_index < number_of_segments;
+			     segment_index++ )
+			{
+				if( libfdata_vector_get_segment_by_index(
+				     index->index_entry_vector,
+				     segment_index,
+				     &segment_file_index,
+				     &segment_offset,
+				     &segment_size,
+				     &segment_flags,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve index entry vector segment: %d.",
+					 function,
+					 segment_index );
+
+					goto on_error;
+				}
+				if( (size64_t) ( element_offset - stream_offset ) < segment_size )
+				{
+					break;
+				}
+				stream_offset += (off64_t) segment_size;
+			}
+			/* Index entries that are sparse or span multiple segments are read on demand
+			 */
+			if( ( segment_index >= number_of_segments )
+			 || ( ( segment_flags & LIBFDATA_RANGE_FLAG_IS_SPARSE ) != 0 )
+			 || ( (size64_t) ( element_offset - stream_offset + index_entry_size ) > segment_size ) )
+			{
+				continue;
+			}
+			index_entry_offsets[ number_of_sub_nodes ] = segment_offset + ( element_offset - stream_offset );
+			element_indexes[ number_of_sub_nodes ]     = element_index;
+
+			number_of_sub_nodes++;
+		}
+		if( ( index_value->flags & LIBFSNTFS_INDEX_VALUE_FLAG_IS_LAST ) != 0 )
+		{
+			break;
+		}
+	}
+	/* Only prefetch the sub nodes that have a cache entry of their own, since
+	 * sub nodes that share a cache entry would evict each other before they are read.
+	 * This also limits the number of prefetched sub nodes to the number of cache entries.
+	 * The prefetched sub nodes are sorted by offset.
+	 */
+	for( sub_node_index = 0;
+	     sub_node_index < number_of_sub_nodes;
+	     sub_node_index++ )
+	{
+		element_index      = element_indexes[ sub_node_index ];
+		index_entry_offset = index_entry_offsets[ sub_node_index ];
+
+		if( cache_entry_counts[ element_index % number_of_cache_entries ] != 1 )
+		{
+			continue;
+		}
+		for( entry_index = number_of_prefetch_sub_nodes;
+		     entry_index > 0;
+		     entry_index-- )
+		{
+			if( index_entry_offsets[ entry_index - 1 ] < index_entry_offset )
+			{
+				break;
+			}
+			index_entry_offsets[ entry_index ] = index_entry_offsets[ entry_index - 1 ];
+			element_indexes[ entry_index ]     = element_indexes[ entry_index - 1 ];
+		}
+		index_entry_offsets[ entry_index ] = index_entry_offset;
+		element_indexes[ entry_index ]     = element_index;
+
+		number_of_prefetch_sub_nodes++;
+	}
+	memory_free(
+	 cache_entry_counts );
+
+	cache_entry_counts = NULL;
+
+	number_of_sub_nodes = number_of_prefetch_sub_nodes;
+
+	if( number_of_sub_nodes < 2 )
+	{
+		memory_free(
+		 element_indexes );
+		memory_free(
+		 index_entry_offsets );
+
+		return( 1 );
+	}
+	if( (size_t) number_of_sub_nodes > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / index_entry_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of sub nodes value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	index_entries_data_size = (size_t) number_of_sub_nodes * index_entry_size;
+
+	index_entries_data = (uint8_t *) memory_allocate(
+	                                  sizeof( uint8_t ) * index_entries_data_size );
+
+	if( index_entries_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index entries data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsntfs_read_queue_initialize(
+	     &read_queue,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read queue.",
+		 function );
+
+		goto on_error;
+	}
+	/* Queue a single read for each run of physically contiguous index entries
+	 */
+	first_entry_index = 0;
+
+	while( first_entry_index < number_of_sub_nodes )
+	{
+		last_entry_index = first_entry_index;
+
+		while( ( last_entry_index + 1 ) < number_of_sub_nodes )
+		{
+			if( index_entry_offsets[ last_entry_index + 1 ] != ( index_entry_offsets[ last_entry_index ] + index_entry_size ) )
+			{
+				break;
+			}
+			last_entry_index++;
+		}
+		/* A single index entry gains nothing from being prefetched
+		 */
+		if( last_entry_index == first_entry_index )
+		{
+			element_indexes[ first_entry_index ] = -1;
+
+			first_entry_index++;
+
+			continue;
+		}
+		read_size = (size_t) ( last_entry_index - first_entry_index + 1 ) * index_entry_size;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: prefetching %d index entries at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+			 function,
+			 last_entry_index - first_entry_index + 1,
+			 index_entry_offsets[ first_entry_index ],
+			 index_entry_offsets[ first_entry_index ] );
+		}
+#endif
+		if( libfsntfs_read_queue_append_request(
+		     read_queue,
+		     index_entry_offsets[ first_entry_index ],
+		     &( index_entries_data[ (size_t) first_entry_index * index_entry_size ] ),
+		     read_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append read request for index entry offset: 0x%08" PRIx64 ".",
+			 function,
+			 index_entry_offsets[ first_entry_index ] );
+
+			goto on_error;
+		}
+		first_entry_index = last_entry_index + 1;
+	}
+	/* The queued reads are kept in flight together and complete in any order
+	 */
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( index->io_handle->read_thread_pool != NULL )
+	{
+		result = libfsntfs_read_thread_pool_read(
+		          index->io_handle->read_thread_pool,
+		          read_queue,
+		          error );
+	}
+	else
+#endif
+	{
+		result = libfsntfs_read_queue_read(
+		          read_queue,
+		          file_io_handle,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index entries data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsntfs_read_queue_free(
+	     &read_queue,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free read queue.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_sub_nodes;
+	     entry_index++ )
+	{
+		if( element_indexes[ entry_index ] < 0 )
+		{
+			continue;
+		}
+		if( libfsntfs_index_entry_initialize(
+		     &index_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create index entry.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsntfs_index_entry_read_data(
+		     index_entry,
+		     &( index_entries_data[ (size_t) entry_index * index_entry_size ] ),
+		     (size_t) index_entry_size,
+		     (uint32_t) element_indexes[ entry_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read index entry: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 element_indexes[ entry_index ],
+			 index_entry_offsets[ entry_index ],
+			 index_entry_offsets[ entry_index ] );
+
+			goto on_error;
+		}
+		libfsntfs_statistics_add_value(
+		 index->io_handle->statistics,
+		 LIBFSNTFS_STATISTICS_VALUE_INDEX_NODES_READ,
+		 1 );
+
+		libfsntfs_statistics_add_value(
+		 index->io_handle->statistics,
+		 LIBFSNTFS_STATISTICS_VALUE_INDEX_BYTES_READ,
+		 (uint64_t) index_entry_size );
+
+		if( libfdata_vector_set_element_value_by_index(
+		     index->index_entry_vector,
+		     (intptr_t *) file_io_handle,
+		     (libfdata_cache_t *) index_node_cache,
+		     element_indexes[ entry_index ],
+		     (intptr_t *) index_entry->node,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsntfs_index_node_free,
+		     LIBFDATA_LIST_ELEMENT_VALUE_FLAG_MANAGED,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set index node as element value.",
+			 function );
+
+			goto on_error;
+		}
+		index_entry->node = NULL;
+
+		if( libfsntfs_index_entry_free(
+		     &index_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free index entry.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 index_entries_data );
+	memory_free(
+	 element_indexes );
+	memory_free(
+	 index_entry_offsets );
+
+	return( 1 );
+
+on_error:
+	if( index_entry != NULL )
+	{
+		libfsntfs_index_entry_free(
+		 &index_entry,
+		 NULL );
+	}
+	if( read_queue != NULL )
+	{
+		libfsntfs_read_queue_free(
+		 &read_queue,
+		 NULL );
+	}
+	if( index_entries_data != NULL )
+	{
+		memory_free(
+		 index_entries_data );
+	}
+	if( element_indexes != NULL )
+	{
+		memory_free(
+		 element_indexes );
+	}
+	if( index_entry_offsets != NULL )
+	{
+		memory_free(
+		 index_entry_offsets );
+	}
+	if( cache_entry_counts != NULL )
+	{
+		memory_free(
+		 cache_entry_counts );
+	}
+	return( -1 );
+}
+
@@ -141,6 +141,13 @@ int libfsntfs_index_get_sub_node(
      libfsntfs_index_node_t **index_node,
      libcerror_error_t **error );
 
+int libfsntfs_index_prefetch_sub_nodes(
+     libfsntfs_index_t *index,
+     libbfio_handle_t *file_io_handle,
+     libfcache_cache_t *index_node_cache,
+     libfsntfs_index_node_t *index_node,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -159,24 +159,22 @@ int libfsntfs_index_entry_free(
 }
 
 /* Reads the index entry
+ * The fix-up values are applied to the data
  * Returns 1 if successful or -1 on error
  */
-int libfsntfs_index_entry_read_file_io_handle(
+int libfsntfs_index_entry_read_data(
      libfsntfs_index_entry_t *index_entry,
-     libbfio_handle_t *file_io_handle,
-     off64_t file_offset,
-     uint32_t index_entry_size,
+     uint8_t *data,
+     size_t data_size,
      uint32_t index_entry_index,
      libcerror_error_t **error )
 {
 	libfsntfs_index_entry_header_t *index_entry_header = NULL;
-	uint8_t *index_entry_data                          = NULL;
-	static char *function                              = "libfsntfs_index_entry_read_file_io_handle";
+	static char *function                              = "libfsntfs_index_entry_read_data";
 	size_t data_offset                                 = 0;
 	size_t index_node_size                             = 0;
 	size_t index_values_offset                         = 0;
 	size_t unknown_data_size                           = 0;
-	ssize_t read_count                                 = 0;
 	off64_t index_value_vcn_offset                     = 0;
 	uint16_t fixup_values_offset                       = 0;
 	uint16_t number_of_fixup_values                    = 0;
@@ -203,75 +201,28 @@ int libfsntfs_index_entry_read_file_io_handle(
 
 		return( -1 );
 	}
-	if( ( index_entry_size < ( sizeof( fsntfs_index_entry_header_t ) + sizeof( fsntfs_index_node_header_t ) ) )
-	 || ( index_entry_size > MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid IO handle - index entry size value out of bounds.",
-		 function );
-
-		goto on_error;
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: reading index entry: %" PRIu32 " at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
-		 function,
-		 index_entry_index,
-		 file_offset,
-		 file_offset );
-	}
-#endif
-	if( libbfio_handle_seek_offset(
-	     file_io_handle,
-	     file_offset,
-	     SEEK_SET,
-	     error ) == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek index entry offset: 0x%08" PRIx64 ".",
-		 function,
-		 file_offset );
-
-		goto on_error;
-	}
-	index_entry_data = (uint8_t *) memory_allocate(
-	                                sizeof( uint8_t ) * index_entry_size );
-
-	if( index_entry_data == NULL )
+	if( data == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create index entry data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	read_count = libbfio_handle_read_buffer(
-	              file_io_handle,
-	              index_entry_data,
-	              (size_t) index_entry_size,
-	              error );
-
-	if( read_count != (ssize_t) index_entry_size )
+	if( ( data_size < ( sizeof( fsntfs_index_entry_header_t ) + sizeof( fsntfs_index_node_header_t ) ) )
+	 || ( data_size > (size_t) UINT32_MAX ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read index entry data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	if( libfsntfs_index_entry_header_initialize(
 	     &index_entry_header,
@@ -288,8 +239,8 @@ int libfsntfs_index_entry_read_file_io_handle(
 	}
 	if( libfsntfs_index_entry_header_read_data(
 	     index_entry_header,
-	     index_entry_data,
-	     (size_t) index_entry_size,
+	     data,
+	     data_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -318,8 +269,8 @@ int libfsntfs_index_entry_read_file_io_handle(
 	}
 	if( libfsntfs_index_node_read_header(
 	     index_entry->node,
-	     index_entry_data,
-	     (size_t) index_entry_size,
+	     data,
+	     data_size,
 	     data_offset,
 	     error ) != 1 )
 	{
@@ -373,7 +324,7 @@ int libfsntfs_index_entry_read_file_io_handle(
 			 "%s: unknown data:\n",
 			 function );
 			libcnotify_print_data(
-			 &( index_entry_data[ data_offset ] ),
+			 &( data[ data_offset ] ),
 			 unknown_data_size,
 			 0 );
 		}
@@ -397,8 +348,8 @@ int libfsntfs_index_entry_read_file_io_handle(
 	if( number_of_fixup_values > 0 )
 	{
 		if( libfsntfs_fixup_values_apply(
-		     index_entry_data,
-		     (size_t) index_entry_size,
+		     data,
+		     data_size,
 		     fixup_values_offset,
 		     number_of_fixup_values,
 		     error ) != 1 )
@@ -427,13 +378,13 @@ int libfsntfs_index_entry_read_file_io_handle(
 
 		goto on_error;
 	}
-	index_value_vcn_offset = (off64_t) index_entry_index * index_entry_size;
+	index_value_vcn_offset = (off64_t) index_entry_index * data_size;
 
 	if( libfsntfs_index_node_read_values(
 	     index_entry->node,
 	     index_value_vcn_offset,
-	     index_entry_data,
-	     (size_t) index_entry_size,
+	     data,
+	     data_size,
 	     data_offset,
 	     error ) != 1 )
 	{
@@ -460,7 +411,7 @@ int libfsntfs_index_entry_read_file_io_handle(
 			 "%s: unknown data:\n",
 			 function );
 			libcnotify_print_data(
-			 &( index_entry_data[ data_offset ] ),
+			 &( data[ data_offset ] ),
 			 unknown_data_size,
 			 0 );
 		}
@@ -473,21 +424,18 @@ int libfsntfs_index_entry_read_file_io_handle(
 	{
 		data_offset += index_node_size;
 
-		if( data_offset < (size_t) index_entry_size )
+		if( data_offset < data_size )
 		{
 			libcnotify_printf(
 			 "%s: trailing data:\n",
 			 function );
 			libcnotify_print_data(
-			 &( index_entry_data[ data_offset ] ),
-			 (size_t) index_entry_size - data_offset,
+			 &( data[ data_offset ] ),
+			 data_size - data_offset,
 			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 		}
 	}
 #endif
-	memory_free(
-	 index_entry_data );
-
 	return( 1 );
 
 on_error:
@@ -503,6 +451,127 @@ on_error:
 		 &index_entry_header,
 		 NULL );
 	}
+	return( -1 );
+}
+
+/* Reads the index entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_index_entry_read_file_io_handle(
+     libfsntfs_index_entry_t *index_entry,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     uint32_t index_entry_size,
+     uint32_t index_entry_index,
+     libcerror_error_t **error )
+{
+	uint8_t *index_entry_data = NULL;
+	static char *function     = "libfsntfs_index_entry_read_file_io_handle";
+	ssize_t read_count        = 0;
+
+	if( index_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( index_entry_size < ( sizeof( fsntfs_index_entry_header_t ) + sizeof( fsntfs_index_node_header_t ) ) )
+	 || ( index_entry_size > MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - index entry size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading index entry: %" PRIu32 " at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 function,
+		 index_entry_index,
+		 file_offset,
+		 file_offset );
+	}
+#endif
+	if( libbfio_handle_seek_offset(
+	     file_io_handle,
+	     file_offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek index entry offset: 0x%08" PRIx64 ".",
+		 function,
+		 file_offset );
+
+		goto on_error;
+	}
+	index_entry_data = (uint8_t *) memory_allocate(
+	                                sizeof( uint8_t ) * index_entry_size );
+
+	if( index_entry_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index entry data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer(
+	              file_io_handle,
+	              index_entry_data,
+	              (size_t) index_entry_size,
+	              error );
+
+	if( read_count != (ssize_t) index_entry_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index entry data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsntfs_index_entry_read_data(
+	     index_entry,
+	     index_entry_data,
+	     (size_t) index_entry_size,
+	     index_entry_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index entry.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 index_entry_data );
+
+	return( 1 );
+
+on_error:
 	if( index_entry_data != NULL )
 	{
 		memory_free(
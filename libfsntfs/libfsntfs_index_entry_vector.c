@@ -31,6 +31,7 @@
 #include "libfsntfs_libcerror.h"
 #include "libfsntfs_libfdata.h"
 #include "libfsntfs_mft_attribute.h"
+#include "libfsntfs_statistics.h"
 #include "libfsntfs_unused.h"
 
 /* Creates an index entry vector
@@ -138,7 +139,7 @@ int libfsntfs_index_entry_vector_initialize(
 	if( libfdata_vector_initialize(
 	     &safe_index_entry_vector,
 	     (size64_t) io_handle->index_entry_size,
-	     NULL,
+	     (intptr_t *) io_handle,
 	     NULL,
 	     NULL,
 	     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfdata_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libfsntfs_index_entry_vector_read_element_data,
@@ -322,7 +323,7 @@ on_error:
  * Returns 1 if successful or -1 on error
  */
 int libfsntfs_index_entry_vector_read_element_data(
-     intptr_t *data_handle LIBFSNTFS_ATTRIBUTE_UNUSED,
+     libfsntfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      libfdata_vector_t *vector,
      libfdata_cache_t *cache,
@@ -337,7 +338,6 @@ int libfsntfs_index_entry_vector_read_element_data(
 	libfsntfs_index_entry_t *index_entry = NULL;
 	static char *function                = "libfsntfs_index_entry_vector_read_element_data";
 
-	LIBFSNTFS_UNREFERENCED_PARAMETER( data_handle )
 	LIBFSNTFS_UNREFERENCED_PARAMETER( element_data_file_index )
 	LIBFSNTFS_UNREFERENCED_PARAMETER( element_flags )
 	LIBFSNTFS_UNREFERENCED_PARAMETER( read_flags )
@@ -397,6 +397,20 @@ int libfsntfs_index_entry_vector_read_element_data(
 
 		goto on_error;
 	}
+	/* The IO handle is not set when the index entry vector is used without a volume
+	 */
+	if( io_handle != NULL )
+	{
+		libfsntfs_statistics_add_value(
+		 io_handle->statistics,
+		 LIBFSNTFS_STATISTICS_VALUE_INDEX_NODES_READ,
+		 1 );
+
+		libfsntfs_statistics_add_value(
+		 io_handle->statistics,
+		 LIBFSNTFS_STATISTICS_VALUE_INDEX_BYTES_READ,
+		 (uint64_t) index_entry_size );
+	}
 	if( libfdata_vector_set_element_value_by_index(
 	     vector,
 	     (intptr_t *) file_io_handle,
@@ -42,7 +42,7 @@ int libfsntfs_index_entry_vector_initialize(
      libcerror_error_t **error );
 
 int libfsntfs_index_entry_vector_read_element_data(
-     intptr_t *data_handle,
+     libfsntfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      libfdata_vector_t *vector,
      libfdata_cache_t *cache,
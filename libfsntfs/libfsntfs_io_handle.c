@@ -25,6 +25,7 @@
 
 #include "libfsntfs_io_handle.h"
 #include "libfsntfs_libcerror.h"
+#include "libfsntfs_read_thread_pool.h"
 
 const char *fsntfs_volume_file_system_signature = "NTFS    ";
 
@@ -93,6 +94,8 @@ int libfsntfs_io_handle_initialize(
 
 		return( -1 );
 	}
+	( *io_handle )->number_of_read_threads = 1;
+
 #if defined( HAVE_PROFILER )
 	if( libfsntfs_profiler_initialize(
 	     &( ( *io_handle )->profiler ),
@@ -196,6 +199,24 @@ int libfsntfs_io_handle_free(
 		}
 #endif /* defined( HAVE_PROFILER ) */
 
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+		if( ( *io_handle )->read_thread_pool != NULL )
+		{
+			if( libfsntfs_read_thread_pool_free(
+			     &( ( *io_handle )->read_thread_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free read thread pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
 		memory_free(
 		 *io_handle );
 
@@ -212,6 +233,7 @@ int libfsntfs_io_handle_clear(
      libcerror_error_t **error )
 {
 	static char *function          = "libfsntfs_io_handle_clear";
+	int number_of_read_threads     = 0;
 
 #if defined( HAVE_PROFILER )
 	libfsntfs_profiler_t *profiler = NULL;
@@ -228,6 +250,10 @@ int libfsntfs_io_handle_clear(
 
 		return( -1 );
 	}
+	/* The number of read threads is a setting that is retained
+	 */
+	number_of_read_threads = io_handle->number_of_read_threads;
+
 #if defined( HAVE_PROFILER )
 	profiler = io_handle->profiler;
 #endif
@@ -245,6 +271,8 @@ int libfsntfs_io_handle_clear(
 
 		return( -1 );
 	}
+	io_handle->number_of_read_threads = number_of_read_threads;
+
 #if defined( HAVE_PROFILER )
 	io_handle->profiler = profiler;
 #endif
@@ -25,8 +25,10 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfsntfs_definitions.h"
 #include "libfsntfs_libcerror.h"
 #include "libfsntfs_profiler.h"
+#include "libfsntfs_read_thread_pool.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -60,6 +62,20 @@ struct libfsntfs_io_handle
 	libfsntfs_profiler_t *profiler;
 #endif
 
+	/* The number of threads used to keep reads in flight
+	 */
+	int number_of_read_threads;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	/* The read thread pool
+	 */
+	libfsntfs_read_thread_pool_t *read_thread_pool;
+#endif
+
+	/* The statistics values
+	 */
+	uint64_t statistics[ LIBFSNTFS_STATISTICS_NUMBER_OF_VALUES ];
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
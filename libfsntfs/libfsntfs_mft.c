@@ -32,6 +32,7 @@
 #include "libfsntfs_mft.h"
 #include "libfsntfs_mft_attribute_list.h"
 #include "libfsntfs_mft_entry.h"
+#include "libfsntfs_statistics.h"
 #include "libfsntfs_types.h"
 
 /* Creates a MFT
@@ -564,6 +565,11 @@ int libfsntfs_mft_get_mft_entry_by_index(
 
 		return( -1 );
 	}
+	libfsntfs_statistics_add_value(
+	 mft->io_handle->statistics,
+	 LIBFSNTFS_STATISTICS_VALUE_MFT_ENTRY_LOOKUPS,
+	 1 );
+
 	if( libfdata_vector_get_element_value_by_index(
 	     mft->mft_entry_vector,
 	     (intptr_t *) file_io_handle,
@@ -653,6 +659,11 @@ int libfsntfs_mft_get_mft_entry_by_index_no_cache(
 
 		return( -1 );
 	}
+	libfsntfs_statistics_add_value(
+	 mft->io_handle->statistics,
+	 LIBFSNTFS_STATISTICS_VALUE_MFT_ENTRY_LOOKUPS,
+	 1 );
+
 	if( libfdata_vector_get_element_value_by_index(
 	     mft->mft_entry_vector,
 	     (intptr_t *) file_io_handle,
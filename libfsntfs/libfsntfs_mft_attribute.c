@@ -31,6 +31,7 @@
 #include "libfsntfs_libcdata.h"
 #include "libfsntfs_libcerror.h"
 #include "libfsntfs_libcnotify.h"
+#include "libfsntfs_libcthreads.h"
 #include "libfsntfs_libuna.h"
 #include "libfsntfs_mft_attribute.h"
 #include "libfsntfs_name.h"
@@ -133,32 +134,18 @@ int libfsntfs_mft_attribute_free(
 	}
 	if( *mft_attribute != NULL )
 	{
-		if( ( *mft_attribute )->name != NULL )
+		/* The name and data reference either the MFT entry data
+		 * or the data buffer and are not freed separately
+		 */
+		if( ( *mft_attribute )->data_buffer != NULL )
 		{
 			memory_free(
-			 ( *mft_attribute )->name );
+			 ( *mft_attribute )->data_buffer );
 		}
-		if( ( *mft_attribute )->data != NULL )
+		if( ( *mft_attribute )->data_runs != NULL )
 		{
 			memory_free(
-			 ( *mft_attribute )->data );
-		}
-		if( ( *mft_attribute )->data_runs_array != NULL )
-		{
-			if( libcdata_array_free(
-			     &( ( *mft_attribute )->data_runs_array ),
-			     (int (*)(intptr_t **, libcerror_error_t **)) &libfsntfs_data_run_free,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free data runs array.",
-				 function );
-
-				result = -1;
-			}
+			 ( *mft_attribute )->data_runs );
 		}
 		memory_free(
 		 *mft_attribute );
@@ -169,6 +156,9 @@ int libfsntfs_mft_attribute_free(
 }
 
 /* Reads the MFT attribute
+ * The name, resident data and data runs reference the data, which must remain
+ * available for the lifetime of the MFT attribute or until
+ * libfsntfs_mft_attribute_copy_data_to_buffer is called
  * Returns 1 if successful or -1 on error
  */
 int libfsntfs_mft_attribute_read_data(
@@ -178,23 +168,18 @@ int libfsntfs_mft_attribute_read_data(
      size_t data_size,
      libcerror_error_t **error )
 {
-	libfsntfs_data_run_t *data_run     = NULL;
-	const uint8_t *non_resident_data   = NULL;
-	const uint8_t *resident_data       = NULL;
-	static char *function              = "libfsntfs_mft_attribute_read_data";
-	size_t data_offset                 = 0;
-	size_t non_resident_data_size      = 0;
-	ssize_t read_count                 = 0;
-	uint64_t last_cluster_block_number = 0;
-	uint16_t compression_unit_size     = 0;
-	uint16_t data_runs_offset          = 0;
-	uint16_t name_offset               = 0;
-	int data_run_index                 = 0;
-	int entry_index                    = 0;
+	const uint8_t *non_resident_data = NULL;
+	const uint8_t *resident_data     = NULL;
+	static char *function            = "libfsntfs_mft_attribute_read_data";
+	size_t data_offset               = 0;
+	size_t non_resident_data_size    = 0;
+	uint16_t compression_unit_size   = 0;
+	uint16_t data_runs_offset        = 0;
+	uint16_t name_offset             = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
-	uint64_t value_64bit               = 0;
-	uint32_t value_32bit               = 0;
+	uint64_t value_64bit             = 0;
+	uint32_t value_32bit             = 0;
 #endif
 
 	if( mft_attribute == NULL )
@@ -230,13 +215,13 @@ int libfsntfs_mft_attribute_read_data(
 
 		return( -1 );
 	}
-	if( mft_attribute->data_runs_array != NULL )
+	if( mft_attribute->data_runs != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid MFT attribute - data runs array value already set.",
+		 "%s: invalid MFT attribute - data runs value already set.",
 		 function );
 
 		return( -1 );
@@ -732,34 +717,8 @@ int libfsntfs_mft_attribute_read_data(
 			 0 );
 		}
 #endif
-		mft_attribute->name = (uint8_t *) memory_allocate(
-		                                   sizeof( uint8_t ) * (size_t) mft_attribute->name_size );
-
-		if( mft_attribute->name == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create name.",
-			 function );
-
-			goto on_error;
-		}
-		if( memory_copy(
-		     mft_attribute->name,
-		     &( data[ data_offset ] ),
-		     (size_t) mft_attribute->name_size ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy name.",
-			 function );
+		mft_attribute->name = (uint8_t *) &( data[ data_offset ] );
 
-			goto on_error;
-		}
 		data_offset += (size_t) mft_attribute->name_size;
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -826,34 +785,8 @@ int libfsntfs_mft_attribute_read_data(
 				 0 );
 			}
 #endif
-			mft_attribute->data = (uint8_t *) memory_allocate(
-			                                   sizeof( uint8_t ) * (size_t) mft_attribute->data_size );
-
-			if( mft_attribute->data == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create resident data.",
-				 function );
-
-				goto on_error;
-			}
-			if( memory_copy(
-			     mft_attribute->data,
-			     &( data[ mft_attribute->data_offset ] ),
-			     (size_t) mft_attribute->data_size ) == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-				 "%s: unable to copy resident data.",
-				 function );
+			mft_attribute->data = (uint8_t *) &( data[ mft_attribute->data_offset ] );
 
-				goto on_error;
-			}
 			data_offset = (size_t) mft_attribute->data_offset + (size_t) mft_attribute->data_size;
 		}
 	}
@@ -889,171 +822,500 @@ int libfsntfs_mft_attribute_read_data(
 			}
 		}
 #endif
-		data_offset = (size_t) data_runs_offset;
+		/* The data runs are read on first use
+		 */
+		mft_attribute->data_runs_data      = (uint8_t *) &( data[ data_runs_offset ] );
+		mft_attribute->data_runs_data_size = (size_t) mft_attribute->size - data_runs_offset;
+		mft_attribute->io_handle           = io_handle;
 
-		if( libcdata_array_initialize(
-		     &( mft_attribute->data_runs_array ),
-		     0,
-		     error ) != 1 )
+		data_offset = (size_t) mft_attribute->size;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( data_offset < mft_attribute->size )
+		{
+			libcnotify_printf(
+			 "%s: trailing data:\n",
+			 function );
+			libcnotify_print_data(
+			 &( data[ data_offset ] ),
+			 (size_t) mft_attribute->size - data_offset,
+			 0 );
+		}
+	}
+#endif
+	return( 1 );
+
+on_error:
+	mft_attribute->data_runs_data      = NULL;
+	mft_attribute->data_runs_data_size = 0;
+	mft_attribute->io_handle           = NULL;
+	mft_attribute->data                = NULL;
+	mft_attribute->name                = NULL;
+	mft_attribute->name_size           = 0;
+
+	return( -1 );
+}
+
+/* Decodes the data runs
+ * The data runs are decoded in a single pass into a contiguous array,
+ * which is shrunk to the number of data runs afterwards
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_mft_attribute_decode_data_runs(
+     libfsntfs_mft_attribute_t *mft_attribute,
+     libcerror_error_t **error )
+{
+	libfsntfs_data_run_t *data_run     = NULL;
+	libfsntfs_data_run_t *data_runs    = NULL;
+	static char *function              = "libfsntfs_mft_attribute_decode_data_runs";
+	size_t data_offset                 = 0;
+	size_t maximum_number_of_data_runs = 0;
+	ssize_t read_count                 = 0;
+	uint64_t last_cluster_block_number = 0;
+	uint64_t vcn                       = 0;
+
+	if( mft_attribute == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MFT attribute.",
+		 function );
+
+		return( -1 );
+	}
+	if( mft_attribute->data_runs_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid MFT attribute - missing data runs data.",
+		 function );
+
+		return( -1 );
+	}
+	if( mft_attribute->data_runs != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid MFT attribute - data runs value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every data run consumes at least 2 bytes, a value sizes tuple and
+	 * a number of cluster blocks value, which bounds the number of data runs.
+	 * An additional entry is reserved for the terminator.
+	 */
+	maximum_number_of_data_runs = ( mft_attribute->data_runs_data_size / 2 ) + 1;
+
+	if( maximum_number_of_data_runs > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsntfs_data_run_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of data runs value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	mft_attribute->data_runs = (libfsntfs_data_run_t *) memory_allocate(
+	                                                     sizeof( libfsntfs_data_run_t ) * maximum_number_of_data_runs );
+
+	if( mft_attribute->data_runs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data runs.",
+		 function );
+
+		goto on_error;
+	}
+	mft_attribute->number_of_data_runs = 0;
+
+	vcn = mft_attribute->data_first_vcn;
+
+	while( data_offset < mft_attribute->data_runs_data_size )
+	{
+		if( (size_t) mft_attribute->number_of_data_runs >= maximum_number_of_data_runs )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create data runs array.",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of data runs value out of bounds.",
 			 function );
 
 			goto on_error;
 		}
-		while( data_offset < data_size )
-		{
-			if( libfsntfs_data_run_initialize(
-			     &data_run,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create data run: %d.",
-				 function,
-				 data_run_index );
+		data_run = &( mft_attribute->data_runs[ mft_attribute->number_of_data_runs ] );
 
-				goto on_error;
-			}
 #if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: reading data run: %d.\n",
-				 function,
-				 data_run_index );
-			}
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: reading data run: %d.\n",
+			 function,
+			 mft_attribute->number_of_data_runs );
+		}
 #endif
-			read_count = libfsntfs_data_run_read_data(
-			              data_run,
-			              io_handle,
-			              &( data[ data_offset ] ),
-			              data_size - data_offset,
-			              last_cluster_block_number,
-			              error );
-
-			if( read_count <= -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read data run: %d.",
-				 function,
-				 data_run_index );
-
-				goto on_error;
-			}
-			else if( read_count == 1 )
-			{
-				if( libfsntfs_data_run_free(
-				     &data_run,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-					 "%s: unable to free data run: %d.",
-					 function,
-					 data_run_index );
+		read_count = libfsntfs_data_run_read_data(
+		              data_run,
+		              mft_attribute->io_handle,
+		              &( mft_attribute->data_runs_data[ data_offset ] ),
+		              mft_attribute->data_runs_data_size - data_offset,
+		              last_cluster_block_number,
+		              error );
+
+		if( read_count <= -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data run: %d.",
+			 function,
+			 mft_attribute->number_of_data_runs );
 
-					goto on_error;
-				}
-				break;
-			}
-			data_offset += read_count;
+			goto on_error;
+		}
+		else if( read_count == 1 )
+		{
+			break;
+		}
+		data_offset += read_count;
 
 #if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
+		if( libcnotify_verbose != 0 )
+		{
+			if( ( data_run->start_offset == 0 )
+			 && ( ( mft_attribute->data_flags & LIBFSNTFS_ATTRIBUTE_FLAG_COMPRESSION_MASK ) == 0 )
+			 && ( ( mft_attribute->data_flags & LIBFSNTFS_ATTRIBUTE_FLAG_SPARSE ) == 0 ) )
 			{
-				if( ( data_run->start_offset == 0 )
-				 && ( ( mft_attribute->data_flags & LIBFSNTFS_ATTRIBUTE_FLAG_COMPRESSION_MASK ) == 0 )
-				 && ( ( mft_attribute->data_flags & LIBFSNTFS_ATTRIBUTE_FLAG_SPARSE ) == 0 ) )
-				{
-					libcnotify_printf(
-					 "%s: data run is sparse but no attribute data flags set.\n\n",
-					 function );
-				}
+				libcnotify_printf(
+				 "%s: data run is sparse but no attribute data flags set.\n\n",
+				 function );
 			}
+		}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
-			if( ( data_run->range_flags & LIBFDATA_RANGE_FLAG_IS_SPARSE ) == 0 )
-			{
-				last_cluster_block_number = data_run->cluster_block_number;
-			}
-			if( libcdata_array_append_entry(
-			     mft_attribute->data_runs_array,
-			     &entry_index,
-			     (intptr_t *) data_run,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to append data run: %d to array.",
-				 function,
-				 data_run_index );
+		if( ( data_run->range_flags & LIBFDATA_RANGE_FLAG_IS_SPARSE ) == 0 )
+		{
+			last_cluster_block_number = data_run->cluster_block_number;
+		}
+		data_run->vcn = vcn;
 
-				goto on_error;
-			}
-			data_run = NULL;
+		vcn += data_run->number_of_cluster_blocks;
 
-			data_run_index++;
-		}
+		mft_attribute->number_of_data_runs++;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	/* The maximum number of data runs is a worst case estimate, hence
+	 * the array is shrunk to the number of data runs that were decoded
+	 */
+	if( mft_attribute->number_of_data_runs == 0 )
 	{
-		if( data_offset < mft_attribute->size )
+		memory_free(
+		 mft_attribute->data_runs );
+
+		mft_attribute->data_runs = NULL;
+	}
+	else if( (size_t) mft_attribute->number_of_data_runs < maximum_number_of_data_runs )
+	{
+		data_runs = (libfsntfs_data_run_t *) memory_reallocate(
+		                                      mft_attribute->data_runs,
+		                                      sizeof( libfsntfs_data_run_t ) * mft_attribute->number_of_data_runs );
+
+		if( data_runs == NULL )
 		{
-			libcnotify_printf(
-			 "%s: trailing data:\n",
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize data runs.",
 			 function );
-			libcnotify_print_data(
-			 &( data[ data_offset ] ),
-			 (size_t) mft_attribute->size - data_offset,
-			 0 );
+
+			goto on_error;
 		}
+		mft_attribute->data_runs = data_runs;
 	}
-#endif
 	return( 1 );
 
 on_error:
-	if( data_run != NULL )
+	if( mft_attribute->data_runs != NULL )
 	{
-		libfsntfs_data_run_free(
-		 &data_run,
-		 NULL );
+		memory_free(
+		 mft_attribute->data_runs );
+
+		mft_attribute->data_runs = NULL;
 	}
-	if( mft_attribute->data_runs_array != NULL )
+	mft_attribute->number_of_data_runs = 0;
+
+	return( -1 );
+}
+
+/* Reads the data runs
+ * The data runs are decoded on first use. Since the MFT attribute can be part of
+ * an MFT entry that is shared by multiple threads the decoding is guarded by
+ * an atomic state, the thread that changes the state to decoding decodes the data runs
+ * while other threads wait until the state changes to decoded
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_mft_attribute_read_data_runs(
+     libfsntfs_mft_attribute_t *mft_attribute,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_mft_attribute_read_data_runs";
+	int data_runs_state   = 0;
+	int result            = 0;
+
+	if( mft_attribute == NULL )
 	{
-		libcdata_array_free(
-		 &( mft_attribute->data_runs_array ),
-		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsntfs_data_run_free,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MFT attribute.",
+		 function );
+
+		return( -1 );
+	}
+	/* The data runs data is set when the MFT attribute is read and not changed afterwards
+	 */
+	if( mft_attribute->data_runs_data == NULL )
+	{
+		return( 1 );
+	}
+	do
+	{
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT ) && defined( __GNUC__ )
+		/* If the exchange fails data runs state is set to the current state
+		 */
+		data_runs_state = LIBFSNTFS_MFT_ATTRIBUTE_DATA_RUNS_STATE_NOT_DECODED;
+
+		__atomic_compare_exchange_n(
+		 &( mft_attribute->data_runs_state ),
+		 &data_runs_state,
+		 LIBFSNTFS_MFT_ATTRIBUTE_DATA_RUNS_STATE_DECODING,
+		 0,
+		 __ATOMIC_ACQUIRE,
+		 __ATOMIC_ACQUIRE );
+
+#elif defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT ) && defined( WINAPI )
+		data_runs_state = (int) InterlockedCompareExchange(
+		                         (LONG volatile *) &( mft_attribute->data_runs_state ),
+		                         (LONG) LIBFSNTFS_MFT_ATTRIBUTE_DATA_RUNS_STATE_DECODING,
+		                         (LONG) LIBFSNTFS_MFT_ATTRIBUTE_DATA_RUNS_STATE_NOT_DECODED );
+
+#else
+		data_runs_state = mft_attribute->data_runs_state;
+
+		if( data_runs_state == LIBFSNTFS_MFT_ATTRIBUTE_DATA_RUNS_STATE_NOT_DECODED )
+		{
+			mft_attribute->data_runs_state = LIBFSNTFS_MFT_ATTRIBUTE_DATA_RUNS_STATE_DECODING;
+		}
+#endif
+		if( data_runs_state == LIBFSNTFS_MFT_ATTRIBUTE_DATA_RUNS_STATE_DECODED )
+		{
+			return( 1 );
+		}
+		/* Another thread is decoding the data runs, the decoding is short
+		 * and does not block hence the state is checked again until it changes
+		 */
+	}
+	while( data_runs_state != LIBFSNTFS_MFT_ATTRIBUTE_DATA_RUNS_STATE_NOT_DECODED );
+
+	result = libfsntfs_mft_attribute_decode_data_runs(
+	          mft_attribute,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to decode data runs.",
+		 function );
+
+		data_runs_state = LIBFSNTFS_MFT_ATTRIBUTE_DATA_RUNS_STATE_NOT_DECODED;
+	}
+	else
+	{
+		data_runs_state = LIBFSNTFS_MFT_ATTRIBUTE_DATA_RUNS_STATE_DECODED;
+	}
+	/* The release makes the decoded data runs visible to the threads that observe the state
+	 */
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT ) && defined( __GNUC__ )
+	__atomic_store_n(
+	 &( mft_attribute->data_runs_state ),
+	 data_runs_state,
+	 __ATOMIC_RELEASE );
+
+#elif defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT ) && defined( WINAPI )
+	InterlockedExchange(
+	 (LONG volatile *) &( mft_attribute->data_runs_state ),
+	 (LONG) data_runs_state );
+
+#else
+	mft_attribute->data_runs_state = data_runs_state;
+
+#endif
+	if( result != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies the name, resident data and data runs data into the data buffer
+ * This is needed when the MFT attribute outlives the MFT entry data it was read from
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_mft_attribute_copy_data_to_buffer(
+     libfsntfs_mft_attribute_t *mft_attribute,
+     libcerror_error_t **error )
+{
+	static char *function   = "libfsntfs_mft_attribute_copy_data_to_buffer";
+	size_t data_buffer_size = 0;
+	size_t data_runs_size   = 0;
+	size_t resident_size    = 0;
+
+	if( mft_attribute == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MFT attribute.",
+		 function );
+
+		return( -1 );
+	}
+	if( mft_attribute->data_buffer != NULL )
+	{
+		return( 1 );
 	}
 	if( mft_attribute->data != NULL )
 	{
-		memory_free(
-		 mft_attribute->data );
+		if( mft_attribute->data_size > (uint64_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - mft_attribute->name_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid MFT attribute - data size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		resident_size = (size_t) mft_attribute->data_size;
+	}
+	if( mft_attribute->data_runs_data != NULL )
+	{
+		data_runs_size = mft_attribute->data_runs_data_size;
+	}
+	if( mft_attribute->name != NULL )
+	{
+		data_buffer_size = (size_t) mft_attribute->name_size;
+	}
+	data_buffer_size += resident_size + data_runs_size;
+
+	if( data_buffer_size == 0 )
+	{
+		return( 1 );
+	}
+	mft_attribute->data_buffer = (uint8_t *) memory_allocate(
+	                                          sizeof( uint8_t ) * data_buffer_size );
+
+	if( mft_attribute->data_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data buffer.",
+		 function );
 
-		mft_attribute->data = NULL;
+		return( -1 );
 	}
 	if( mft_attribute->name != NULL )
 	{
-		memory_free(
-		 mft_attribute->name );
+		if( memory_copy(
+		     mft_attribute->data_buffer,
+		     mft_attribute->name,
+		     (size_t) mft_attribute->name_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy name.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( data_runs_size > 0 )
+	{
+		if( memory_copy(
+		     &( mft_attribute->data_buffer[ data_buffer_size - data_runs_size ] ),
+		     mft_attribute->data_runs_data,
+		     data_runs_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data runs data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( resident_size > 0 )
+	{
+		if( memory_copy(
+		     &( mft_attribute->data_buffer[ data_buffer_size - data_runs_size - resident_size ] ),
+		     mft_attribute->data,
+		     resident_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy resident data.",
+			 function );
 
-		mft_attribute->name = NULL;
+			goto on_error;
+		}
+	}
+	if( mft_attribute->name != NULL )
+	{
+		mft_attribute->name = mft_attribute->data_buffer;
+	}
+	if( resident_size > 0 )
+	{
+		mft_attribute->data = &( mft_attribute->data_buffer[ data_buffer_size - data_runs_size - resident_size ] );
+	}
+	if( data_runs_size > 0 )
+	{
+		mft_attribute->data_runs_data = &( mft_attribute->data_buffer[ data_buffer_size - data_runs_size ] );
 	}
-	mft_attribute->name_size = 0;
+	return( 1 );
+
+on_error:
+	memory_free(
+	 mft_attribute->data_buffer );
+
+	mft_attribute->data_buffer = NULL;
 
 	return( -1 );
 }
@@ -1740,39 +2002,110 @@ int libfsntfs_mft_attribute_get_number_of_data_runs(
 
 		return( -1 );
 	}
-	if( mft_attribute->data_runs_array == NULL )
+	if( libfsntfs_mft_attribute_read_data_runs(
+	     mft_attribute,
+	     error ) != 1 )
 	{
-		if( number_of_data_runs == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-			 "%s: invalid number of data runs.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data runs.",
+		 function );
 
-			return( -1 );
-		}
-		*number_of_data_runs = 0;
+		return( -1 );
 	}
-	else
+	if( number_of_data_runs == NULL )
 	{
-		if( libcdata_array_get_number_of_entries(
-		     mft_attribute->data_runs_array,
-		     number_of_data_runs,
-		     error ) != 1 )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of data runs.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_data_runs = mft_attribute->number_of_data_runs;
+
+	return( 1 );
+}
+
+/* Retrieves the index of the data run that contains a specific VCN
+ * Returns 1 if successful, 0 if no such data run or -1 on error
+ */
+int libfsntfs_mft_attribute_get_data_run_index_at_vcn(
+     libfsntfs_mft_attribute_t *mft_attribute,
+     uint64_t vcn,
+     int *data_run_index,
+     libcerror_error_t **error )
+{
+	libfsntfs_data_run_t *data_run = NULL;
+	static char *function          = "libfsntfs_mft_attribute_get_data_run_index_at_vcn";
+	int lower_index                = 0;
+	int middle_index               = 0;
+	int upper_index                = 0;
+
+	if( mft_attribute == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MFT attribute.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_run_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data run index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsntfs_mft_attribute_read_data_runs(
+	     mft_attribute,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data runs.",
+		 function );
+
+		return( -1 );
+	}
+	/* The data runs are contiguous and sorted by VCN
+	 */
+	upper_index = mft_attribute->number_of_data_runs;
+
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+		data_run     = &( mft_attribute->data_runs[ middle_index ] );
+
+		if( vcn < data_run->vcn )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of data runs.",
-			 function );
+			upper_index = middle_index;
+		}
+		else if( ( vcn - data_run->vcn ) >= data_run->number_of_cluster_blocks )
+		{
+			lower_index = middle_index + 1;
+		}
+		else
+		{
+			*data_run_index = middle_index;
 
-			return( -1 );
+			return( 1 );
 		}
 	}
-	return( 1 );
+	return( 0 );
 }
 
 /* Retrieves a specific data run
@@ -1797,22 +2130,44 @@ int libfsntfs_mft_attribute_get_data_run_by_index(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     mft_attribute->data_runs_array,
-	     data_run_index,
-	     (intptr_t **) data_run,
+	if( libfsntfs_mft_attribute_read_data_runs(
+	     mft_attribute,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve data run: %d.",
-		 function,
-		 data_run_index );
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data runs.",
+		 function );
 
 		return( -1 );
 	}
+	if( ( data_run_index < 0 )
+	 || ( data_run_index >= mft_attribute->number_of_data_runs ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data run index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_run == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data run.",
+		 function );
+
+		return( -1 );
+	}
+	*data_run = &( mft_attribute->data_runs[ data_run_index ] );
+
 	return( 1 );
 }
 
@@ -1835,7 +2190,6 @@ int libfsntfs_mft_attribute_get_data_extents_array(
 	int attribute_index                          = 0;
 	int data_run_index                           = 0;
 	int entry_index                              = 0;
-	int number_of_data_runs                      = 0;
 
 	if( mft_attribute == NULL )
 	{
@@ -1897,7 +2251,21 @@ int libfsntfs_mft_attribute_get_data_extents_array(
 	}
 	while( mft_attribute != NULL )
 	{
-		if( mft_attribute->data_runs_array != NULL )
+		if( libfsntfs_mft_attribute_read_data_runs(
+		     mft_attribute,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read attribute: %d data runs.",
+			 function,
+			 attribute_index );
+
+			goto on_error;
+		}
+		if( mft_attribute->data_runs != NULL )
 		{
 			attribute_data_vcn_offset = mft_attribute->data_first_vcn;
 			attribute_data_vcn_size   = mft_attribute->data_last_vcn;
@@ -1945,51 +2313,22 @@ int libfsntfs_mft_attribute_get_data_extents_array(
 				}
 				calculated_attribute_data_vcn_offset = attribute_data_vcn_offset + (off64_t) attribute_data_vcn_size;
 			}
-			if( libcdata_array_get_number_of_entries(
-			     mft_attribute->data_runs_array,
-			     &number_of_data_runs,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve attribute: %d number of data runs.",
-				 function,
-				 attribute_index );
-
-				goto on_error;
-			}
 			for( data_run_index = 0;
-			     data_run_index < number_of_data_runs;
+			     data_run_index < mft_attribute->number_of_data_runs;
 			     data_run_index++ )
 			{
-				if( libcdata_array_get_entry_by_index(
-				     mft_attribute->data_runs_array,
+				if( libfsntfs_mft_attribute_get_data_run_by_index(
+				     mft_attribute,
 				     data_run_index,
-				     (intptr_t **) &data_run,
+				     &data_run,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve attribute: %d data run: %d.",
-					 function,
-					 attribute_index,
-					 data_run_index );
-
-					goto on_error;
-				}
-				if( data_run == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-					 "%s: missing attribute: %d data run: %d.",
+					 "%s: unable to retrieve data run: %d.",
 					 function,
-					 attribute_index,
 					 data_run_index );
 
 					goto on_error;
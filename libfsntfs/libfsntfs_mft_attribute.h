@@ -34,6 +34,13 @@
 extern "C" {
 #endif
 
+enum LIBFSNTFS_MFT_ATTRIBUTE_DATA_RUNS_STATES
+{
+	LIBFSNTFS_MFT_ATTRIBUTE_DATA_RUNS_STATE_NOT_DECODED	= 0,
+	LIBFSNTFS_MFT_ATTRIBUTE_DATA_RUNS_STATE_DECODING	= 1,
+	LIBFSNTFS_MFT_ATTRIBUTE_DATA_RUNS_STATE_DECODED		= 2
+};
+
 typedef struct libfsntfs_mft_attribute libfsntfs_mft_attribute_t;
 
 struct libfsntfs_mft_attribute
@@ -91,16 +98,45 @@ struct libfsntfs_mft_attribute
 	uint64_t valid_data_size;
 
 	/* The name
+	 * References the MFT entry data or the data buffer
 	 */
 	uint8_t *name;
 
-	/* The data
+	/* The (resident) data
+	 * References the MFT entry data or the data buffer
 	 */
 	uint8_t *data;
 
-	/* The data runs array
+	/* The data runs data, which is decoded on first use
+	 * References the MFT entry data or the data buffer
+	 */
+	uint8_t *data_runs_data;
+
+	/* The data runs data size
+	 */
+	size_t data_runs_data_size;
+
+	/* The IO handle used to decode the data runs
 	 */
-	libcdata_array_t *data_runs_array;
+	libfsntfs_io_handle_t *io_handle;
+
+	/* The data buffer, which contains a copy of the name, resident data
+	 * and data runs data when the attribute no longer references
+	 * the MFT entry data
+	 */
+	uint8_t *data_buffer;
+
+	/* The data runs, sorted by VCN
+	 */
+	libfsntfs_data_run_t *data_runs;
+
+	/* The number of data runs
+	 */
+	int number_of_data_runs;
+
+	/* The data runs state, which is changed atomically with multi-threading support
+	 */
+	int data_runs_state;
 
 	/* The next attribute in an attribute chain
 	 */
@@ -122,6 +158,18 @@ int libfsntfs_mft_attribute_read_data(
      size_t data_size,
      libcerror_error_t **error );
 
+int libfsntfs_mft_attribute_decode_data_runs(
+     libfsntfs_mft_attribute_t *mft_attribute,
+     libcerror_error_t **error );
+
+int libfsntfs_mft_attribute_read_data_runs(
+     libfsntfs_mft_attribute_t *mft_attribute,
+     libcerror_error_t **error );
+
+int libfsntfs_mft_attribute_copy_data_to_buffer(
+     libfsntfs_mft_attribute_t *mft_attribute,
+     libcerror_error_t **error );
+
 int libfsntfs_mft_attribute_data_is_resident(
      libfsntfs_mft_attribute_t *mft_attribute,
      libcerror_error_t **error );
@@ -202,6 +250,12 @@ int libfsntfs_mft_attribute_get_number_of_data_runs(
      int *number_of_data_runs,
      libcerror_error_t **error );
 
+int libfsntfs_mft_attribute_get_data_run_index_at_vcn(
+     libfsntfs_mft_attribute_t *mft_attribute,
+     uint64_t vcn,
+     int *data_run_index,
+     libcerror_error_t **error );
+
 int libfsntfs_mft_attribute_get_data_run_by_index(
      libfsntfs_mft_attribute_t *mft_attribute,
      int data_run_index,
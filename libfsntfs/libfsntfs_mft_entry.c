@@ -33,6 +33,7 @@
 #include "libfsntfs_libcdata.h"
 #include "libfsntfs_libcerror.h"
 #include "libfsntfs_libcnotify.h"
+#include "libfsntfs_libcthreads.h"
 #include "libfsntfs_libfcache.h"
 #include "libfsntfs_libfdata.h"
 #include "libfsntfs_libuna.h"
@@ -42,6 +43,7 @@
 #include "libfsntfs_mft_entry.h"
 #include "libfsntfs_mft_entry_header.h"
 #include "libfsntfs_standard_information_values.h"
+#include "libfsntfs_statistics.h"
 #include "libfsntfs_types.h"
 #include "libfsntfs_unused.h"
 
@@ -241,6 +243,7 @@ int libfsntfs_mft_entry_initialize(
 	( *mft_entry )->standard_information_attribute_index = -1;
 	( *mft_entry )->volume_information_attribute_index   = -1;
 	( *mft_entry )->volume_name_attribute_index          = -1;
+	( *mft_entry )->number_of_references                 = 1;
 
 	return( 1 );
 
@@ -270,14 +273,16 @@ on_error:
 }
 
 /* Frees a MFT entry
+ * The MFT entry is only freed when the last reference is released
  * Returns 1 if successful or -1 on error
  */
 int libfsntfs_mft_entry_free(
      libfsntfs_mft_entry_t **mft_entry,
      libcerror_error_t **error )
 {
-	static char *function = "libfsntfs_mft_entry_free";
-	int result            = 1;
+	static char *function    = "libfsntfs_mft_entry_free";
+	int number_of_references = 0;
+	int result               = 1;
 
 	if( mft_entry == NULL )
 	{
@@ -292,6 +297,28 @@ int libfsntfs_mft_entry_free(
 	}
 	if( *mft_entry != NULL )
 	{
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT ) && defined( __GNUC__ )
+		number_of_references = __atomic_sub_fetch(
+		                        &( ( *mft_entry )->number_of_references ),
+		                        1,
+		                        __ATOMIC_ACQ_REL );
+
+#elif defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT ) && defined( WINAPI )
+		number_of_references = (int) InterlockedDecrement(
+		                              (LONG volatile *) &( ( *mft_entry )->number_of_references ) );
+
+#else
+		( *mft_entry )->number_of_references -= 1;
+
+		number_of_references = ( *mft_entry )->number_of_references;
+
+#endif
+		if( number_of_references > 0 )
+		{
+			*mft_entry = NULL;
+
+			return( 1 );
+		}
 		if( ( *mft_entry )->header != NULL )
 		{
 			if( libfsntfs_mft_entry_header_free(
@@ -371,6 +398,55 @@ int libfsntfs_mft_entry_free(
 	return( result );
 }
 
+/* Adds a reference to a MFT entry
+ * Every reference must be released with libfsntfs_mft_entry_free
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_mft_entry_add_reference(
+     libfsntfs_mft_entry_t *mft_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_mft_entry_add_reference";
+
+	if( mft_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MFT entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( mft_entry->number_of_references <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid MFT entry - number of references value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT ) && defined( __GNUC__ )
+	__atomic_add_fetch(
+	 &( mft_entry->number_of_references ),
+	 1,
+	 __ATOMIC_RELAXED );
+
+#elif defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT ) && defined( WINAPI )
+	InterlockedIncrement(
+	 (LONG volatile *) &( mft_entry->number_of_references ) );
+
+#else
+	mft_entry->number_of_references += 1;
+
+#endif
+	return( 1 );
+}
+
 /* Reads the MFT entry
  * Returns 1 if successful, 0 if empty or marked as bad, or -1 on error
  */
@@ -624,6 +700,28 @@ int libfsntfs_mft_entry_read_data(
 	}
 	if( number_of_fixup_values > 0 )
 	{
+		result = libfsntfs_fixup_values_verify(
+		          data,
+		          data_size,
+		          fixup_values_offset,
+		          number_of_fixup_values,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to verify fix-up values.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			mft_entry->has_fixup_value_mismatch = 1;
+		}
 		if( libfsntfs_fixup_values_apply(
 		     data,
 		     data_size,
@@ -1567,6 +1665,23 @@ int libfsntfs_mft_entry_read_attribute_list_data_mft_entry_by_index(
 
 			return( -1 );
 		}
+		/* The attribute references the data of the list MFT entry
+		 * which is freed when the MFT entry cache is freed
+		 */
+		if( libfsntfs_mft_attribute_copy_data_to_buffer(
+		     mft_attribute,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy data of attribute: %d from list MFT entry.",
+			 function,
+			 attribute_index );
+
+			return( -1 );
+		}
 		if( libcdata_array_set_entry_by_index(
 		     data_mft_entry->attributes_array,
 		     attribute_index,
@@ -3063,7 +3178,7 @@ int libfsntfs_mft_entry_has_directory_entries_index(
  * Returns 1 if successful or -1 on error
  */
 int libfsntfs_mft_entry_read_element_data(
-     intptr_t *data_handle LIBFSNTFS_ATTRIBUTE_UNUSED,
+     libfsntfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      libfdata_vector_t *vector,
      libfdata_cache_t *cache,
@@ -3078,7 +3193,6 @@ int libfsntfs_mft_entry_read_element_data(
 	libfsntfs_mft_entry_t *mft_entry = NULL;
 	static char *function            = "libfsntfs_mft_entry_read_element_data";
 
-	LIBFSNTFS_UNREFERENCED_PARAMETER( data_handle )
 	LIBFSNTFS_UNREFERENCED_PARAMETER( element_data_file_index )
 	LIBFSNTFS_UNREFERENCED_PARAMETER( element_flags )
 	LIBFSNTFS_UNREFERENCED_PARAMETER( read_flags )
@@ -3141,6 +3255,28 @@ int libfsntfs_mft_entry_read_element_data(
 
 		goto on_error;
 	}
+	/* The IO handle is not set when the MFT entry vector is used without a volume
+	 */
+	if( io_handle != NULL )
+	{
+		libfsntfs_statistics_add_value(
+		 io_handle->statistics,
+		 LIBFSNTFS_STATISTICS_VALUE_MFT_ENTRIES_READ,
+		 1 );
+
+		libfsntfs_statistics_add_value(
+		 io_handle->statistics,
+		 LIBFSNTFS_STATISTICS_VALUE_MFT_BYTES_READ,
+		 (uint64_t) element_data_size );
+
+		if( mft_entry->has_fixup_value_mismatch != 0 )
+		{
+			libfsntfs_statistics_add_value(
+			 io_handle->statistics,
+			 LIBFSNTFS_STATISTICS_VALUE_MFT_ENTRY_FIXUP_FAILURES,
+			 1 );
+		}
+	}
 	if( libfdata_vector_set_element_value_by_index(
 	     vector,
 	     (intptr_t *) file_io_handle,
@@ -112,6 +112,11 @@ struct libfsntfs_mft_entry
 	 */
 	int volume_name_attribute_index;
 
+	/* The number of references to the MFT entry
+	 * A cached MFT entry is shared by the MFT entry cache and the file entries
+	 */
+	int number_of_references;
+
 	/* Value to indicate the MFT entry is empty
 	 */
 	uint8_t is_empty;
@@ -120,6 +125,10 @@ struct libfsntfs_mft_entry
 	 */
 	uint8_t is_corrupted;
 
+	/* Value to indicate the fix-up placeholders did not match when the MFT entry was read
+	 */
+	uint8_t has_fixup_value_mismatch;
+
 	/* Value to indicate the MFT entry has an $I30 index
 	 */
 	uint8_t has_i30_index;
@@ -142,6 +151,10 @@ int libfsntfs_mft_entry_free(
      libfsntfs_mft_entry_t **mft_entry,
      libcerror_error_t **error );
 
+int libfsntfs_mft_entry_add_reference(
+     libfsntfs_mft_entry_t *mft_entry,
+     libcerror_error_t **error );
+
 int libfsntfs_mft_entry_read_data(
      libfsntfs_mft_entry_t *mft_entry,
      uint8_t *data,
@@ -304,7 +317,7 @@ int libfsntfs_mft_entry_has_directory_entries_index(
      libcerror_error_t **error );
 
 int libfsntfs_mft_entry_read_element_data(
-     intptr_t *data_handle,
+     libfsntfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      libfdata_vector_t *vector,
      libfdata_cache_t *cache,
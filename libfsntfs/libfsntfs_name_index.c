@@ -0,0 +1,1685 @@
+/*
+ * Name index functions
+ *
+ * Copyright (C) 2010-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_WCTYPE_H )
+#include <wctype.h>
+#endif
+
+#include "libfsntfs_definitions.h"
+#include "libfsntfs_file_name_values.h"
+#include "libfsntfs_libcerror.h"
+#include "libfsntfs_libuna.h"
+#include "libfsntfs_mft_attribute.h"
+#include "libfsntfs_mft_entry.h"
+#include "libfsntfs_name_index.h"
+
+/* Case folds an UTF-16 value, surrogates are not folded
+ */
+#define libfsntfs_name_index_fold_value( value ) \
+	( ( ( ( value ) >= 0xd800 ) && ( ( value ) <= 0xdfff ) ) ? ( value ) : (uint16_t) towupper( (wint_t) ( value ) ) )
+
+/* Creates a name index
+ * Make sure the value name_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_name_index_initialize(
+     libfsntfs_name_index_t **name_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_name_index_initialize";
+
+	if( name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *name_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid name index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*name_index = memory_allocate_structure(
+	               libfsntfs_name_index_t );
+
+	if( *name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *name_index,
+	     0,
+	     sizeof( libfsntfs_name_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear name index.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *name_index != NULL )
+	{
+		memory_free(
+		 *name_index );
+
+		*name_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a name index
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_name_index_free(
+     libfsntfs_name_index_t **name_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_name_index_free";
+
+	if( name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *name_index != NULL )
+	{
+		if( ( *name_index )->suffixes != NULL )
+		{
+			memory_free(
+			 ( *name_index )->suffixes );
+		}
+		if( ( *name_index )->entries != NULL )
+		{
+			memory_free(
+			 ( *name_index )->entries );
+		}
+		if( ( *name_index )->names != NULL )
+		{
+			memory_free(
+			 ( *name_index )->names );
+		}
+		memory_free(
+		 *name_index );
+
+		*name_index = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends a name to the name index
+ * The name is stored case folded
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_name_index_append_name(
+     libfsntfs_name_index_t *name_index,
+     uint64_t file_reference,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     libcerror_error_t **error )
+{
+	libfsntfs_name_index_entry_t *entries = NULL;
+	libfsntfs_name_index_entry_t *entry   = NULL;
+	uint16_t *names                       = NULL;
+	static char *function                 = "libfsntfs_name_index_append_name";
+	size_t allocation_size                = 0;
+	size_t name_length                    = 0;
+	size_t value_index                    = 0;
+	uint32_t maximum_names_length         = 0;
+	uint16_t value_16bit                  = 0;
+	int maximum_number_of_entries         = 0;
+
+	if( name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name index.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_index->suffixes != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid name index - suffixes value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_stream_size > (size_t) SSIZE_MAX )
+	 || ( ( utf16_stream_size % 2 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-16 stream size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	name_length = utf16_stream_size / 2;
+
+	if( ( name_length > 0 )
+	 && ( utf16_stream[ utf16_stream_size - 2 ] == 0 )
+	 && ( utf16_stream[ utf16_stream_size - 1 ] == 0 ) )
+	{
+		name_length -= 1;
+	}
+	if( name_length == 0 )
+	{
+		return( 1 );
+	}
+	if( ( name_length + 1 ) > (size_t) ( UINT32_MAX - name_index->names_length ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name index - names length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_index->names_length + name_length + 1 ) > name_index->maximum_names_length )
+	{
+		maximum_names_length = name_index->maximum_names_length;
+
+		if( maximum_names_length == 0 )
+		{
+			maximum_names_length = LIBFSNTFS_NAME_INDEX_NAMES_ALLOCATION_SIZE;
+		}
+		while( ( name_index->names_length + name_length + 1 ) > maximum_names_length )
+		{
+			if( maximum_names_length > ( UINT32_MAX / 2 ) )
+			{
+				maximum_names_length = UINT32_MAX;
+
+				break;
+			}
+			maximum_names_length *= 2;
+		}
+		allocation_size = sizeof( uint16_t ) * (size_t) maximum_names_length;
+
+		if( allocation_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid names size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		names = (uint16_t *) memory_reallocate(
+		                      name_index->names,
+		                      allocation_size );
+
+		if( names == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize names.",
+			 function );
+
+			return( -1 );
+		}
+		name_index->names                = names;
+		name_index->maximum_names_length = maximum_names_length;
+	}
+	if( name_index->number_of_entries >= name_index->maximum_number_of_entries )
+	{
+		if( name_index->maximum_number_of_entries > ( INT_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid name index - maximum number of entries value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		maximum_number_of_entries = name_index->maximum_number_of_entries * 2;
+
+		if( maximum_number_of_entries == 0 )
+		{
+			maximum_number_of_entries = LIBFSNTFS_NAME_INDEX_ENTRIES_ALLOCATION_SIZE;
+		}
+		allocation_size = sizeof( libfsntfs_name_index_entry_t ) * (size_t) maximum_number_of_entries;
+
+		if( allocation_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid entries size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		entries = (libfsntfs_name_index_entry_t *) memory_reallocate(
+		                                            name_index->entries,
+		                                            allocation_size );
+
+		if( entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		name_index->entries                   = entries;
+		name_index->maximum_number_of_entries = maximum_number_of_entries;
+	}
+	entry = &( name_index->entries[ name_index->number_of_entries ] );
+
+	entry->file_reference = file_reference;
+	entry->name_offset    = name_index->names_length;
+	entry->name_length    = (uint32_t) name_length;
+
+	names = &( name_index->names[ name_index->names_length ] );
+
+	for( value_index = 0;
+	     value_index < name_length;
+	     value_index++ )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( utf16_stream[ value_index * 2 ] ),
+		 value_16bit );
+
+		names[ value_index ] = libfsntfs_name_index_fold_value( value_16bit );
+	}
+	names[ name_length ] = 0;
+
+	name_index->names_length      += (uint32_t) name_length + 1;
+	name_index->number_of_entries += 1;
+
+	return( 1 );
+}
+
+/* Appends the names of the $FILE_NAME attributes of a MFT entry to the name index
+ * The names of all name spaces are appended, MFT entries that are not a base record are ignored
+ * since their attributes are part of the base record MFT entry
+ * Returns 1 if successful, 0 if the MFT entry was ignored or -1 on error
+ */
+int libfsntfs_name_index_append_mft_entry(
+     libfsntfs_name_index_t *name_index,
+     libfsntfs_mft_entry_t *mft_entry,
+     libcerror_error_t **error )
+{
+	libfsntfs_file_name_values_t *file_name_values = NULL;
+	libfsntfs_mft_attribute_t *mft_attribute       = NULL;
+	static char *function                          = "libfsntfs_name_index_append_mft_entry";
+	uint64_t base_record_file_reference            = 0;
+	uint64_t file_reference                        = 0;
+	uint32_t attribute_type                        = 0;
+	int attribute_index                            = 0;
+	int number_of_attributes                       = 0;
+	int result                                     = 0;
+
+	if( name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name index.",
+		 function );
+
+		return( -1 );
+	}
+	if( mft_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MFT entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( mft_entry->is_empty != 0 )
+	{
+		return( 0 );
+	}
+	result = libfsntfs_mft_entry_get_base_record_file_reference(
+	          mft_entry,
+	          &base_record_file_reference,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve base record file reference.",
+		 function );
+
+		goto on_error;
+	}
+	else if( ( result == 0 )
+	      || ( base_record_file_reference != 0 ) )
+	{
+		return( 0 );
+	}
+	if( libfsntfs_mft_entry_get_file_reference(
+	     mft_entry,
+	     &file_reference,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file reference.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsntfs_mft_entry_get_number_of_attributes(
+	     mft_entry,
+	     &number_of_attributes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of attributes.",
+		 function );
+
+		goto on_error;
+	}
+	for( attribute_index = 0;
+	     attribute_index < number_of_attributes;
+	     attribute_index++ )
+	{
+		if( libfsntfs_mft_entry_get_attribute_by_index(
+		     mft_entry,
+		     attribute_index,
+		     &mft_attribute,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve attribute: %d.",
+			 function,
+			 attribute_index );
+
+			goto on_error;
+		}
+		if( libfsntfs_mft_attribute_get_type(
+		     mft_attribute,
+		     &attribute_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve attribute: %d type.",
+			 function,
+			 attribute_index );
+
+			goto on_error;
+		}
+		if( attribute_type != LIBFSNTFS_ATTRIBUTE_TYPE_FILE_NAME )
+		{
+			continue;
+		}
+		if( libfsntfs_file_name_values_initialize(
+		     &file_name_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file name values.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsntfs_file_name_values_read_from_mft_attribute(
+		     file_name_values,
+		     mft_attribute,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read file name values.",
+			 function );
+
+			goto on_error;
+		}
+		if( file_name_values->name != NULL )
+		{
+			if( libfsntfs_name_index_append_name(
+			     name_index,
+			     file_reference,
+			     file_name_values->name,
+			     file_name_values->name_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append name of attribute: %d.",
+				 function,
+				 attribute_index );
+
+				goto on_error;
+			}
+		}
+		if( libfsntfs_file_name_values_free(
+		     &file_name_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file name values.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( file_name_values != NULL )
+	{
+		libfsntfs_file_name_values_free(
+		 &file_name_values,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Compares two suffixes in the names
+ * Suffixes that are equal are ordered by their offset
+ * Returns -1 if the first suffix sorts before the second, 1 if after or 0 if the same
+ */
+int libfsntfs_name_index_compare_suffixes(
+     const uint16_t *names,
+     uint32_t first_suffix,
+     uint32_t second_suffix )
+{
+	const uint16_t *first_string  = &( names[ first_suffix ] );
+	const uint16_t *second_string = &( names[ second_suffix ] );
+
+	if( first_suffix == second_suffix )
+	{
+		return( 0 );
+	}
+	while( *first_string == *second_string )
+	{
+		if( *first_string == 0 )
+		{
+			if( first_suffix < second_suffix )
+			{
+				return( -1 );
+			}
+			return( 1 );
+		}
+		first_string++;
+		second_string++;
+	}
+	if( *first_string < *second_string )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Builds the suffix array of the names
+ * The suffixes are sorted using a bottom-up merge sort
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_name_index_build_suffixes(
+     libfsntfs_name_index_t *name_index,
+     libcerror_error_t **error )
+{
+	uint32_t *merged_suffixes = NULL;
+	uint32_t *sorted_suffixes = NULL;
+	uint32_t *swap_suffixes   = NULL;
+	static char *function     = "libfsntfs_name_index_build_suffixes";
+	size_t allocation_size    = 0;
+	size_t first_index        = 0;
+	size_t left_index         = 0;
+	size_t merge_index        = 0;
+	size_t middle_index       = 0;
+	size_t number_of_suffixes = 0;
+	size_t right_index        = 0;
+	size_t second_index       = 0;
+	size_t width              = 0;
+	uint32_t names_offset     = 0;
+
+	if( name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name index.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_index->suffixes != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid name index - suffixes value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every value of the names except for the end-of-string values starts a suffix
+	 */
+	for( names_offset = 0;
+	     names_offset < name_index->names_length;
+	     names_offset++ )
+	{
+		if( name_index->names[ names_offset ] != 0 )
+		{
+			number_of_suffixes++;
+		}
+	}
+	allocation_size = sizeof( uint32_t ) * ( number_of_suffixes + 1 );
+
+	if( allocation_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid suffixes size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	sorted_suffixes = (uint32_t *) memory_allocate(
+	                                allocation_size );
+
+	if( sorted_suffixes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create suffixes.",
+		 function );
+
+		goto on_error;
+	}
+	merged_suffixes = (uint32_t *) memory_allocate(
+	                                allocation_size );
+
+	if( merged_suffixes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create merged suffixes.",
+		 function );
+
+		goto on_error;
+	}
+	merge_index = 0;
+
+	for( names_offset = 0;
+	     names_offset < name_index->names_length;
+	     names_offset++ )
+	{
+		if( name_index->names[ names_offset ] != 0 )
+		{
+			sorted_suffixes[ merge_index++ ] = names_offset;
+		}
+	}
+	for( width = 1;
+	     width < number_of_suffixes;
+	     width *= 2 )
+	{
+		for( left_index = 0;
+		     left_index < number_of_suffixes;
+		     left_index += 2 * width )
+		{
+			middle_index = left_index + width;
+
+			if( middle_index > number_of_suffixes )
+			{
+				middle_index = number_of_suffixes;
+			}
+			right_index = middle_index + width;
+
+			if( right_index > number_of_suffixes )
+			{
+				right_index = number_of_suffixes;
+			}
+			first_index  = left_index;
+			second_index = middle_index;
+
+			for( merge_index = left_index;
+			     merge_index < right_index;
+			     merge_index++ )
+			{
+				if( ( first_index < middle_index )
+				 && ( ( second_index >= right_index )
+				  ||  ( libfsntfs_name_index_compare_suffixes(
+				         name_index->names,
+				         sorted_suffixes[ first_index ],
+				         sorted_suffixes[ second_index ] ) < 0 ) ) )
+				{
+					merged_suffixes[ merge_index ] = sorted_suffixes[ first_index++ ];
+				}
+				else
+				{
+					merged_suffixes[ merge_index ] = sorted_suffixes[ second_index++ ];
+				}
+			}
+		}
+		swap_suffixes   = sorted_suffixes;
+		sorted_suffixes = merged_suffixes;
+		merged_suffixes = swap_suffixes;
+	}
+	memory_free(
+	 merged_suffixes );
+
+	name_index->suffixes           = sorted_suffixes;
+	name_index->number_of_suffixes = (uint32_t) number_of_suffixes;
+
+	return( 1 );
+
+on_error:
+	if( merged_suffixes != NULL )
+	{
+		memory_free(
+		 merged_suffixes );
+	}
+	if( sorted_suffixes != NULL )
+	{
+		memory_free(
+		 sorted_suffixes );
+	}
+	return( -1 );
+}
+
+/* Compares a suffix in the names with the start of a case folded UTF-16 string
+ * Returns -1 if the suffix sorts before the string, 1 if after or 0 if the suffix starts with the string
+ */
+int libfsntfs_name_index_compare_suffix_with_string(
+     const uint16_t *names,
+     uint32_t suffix,
+     const uint16_t *string,
+     size_t string_length )
+{
+	const uint16_t *suffix_string = &( names[ suffix ] );
+	size_t string_index           = 0;
+
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( suffix_string[ string_index ] != string[ string_index ] )
+		{
+			if( suffix_string[ string_index ] < string[ string_index ] )
+			{
+				return( -1 );
+			}
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Retrieves the range of the suffixes that start with a case folded UTF-16 string
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_name_index_get_suffixes_range(
+     libfsntfs_name_index_t *name_index,
+     const uint16_t *string,
+     size_t string_length,
+     uint32_t *first_suffix_index,
+     uint32_t *number_of_suffixes,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_name_index_get_suffixes_range";
+	uint32_t lower_index  = 0;
+	uint32_t middle_index = 0;
+	uint32_t upper_index  = 0;
+	uint32_t range_start  = 0;
+
+	if( name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name index.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_index->suffixes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid name index - missing suffixes.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_length == 0 )
+	 || ( string_length > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_suffix_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first suffix index.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_suffixes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of suffixes.",
+		 function );
+
+		return( -1 );
+	}
+	/* Determine the first suffix that does not sort before the string
+	 */
+	lower_index = 0;
+	upper_index = name_index->number_of_suffixes;
+
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( libfsntfs_name_index_compare_suffix_with_string(
+		     name_index->names,
+		     name_index->suffixes[ middle_index ],
+		     string,
+		     string_length ) < 0 )
+		{
+			lower_index = middle_index + 1;
+		}
+		else
+		{
+			upper_index = middle_index;
+		}
+	}
+	range_start = lower_index;
+
+	/* Determine the first suffix that sorts after the string
+	 */
+	upper_index = name_index->number_of_suffixes;
+
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( libfsntfs_name_index_compare_suffix_with_string(
+		     name_index->names,
+		     name_index->suffixes[ middle_index ],
+		     string,
+		     string_length ) <= 0 )
+		{
+			lower_index = middle_index + 1;
+		}
+		else
+		{
+			upper_index = middle_index;
+		}
+	}
+	*first_suffix_index = range_start;
+	*number_of_suffixes = lower_index - range_start;
+
+	return( 1 );
+}
+
+/* Retrieves the index of the entry that contains a specific name offset
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_name_index_get_entry_index_by_name_offset(
+     libfsntfs_name_index_t *name_index,
+     uint32_t name_offset,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_name_index_get_entry_index_by_name_offset";
+	int lower_index       = 0;
+	int middle_index      = 0;
+	int upper_index       = 0;
+
+	if( name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name index.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_offset >= name_index->names_length )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	/* Determine the last entry with a name offset that is less than or equal to the name offset
+	 */
+	lower_index = 0;
+	upper_index = name_index->number_of_entries;
+
+	while( ( upper_index - lower_index ) > 1 )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( name_index->entries[ middle_index ].name_offset <= name_offset )
+		{
+			lower_index = middle_index;
+		}
+		else
+		{
+			upper_index = middle_index;
+		}
+	}
+	*entry_index = lower_index;
+
+	return( 1 );
+}
+
+/* Determines if a case folded UTF-16 name matches a case folded UTF-16 glob pattern
+ * The pattern supports * to match any sequence of characters and ? to match a single character
+ * Returns 1 if the name matches, 0 if not
+ */
+int libfsntfs_name_index_glob_match(
+     const uint16_t *name,
+     size_t name_length,
+     const uint16_t *pattern,
+     size_t pattern_length )
+{
+	size_t backtrack_name_index    = 0;
+	size_t backtrack_pattern_index = 0;
+	size_t name_index              = 0;
+	size_t pattern_index           = 0;
+	uint8_t has_backtrack          = 0;
+
+	while( name_index < name_length )
+	{
+		if( ( pattern_index < pattern_length )
+		 && ( pattern[ pattern_index ] == (uint16_t) '*' ) )
+		{
+			pattern_index++;
+
+			backtrack_pattern_index = pattern_index;
+			backtrack_name_index    = name_index;
+			has_backtrack           = 1;
+		}
+		else if( ( pattern_index < pattern_length )
+		      && ( ( pattern[ pattern_index ] == (uint16_t) '?' )
+		       ||  ( pattern[ pattern_index ] == name[ name_index ] ) ) )
+		{
+			pattern_index++;
+			name_index++;
+		}
+		else if( has_backtrack != 0 )
+		{
+			backtrack_name_index++;
+
+			pattern_index = backtrack_pattern_index;
+			name_index    = backtrack_name_index;
+		}
+		else
+		{
+			return( 0 );
+		}
+	}
+	while( ( pattern_index < pattern_length )
+	    && ( pattern[ pattern_index ] == (uint16_t) '*' ) )
+	{
+		pattern_index++;
+	}
+	if( pattern_index != pattern_length )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Compares two file references
+ * Returns -1 if the first file reference is less than the second, 1 if greater or 0 if equal
+ */
+int libfsntfs_name_index_file_reference_compare(
+     const void *first_file_reference,
+     const void *second_file_reference )
+{
+	uint64_t first  = *( (const uint64_t *) first_file_reference );
+	uint64_t second = *( (const uint64_t *) second_file_reference );
+
+	if( first < second )
+	{
+		return( -1 );
+	}
+	else if( first > second )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Searches the name index for names that match a case folded UTF-16 string
+ * The search type is either a substring or a glob pattern search
+ * The file references are sorted and unique, number_of_file_references is set to the number
+ * of matching file references even if it exceeds maximum_number_of_file_references
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_name_index_search(
+     libfsntfs_name_index_t *name_index,
+     const uint16_t *string,
+     size_t string_length,
+     int search_type,
+     uint64_t *file_references,
+     int maximum_number_of_file_references,
+     int *number_of_file_references,
+     libcerror_error_t **error )
+{
+	libfsntfs_name_index_entry_t *name_index_entry = NULL;
+	uint64_t *matches                              = NULL;
+	static char *function                          = "libfsntfs_name_index_search";
+	size_t allocation_size                         = 0;
+	size_t literal_length                          = 0;
+	size_t literal_start                           = 0;
+	size_t maximum_number_of_matches               = 0;
+	size_t number_of_matches                       = 0;
+	size_t match_index                             = 0;
+	size_t run_length                              = 0;
+	size_t string_index                            = 0;
+	size_t unique_index                            = 0;
+	uint32_t first_suffix_index                    = 0;
+	uint32_t number_of_suffixes                    = 0;
+	uint32_t suffix_index                          = 0;
+	int entry_index                                = 0;
+
+	if( name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name index.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_index->suffixes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid name index - missing suffixes.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_length == 0 )
+	 || ( string_length > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( search_type != LIBFSNTFS_NAME_SEARCH_TYPE_SUBSTRING )
+	 && ( search_type != LIBFSNTFS_NAME_SEARCH_TYPE_GLOB ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported search type.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_file_references < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of file references value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_references == NULL )
+	 && ( maximum_number_of_file_references > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file references.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_file_references == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of file references.",
+		 function );
+
+		return( -1 );
+	}
+	if( search_type == LIBFSNTFS_NAME_SEARCH_TYPE_GLOB )
+	{
+		/* Use the longest run of literal characters in the pattern to narrow down the candidates
+		 */
+		for( string_index = 0;
+		     string_index <= string_length;
+		     string_index++ )
+		{
+			if( ( string_index < string_length )
+			 && ( string[ string_index ] != (uint16_t) '*' )
+			 && ( string[ string_index ] != (uint16_t) '?' ) )
+			{
+				run_length++;
+			}
+			else
+			{
+				if( run_length > literal_length )
+				{
+					literal_start  = string_index - run_length;
+					literal_length = run_length;
+				}
+				run_length = 0;
+			}
+		}
+	}
+	else
+	{
+		literal_start  = 0;
+		literal_length = string_length;
+	}
+	if( literal_length > 0 )
+	{
+		if( libfsntfs_name_index_get_suffixes_range(
+		     name_index,
+		     &( string[ literal_start ] ),
+		     literal_length,
+		     &first_suffix_index,
+		     &number_of_suffixes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve suffixes range.",
+			 function );
+
+			goto on_error;
+		}
+		maximum_number_of_matches = (size_t) number_of_suffixes;
+	}
+	else
+	{
+		maximum_number_of_matches = (size_t) name_index->number_of_entries;
+	}
+	if( maximum_number_of_matches > 0 )
+	{
+		allocation_size = sizeof( uint64_t ) * maximum_number_of_matches;
+
+		if( allocation_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid matches size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		matches = (uint64_t *) memory_allocate(
+		                        allocation_size );
+
+		if( matches == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create matches.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( literal_length > 0 )
+	{
+		for( suffix_index = first_suffix_index;
+		     suffix_index < first_suffix_index + number_of_suffixes;
+		     suffix_index++ )
+		{
+			if( libfsntfs_name_index_get_entry_index_by_name_offset(
+			     name_index,
+			     name_index->suffixes[ suffix_index ],
+			     &entry_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve entry index of suffix: %" PRIu32 ".",
+				 function,
+				 suffix_index );
+
+				goto on_error;
+			}
+			name_index_entry = &( name_index->entries[ entry_index ] );
+
+			if( ( search_type == LIBFSNTFS_NAME_SEARCH_TYPE_GLOB )
+			 && ( libfsntfs_name_index_glob_match(
+			       &( name_index->names[ name_index_entry->name_offset ] ),
+			       (size_t) name_index_entry->name_length,
+			       string,
+			       string_length ) == 0 ) )
+			{
+				continue;
+			}
+			matches[ number_of_matches++ ] = name_index_entry->file_reference;
+		}
+	}
+	else
+	{
+		/* The glob pattern consists of wildcards only
+		 */
+		for( entry_index = 0;
+		     entry_index < name_index->number_of_entries;
+		     entry_index++ )
+		{
+			name_index_entry = &( name_index->entries[ entry_index ] );
+
+			if( libfsntfs_name_index_glob_match(
+			     &( name_index->names[ name_index_entry->name_offset ] ),
+			     (size_t) name_index_entry->name_length,
+			     string,
+			     string_length ) == 0 )
+			{
+				continue;
+			}
+			matches[ number_of_matches++ ] = name_index_entry->file_reference;
+		}
+	}
+	if( number_of_matches > 1 )
+	{
+		qsort(
+		 matches,
+		 number_of_matches,
+		 sizeof( uint64_t ),
+		 &libfsntfs_name_index_file_reference_compare );
+
+		unique_index = 0;
+
+		for( match_index = 1;
+		     match_index < number_of_matches;
+		     match_index++ )
+		{
+			if( matches[ match_index ] != matches[ unique_index ] )
+			{
+				unique_index++;
+
+				matches[ unique_index ] = matches[ match_index ];
+			}
+		}
+		number_of_matches = unique_index + 1;
+	}
+	if( number_of_matches > (size_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of matches value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	for( match_index = 0;
+	     match_index < number_of_matches;
+	     match_index++ )
+	{
+		if( match_index >= (size_t) maximum_number_of_file_references )
+		{
+			break;
+		}
+		file_references[ match_index ] = matches[ match_index ];
+	}
+	if( matches != NULL )
+	{
+		memory_free(
+		 matches );
+	}
+	*number_of_file_references = (int) number_of_matches;
+
+	return( 1 );
+
+on_error:
+	if( matches != NULL )
+	{
+		memory_free(
+		 matches );
+	}
+	return( -1 );
+}
+
+/* Searches the name index for names that match an UTF-8 encoded string
+ * The search is case insensitive
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_name_index_search_utf8(
+     libfsntfs_name_index_t *name_index,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int search_type,
+     uint64_t *file_references,
+     int maximum_number_of_file_references,
+     int *number_of_file_references,
+     libcerror_error_t **error )
+{
+	uint16_t *utf16_string   = NULL;
+	static char *function    = "libfsntfs_name_index_search_utf8";
+	size_t string_index      = 0;
+	size_t utf16_string_size = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string_length == 0 )
+	 || ( utf8_string_length > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libuna_utf16_string_size_from_utf8(
+	     utf8_string,
+	     utf8_string_length,
+	     &utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine UTF-16 string size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( utf16_string_size == 0 )
+	 || ( utf16_string_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint16_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-16 string size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	utf16_string = (uint16_t *) memory_allocate(
+	                             sizeof( uint16_t ) * utf16_string_size );
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-16 string.",
+		 function );
+
+		goto on_error;
+	}
+	if( libuna_utf16_string_copy_from_utf8(
+	     utf16_string,
+	     utf16_string_size,
+	     utf8_string,
+	     utf8_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to copy UTF-16 string from UTF-8 string.",
+		 function );
+
+		goto on_error;
+	}
+	/* Ignore the end-of-string character
+	 */
+	if( utf16_string[ utf16_string_size - 1 ] == 0 )
+	{
+		utf16_string_size -= 1;
+	}
+	for( string_index = 0;
+	     string_index < utf16_string_size;
+	     string_index++ )
+	{
+		utf16_string[ string_index ] = libfsntfs_name_index_fold_value(
+		                                utf16_string[ string_index ] );
+	}
+	if( libfsntfs_name_index_search(
+	     name_index,
+	     utf16_string,
+	     utf16_string_size,
+	     search_type,
+	     file_references,
+	     maximum_number_of_file_references,
+	     number_of_file_references,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to search name index.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 utf16_string );
+
+	return( 1 );
+
+on_error:
+	if( utf16_string != NULL )
+	{
+		memory_free(
+		 utf16_string );
+	}
+	return( -1 );
+}
+
+/* Searches the name index for names that match an UTF-16 encoded string
+ * The search is case insensitive
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_name_index_search_utf16(
+     libfsntfs_name_index_t *name_index,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     int search_type,
+     uint64_t *file_references,
+     int maximum_number_of_file_references,
+     int *number_of_file_references,
+     libcerror_error_t **error )
+{
+	uint16_t *folded_string = NULL;
+	static char *function   = "libfsntfs_name_index_search_utf16";
+	size_t string_index     = 0;
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	/* Ignore the end-of-string character
+	 */
+	if( ( utf16_string_length > 0 )
+	 && ( utf16_string[ utf16_string_length - 1 ] == 0 ) )
+	{
+		utf16_string_length -= 1;
+	}
+	if( ( utf16_string_length == 0 )
+	 || ( utf16_string_length > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint16_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-16 string length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	folded_string = (uint16_t *) memory_allocate(
+	                              sizeof( uint16_t ) * utf16_string_length );
+
+	if( folded_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create folded string.",
+		 function );
+
+		goto on_error;
+	}
+	for( string_index = 0;
+	     string_index < utf16_string_length;
+	     string_index++ )
+	{
+		folded_string[ string_index ] = libfsntfs_name_index_fold_value(
+		                                 utf16_string[ string_index ] );
+	}
+	if( libfsntfs_name_index_search(
+	     name_index,
+	     folded_string,
+	     utf16_string_length,
+	     search_type,
+	     file_references,
+	     maximum_number_of_file_references,
+	     number_of_file_references,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to search name index.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 folded_string );
+
+	return( 1 );
+
+on_error:
+	if( folded_string != NULL )
+	{
+		memory_free(
+		 folded_string );
+	}
+	return( -1 );
+}
@@ -0,0 +1,188 @@
+/*
+ * Name index functions
+ *
+ * Copyright (C) 2010-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSNTFS_NAME_INDEX_H )
+#define _LIBFSNTFS_NAME_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsntfs_libcerror.h"
+#include "libfsntfs_mft_entry.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsntfs_name_index_entry libfsntfs_name_index_entry_t;
+
+/* A name in the name index
+ */
+struct libfsntfs_name_index_entry
+{
+	/* The file reference
+	 */
+	uint64_t file_reference;
+
+	/* The offset of the name in the names
+	 */
+	uint32_t name_offset;
+
+	/* The length of the name in UTF-16 values
+	 */
+	uint32_t name_length;
+};
+
+typedef struct libfsntfs_name_index libfsntfs_name_index_t;
+
+/* An index of the names of the $FILE_NAME attributes of a volume
+ * The index consists of flat arrays without pointers so that it can be stored as-is
+ */
+struct libfsntfs_name_index
+{
+	/* The case folded UTF-16 names, each terminated by a 0 value
+	 */
+	uint16_t *names;
+
+	/* The number of UTF-16 values in the names
+	 */
+	uint32_t names_length;
+
+	/* The maximum number of UTF-16 values in the names
+	 */
+	uint32_t maximum_names_length;
+
+	/* The entries, sorted by name offset
+	 */
+	libfsntfs_name_index_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The maximum number of entries
+	 */
+	int maximum_number_of_entries;
+
+	/* The suffix array, contains the offsets of all name suffixes sorted by suffix
+	 */
+	uint32_t *suffixes;
+
+	/* The number of suffixes
+	 */
+	uint32_t number_of_suffixes;
+};
+
+int libfsntfs_name_index_initialize(
+     libfsntfs_name_index_t **name_index,
+     libcerror_error_t **error );
+
+int libfsntfs_name_index_free(
+     libfsntfs_name_index_t **name_index,
+     libcerror_error_t **error );
+
+int libfsntfs_name_index_append_name(
+     libfsntfs_name_index_t *name_index,
+     uint64_t file_reference,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     libcerror_error_t **error );
+
+int libfsntfs_name_index_append_mft_entry(
+     libfsntfs_name_index_t *name_index,
+     libfsntfs_mft_entry_t *mft_entry,
+     libcerror_error_t **error );
+
+int libfsntfs_name_index_compare_suffixes(
+     const uint16_t *names,
+     uint32_t first_suffix,
+     uint32_t second_suffix );
+
+int libfsntfs_name_index_build_suffixes(
+     libfsntfs_name_index_t *name_index,
+     libcerror_error_t **error );
+
+int libfsntfs_name_index_compare_suffix_with_string(
+     const uint16_t *names,
+     uint32_t suffix,
+     const uint16_t *string,
+     size_t string_length );
+
+int libfsntfs_name_index_get_suffixes_range(
+     libfsntfs_name_index_t *name_index,
+     const uint16_t *string,
+     size_t string_length,
+     uint32_t *first_suffix_index,
+     uint32_t *number_of_suffixes,
+     libcerror_error_t **error );
+
+int libfsntfs_name_index_get_entry_index_by_name_offset(
+     libfsntfs_name_index_t *name_index,
+     uint32_t name_offset,
+     int *entry_index,
+     libcerror_error_t **error );
+
+int libfsntfs_name_index_glob_match(
+     const uint16_t *name,
+     size_t name_length,
+     const uint16_t *pattern,
+     size_t pattern_length );
+
+int libfsntfs_name_index_file_reference_compare(
+     const void *first_file_reference,
+     const void *second_file_reference );
+
+int libfsntfs_name_index_search(
+     libfsntfs_name_index_t *name_index,
+     const uint16_t *string,
+     size_t string_length,
+     int search_type,
+     uint64_t *file_references,
+     int maximum_number_of_file_references,
+     int *number_of_file_references,
+     libcerror_error_t **error );
+
+int libfsntfs_name_index_search_utf8(
+     libfsntfs_name_index_t *name_index,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int search_type,
+     uint64_t *file_references,
+     int maximum_number_of_file_references,
+     int *number_of_file_references,
+     libcerror_error_t **error );
+
+int libfsntfs_name_index_search_utf16(
+     libfsntfs_name_index_t *name_index,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     int search_type,
+     uint64_t *file_references,
+     int maximum_number_of_file_references,
+     int *number_of_file_references,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSNTFS_NAME_INDEX_H ) */
+
@@ -0,0 +1,774 @@
+/*
+ * Object identifier index functions
+ *
+ * Copyright (C) 2010-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsntfs_definitions.h"
+#include "libfsntfs_index.h"
+#include "libfsntfs_index_node.h"
+#include "libfsntfs_index_value.h"
+#include "libfsntfs_libbfio.h"
+#include "libfsntfs_libcdata.h"
+#include "libfsntfs_libcerror.h"
+#include "libfsntfs_mft_entry.h"
+#include "libfsntfs_object_identifier_index.h"
+
+#include "fsntfs_index.h"
+#include "fsntfs_object_identifier.h"
+
+/* Creates an object identifier index
+ * Make sure the value object_identifier_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_object_identifier_index_initialize(
+     libfsntfs_object_identifier_index_t **object_identifier_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_object_identifier_index_initialize";
+
+	if( object_identifier_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid object identifier index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *object_identifier_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid object identifier index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*object_identifier_index = memory_allocate_structure(
+	                            libfsntfs_object_identifier_index_t );
+
+	if( *object_identifier_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create object identifier index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *object_identifier_index,
+	     0,
+	     sizeof( libfsntfs_object_identifier_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear object identifier index.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *object_identifier_index != NULL )
+	{
+		memory_free(
+		 *object_identifier_index );
+
+		*object_identifier_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an object identifier index
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_object_identifier_index_free(
+     libfsntfs_object_identifier_index_t **object_identifier_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_object_identifier_index_free";
+	int result            = 1;
+
+	if( object_identifier_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid object identifier index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *object_identifier_index != NULL )
+	{
+		if( ( *object_identifier_index )->o_index != NULL )
+		{
+			if( libfsntfs_index_free(
+			     &( ( *object_identifier_index )->o_index ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free $O index.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *object_identifier_index );
+
+		*object_identifier_index = NULL;
+	}
+	return( result );
+}
+
+/* Reads the object identifier ($O) index
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsntfs_object_identifier_index_read_o_index(
+     libfsntfs_object_identifier_index_t *object_identifier_index,
+     libfsntfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsntfs_mft_entry_t *mft_entry,
+     libcerror_error_t **error )
+{
+	static char *function   = "libfsntfs_object_identifier_index_read_o_index";
+	uint32_t attribute_type = 0;
+	uint32_t collation_type = 0;
+	int result              = 0;
+
+	if( object_identifier_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid object identifier index.",
+		 function );
+
+		return( -1 );
+	}
+	if( object_identifier_index->o_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid object identifier index - $O index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsntfs_index_initialize(
+	     &( object_identifier_index->o_index ),
+	     io_handle,
+	     (uint8_t *) "$O",
+	     3,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create $O index.",
+		 function );
+
+		goto on_error;
+	}
+	result = libfsntfs_index_read(
+	          object_identifier_index->o_index,
+	          file_io_handle,
+	          mft_entry,
+	          0,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read $O index.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		if( libfsntfs_index_free(
+		     &( object_identifier_index->o_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free $O index.",
+			 function );
+
+			goto on_error;
+		}
+		return( 0 );
+	}
+	if( libfsntfs_index_get_attribute_type(
+	     object_identifier_index->o_index,
+	     &attribute_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve attribute type from index.",
+		 function );
+
+		goto on_error;
+	}
+	if( attribute_type != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported index attribute type.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsntfs_index_get_collation_type(
+	     object_identifier_index->o_index,
+	     &collation_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve collation type from index.",
+		 function );
+
+		goto on_error;
+	}
+	/* The $O index uses the COLLATION_NTOFS_ULONGS collation type
+	 */
+	if( collation_type != 19 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported index collation type.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( object_identifier_index->o_index != NULL )
+	{
+		libfsntfs_index_free(
+		 &( object_identifier_index->o_index ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Compares an object identifier with the key of a $O index value
+ * The key is compared as a sequence of 32-bit little-endian values (COLLATION_NTOFS_ULONGS)
+ * Returns LIBCDATA_COMPARE_LESS, LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ */
+int libfsntfs_object_identifier_index_compare_key(
+     const uint8_t *key_data,
+     size_t key_data_size,
+     const uint8_t *object_identifier,
+     libcerror_error_t **error )
+{
+	static char *function       = "libfsntfs_object_identifier_index_compare_key";
+	size_t data_offset          = 0;
+	uint32_t key_value_32bit    = 0;
+	uint32_t object_value_32bit = 0;
+
+	if( key_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_data_size != 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported key data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( object_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid object identifier.",
+		 function );
+
+		return( -1 );
+	}
+	for( data_offset = 0;
+	     data_offset < 16;
+	     data_offset += 4 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( key_data[ data_offset ] ),
+		 key_value_32bit );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( object_identifier[ data_offset ] ),
+		 object_value_32bit );
+
+		if( object_value_32bit < key_value_32bit )
+		{
+			return( LIBCDATA_COMPARE_LESS );
+		}
+		else if( object_value_32bit > key_value_32bit )
+		{
+			return( LIBCDATA_COMPARE_GREATER );
+		}
+	}
+	return( LIBCDATA_COMPARE_EQUAL );
+}
+
+/* Retrieves the file reference from a $O index value
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_object_identifier_index_get_file_reference_from_index_value(
+     libfsntfs_index_value_t *index_value,
+     uint64_t *file_reference,
+     libcerror_error_t **error )
+{
+	static char *function    = "libfsntfs_object_identifier_index_get_file_reference_from_index_value";
+	size_t value_data_offset = 0;
+	uint16_t data_offset     = 0;
+	uint16_t data_size       = 0;
+
+	if( index_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index value.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_reference == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file reference.",
+		 function );
+
+		return( -1 );
+	}
+	/* In a view index the file reference of the index value header contains
+	 * the offset and size of the data relative to the start of the index value
+	 */
+	data_offset = (uint16_t) ( index_value->file_reference & 0xffff );
+	data_size   = (uint16_t) ( ( index_value->file_reference >> 16 ) & 0xffff );
+
+	if( ( (size_t) data_offset < ( sizeof( fsntfs_index_value_t ) + index_value->key_data_size ) )
+	 || ( (size_t) data_size < sizeof( fsntfs_object_identifier_index_value_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid index value - data offset or size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	value_data_offset = (size_t) data_offset - sizeof( fsntfs_index_value_t ) - index_value->key_data_size;
+
+	if( ( index_value->value_data == NULL )
+	 || ( value_data_offset > index_value->value_data_size )
+	 || ( sizeof( fsntfs_object_identifier_index_value_t ) > ( index_value->value_data_size - value_data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid index value - value data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsntfs_object_identifier_index_value_t *) &( index_value->value_data[ value_data_offset ] ) )->file_reference,
+	 *file_reference );
+
+	return( 1 );
+}
+
+/* Retrieves the file reference from an index node for a specific object identifier
+ * Returns 1 if successful, 0 if no such object identifier or -1 on error
+ */
+int libfsntfs_object_identifier_index_get_file_reference_from_index_node_by_identifier(
+     libfsntfs_object_identifier_index_t *object_identifier_index,
+     libbfio_handle_t *file_io_handle,
+     libfsntfs_index_node_t *index_node,
+     const uint8_t *object_identifier,
+     uint64_t *file_reference,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	libfsntfs_index_node_t *sub_node     = NULL;
+	libfsntfs_index_value_t *index_value = NULL;
+	static char *function                = "libfsntfs_object_identifier_index_get_file_reference_from_index_node_by_identifier";
+	off64_t index_entry_offset           = 0;
+	int compare_result                   = 0;
+	int index_value_entry                = 0;
+	int is_allocated                     = 0;
+	int number_of_index_values           = 0;
+	int result                           = 0;
+
+	if( object_identifier_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid object identifier index.",
+		 function );
+
+		return( -1 );
+	}
+	if( object_identifier_index->o_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid object identifier index - missing $O index.",
+		 function );
+
+		return( -1 );
+	}
+	if( object_identifier_index->o_index->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid object identifier index - invalid $O index - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( object_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid object identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_reference == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file reference.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > LIBFSNTFS_MAXIMUM_INDEX_NODE_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsntfs_index_node_get_number_of_values(
+	     index_node,
+	     &number_of_index_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of values from index node.",
+		 function );
+
+		return( -1 );
+	}
+	/* The index values are sorted by key, the sub node of an index value
+	 * contains the keys that sort before the key of the index value
+	 */
+	for( index_value_entry = 0;
+	     index_value_entry < number_of_index_values;
+	     index_value_entry++ )
+	{
+		if( libfsntfs_index_node_get_value_by_index(
+		     index_node,
+		     index_value_entry,
+		     &index_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d from index node.",
+			 function,
+			 index_value_entry );
+
+			return( -1 );
+		}
+		if( ( index_value->flags & LIBFSNTFS_INDEX_VALUE_FLAG_IS_LAST ) != 0 )
+		{
+			break;
+		}
+		compare_result = libfsntfs_object_identifier_index_compare_key(
+		                  index_value->key_data,
+		                  (size_t) index_value->key_data_size,
+		                  object_identifier,
+		                  error );
+
+		if( compare_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare key of value: %d.",
+			 function,
+			 index_value_entry );
+
+			return( -1 );
+		}
+		else if( compare_result == LIBCDATA_COMPARE_EQUAL )
+		{
+			if( libfsntfs_object_identifier_index_get_file_reference_from_index_value(
+			     index_value,
+			     file_reference,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve file reference from value: %d.",
+				 function,
+				 index_value_entry );
+
+				return( -1 );
+			}
+			return( 1 );
+		}
+		else if( compare_result == LIBCDATA_COMPARE_LESS )
+		{
+			break;
+		}
+	}
+	if( ( index_value_entry >= number_of_index_values )
+	 || ( ( index_value->flags & LIBFSNTFS_INDEX_VALUE_FLAG_HAS_SUB_NODE ) == 0 ) )
+	{
+		return( 0 );
+	}
+	if( index_value->sub_node_vcn > (uint64_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: node index value: %d sub node VCN value out of bounds.",
+		 function,
+		 index_value_entry );
+
+		return( -1 );
+	}
+	is_allocated = libfsntfs_index_sub_node_is_allocated(
+	                object_identifier_index->o_index,
+	                (int) index_value->sub_node_vcn,
+	                error );
+
+	if( is_allocated == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if sub node with VCN: %d is allocated.",
+		 function,
+		 (int) index_value->sub_node_vcn );
+
+		return( -1 );
+	}
+	else if( is_allocated == 0 )
+	{
+		return( 0 );
+	}
+	index_entry_offset = (off64_t) ( index_value->sub_node_vcn * object_identifier_index->o_index->io_handle->cluster_block_size );
+
+	if( libfsntfs_index_get_sub_node(
+	     object_identifier_index->o_index,
+	     file_io_handle,
+	     object_identifier_index->o_index->index_node_cache,
+	     index_entry_offset,
+	     (int) index_value->sub_node_vcn,
+	     &sub_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub node with VCN: %d at offset: 0x%08" PRIx64 ".",
+		 function,
+		 (int) index_value->sub_node_vcn,
+		 index_entry_offset );
+
+		return( -1 );
+	}
+	result = libfsntfs_object_identifier_index_get_file_reference_from_index_node_by_identifier(
+	          object_identifier_index,
+	          file_io_handle,
+	          sub_node,
+	          object_identifier,
+	          file_reference,
+	          recursion_depth + 1,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file reference by object identifier from index entry with VCN: %d at offset: 0x%08" PRIx64 ".",
+		 function,
+		 (int) index_value->sub_node_vcn,
+		 index_entry_offset );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the file reference for a specific object identifier
+ * The object identifier consists of 16 bytes and contains a GUID
+ * Returns 1 if successful, 0 if no such object identifier or -1 on error
+ */
+int libfsntfs_object_identifier_index_get_file_reference_by_identifier(
+     libfsntfs_object_identifier_index_t *object_identifier_index,
+     libbfio_handle_t *file_io_handle,
+     const uint8_t *object_identifier,
+     uint64_t *file_reference,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_object_identifier_index_get_file_reference_by_identifier";
+	int result            = 0;
+
+	if( object_identifier_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid object identifier index.",
+		 function );
+
+		return( -1 );
+	}
+	if( object_identifier_index->o_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid object identifier index - missing $O index.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsntfs_object_identifier_index_get_file_reference_from_index_node_by_identifier(
+	          object_identifier_index,
+	          file_io_handle,
+	          object_identifier_index->o_index->root_node,
+	          object_identifier,
+	          file_reference,
+	          0,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file reference by object identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
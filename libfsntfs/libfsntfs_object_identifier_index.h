@@ -0,0 +1,96 @@
+/*
+ * Object identifier index functions
+ *
+ * Copyright (C) 2010-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSNTFS_OBJECT_IDENTIFIER_INDEX_H )
+#define _LIBFSNTFS_OBJECT_IDENTIFIER_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsntfs_index.h"
+#include "libfsntfs_index_node.h"
+#include "libfsntfs_index_value.h"
+#include "libfsntfs_io_handle.h"
+#include "libfsntfs_libbfio.h"
+#include "libfsntfs_libcerror.h"
+#include "libfsntfs_mft_entry.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsntfs_object_identifier_index libfsntfs_object_identifier_index_t;
+
+struct libfsntfs_object_identifier_index
+{
+	/* The $O index
+	 */
+	libfsntfs_index_t *o_index;
+};
+
+int libfsntfs_object_identifier_index_initialize(
+     libfsntfs_object_identifier_index_t **object_identifier_index,
+     libcerror_error_t **error );
+
+int libfsntfs_object_identifier_index_free(
+     libfsntfs_object_identifier_index_t **object_identifier_index,
+     libcerror_error_t **error );
+
+int libfsntfs_object_identifier_index_read_o_index(
+     libfsntfs_object_identifier_index_t *object_identifier_index,
+     libfsntfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsntfs_mft_entry_t *mft_entry,
+     libcerror_error_t **error );
+
+int libfsntfs_object_identifier_index_compare_key(
+     const uint8_t *key_data,
+     size_t key_data_size,
+     const uint8_t *object_identifier,
+     libcerror_error_t **error );
+
+int libfsntfs_object_identifier_index_get_file_reference_from_index_value(
+     libfsntfs_index_value_t *index_value,
+     uint64_t *file_reference,
+     libcerror_error_t **error );
+
+int libfsntfs_object_identifier_index_get_file_reference_from_index_node_by_identifier(
+     libfsntfs_object_identifier_index_t *object_identifier_index,
+     libbfio_handle_t *file_io_handle,
+     libfsntfs_index_node_t *index_node,
+     const uint8_t *object_identifier,
+     uint64_t *file_reference,
+     int recursion_depth,
+     libcerror_error_t **error );
+
+int libfsntfs_object_identifier_index_get_file_reference_by_identifier(
+     libfsntfs_object_identifier_index_t *object_identifier_index,
+     libbfio_handle_t *file_io_handle,
+     const uint8_t *object_identifier,
+     uint64_t *file_reference,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSNTFS_OBJECT_IDENTIFIER_INDEX_H ) */
+
@@ -0,0 +1,1116 @@
+/*
+ * Quota index functions
+ *
+ * Copyright (C) 2010-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsntfs_definitions.h"
+#include "libfsntfs_index.h"
+#include "libfsntfs_index_node.h"
+#include "libfsntfs_index_value.h"
+#include "libfsntfs_libbfio.h"
+#include "libfsntfs_libcdata.h"
+#include "libfsntfs_libcerror.h"
+#include "libfsntfs_mft_entry.h"
+#include "libfsntfs_quota_index.h"
+
+#include "fsntfs_index.h"
+#include "fsntfs_quota.h"
+
+/* Creates an quota index
+ * Make sure the value quota_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_quota_index_initialize(
+     libfsntfs_quota_index_t **quota_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_quota_index_initialize";
+
+	if( quota_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid quota index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *quota_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid quota index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*quota_index = memory_allocate_structure(
+	                libfsntfs_quota_index_t );
+
+	if( *quota_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create quota index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *quota_index,
+	     0,
+	     sizeof( libfsntfs_quota_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear quota index.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *quota_index != NULL )
+	{
+		memory_free(
+		 *quota_index );
+
+		*quota_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an quota index
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_quota_index_free(
+     libfsntfs_quota_index_t **quota_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_quota_index_free";
+	int result            = 1;
+
+	if( quota_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid quota index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *quota_index != NULL )
+	{
+		if( ( *quota_index )->o_index != NULL )
+		{
+			if( libfsntfs_index_free(
+			     &( ( *quota_index )->o_index ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free $O index.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *quota_index )->q_index != NULL )
+		{
+			if( libfsntfs_index_free(
+			     &( ( *quota_index )->q_index ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free $Q index.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *quota_index );
+
+		*quota_index = NULL;
+	}
+	return( result );
+}
+
+/* Reads a quota index
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsntfs_quota_index_read_index(
+     libfsntfs_index_t **index,
+     libfsntfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsntfs_mft_entry_t *mft_entry,
+     const uint8_t *name,
+     size_t name_size,
+     uint32_t collation_type,
+     libcerror_error_t **error )
+{
+	static char *function         = "libfsntfs_quota_index_read_index";
+	uint32_t attribute_type       = 0;
+	uint32_t index_collation_type = 0;
+	int result                    = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsntfs_index_initialize(
+	     index,
+	     io_handle,
+	     name,
+	     name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index.",
+		 function );
+
+		goto on_error;
+	}
+	result = libfsntfs_index_read(
+	          *index,
+	          file_io_handle,
+	          mft_entry,
+	          0,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		if( libfsntfs_index_free(
+		     index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free index.",
+			 function );
+
+			goto on_error;
+		}
+		return( 0 );
+	}
+	if( libfsntfs_index_get_attribute_type(
+	     *index,
+	     &attribute_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve attribute type from index.",
+		 function );
+
+		goto on_error;
+	}
+	if( attribute_type != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported index attribute type.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsntfs_index_get_collation_type(
+	     *index,
+	     &index_collation_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve collation type from index.",
+		 function );
+
+		goto on_error;
+	}
+	if( index_collation_type != collation_type )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported index collation type.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *index != NULL )
+	{
+		libfsntfs_index_free(
+		 index,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the owner ($O) and quota ($Q) indexes
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsntfs_quota_index_read(
+     libfsntfs_quota_index_t *quota_index,
+     libfsntfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsntfs_mft_entry_t *mft_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_quota_index_read";
+	int result            = 0;
+
+	if( quota_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid quota index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( quota_index->o_index != NULL )
+	 || ( quota_index->q_index != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid quota index - index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* The $O index uses the COLLATION_NTOFS_SID collation type
+	 */
+	result = libfsntfs_quota_index_read_index(
+	          &( quota_index->o_index ),
+	          io_handle,
+	          file_io_handle,
+	          mft_entry,
+	          (uint8_t *) "$O",
+	          3,
+	          17,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read $O index.",
+		 function );
+
+		goto on_error;
+	}
+	/* The $Q index uses the COLLATION_NTOFS_ULONG collation type
+	 */
+	result = libfsntfs_quota_index_read_index(
+	          &( quota_index->q_index ),
+	          io_handle,
+	          file_io_handle,
+	          mft_entry,
+	          (uint8_t *) "$Q",
+	          3,
+	          16,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read $Q index.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( quota_index->o_index == NULL )
+	 && ( quota_index->q_index == NULL ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( quota_index->o_index != NULL )
+	{
+		libfsntfs_index_free(
+		 &( quota_index->o_index ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Compares data with the key of a $O or $Q index value
+ * The $O index keys are SIDs that are compared as binary data (COLLATION_NTOFS_SID)
+ * The $Q index keys are owner identifiers that are compared as a 32-bit little-endian value (COLLATION_NTOFS_ULONG)
+ * Returns LIBCDATA_COMPARE_LESS, LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ */
+int libfsntfs_quota_index_compare_key(
+     uint32_t collation_type,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libfsntfs_quota_index_compare_key";
+	size_t compare_size       = 0;
+	uint32_t data_value_32bit = 0;
+	uint32_t key_value_32bit  = 0;
+	int result                = 0;
+
+	if( key_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid key data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( collation_type == 16 )
+	{
+		if( ( key_data_size != 4 )
+		 || ( data_size != 4 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported key data or data size.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 key_data,
+		 key_value_32bit );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 data,
+		 data_value_32bit );
+
+		if( data_value_32bit < key_value_32bit )
+		{
+			return( LIBCDATA_COMPARE_LESS );
+		}
+		else if( data_value_32bit > key_value_32bit )
+		{
+			return( LIBCDATA_COMPARE_GREATER );
+		}
+		return( LIBCDATA_COMPARE_EQUAL );
+	}
+	else if( collation_type == 17 )
+	{
+		compare_size = data_size;
+
+		if( compare_size > key_data_size )
+		{
+			compare_size = key_data_size;
+		}
+		result = memory_compare(
+		          data,
+		          key_data,
+		          compare_size );
+
+		if( result < 0 )
+		{
+			return( LIBCDATA_COMPARE_LESS );
+		}
+		else if( result > 0 )
+		{
+			return( LIBCDATA_COMPARE_GREATER );
+		}
+		else if( data_size < key_data_size )
+		{
+			return( LIBCDATA_COMPARE_LESS );
+		}
+		else if( data_size > key_data_size )
+		{
+			return( LIBCDATA_COMPARE_GREATER );
+		}
+		return( LIBCDATA_COMPARE_EQUAL );
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+	 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+	 "%s: unsupported collation type: %" PRIu32 ".",
+	 function,
+	 collation_type );
+
+	return( -1 );
+}
+
+/* Retrieves the data from a $O or $Q index value
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_quota_index_get_data_from_index_value(
+     libfsntfs_index_value_t *index_value,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function    = "libfsntfs_quota_index_get_data_from_index_value";
+	size_t value_data_offset = 0;
+	uint16_t value_data_size = 0;
+	uint16_t data_offset     = 0;
+
+	if( index_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index value.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	/* In a view index the file reference of the index value header contains
+	 * the offset and size of the data relative to the start of the index value
+	 */
+	data_offset     = (uint16_t) ( index_value->file_reference & 0xffff );
+	value_data_size = (uint16_t) ( ( index_value->file_reference >> 16 ) & 0xffff );
+
+	if( (size_t) data_offset < ( sizeof( fsntfs_index_value_t ) + index_value->key_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid index value - data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	value_data_offset = (size_t) data_offset - sizeof( fsntfs_index_value_t ) - index_value->key_data_size;
+
+	if( ( index_value->value_data == NULL )
+	 || ( value_data_offset > index_value->value_data_size )
+	 || ( (size_t) value_data_size > ( index_value->value_data_size - value_data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid index value - data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*data      = &( index_value->value_data[ value_data_offset ] );
+	*data_size = (size_t) value_data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the index value from an index node for specific data
+ * The index value is owned by the index node and is only valid until the index node cache is used again
+ * Returns 1 if successful, 0 if no such index value or -1 on error
+ */
+int libfsntfs_quota_index_get_index_value_from_index_node(
+     libfsntfs_index_t *index,
+     libbfio_handle_t *file_io_handle,
+     libfsntfs_index_node_t *index_node,
+     uint32_t collation_type,
+     const uint8_t *data,
+     size_t data_size,
+     libfsntfs_index_value_t **index_value,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	libfsntfs_index_node_t *sub_node          = NULL;
+	libfsntfs_index_value_t *node_index_value = NULL;
+	static char *function                     = "libfsntfs_quota_index_get_index_value_from_index_node";
+	off64_t index_entry_offset                = 0;
+	int compare_result                        = 0;
+	int index_value_entry                     = 0;
+	int is_allocated                          = 0;
+	int number_of_index_values                = 0;
+	int result                                = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( index->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > LIBFSNTFS_MAXIMUM_INDEX_NODE_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsntfs_index_node_get_number_of_values(
+	     index_node,
+	     &number_of_index_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of values from index node.",
+		 function );
+
+		return( -1 );
+	}
+	/* The index values are sorted by key, the sub node of an index value
+	 * contains the keys that sort before the key of the index value
+	 */
+	for( index_value_entry = 0;
+	     index_value_entry < number_of_index_values;
+	     index_value_entry++ )
+	{
+		if( libfsntfs_index_node_get_value_by_index(
+		     index_node,
+		     index_value_entry,
+		     &node_index_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d from index node.",
+			 function,
+			 index_value_entry );
+
+			return( -1 );
+		}
+		if( ( node_index_value->flags & LIBFSNTFS_INDEX_VALUE_FLAG_IS_LAST ) != 0 )
+		{
+			break;
+		}
+		compare_result = libfsntfs_quota_index_compare_key(
+		                  collation_type,
+		                  node_index_value->key_data,
+		                  (size_t) node_index_value->key_data_size,
+		                  data,
+		                  data_size,
+		                  error );
+
+		if( compare_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare key of value: %d.",
+			 function,
+			 index_value_entry );
+
+			return( -1 );
+		}
+		else if( compare_result == LIBCDATA_COMPARE_EQUAL )
+		{
+			*index_value = node_index_value;
+
+			return( 1 );
+		}
+		else if( compare_result == LIBCDATA_COMPARE_LESS )
+		{
+			break;
+		}
+	}
+	if( ( index_value_entry >= number_of_index_values )
+	 || ( ( node_index_value->flags & LIBFSNTFS_INDEX_VALUE_FLAG_HAS_SUB_NODE ) == 0 ) )
+	{
+		return( 0 );
+	}
+	if( node_index_value->sub_node_vcn > (uint64_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: node index value: %d sub node VCN value out of bounds.",
+		 function,
+		 index_value_entry );
+
+		return( -1 );
+	}
+	is_allocated = libfsntfs_index_sub_node_is_allocated(
+	                index,
+	                (int) node_index_value->sub_node_vcn,
+	                error );
+
+	if( is_allocated == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if sub node with VCN: %d is allocated.",
+		 function,
+		 (int) node_index_value->sub_node_vcn );
+
+		return( -1 );
+	}
+	else if( is_allocated == 0 )
+	{
+		return( 0 );
+	}
+	index_entry_offset = (off64_t) ( node_index_value->sub_node_vcn * index->io_handle->cluster_block_size );
+
+	if( libfsntfs_index_get_sub_node(
+	     index,
+	     file_io_handle,
+	     index->index_node_cache,
+	     index_entry_offset,
+	     (int) node_index_value->sub_node_vcn,
+	     &sub_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub node with VCN: %d at offset: 0x%08" PRIx64 ".",
+		 function,
+		 (int) node_index_value->sub_node_vcn,
+		 index_entry_offset );
+
+		return( -1 );
+	}
+	result = libfsntfs_quota_index_get_index_value_from_index_node(
+	          index,
+	          file_io_handle,
+	          sub_node,
+	          collation_type,
+	          data,
+	          data_size,
+	          index_value,
+	          recursion_depth + 1,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve index value from index entry with VCN: %d at offset: 0x%08" PRIx64 ".",
+		 function,
+		 (int) node_index_value->sub_node_vcn,
+		 index_entry_offset );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the owner identifier for a specific SID
+ * Returns 1 if successful, 0 if no such SID or -1 on error
+ */
+int libfsntfs_quota_index_get_owner_identifier_by_sid(
+     libfsntfs_quota_index_t *quota_index,
+     libbfio_handle_t *file_io_handle,
+     const uint8_t *sid_data,
+     size_t sid_data_size,
+     uint32_t *owner_identifier,
+     libcerror_error_t **error )
+{
+	libfsntfs_index_value_t *index_value = NULL;
+	const uint8_t *data                  = NULL;
+	static char *function                = "libfsntfs_quota_index_get_owner_identifier_by_sid";
+	size_t data_size                     = 0;
+	int result                           = 0;
+
+	if( quota_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid quota index.",
+		 function );
+
+		return( -1 );
+	}
+	if( owner_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid owner identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( quota_index->o_index == NULL )
+	{
+		return( 0 );
+	}
+	result = libfsntfs_quota_index_get_index_value_from_index_node(
+	          quota_index->o_index,
+	          file_io_handle,
+	          quota_index->o_index->root_node,
+	          17,
+	          sid_data,
+	          sid_data_size,
+	          &index_value,
+	          0,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve index value by SID from $O index.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libfsntfs_quota_index_get_data_from_index_value(
+		     index_value,
+		     &data,
+		     &data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data from index value.",
+			 function );
+
+			return( -1 );
+		}
+		if( data_size < sizeof( fsntfs_quota_owner_index_value_t ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid data size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (fsntfs_quota_owner_index_value_t *) data )->owner_identifier,
+		 *owner_identifier );
+	}
+	return( result );
+}
+
+/* Retrieves the quota values for a specific owner identifier
+ * Returns 1 if successful, 0 if no such owner identifier or -1 on error
+ */
+int libfsntfs_quota_index_get_quota_by_owner_identifier(
+     libfsntfs_quota_index_t *quota_index,
+     libbfio_handle_t *file_io_handle,
+     uint32_t owner_identifier,
+     uint64_t *bytes_used,
+     uint64_t *warning_limit,
+     uint64_t *hard_limit,
+     libcerror_error_t **error )
+{
+	uint8_t owner_identifier_data[ 4 ];
+
+	libfsntfs_index_value_t *index_value = NULL;
+	const uint8_t *data                  = NULL;
+	static char *function                = "libfsntfs_quota_index_get_quota_by_owner_identifier";
+	size_t data_size                     = 0;
+	int result                           = 0;
+
+	if( quota_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid quota index.",
+		 function );
+
+		return( -1 );
+	}
+	if( bytes_used == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bytes used.",
+		 function );
+
+		return( -1 );
+	}
+	if( warning_limit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid warning limit.",
+		 function );
+
+		return( -1 );
+	}
+	if( hard_limit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hard limit.",
+		 function );
+
+		return( -1 );
+	}
+	if( quota_index->q_index == NULL )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 owner_identifier_data,
+	 owner_identifier );
+
+	result = libfsntfs_quota_index_get_index_value_from_index_node(
+	          quota_index->q_index,
+	          file_io_handle,
+	          quota_index->q_index->root_node,
+	          16,
+	          owner_identifier_data,
+	          4,
+	          &index_value,
+	          0,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve index value by owner identifier: %" PRIu32 " from $Q index.",
+		 function,
+		 owner_identifier );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libfsntfs_quota_index_get_data_from_index_value(
+		     index_value,
+		     &data,
+		     &data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data from index value.",
+			 function );
+
+			return( -1 );
+		}
+		if( data_size < sizeof( fsntfs_quota_control_entry_t ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid data size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (fsntfs_quota_control_entry_t *) data )->bytes_used,
+		 *bytes_used );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (fsntfs_quota_control_entry_t *) data )->warning_limit,
+		 *warning_limit );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (fsntfs_quota_control_entry_t *) data )->hard_limit,
+		 *hard_limit );
+	}
+	return( result );
+}
+
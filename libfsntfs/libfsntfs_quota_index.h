@@ -0,0 +1,125 @@
+/*
+ * Quota index functions
+ *
+ * Copyright (C) 2010-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSNTFS_QUOTA_INDEX_H )
+#define _LIBFSNTFS_QUOTA_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsntfs_index.h"
+#include "libfsntfs_index_node.h"
+#include "libfsntfs_index_value.h"
+#include "libfsntfs_io_handle.h"
+#include "libfsntfs_libbfio.h"
+#include "libfsntfs_libcerror.h"
+#include "libfsntfs_mft_entry.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsntfs_quota_index libfsntfs_quota_index_t;
+
+struct libfsntfs_quota_index
+{
+	/* The owner ($O) index
+	 */
+	libfsntfs_index_t *o_index;
+
+	/* The quota ($Q) index
+	 */
+	libfsntfs_index_t *q_index;
+};
+
+int libfsntfs_quota_index_initialize(
+     libfsntfs_quota_index_t **quota_index,
+     libcerror_error_t **error );
+
+int libfsntfs_quota_index_free(
+     libfsntfs_quota_index_t **quota_index,
+     libcerror_error_t **error );
+
+int libfsntfs_quota_index_read_index(
+     libfsntfs_index_t **index,
+     libfsntfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsntfs_mft_entry_t *mft_entry,
+     const uint8_t *name,
+     size_t name_size,
+     uint32_t collation_type,
+     libcerror_error_t **error );
+
+int libfsntfs_quota_index_read(
+     libfsntfs_quota_index_t *quota_index,
+     libfsntfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsntfs_mft_entry_t *mft_entry,
+     libcerror_error_t **error );
+
+int libfsntfs_quota_index_compare_key(
+     uint32_t collation_type,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfsntfs_quota_index_get_data_from_index_value(
+     libfsntfs_index_value_t *index_value,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int libfsntfs_quota_index_get_index_value_from_index_node(
+     libfsntfs_index_t *index,
+     libbfio_handle_t *file_io_handle,
+     libfsntfs_index_node_t *index_node,
+     uint32_t collation_type,
+     const uint8_t *data,
+     size_t data_size,
+     libfsntfs_index_value_t **index_value,
+     int recursion_depth,
+     libcerror_error_t **error );
+
+int libfsntfs_quota_index_get_owner_identifier_by_sid(
+     libfsntfs_quota_index_t *quota_index,
+     libbfio_handle_t *file_io_handle,
+     const uint8_t *sid_data,
+     size_t sid_data_size,
+     uint32_t *owner_identifier,
+     libcerror_error_t **error );
+
+int libfsntfs_quota_index_get_quota_by_owner_identifier(
+     libfsntfs_quota_index_t *quota_index,
+     libbfio_handle_t *file_io_handle,
+     uint32_t owner_identifier,
+     uint64_t *bytes_used,
+     uint64_t *warning_limit,
+     uint64_t *hard_limit,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSNTFS_QUOTA_INDEX_H ) */
+
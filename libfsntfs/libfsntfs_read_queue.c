@@ -0,0 +1,583 @@
+/*
+ * Read queue functions
+ *
+ * Copyright (C) 2010-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsntfs_definitions.h"
+#include "libfsntfs_libbfio.h"
+#include "libfsntfs_libcerror.h"
+#include "libfsntfs_libcnotify.h"
+#include "libfsntfs_libcthreads.h"
+#include "libfsntfs_read_queue.h"
+
+/* Creates a read queue
+ * Make sure the value read_queue is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_read_queue_initialize(
+     libfsntfs_read_queue_t **read_queue,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_read_queue_initialize";
+
+	if( read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_queue != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read queue value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*read_queue = memory_allocate_structure(
+	               libfsntfs_read_queue_t );
+
+	if( *read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read queue.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *read_queue,
+	     0,
+	     sizeof( libfsntfs_read_queue_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read queue.",
+		 function );
+
+		memory_free(
+		 *read_queue );
+
+		*read_queue = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *read_queue )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *read_queue != NULL )
+	{
+		memory_free(
+		 *read_queue );
+
+		*read_queue = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a read queue
+ * The data of the read requests is not freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_read_queue_free(
+     libfsntfs_read_queue_t **read_queue,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_read_queue_free";
+	int result            = 1;
+
+	if( read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_queue != NULL )
+	{
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *read_queue )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( ( *read_queue )->requests != NULL )
+		{
+			memory_free(
+			 ( *read_queue )->requests );
+		}
+		memory_free(
+		 *read_queue );
+
+		*read_queue = NULL;
+	}
+	return( result );
+}
+
+/* Empties a read queue
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_read_queue_empty(
+     libfsntfs_read_queue_t *read_queue,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_read_queue_empty";
+
+	if( read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	read_queue->number_of_requests = 0;
+	read_queue->next_request_index = 0;
+
+	return( 1 );
+}
+
+/* Retrieves the number of read requests
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_read_queue_get_number_of_requests(
+     libfsntfs_read_queue_t *read_queue,
+     int *number_of_requests,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_read_queue_get_number_of_requests";
+
+	if( read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_requests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of requests.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_requests = read_queue->number_of_requests;
+
+	return( 1 );
+}
+
+/* Appends a read request
+ * The data must remain available until the read queue has been read or emptied
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_read_queue_append_request(
+     libfsntfs_read_queue_t *read_queue,
+     off64_t offset,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libfsntfs_read_request_t *request  = NULL;
+	libfsntfs_read_request_t *requests = NULL;
+	static char *function              = "libfsntfs_read_queue_append_request";
+	size_t requests_size               = 0;
+	int maximum_number_of_requests     = 0;
+
+	if( read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_queue->number_of_requests >= read_queue->maximum_number_of_requests )
+	{
+		if( read_queue->maximum_number_of_requests > ( INT_MAX - 16 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid read queue - maximum number of requests value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		maximum_number_of_requests = read_queue->maximum_number_of_requests + 16;
+
+		requests_size = sizeof( libfsntfs_read_request_t ) * maximum_number_of_requests;
+
+		if( requests_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid requests size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		requests = (libfsntfs_read_request_t *) memory_reallocate(
+		                                         read_queue->requests,
+		                                         requests_size );
+
+		if( requests == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize requests.",
+			 function );
+
+			return( -1 );
+		}
+		read_queue->requests                   = requests;
+		read_queue->maximum_number_of_requests = maximum_number_of_requests;
+	}
+	request = &( read_queue->requests[ read_queue->number_of_requests ] );
+
+	request->offset     = offset;
+	request->data       = data;
+	request->data_size  = data_size;
+	request->read_count = -1;
+
+	read_queue->number_of_requests += 1;
+
+	return( 1 );
+}
+
+/* Reads the read requests that have not been handed out yet using a specific file IO handle
+ * This function is used both on the calling thread and by the threads of a read thread pool
+ * A request that cannot be read is marked by its read count, the other requests are still read
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_read_queue_read_requests(
+     libbfio_handle_t *file_io_handle,
+     libfsntfs_read_queue_t *read_queue )
+{
+	libcerror_error_t *error          = NULL;
+	libfsntfs_read_request_t *request = NULL;
+	int request_index                 = 0;
+
+	if( file_io_handle == NULL )
+	{
+		return( -1 );
+	}
+	if( read_queue == NULL )
+	{
+		return( -1 );
+	}
+	while( 1 )
+	{
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     read_queue->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_free(
+			 &error );
+
+			return( -1 );
+		}
+#endif
+		request_index = read_queue->next_request_index;
+
+		if( request_index < read_queue->number_of_requests )
+		{
+			read_queue->next_request_index += 1;
+		}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_release(
+		     read_queue->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_free(
+			 &error );
+
+			return( -1 );
+		}
+#endif
+		if( request_index >= read_queue->number_of_requests )
+		{
+			break;
+		}
+		request = &( read_queue->requests[ request_index ] );
+
+		request->read_count = libbfio_handle_read_buffer_at_offset(
+		                       file_io_handle,
+		                       request->data,
+		                       request->data_size,
+		                       request->offset,
+		                       &error );
+
+		if( request->read_count == -1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_print_error_backtrace(
+				 error );
+			}
+#endif
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	return( 1 );
+}
+
+/* Resets the read requests so that they can be read
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_read_queue_reset_requests(
+     libfsntfs_read_queue_t *read_queue,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_read_queue_reset_requests";
+	int request_index     = 0;
+
+	if( read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	for( request_index = 0;
+	     request_index < read_queue->number_of_requests;
+	     request_index++ )
+	{
+		read_queue->requests[ request_index ].read_count = -1;
+	}
+	read_queue->next_request_index = 0;
+
+	return( 1 );
+}
+
+/* Verifies that all the data of the read requests was read
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_read_queue_verify_requests(
+     libfsntfs_read_queue_t *read_queue,
+     libcerror_error_t **error )
+{
+	libfsntfs_read_request_t *request = NULL;
+	static char *function             = "libfsntfs_read_queue_verify_requests";
+	int request_index                 = 0;
+
+	if( read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	for( request_index = 0;
+	     request_index < read_queue->number_of_requests;
+	     request_index++ )
+	{
+		request = &( read_queue->requests[ request_index ] );
+
+		if( request->read_count != (ssize_t) request->data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read request: %d of size: %" PRIzd " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 request_index,
+			 request->data_size,
+			 request->offset,
+			 request->offset );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads the data of all the read requests in order on the calling thread
+ * Use libfsntfs_read_thread_pool_read to keep the reads in flight by multiple threads
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_read_queue_read(
+     libfsntfs_read_queue_t *read_queue,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_read_queue_read";
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsntfs_read_queue_reset_requests(
+	     read_queue,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset requests.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsntfs_read_queue_read_requests(
+	     file_io_handle,
+	     read_queue ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read requests.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsntfs_read_queue_verify_requests(
+	     read_queue,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to verify requests.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,134 @@
+/*
+ * Read queue functions
+ *
+ * Copyright (C) 2010-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSNTFS_READ_QUEUE_H )
+#define _LIBFSNTFS_READ_QUEUE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsntfs_libbfio.h"
+#include "libfsntfs_libcerror.h"
+#include "libfsntfs_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsntfs_read_request libfsntfs_read_request_t;
+
+/* A request to read data at a specific offset
+ */
+struct libfsntfs_read_request
+{
+	/* The offset of the data in the file IO handle
+	 */
+	off64_t offset;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The number of bytes read
+	 */
+	ssize_t read_count;
+};
+
+typedef struct libfsntfs_read_queue libfsntfs_read_queue_t;
+
+/* A queue of read requests that are kept in flight together
+ */
+struct libfsntfs_read_queue
+{
+	/* The read requests
+	 */
+	libfsntfs_read_request_t *requests;
+
+	/* The number of read requests
+	 */
+	int number_of_requests;
+
+	/* The maximum number of read requests
+	 */
+	int maximum_number_of_requests;
+
+	/* The index of the next read request to be handed to a worker
+	 */
+	int next_request_index;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	/* The mutex that protects the index of the next read request
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libfsntfs_read_queue_initialize(
+     libfsntfs_read_queue_t **read_queue,
+     libcerror_error_t **error );
+
+int libfsntfs_read_queue_free(
+     libfsntfs_read_queue_t **read_queue,
+     libcerror_error_t **error );
+
+int libfsntfs_read_queue_empty(
+     libfsntfs_read_queue_t *read_queue,
+     libcerror_error_t **error );
+
+int libfsntfs_read_queue_get_number_of_requests(
+     libfsntfs_read_queue_t *read_queue,
+     int *number_of_requests,
+     libcerror_error_t **error );
+
+int libfsntfs_read_queue_append_request(
+     libfsntfs_read_queue_t *read_queue,
+     off64_t offset,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfsntfs_read_queue_read_requests(
+     libbfio_handle_t *file_io_handle,
+     libfsntfs_read_queue_t *read_queue );
+
+int libfsntfs_read_queue_reset_requests(
+     libfsntfs_read_queue_t *read_queue,
+     libcerror_error_t **error );
+
+int libfsntfs_read_queue_verify_requests(
+     libfsntfs_read_queue_t *read_queue,
+     libcerror_error_t **error );
+
+int libfsntfs_read_queue_read(
+     libfsntfs_read_queue_t *read_queue,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSNTFS_READ_QUEUE_H ) */
+
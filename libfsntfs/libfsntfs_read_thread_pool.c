@@ -0,0 +1,707 @@
+/*
+ * Read thread pool functions
+ *
+ * Copyright (C) 2010-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsntfs_definitions.h"
+#include "libfsntfs_libbfio.h"
+#include "libfsntfs_libcerror.h"
+#include "libfsntfs_libcthreads.h"
+#include "libfsntfs_read_queue.h"
+#include "libfsntfs_read_thread_pool.h"
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+
+/* Creates a read thread pool
+ * Make sure the value read_thread_pool is referencing, is set to NULL
+ * Every thread reads using its own clone of the file IO handle, hence the file IO handle
+ * must support cloning and the clones must be able to read at the same time
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_read_thread_pool_initialize(
+     libfsntfs_read_thread_pool_t **read_thread_pool,
+     libbfio_handle_t *file_io_handle,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function       = "libfsntfs_read_thread_pool_initialize";
+	size_t file_io_handles_size = 0;
+	int file_io_handle_is_open  = 0;
+	int thread_index            = 0;
+
+	if( read_thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_thread_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read thread pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > LIBFSNTFS_READ_QUEUE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*read_thread_pool = memory_allocate_structure(
+	                     libfsntfs_read_thread_pool_t );
+
+	if( *read_thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *read_thread_pool,
+	     0,
+	     sizeof( libfsntfs_read_thread_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read thread pool.",
+		 function );
+
+		memory_free(
+		 *read_thread_pool );
+
+		*read_thread_pool = NULL;
+
+		return( -1 );
+	}
+	file_io_handles_size = sizeof( libbfio_handle_t * ) * number_of_threads;
+
+	( *read_thread_pool )->file_io_handles = (libbfio_handle_t **) memory_allocate(
+	                                                                file_io_handles_size );
+
+	if( ( *read_thread_pool )->file_io_handles == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file IO handles.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *read_thread_pool )->file_io_handles,
+	     0,
+	     file_io_handles_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file IO handles.",
+		 function );
+
+		goto on_error;
+	}
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		if( libbfio_handle_clone(
+		     &( ( *read_thread_pool )->file_io_handles[ thread_index ] ),
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to clone file IO handle: %d.",
+			 function,
+			 thread_index );
+
+			goto on_error;
+		}
+		( *read_thread_pool )->number_of_threads += 1;
+
+		file_io_handle_is_open = libbfio_handle_is_open(
+		                          ( *read_thread_pool )->file_io_handles[ thread_index ],
+		                          error );
+
+		if( file_io_handle_is_open == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to determine if file IO handle: %d is open.",
+			 function,
+			 thread_index );
+
+			goto on_error;
+		}
+		else if( file_io_handle_is_open == 0 )
+		{
+			if( libbfio_handle_open(
+			     ( *read_thread_pool )->file_io_handles[ thread_index ],
+			     LIBBFIO_ACCESS_FLAG_READ,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open file IO handle: %d.",
+				 function,
+				 thread_index );
+
+				goto on_error;
+			}
+		}
+	}
+	if( libcthreads_mutex_initialize(
+	     &( ( *read_thread_pool )->read_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_initialize(
+	     &( ( *read_thread_pool )->condition_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create condition mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *read_thread_pool )->condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create condition.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_thread_pool_create(
+	     &( ( *read_thread_pool )->thread_pool ),
+	     NULL,
+	     number_of_threads,
+	     number_of_threads,
+	     (int (*)(intptr_t *, void *)) &libfsntfs_read_thread_pool_read_requests,
+	     (void *) *read_thread_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *read_thread_pool != NULL )
+	{
+		libfsntfs_read_thread_pool_free(
+		 read_thread_pool,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a read thread pool
+ * The threads are joined before the file IO handles are closed
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_read_thread_pool_free(
+     libfsntfs_read_thread_pool_t **read_thread_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_read_thread_pool_free";
+	int result            = 1;
+	int thread_index      = 0;
+
+	if( read_thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_thread_pool != NULL )
+	{
+		if( ( *read_thread_pool )->thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_join(
+			     &( ( *read_thread_pool )->thread_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *read_thread_pool )->condition != NULL )
+		{
+			if( libcthreads_condition_free(
+			     &( ( *read_thread_pool )->condition ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free condition.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *read_thread_pool )->condition_mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *read_thread_pool )->condition_mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free condition mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *read_thread_pool )->read_mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *read_thread_pool )->read_mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free read mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *read_thread_pool )->file_io_handles != NULL )
+		{
+			for( thread_index = 0;
+			     thread_index < ( *read_thread_pool )->number_of_threads;
+			     thread_index++ )
+			{
+				if( libbfio_handle_free(
+				     &( ( *read_thread_pool )->file_io_handles[ thread_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free file IO handle: %d.",
+					 function,
+					 thread_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 ( *read_thread_pool )->file_io_handles );
+		}
+		memory_free(
+		 *read_thread_pool );
+
+		*read_thread_pool = NULL;
+	}
+	return( result );
+}
+
+/* Reads the requests of the read queue that is being read using a specific file IO handle
+ * This function is used as the thread pool callback
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_read_thread_pool_read_requests(
+     libbfio_handle_t *file_io_handle,
+     libfsntfs_read_thread_pool_t *read_thread_pool )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 1;
+
+	if( read_thread_pool == NULL )
+	{
+		return( -1 );
+	}
+	/* A request that cannot be read is marked by its read count
+	 */
+	if( libfsntfs_read_queue_read_requests(
+	     file_io_handle,
+	     read_thread_pool->read_queue ) != 1 )
+	{
+		result = -1;
+	}
+	if( libcthreads_mutex_grab(
+	     read_thread_pool->condition_mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_free(
+		 &error );
+
+		return( -1 );
+	}
+	read_thread_pool->number_of_busy_threads -= 1;
+
+	if( read_thread_pool->number_of_busy_threads == 0 )
+	{
+		if( libcthreads_condition_broadcast(
+		     read_thread_pool->condition,
+		     &error ) != 1 )
+		{
+			libcerror_error_free(
+			 &error );
+
+			result = -1;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     read_thread_pool->condition_mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_free(
+		 &error );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Waits until no more threads are reading the read queue
+ * The number of idle threads are the threads that were accounted as busy but have not
+ * been pushed onto the thread pool, it is set to 0 once it has been accounted for
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_read_thread_pool_wait_for_busy_threads(
+     libfsntfs_read_thread_pool_t *read_thread_pool,
+     int *number_of_idle_threads,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_read_thread_pool_wait_for_busy_threads";
+
+	if( read_thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_idle_threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of idle threads.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     read_thread_pool->condition_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab condition mutex.",
+		 function );
+
+		return( -1 );
+	}
+	read_thread_pool->number_of_busy_threads -= *number_of_idle_threads;
+
+	*number_of_idle_threads = 0;
+
+	while( read_thread_pool->number_of_busy_threads > 0 )
+	{
+		if( libcthreads_condition_wait(
+		     read_thread_pool->condition,
+		     read_thread_pool->condition_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for condition.",
+			 function );
+
+			libcthreads_mutex_release(
+			 read_thread_pool->condition_mutex,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	if( libcthreads_mutex_release(
+	     read_thread_pool->condition_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release condition mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the data of all the read requests of a read queue
+ * The reads are kept in flight by the threads of the pool and complete in any order.
+ * Read queues are read one at a time, the function returns when all the threads
+ * have finished reading the read queue
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_read_thread_pool_read(
+     libfsntfs_read_thread_pool_t *read_thread_pool,
+     libfsntfs_read_queue_t *read_queue,
+     libcerror_error_t **error )
+{
+	static char *function      = "libfsntfs_read_thread_pool_read";
+	int number_of_idle_threads = 0;
+	int number_of_threads      = 0;
+	int thread_index           = 0;
+
+	if( read_thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsntfs_read_queue_reset_requests(
+	     read_queue,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset requests.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_queue->number_of_requests == 0 )
+	{
+		return( 1 );
+	}
+	number_of_threads = read_thread_pool->number_of_threads;
+
+	if( number_of_threads > read_queue->number_of_requests )
+	{
+		number_of_threads = read_queue->number_of_requests;
+	}
+	if( libcthreads_mutex_grab(
+	     read_thread_pool->read_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read mutex.",
+		 function );
+
+		return( -1 );
+	}
+	read_thread_pool->read_queue             = read_queue;
+	read_thread_pool->number_of_busy_threads = number_of_threads;
+
+	/* Every thread reads with a different file IO handle, since only one read queue
+	 * is read at a time no file IO handle is used by more than one thread
+	 */
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		if( libcthreads_thread_pool_push(
+		     read_thread_pool->thread_pool,
+		     (intptr_t *) read_thread_pool->file_io_handles[ thread_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push file IO handle: %d onto thread pool.",
+			 function,
+			 thread_index );
+
+			number_of_idle_threads = number_of_threads - thread_index;
+
+			goto on_error;
+		}
+	}
+	if( libfsntfs_read_thread_pool_wait_for_busy_threads(
+	     read_thread_pool,
+	     &number_of_idle_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to wait for busy threads.",
+		 function );
+
+		goto on_error;
+	}
+	read_thread_pool->read_queue = NULL;
+
+	if( libcthreads_mutex_release(
+	     read_thread_pool->read_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsntfs_read_queue_verify_requests(
+	     read_queue,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to verify requests.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	/* The read queue is owned by the caller and cannot be released while
+	 * the threads that have been pushed are still reading it
+	 */
+	while( libfsntfs_read_thread_pool_wait_for_busy_threads(
+	        read_thread_pool,
+	        &number_of_idle_threads,
+	        NULL ) != 1 )
+	{
+	}
+	read_thread_pool->read_queue = NULL;
+
+	libcthreads_mutex_release(
+	 read_thread_pool->read_mutex,
+	 NULL );
+
+	return( -1 );
+}
+
+#endif /* defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT ) */
+
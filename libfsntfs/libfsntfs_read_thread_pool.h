@@ -0,0 +1,110 @@
+/*
+ * Read thread pool functions
+ *
+ * Copyright (C) 2010-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSNTFS_READ_THREAD_POOL_H )
+#define _LIBFSNTFS_READ_THREAD_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsntfs_libbfio.h"
+#include "libfsntfs_libcerror.h"
+#include "libfsntfs_libcthreads.h"
+#include "libfsntfs_read_queue.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+
+typedef struct libfsntfs_read_thread_pool libfsntfs_read_thread_pool_t;
+
+/* A pool of threads, each with their own clone of the file IO handle,
+ * that is kept for the lifetime of an open volume to read the requests of read queues
+ */
+struct libfsntfs_read_thread_pool
+{
+	/* The file IO handles, one for every thread
+	 */
+	libbfio_handle_t **file_io_handles;
+
+	/* The number of threads
+	 */
+	int number_of_threads;
+
+	/* The thread pool
+	 */
+	libcthreads_thread_pool_t *thread_pool;
+
+	/* The mutex that allows only one read queue to be read at a time
+	 */
+	libcthreads_mutex_t *read_mutex;
+
+	/* The read queue that is being read
+	 */
+	libfsntfs_read_queue_t *read_queue;
+
+	/* The number of threads that are reading the read queue
+	 */
+	int number_of_busy_threads;
+
+	/* The mutex that protects the number of busy threads
+	 */
+	libcthreads_mutex_t *condition_mutex;
+
+	/* The condition that is broadcasted when no more threads are reading the read queue
+	 */
+	libcthreads_condition_t *condition;
+};
+
+int libfsntfs_read_thread_pool_initialize(
+     libfsntfs_read_thread_pool_t **read_thread_pool,
+     libbfio_handle_t *file_io_handle,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+int libfsntfs_read_thread_pool_free(
+     libfsntfs_read_thread_pool_t **read_thread_pool,
+     libcerror_error_t **error );
+
+int libfsntfs_read_thread_pool_read_requests(
+     libbfio_handle_t *file_io_handle,
+     libfsntfs_read_thread_pool_t *read_thread_pool );
+
+int libfsntfs_read_thread_pool_wait_for_busy_threads(
+     libfsntfs_read_thread_pool_t *read_thread_pool,
+     int *number_of_idle_threads,
+     libcerror_error_t **error );
+
+int libfsntfs_read_thread_pool_read(
+     libfsntfs_read_thread_pool_t *read_thread_pool,
+     libfsntfs_read_queue_t *read_queue,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSNTFS_READ_THREAD_POOL_H ) */
+
@@ -0,0 +1,874 @@
+/*
+ * Reparse point index functions
+ *
+ * Copyright (C) 2010-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsntfs_definitions.h"
+#include "libfsntfs_index.h"
+#include "libfsntfs_index_node.h"
+#include "libfsntfs_index_value.h"
+#include "libfsntfs_libbfio.h"
+#include "libfsntfs_libcerror.h"
+#include "libfsntfs_libcnotify.h"
+#include "libfsntfs_libfcache.h"
+#include "libfsntfs_mft_entry.h"
+#include "libfsntfs_reparse_point_index.h"
+
+#include "fsntfs_reparse_point.h"
+
+/* Creates a reparse point index
+ * Make sure the value reparse_point_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_reparse_point_index_initialize(
+     libfsntfs_reparse_point_index_t **reparse_point_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_reparse_point_index_initialize";
+
+	if( reparse_point_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid reparse point index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *reparse_point_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid reparse point index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*reparse_point_index = memory_allocate_structure(
+	                        libfsntfs_reparse_point_index_t );
+
+	if( *reparse_point_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create reparse point index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *reparse_point_index,
+	     0,
+	     sizeof( libfsntfs_reparse_point_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear reparse point index.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *reparse_point_index != NULL )
+	{
+		memory_free(
+		 *reparse_point_index );
+
+		*reparse_point_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a reparse point index
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_reparse_point_index_free(
+     libfsntfs_reparse_point_index_t **reparse_point_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_reparse_point_index_free";
+
+	if( reparse_point_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid reparse point index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *reparse_point_index != NULL )
+	{
+		if( ( *reparse_point_index )->entries != NULL )
+		{
+			memory_free(
+			 ( *reparse_point_index )->entries );
+		}
+		memory_free(
+		 *reparse_point_index );
+
+		*reparse_point_index = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends an entry to the reparse point index
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_reparse_point_index_append_entry(
+     libfsntfs_reparse_point_index_t *reparse_point_index,
+     uint32_t tag,
+     uint64_t file_reference,
+     libcerror_error_t **error )
+{
+	libfsntfs_reparse_point_index_entry_t *entries = NULL;
+	static char *function                          = "libfsntfs_reparse_point_index_append_entry";
+	size_t allocation_size                         = 0;
+	int maximum_number_of_entries                  = 0;
+
+	if( reparse_point_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid reparse point index.",
+		 function );
+
+		return( -1 );
+	}
+	if( reparse_point_index->number_of_entries >= reparse_point_index->maximum_number_of_entries )
+	{
+		if( reparse_point_index->maximum_number_of_entries > ( INT_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid reparse point index - maximum number of entries value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		maximum_number_of_entries = reparse_point_index->maximum_number_of_entries * 2;
+
+		if( maximum_number_of_entries == 0 )
+		{
+			maximum_number_of_entries = LIBFSNTFS_REPARSE_POINT_INDEX_ENTRIES_ALLOCATION_SIZE;
+		}
+		allocation_size = sizeof( libfsntfs_reparse_point_index_entry_t ) * (size_t) maximum_number_of_entries;
+
+		if( allocation_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid entries size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		entries = (libfsntfs_reparse_point_index_entry_t *) memory_reallocate(
+		                                                     reparse_point_index->entries,
+		                                                     allocation_size );
+
+		if( entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		reparse_point_index->entries                   = entries;
+		reparse_point_index->maximum_number_of_entries = maximum_number_of_entries;
+	}
+	reparse_point_index->entries[ reparse_point_index->number_of_entries ].file_reference = file_reference;
+	reparse_point_index->entries[ reparse_point_index->number_of_entries ].tag            = tag;
+
+	reparse_point_index->number_of_entries += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the tag and file reference from a $R index value
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_reparse_point_index_get_values_from_index_value(
+     libfsntfs_index_value_t *index_value,
+     uint32_t *tag,
+     uint64_t *file_reference,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_reparse_point_index_get_values_from_index_value";
+
+	if( index_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( index_value->key_data == NULL )
+	 || ( index_value->key_data_size < sizeof( fsntfs_reparse_point_index_key_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid index value - key data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_reference == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file reference.",
+		 function );
+
+		return( -1 );
+	}
+	/* The $R index stores the tag and file reference in the key,
+	 * the data of the index value is empty
+	 */
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (fsntfs_reparse_point_index_key_t *) index_value->key_data )->tag,
+	 *tag );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsntfs_reparse_point_index_key_t *) index_value->key_data )->file_reference,
+	 *file_reference );
+
+	return( 1 );
+}
+
+/* Reads the reparse point index entries from an index node
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_reparse_point_index_read_from_index_node(
+     libfsntfs_reparse_point_index_t *reparse_point_index,
+     libfsntfs_index_t *r_index,
+     libbfio_handle_t *file_io_handle,
+     libfsntfs_index_node_t *index_node,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	libfcache_cache_t *sub_node_cache    = NULL;
+	libfsntfs_index_node_t *sub_node     = NULL;
+	libfsntfs_index_value_t *index_value = NULL;
+	static char *function                = "libfsntfs_reparse_point_index_read_from_index_node";
+	off64_t index_entry_offset           = 0;
+	uint64_t file_reference              = 0;
+	uint32_t tag                         = 0;
+	int index_value_entry                = 0;
+	int is_allocated                     = 0;
+	int number_of_cache_entries          = 0;
+	int number_of_index_values           = 0;
+
+	if( reparse_point_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid reparse point index.",
+		 function );
+
+		return( -1 );
+	}
+	if( r_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid $R index.",
+		 function );
+
+		return( -1 );
+	}
+	if( r_index->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid $R index - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > LIBFSNTFS_MAXIMUM_INDEX_NODE_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsntfs_index_node_get_number_of_values(
+	     index_node,
+	     &number_of_index_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of values from index node.",
+		 function );
+
+		goto on_error;
+	}
+	/* Use a local cache to prevent cache invalidation of index node
+	 * when reading sub nodes. The cache is sized to hold the sub nodes
+	 * of the index node so that they can be prefetched.
+	 */
+	number_of_cache_entries = number_of_index_values;
+
+	if( number_of_cache_entries < 1 )
+	{
+		number_of_cache_entries = 1;
+	}
+	else if( number_of_cache_entries > LIBFSNTFS_MAXIMUM_CACHE_ENTRIES_INDEX_NODES )
+	{
+		number_of_cache_entries = LIBFSNTFS_MAXIMUM_CACHE_ENTRIES_INDEX_NODES;
+	}
+	if( libfcache_cache_initialize(
+	     &sub_node_cache,
+	     number_of_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sub node cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsntfs_index_prefetch_sub_nodes(
+	     r_index,
+	     file_io_handle,
+	     sub_node_cache,
+	     index_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to prefetch sub nodes.",
+		 function );
+
+		goto on_error;
+	}
+	for( index_value_entry = 0;
+	     index_value_entry < number_of_index_values;
+	     index_value_entry++ )
+	{
+		if( libfsntfs_index_node_get_value_by_index(
+		     index_node,
+		     index_value_entry,
+		     &index_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d from index node.",
+			 function,
+			 index_value_entry );
+
+			goto on_error;
+		}
+		if( ( index_value->flags & LIBFSNTFS_INDEX_VALUE_FLAG_HAS_SUB_NODE ) != 0 )
+		{
+			if( index_value->sub_node_vcn > (uint64_t) INT_MAX )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: node index value: %d sub node VCN value out of bounds.",
+				 function,
+				 index_value_entry );
+
+				goto on_error;
+			}
+			is_allocated = libfsntfs_index_sub_node_is_allocated(
+			                r_index,
+			                (int) index_value->sub_node_vcn,
+			                error );
+
+			if( is_allocated == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine if sub node with VCN: %d is allocated.",
+				 function,
+				 (int) index_value->sub_node_vcn );
+
+				goto on_error;
+			}
+			else if( is_allocated != 0 )
+			{
+				index_entry_offset = (off64_t) ( index_value->sub_node_vcn * r_index->io_handle->cluster_block_size );
+
+				if( libfsntfs_index_get_sub_node(
+				     r_index,
+				     file_io_handle,
+				     sub_node_cache,
+				     index_entry_offset,
+				     (int) index_value->sub_node_vcn,
+				     &sub_node,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve sub node with VCN: %d at offset: 0x%08" PRIx64 ".",
+					 function,
+					 (int) index_value->sub_node_vcn,
+					 index_entry_offset );
+
+					goto on_error;
+				}
+				if( libfsntfs_reparse_point_index_read_from_index_node(
+				     reparse_point_index,
+				     r_index,
+				     file_io_handle,
+				     sub_node,
+				     recursion_depth + 1,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read reparse point index from index entry with VCN: %d at offset: 0x%08" PRIx64 ".",
+					 function,
+					 (int) index_value->sub_node_vcn,
+					 index_entry_offset );
+
+					goto on_error;
+				}
+			}
+		}
+		if( ( index_value->flags & LIBFSNTFS_INDEX_VALUE_FLAG_IS_LAST ) != 0 )
+		{
+			break;
+		}
+		if( libfsntfs_reparse_point_index_get_values_from_index_value(
+		     index_value,
+		     &tag,
+		     &file_reference,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve values from index value: %d.",
+			 function,
+			 index_value_entry );
+
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: index value: %03d tag: 0x%08" PRIx32 " file reference: %" PRIu64 "-%" PRIu64 "\n",
+			 function,
+			 index_value_entry,
+			 tag,
+			 file_reference & 0xffffffffffffUL,
+			 file_reference >> 48 );
+
+			libcnotify_printf(
+			 "\n" );
+		}
+#endif
+		/* Add the entries in a depth first manner since this will preserve
+		 * the sorted by tag and file reference order of the index
+		 */
+		if( libfsntfs_reparse_point_index_append_entry(
+		     reparse_point_index,
+		     tag,
+		     file_reference,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append entry to reparse point index.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfcache_cache_free(
+	     &sub_node_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free sub node cache.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( sub_node_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &sub_node_cache,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the reparse point index from the $R index
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsntfs_reparse_point_index_read_r_index(
+     libfsntfs_reparse_point_index_t *reparse_point_index,
+     libfsntfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsntfs_mft_entry_t *mft_entry,
+     libcerror_error_t **error )
+{
+	libfsntfs_index_t *r_index = NULL;
+	static char *function      = "libfsntfs_reparse_point_index_read_r_index";
+	uint32_t attribute_type    = 0;
+	uint32_t collation_type    = 0;
+	int result                 = 0;
+
+	if( reparse_point_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid reparse point index.",
+		 function );
+
+		return( -1 );
+	}
+	if( reparse_point_index->number_of_entries != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid reparse point index - entries value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsntfs_index_initialize(
+	     &r_index,
+	     io_handle,
+	     (uint8_t *) "$R",
+	     3,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create $R index.",
+		 function );
+
+		goto on_error;
+	}
+	result = libfsntfs_index_read(
+	          r_index,
+	          file_io_handle,
+	          mft_entry,
+	          0,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read $R index.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libfsntfs_index_get_attribute_type(
+		     r_index,
+		     &attribute_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve attribute type from index.",
+			 function );
+
+			goto on_error;
+		}
+		if( attribute_type != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported index attribute type.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsntfs_index_get_collation_type(
+		     r_index,
+		     &collation_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve collation type from index.",
+			 function );
+
+			goto on_error;
+		}
+		/* The $R index uses the COLLATION_NTOFS_ULONGS collation type
+		 */
+		if( collation_type != 19 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported index collation type.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsntfs_reparse_point_index_read_from_index_node(
+		     reparse_point_index,
+		     r_index,
+		     file_io_handle,
+		     r_index->root_node,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read reparse point index from root node.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The entries are copied so the $R index is not retained
+	 */
+	if( libfsntfs_index_free(
+	     &r_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free $R index.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( r_index != NULL )
+	{
+		libfsntfs_index_free(
+		 &r_index,
+		 NULL );
+	}
+	reparse_point_index->number_of_entries = 0;
+
+	return( -1 );
+}
+
+/* Retrieves the number of entries
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_reparse_point_index_get_number_of_entries(
+     libfsntfs_reparse_point_index_t *reparse_point_index,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_reparse_point_index_get_number_of_entries";
+
+	if( reparse_point_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid reparse point index.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = reparse_point_index->number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves a specific entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_reparse_point_index_get_entry_by_index(
+     libfsntfs_reparse_point_index_t *reparse_point_index,
+     int entry_index,
+     uint32_t *tag,
+     uint64_t *file_reference,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_reparse_point_index_get_entry_by_index";
+
+	if( reparse_point_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid reparse point index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= reparse_point_index->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_reference == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file reference.",
+		 function );
+
+		return( -1 );
+	}
+	*tag            = reparse_point_index->entries[ entry_index ].tag;
+	*file_reference = reparse_point_index->entries[ entry_index ].file_reference;
+
+	return( 1 );
+}
+
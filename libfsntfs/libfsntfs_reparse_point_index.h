@@ -0,0 +1,126 @@
+/*
+ * Reparse point index functions
+ *
+ * Copyright (C) 2010-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSNTFS_REPARSE_POINT_INDEX_H )
+#define _LIBFSNTFS_REPARSE_POINT_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsntfs_index.h"
+#include "libfsntfs_index_node.h"
+#include "libfsntfs_index_value.h"
+#include "libfsntfs_io_handle.h"
+#include "libfsntfs_libbfio.h"
+#include "libfsntfs_libcerror.h"
+#include "libfsntfs_mft_entry.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsntfs_reparse_point_index_entry libfsntfs_reparse_point_index_entry_t;
+
+/* A reparse point in the reparse point index
+ */
+struct libfsntfs_reparse_point_index_entry
+{
+	/* The file reference
+	 */
+	uint64_t file_reference;
+
+	/* The tag
+	 */
+	uint32_t tag;
+};
+
+typedef struct libfsntfs_reparse_point_index libfsntfs_reparse_point_index_t;
+
+/* The reparse points of the $R index of $Extend\$Reparse
+ */
+struct libfsntfs_reparse_point_index
+{
+	/* The entries, sorted by tag and file reference
+	 */
+	libfsntfs_reparse_point_index_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The maximum number of entries
+	 */
+	int maximum_number_of_entries;
+};
+
+int libfsntfs_reparse_point_index_initialize(
+     libfsntfs_reparse_point_index_t **reparse_point_index,
+     libcerror_error_t **error );
+
+int libfsntfs_reparse_point_index_free(
+     libfsntfs_reparse_point_index_t **reparse_point_index,
+     libcerror_error_t **error );
+
+int libfsntfs_reparse_point_index_append_entry(
+     libfsntfs_reparse_point_index_t *reparse_point_index,
+     uint32_t tag,
+     uint64_t file_reference,
+     libcerror_error_t **error );
+
+int libfsntfs_reparse_point_index_get_values_from_index_value(
+     libfsntfs_index_value_t *index_value,
+     uint32_t *tag,
+     uint64_t *file_reference,
+     libcerror_error_t **error );
+
+int libfsntfs_reparse_point_index_read_from_index_node(
+     libfsntfs_reparse_point_index_t *reparse_point_index,
+     libfsntfs_index_t *r_index,
+     libbfio_handle_t *file_io_handle,
+     libfsntfs_index_node_t *index_node,
+     int recursion_depth,
+     libcerror_error_t **error );
+
+int libfsntfs_reparse_point_index_read_r_index(
+     libfsntfs_reparse_point_index_t *reparse_point_index,
+     libfsntfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsntfs_mft_entry_t *mft_entry,
+     libcerror_error_t **error );
+
+int libfsntfs_reparse_point_index_get_number_of_entries(
+     libfsntfs_reparse_point_index_t *reparse_point_index,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+int libfsntfs_reparse_point_index_get_entry_by_index(
+     libfsntfs_reparse_point_index_t *reparse_point_index,
+     int entry_index,
+     uint32_t *tag,
+     uint64_t *file_reference,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSNTFS_REPARSE_POINT_INDEX_H ) */
+
@@ -0,0 +1,241 @@
+/*
+ * Statistics functions
+ *
+ * Copyright (C) 2010-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( TIME_WITH_SYS_TIME )
+#include <sys/time.h>
+#include <time.h>
+#elif defined( HAVE_SYS_TIME_H )
+#include <sys/time.h>
+#else
+#include <time.h>
+#endif
+
+#include "libfsntfs_definitions.h"
+#include "libfsntfs_libcerror.h"
+#include "libfsntfs_libcthreads.h"
+#include "libfsntfs_statistics.h"
+
+/* Retrieves a monotonic timestamp in nano seconds to start timing
+ * The start timestamp is set to 0 if no monotonic clock is available
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_statistics_start_timing(
+     uint64_t *start_timestamp,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+
+#elif defined( CLOCK_MONOTONIC )
+	struct timespec start_time;
+
+#endif
+	static char *function = "libfsntfs_statistics_start_timing";
+
+	if( start_timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid start timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	*start_timestamp = 0;
+
+#if defined( WINAPI )
+	if( ( QueryPerformanceFrequency(
+	       &frequency ) != 0 )
+	 && ( QueryPerformanceCounter(
+	       &counter ) != 0 )
+	 && ( frequency.QuadPart > 0 ) )
+	{
+		*start_timestamp = ( ( (uint64_t) counter.QuadPart / (uint64_t) frequency.QuadPart ) * 1000000000 )
+		                 + ( ( ( (uint64_t) counter.QuadPart % (uint64_t) frequency.QuadPart ) * 1000000000 ) / (uint64_t) frequency.QuadPart );
+	}
+#elif defined( CLOCK_MONOTONIC )
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &start_time ) == 0 )
+	{
+		*start_timestamp = ( (uint64_t) start_time.tv_sec * 1000000000 ) + (uint64_t) start_time.tv_nsec;
+	}
+#endif
+	return( 1 );
+}
+
+/* Adds the time passed since the start timestamp to the decompression time of a specific compression method
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_statistics_add_decompression_time(
+     uint64_t *statistics,
+     uint32_t compression_method,
+     uint64_t start_timestamp,
+     libcerror_error_t **error )
+{
+	static char *function   = "libfsntfs_statistics_add_decompression_time";
+	uint64_t stop_timestamp = 0;
+	int value_index         = 0;
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	switch( compression_method )
+	{
+		case LIBFSNTFS_COMPRESSION_METHOD_LZNT1:
+			value_index = LIBFSNTFS_STATISTICS_VALUE_LZNT1_DECOMPRESSION_TIME;
+			break;
+
+		case LIBFSNTFS_COMPRESSION_METHOD_LZX:
+			value_index = LIBFSNTFS_STATISTICS_VALUE_LZX_DECOMPRESSION_TIME;
+			break;
+
+		case LIBFSNTFS_COMPRESSION_METHOD_LZXPRESS_HUFFMAN:
+			value_index = LIBFSNTFS_STATISTICS_VALUE_LZXPRESS_HUFFMAN_DECOMPRESSION_TIME;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported compression method.",
+			 function );
+
+			return( -1 );
+	}
+	if( libfsntfs_statistics_start_timing(
+	     &stop_timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve stop timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	/* A monotonic clock should never go backwards but guard against it regardless
+	 */
+	if( stop_timestamp < start_timestamp )
+	{
+		stop_timestamp = start_timestamp;
+	}
+	libfsntfs_statistics_add_value(
+	 statistics,
+	 value_index,
+	 stop_timestamp - start_timestamp );
+
+	return( 1 );
+}
+
+/* Retrieves the statistics values
+ * Values beyond the number of statistics values are set to 0
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_statistics_get_values(
+     uint64_t *statistics,
+     uint64_t *values,
+     int number_of_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_statistics_get_values";
+	int value_index       = 0;
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of values value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		if( value_index >= LIBFSNTFS_STATISTICS_NUMBER_OF_VALUES )
+		{
+			values[ value_index ] = 0;
+		}
+		else
+		{
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT ) && defined( __GNUC__ )
+			values[ value_index ] = __atomic_load_n(
+			                         &( statistics[ value_index ] ),
+			                         __ATOMIC_RELAXED );
+
+#elif defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT ) && defined( WINAPI )
+			values[ value_index ] = (uint64_t) InterlockedCompareExchange64(
+			                                    (LONG64 volatile *) &( statistics[ value_index ] ),
+			                                    0,
+			                                    0 );
+
+#else
+			values[ value_index ] = statistics[ value_index ];
+
+#endif
+		}
+	}
+	return( 1 );
+}
+
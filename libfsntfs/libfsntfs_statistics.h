@@ -0,0 +1,75 @@
+/*
+ * Statistics functions
+ *
+ * Copyright (C) 2010-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSNTFS_STATISTICS_H )
+#define _LIBFSNTFS_STATISTICS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsntfs_libcerror.h"
+#include "libfsntfs_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* Adds a value to a statistics value
+ * The statistics values are updated without locking, with multi-threading support
+ * the value is added atomically so concurrent readers can update the same values.
+ * Adding a value cannot fail, which keeps it out of the error handling of the read functions
+ */
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT ) && defined( __GNUC__ )
+#define libfsntfs_statistics_add_value( statistics, value_index, value ) \
+	(void) __atomic_fetch_add( &( ( statistics )[ value_index ] ), (uint64_t) ( value ), __ATOMIC_RELAXED )
+
+#elif defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT ) && defined( WINAPI )
+#define libfsntfs_statistics_add_value( statistics, value_index, value ) \
+	(void) InterlockedExchangeAdd64( (LONG64 volatile *) &( ( statistics )[ value_index ] ), (LONG64) ( value ) )
+
+#else
+#define libfsntfs_statistics_add_value( statistics, value_index, value ) \
+	( statistics )[ value_index ] += (uint64_t) ( value )
+
+#endif
+
+int libfsntfs_statistics_start_timing(
+     uint64_t *start_timestamp,
+     libcerror_error_t **error );
+
+int libfsntfs_statistics_add_decompression_time(
+     uint64_t *statistics,
+     uint32_t compression_method,
+     uint64_t start_timestamp,
+     libcerror_error_t **error );
+
+int libfsntfs_statistics_get_values(
+     uint64_t *statistics,
+     uint64_t *values,
+     int number_of_values,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSNTFS_STATISTICS_H ) */
+
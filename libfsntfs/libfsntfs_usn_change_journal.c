@@ -26,15 +26,19 @@
 
 #include "libfsntfs_cluster_block_stream.h"
 #include "libfsntfs_definitions.h"
+#include "libfsntfs_extent_data_handle.h"
 #include "libfsntfs_file_entry.h"
 #include "libfsntfs_libcerror.h"
 #include "libfsntfs_libcthreads.h"
 #include "libfsntfs_mft_attribute.h"
 #include "libfsntfs_types.h"
 #include "libfsntfs_usn_change_journal.h"
+#include "libfsntfs_usn_record_chunk.h"
 
 /* Creates an USN change journal
  * Make sure the value usn_change_journal is referencing, is set to NULL
+ * On success the USN change journal takes over management of the directory entry and
+ * the reference to the MFT entry that contains the $J data attribute
  * Returns 1 if successful or -1 on error
  */
 int libfsntfs_usn_change_journal_initialize(
@@ -42,13 +46,14 @@ int libfsntfs_usn_change_journal_initialize(
      libfsntfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      libfsntfs_directory_entry_t *directory_entry,
+     libfsntfs_mft_entry_t *mft_entry,
      libfsntfs_mft_attribute_t *data_attribute,
      libcerror_error_t **error )
 {
 	libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal = NULL;
 	static char *function                                                = "libfsntfs_usn_change_journal_initialize";
-	off64_t segment_offset                                               = 0;
-	int segment_file_index                                               = 0;
+	uint16_t data_flags                                                  = 0;
+	int result                                                           = 0;
 
 	if( usn_change_journal == NULL )
 	{
@@ -83,6 +88,17 @@ int libfsntfs_usn_change_journal_initialize(
 
 		return( -1 );
 	}
+	if( mft_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MFT entry.",
+		 function );
+
+		return( -1 );
+	}
 	if( data_attribute == NULL )
 	{
 		libcerror_error_set(
@@ -156,58 +172,152 @@ int libfsntfs_usn_change_journal_initialize(
 
 		goto on_error;
 	}
-	if( libfdata_stream_get_number_of_segments(
-	     internal_usn_change_journal->data_stream,
-	     &( internal_usn_change_journal->number_of_extents ),
+	/* The extents are maintained separately from the $J data stream
+	 * to look up the sparse extents that can be skipped
+	 */
+	if( libfsntfs_extent_data_handle_initialize(
+	     &( internal_usn_change_journal->data_extents ),
 	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create $J data stream extents.",
+		 function );
+
+		goto on_error;
+	}
+	result = libfsntfs_mft_attribute_data_is_resident(
+	          data_attribute,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve $J data stream number of extents.",
+		 "%s: unable to determine if $J data attribute is resident.",
 		 function );
 
 		goto on_error;
 	}
-	if( libfdata_stream_get_segment_by_index(
-	     internal_usn_change_journal->data_stream,
-	     internal_usn_change_journal->extent_index,
-	     &segment_file_index,
-	     &segment_offset,
-	     &( internal_usn_change_journal->extent_size ),
-	     &( internal_usn_change_journal->extent_flags ),
+	if( libfsntfs_mft_attribute_get_data_flags(
+	     data_attribute,
+	     &data_flags,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve $J data stream extent: %d.",
-		 function,
-		 internal_usn_change_journal->extent_index );
+		 "%s: unable to retrieve $J data attribute data flags.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( result == 0 )
+	 && ( ( data_flags & LIBFSNTFS_ATTRIBUTE_FLAG_COMPRESSION_MASK ) == 0 ) )
+	{
+		result = libfsntfs_extent_data_handle_append_data_runs(
+		          internal_usn_change_journal->data_extents,
+		          io_handle,
+		          data_attribute,
+		          internal_usn_change_journal->data_size,
+		          error );
+	}
+	else
+	{
+		/* Resident and compressed data is represented as a single extent
+		 */
+		result = libfsntfs_extent_data_handle_append_extent(
+		          internal_usn_change_journal->data_extents,
+		          0,
+		          internal_usn_change_journal->data_size,
+		          0,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append $J data stream extents.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsntfs_extent_data_handle_get_number_of_extents(
+	     internal_usn_change_journal->data_extents,
+	     &( internal_usn_change_journal->number_of_extents ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve $J data stream number of extents.",
+		 function );
 
 		goto on_error;
 	}
 /* TODO what defines the journal block size? the index entry size? */
 	internal_usn_change_journal->journal_block_size = 0x1000;
+	internal_usn_change_journal->buffer_size        = LIBFSNTFS_USN_CHANGE_JOURNAL_READ_BUFFER_SIZE;
 
-	internal_usn_change_journal->journal_block_data = (uint8_t *) memory_allocate(
-	                                                               sizeof( uint8_t ) * internal_usn_change_journal->journal_block_size );
+	internal_usn_change_journal->buffer_data = (uint8_t *) memory_allocate(
+	                                                        sizeof( uint8_t ) * internal_usn_change_journal->buffer_size );
 
-	if( internal_usn_change_journal->journal_block_data == NULL )
+	if( internal_usn_change_journal->buffer_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_MEMORY,
 		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create journal block data.",
+		 "%s: unable to create read buffer data.",
 		 function );
 
 		goto on_error;
 	}
-	internal_usn_change_journal->file_io_handle  = file_io_handle;
+	internal_usn_change_journal->file_io_handle = file_io_handle;
+
+	/* Leading sparse extents are skipped in one step so that reading starts
+	 * at the first extent that contains USN records
+	 */
+	if( internal_usn_change_journal->number_of_extents > 0 )
+	{
+		if( libfsntfs_internal_usn_change_journal_get_extent_at_offset(
+		     internal_usn_change_journal,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve $J data stream extent at offset: 0.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsntfs_internal_usn_change_journal_skip_sparse_extents(
+		     internal_usn_change_journal,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to skip sparse $J data stream extents.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	internal_usn_change_journal->directory_entry = directory_entry;
+	internal_usn_change_journal->mft_entry       = mft_entry;
 
 	*usn_change_journal = (libfsntfs_usn_change_journal_t *) internal_usn_change_journal;
 
@@ -216,6 +326,17 @@ int libfsntfs_usn_change_journal_initialize(
 on_error:
 	if( internal_usn_change_journal != NULL )
 	{
+		if( internal_usn_change_journal->buffer_data != NULL )
+		{
+			memory_free(
+			 internal_usn_change_journal->buffer_data );
+		}
+		if( internal_usn_change_journal->data_extents != NULL )
+		{
+			libfsntfs_extent_data_handle_free(
+			 &( internal_usn_change_journal->data_extents ),
+			 NULL );
+		}
 		if( internal_usn_change_journal->data_stream != NULL )
 		{
 			libfdata_stream_free(
@@ -270,6 +391,21 @@ int libfsntfs_usn_change_journal_free(
 
 			result = -1;
 		}
+		/* The $J data stream references the data attribute of the MFT entry
+		 */
+		if( libfsntfs_mft_entry_free(
+		     &( internal_usn_change_journal->mft_entry ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release MFT entry.",
+			 function );
+
+			result = -1;
+		}
 		if( libfdata_stream_free(
 		     &( internal_usn_change_journal->data_stream ),
 		     error ) != 1 )
@@ -283,8 +419,21 @@ int libfsntfs_usn_change_journal_free(
 
 			result = -1;
 		}
+		if( libfsntfs_extent_data_handle_free(
+		     &( internal_usn_change_journal->data_extents ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free $J data stream extents.",
+			 function );
+
+			result = -1;
+		}
 		memory_free(
-		 internal_usn_change_journal->journal_block_data );
+		 internal_usn_change_journal->buffer_data );
 		memory_free(
 		 internal_usn_change_journal );
 	}
@@ -331,23 +480,17 @@ int libfsntfs_usn_change_journal_get_offset(
 	return( 1 );
 }
 
-/* Reads an USN record from the USN change journal
- * Returns the number of bytes read if successful or -1 on error
+/* Retrieves the size of the USN change journal
+ * The size of the $J data stream corresponds to the next update sequence number (USN)
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libfsntfs_usn_change_journal_read_usn_record(
-         libfsntfs_usn_change_journal_t *usn_change_journal,
-         uint8_t *usn_record_data,
-         size_t usn_record_data_size,
-         libcerror_error_t **error )
+int libfsntfs_usn_change_journal_get_size(
+     libfsntfs_usn_change_journal_t *usn_change_journal,
+     size64_t *size,
+     libcerror_error_t **error )
 {
 	libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal = NULL;
-	static char *function                                                = "libfsntfs_usn_change_journal_read_usn_record";
-	size_t read_size                                                     = 0;
-	ssize_t read_count                                                   = 0;
-	off64_t segment_offset                                               = 0;
-	uint32_t usn_record_size                                             = 0;
-	int read_journal_block                                               = 0;
-	int segment_file_index                                               = 0;
+	static char *function                                                = "libfsntfs_usn_change_journal_get_size";
 
 	if( usn_change_journal == NULL )
 	{
@@ -362,228 +505,2064 @@ ssize_t libfsntfs_usn_change_journal_read_usn_record(
 	}
 	internal_usn_change_journal = (libfsntfs_internal_usn_change_journal_t *) usn_change_journal;
 
-	if( internal_usn_change_journal->journal_block_size < 60 )
+	if( size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid USN change journal - journal block size value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
 		 function );
 
 		return( -1 );
 	}
-	if( usn_record_data == NULL )
+	*size = internal_usn_change_journal->data_size;
+
+	return( 1 );
+}
+
+/* Seeks the USN record with a specific update sequence number (USN)
+ * The USN of a record is the offset of the record in the $J data stream
+ * If the USN refers to data that is no longer available, e.g. that was purged
+ * from the journal, the first available USN record that follows is used.
+ * If the USN exceeds the size of the journal the end of the journal is used.
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_usn_change_journal_seek_usn(
+     libfsntfs_usn_change_journal_t *usn_change_journal,
+     uint64_t update_sequence_number,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal = NULL;
+	static char *function                                                = "libfsntfs_usn_change_journal_seek_usn";
+
+	if( usn_change_journal == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid USN record data.",
+		 "%s: invalid USN change journal.",
 		 function );
 
 		return( -1 );
 	}
-	if( usn_record_data_size > (size_t) SSIZE_MAX )
+	internal_usn_change_journal = (libfsntfs_internal_usn_change_journal_t *) usn_change_journal;
+
+	if( update_sequence_number >= (uint64_t) internal_usn_change_journal->data_size )
+	{
+		internal_usn_change_journal->data_offset = (off64_t) internal_usn_change_journal->data_size;
+
+		return( 1 );
+	}
+	if( libfsntfs_internal_usn_change_journal_get_extent_at_offset(
+	     internal_usn_change_journal,
+	     (off64_t) update_sequence_number,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid USN record data size value out of bounds.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve $J data stream extent at offset: 0x%08" PRIx64 ".",
+		 function,
+		 update_sequence_number );
 
 		return( -1 );
 	}
-	if( internal_usn_change_journal->extent_index >= internal_usn_change_journal->number_of_extents )
-	{
-		return( 0 );
-	}
-	while( usn_record_size == 0 )
-	{
-		while( ( ( internal_usn_change_journal->extent_flags & LIBFSNTFS_EXTENT_FLAG_IS_SPARSE ) != 0 )
-		    || ( ( internal_usn_change_journal->journal_block_offset >= ( internal_usn_change_journal->journal_block_size - 60 ) )
-		     &&  ( (size64_t) internal_usn_change_journal->extent_offset >= internal_usn_change_journal->extent_size ) ) )
-		{
-			internal_usn_change_journal->extent_index += 1;
-
-			if( internal_usn_change_journal->extent_index >= internal_usn_change_journal->number_of_extents )
-			{
-				return( 0 );
-			}
-/* TODO make sure internal values are reset on error */
-			if( libfdata_stream_get_segment_by_index(
-			     internal_usn_change_journal->data_stream,
-			     internal_usn_change_journal->extent_index,
-			     &segment_file_index,
-			     &segment_offset,
-			     &( internal_usn_change_journal->extent_size ),
-			     &( internal_usn_change_journal->extent_flags ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve $J data stream extent: %d.",
-				 function,
-				 internal_usn_change_journal->extent_index );
-
-				return( -1 );
-			}
-			if( ( internal_usn_change_journal->extent_flags & LIBFSNTFS_EXTENT_FLAG_IS_SPARSE ) != 0 )
-			{
-				internal_usn_change_journal->data_offset += internal_usn_change_journal->extent_size;
-			}
-			else
-			{
-				if( libfdata_stream_seek_offset(
-				     internal_usn_change_journal->data_stream,
-				     internal_usn_change_journal->extent_offset,
-				     SEEK_SET,
-				     error ) == -1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_SEEK_FAILED,
-					 "%s: unable to seek offset: 0x%08" PRIx64 " in $J data stream.",
-					 function,
-					 internal_usn_change_journal->extent_offset );
-
-					return( -1 );
-				}
-				read_journal_block = 1;
-			}
-		}
-		if( ( internal_usn_change_journal->journal_block_offset == 0 )
-		 || ( internal_usn_change_journal->journal_block_offset >= ( internal_usn_change_journal->journal_block_size - 60 ) ) )
-		{
-			read_journal_block = 1;
-		}
-		if( read_journal_block != 0 )
-		{
-			if( (size64_t) internal_usn_change_journal->extent_offset >= internal_usn_change_journal->extent_size )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid USN change journal - extent data offset value out of bounds.",
-				 function );
-
-				return( -1 );
-			}
-			if( memory_set(
-			     internal_usn_change_journal->journal_block_data,
-			     0,
-			     internal_usn_change_journal->journal_block_size ) == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-				 "%s: unable to clear journal block.",
-				 function );
-
-				return( -1 );
-			}
-			read_size = internal_usn_change_journal->journal_block_size;
-
-			if( read_size > ( internal_usn_change_journal->extent_size - internal_usn_change_journal->extent_offset ) )
-			{
-				read_size = (size_t) ( internal_usn_change_journal->extent_size - internal_usn_change_journal->extent_offset );
-			}
-			read_count = libfdata_stream_read_buffer(
-			              internal_usn_change_journal->data_stream,
-			              (intptr_t *) internal_usn_change_journal->file_io_handle,
-			              internal_usn_change_journal->journal_block_data,
-			              read_size,
-			              0,
-			              error );
-
-			if( read_count != (ssize_t) read_size )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read journal block from $J data stream.",
-				 function );
-
-				return( -1 );
-			}
-			internal_usn_change_journal->extent_offset       += read_count;
-			internal_usn_change_journal->journal_block_offset = 0;
-
-/* TODO do an empty block check
-			if( buffer[ 0 ] == 0 )
-			{
-				continue;
-			}
-*/
-		}
-		if( internal_usn_change_journal->journal_block_offset >= ( internal_usn_change_journal->journal_block_size - 60 ) )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid USN change journal - journal block offset value out of bounds.",
-			 function );
+	internal_usn_change_journal->data_offset = (off64_t) update_sequence_number;
 
-			return( -1 );
-		}
-		byte_stream_copy_to_uint32_little_endian(
-		 &( internal_usn_change_journal->journal_block_data[ internal_usn_change_journal->journal_block_offset ] ),
-		 usn_record_size );
-
-		if( usn_record_size == 0 )
-		{
-			internal_usn_change_journal->data_offset          = internal_usn_change_journal->journal_block_size - internal_usn_change_journal->journal_block_offset;
-			internal_usn_change_journal->journal_block_offset = internal_usn_change_journal->journal_block_size;
-		}
-	}
-	if( ( usn_record_size < 60 )
-	 || ( usn_record_size > ( internal_usn_change_journal->journal_block_size - internal_usn_change_journal->journal_block_offset ) ) )
+	if( libfsntfs_internal_usn_change_journal_skip_sparse_extents(
+	     internal_usn_change_journal,
+	     error ) == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid USN record size value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to skip sparse $J data stream extents.",
 		 function );
 
 		return( -1 );
 	}
-	if( usn_record_data_size < usn_record_size )
+	return( 1 );
+}
+
+/* Retrieves the $J data stream extent that contains a specific offset
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_internal_usn_change_journal_get_extent_at_offset(
+     libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal,
+     off64_t offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_internal_usn_change_journal_get_extent_at_offset";
+	int extent_index      = 0;
+	int result            = 0;
+
+	if( internal_usn_change_journal == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: USN record data size value too small.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN change journal.",
 		 function );
 
 		return( -1 );
 	}
-	if( memory_copy(
-	     usn_record_data,
-	     &( internal_usn_change_journal->journal_block_data[ internal_usn_change_journal->journal_block_offset ] ),
-	     (size_t) usn_record_size ) == NULL )
+	result = libfsntfs_extent_data_handle_get_extent_index_at_offset(
+	          internal_usn_change_journal->data_extents,
+	          offset,
+	          &extent_index,
+	          error );
+
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to copy USN record data.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve $J data stream extent index at offset: 0x%08" PRIx64 ".",
+		 function,
+		 offset );
 
 		return( -1 );
 	}
-	internal_usn_change_journal->data_offset          += usn_record_size;
-	internal_usn_change_journal->journal_block_offset += usn_record_size;
+	if( libfsntfs_extent_data_handle_get_extent_by_index(
+	     internal_usn_change_journal->data_extents,
+	     extent_index,
+	     &( internal_usn_change_journal->extent_offset ),
+	     &( internal_usn_change_journal->extent_size ),
+	     &( internal_usn_change_journal->extent_flags ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve $J data stream extent: %d.",
+		 function,
+		 extent_index );
 
-	return( (ssize_t) usn_record_size );
+		return( -1 );
+	}
+	internal_usn_change_journal->extent_index = extent_index;
+
+	return( 1 );
+}
+
+/* Moves the current offset past the end of the current extent and any sparse extents that follow
+ * Returns 1 if the current offset is in a non-sparse extent, 0 if the end of the $J data stream was reached or -1 on error
+ */
+int libfsntfs_internal_usn_change_journal_skip_sparse_extents(
+     libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_internal_usn_change_journal_skip_sparse_extents";
+	off64_t extent_offset = 0;
+	int extent_index      = 0;
+
+	if( internal_usn_change_journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN change journal.",
+		 function );
+
+		return( -1 );
+	}
+	while( (size64_t) internal_usn_change_journal->data_offset < internal_usn_change_journal->data_size )
+	{
+		extent_offset = internal_usn_change_journal->extent_offset + (off64_t) internal_usn_change_journal->extent_size;
+
+		if( ( internal_usn_change_journal->extent_flags & LIBFSNTFS_EXTENT_FLAG_IS_SPARSE ) != 0 )
+		{
+			/* Sparse extents contain no USN records
+			 */
+			internal_usn_change_journal->data_offset = extent_offset;
+		}
+		else if( internal_usn_change_journal->data_offset < extent_offset )
+		{
+			return( 1 );
+		}
+		extent_index = internal_usn_change_journal->extent_index + 1;
+
+		if( extent_index >= internal_usn_change_journal->number_of_extents )
+		{
+			break;
+		}
+		if( libfsntfs_extent_data_handle_get_extent_by_index(
+		     internal_usn_change_journal->data_extents,
+		     extent_index,
+		     &( internal_usn_change_journal->extent_offset ),
+		     &( internal_usn_change_journal->extent_size ),
+		     &( internal_usn_change_journal->extent_flags ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve $J data stream extent: %d.",
+			 function,
+			 extent_index );
+
+			return( -1 );
+		}
+		internal_usn_change_journal->extent_index = extent_index;
+
+		if( internal_usn_change_journal->data_offset < internal_usn_change_journal->extent_offset )
+		{
+			internal_usn_change_journal->data_offset = internal_usn_change_journal->extent_offset;
+		}
+	}
+	internal_usn_change_journal->data_offset = (off64_t) internal_usn_change_journal->data_size;
+
+	return( 0 );
+}
+
+/* Determines the range of the journal block that contains the current offset
+ * and as many of the journal blocks that follow it as fit in the read buffer, up to the next sparse extent
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_internal_usn_change_journal_get_read_range(
+     libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal,
+     off64_t *read_offset,
+     size_t *read_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_internal_usn_change_journal_get_read_range";
+	size64_t extent_size  = 0;
+	off64_t block_offset  = 0;
+	off64_t extent_offset = 0;
+	off64_t read_end      = 0;
+	uint32_t extent_flags = 0;
+	int extent_index      = 0;
+
+	if( internal_usn_change_journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN change journal.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_usn_change_journal->journal_block_size == 0 )
+	 || ( internal_usn_change_journal->journal_block_size > (size64_t) internal_usn_change_journal->buffer_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid USN change journal - journal block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read size.",
+		 function );
+
+		return( -1 );
+	}
+	block_offset = internal_usn_change_journal->data_offset
+	             - (off64_t) ( (size64_t) internal_usn_change_journal->data_offset % internal_usn_change_journal->journal_block_size );
+
+	read_end = block_offset + (off64_t) internal_usn_change_journal->buffer_size;
+
+	if( (size64_t) read_end > internal_usn_change_journal->data_size )
+	{
+		read_end = (off64_t) internal_usn_change_journal->data_size;
+	}
+	/* Extend the read over the non-sparse extents that follow the current extent
+	 * so that a fragmented $J data stream is still read in large chunks
+	 */
+	extent_index  = internal_usn_change_journal->extent_index;
+	extent_offset = internal_usn_change_journal->extent_offset + (off64_t) internal_usn_change_journal->extent_size;
+
+	while( extent_offset < read_end )
+	{
+		extent_index++;
+
+		if( extent_index >= internal_usn_change_journal->number_of_extents )
+		{
+			break;
+		}
+		if( libfsntfs_extent_data_handle_get_extent_by_index(
+		     internal_usn_change_journal->data_extents,
+		     extent_index,
+		     &extent_offset,
+		     &extent_size,
+		     &extent_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve $J data stream extent: %d.",
+			 function,
+			 extent_index );
+
+			return( -1 );
+		}
+		if( ( extent_flags & LIBFSNTFS_EXTENT_FLAG_IS_SPARSE ) != 0 )
+		{
+			/* Records never span journal blocks, hence the read only needs to extend
+			 * into a sparse extent up to the end of the last journal block
+			 */
+			if( ( (size64_t) extent_offset % internal_usn_change_journal->journal_block_size ) != 0 )
+			{
+				extent_offset += (off64_t) ( internal_usn_change_journal->journal_block_size - ( (size64_t) extent_offset % internal_usn_change_journal->journal_block_size ) );
+			}
+			if( extent_offset < ( block_offset + (off64_t) internal_usn_change_journal->journal_block_size ) )
+			{
+				extent_offset = block_offset + (off64_t) internal_usn_change_journal->journal_block_size;
+			}
+			if( extent_offset < read_end )
+			{
+				read_end = extent_offset;
+			}
+			break;
+		}
+		extent_offset += (off64_t) extent_size;
+	}
+	*read_offset = block_offset;
+	*read_size   = (size_t) ( read_end - block_offset );
+
+	return( 1 );
+}
+
+/* Fills the read buffer with the data of the journal block that contains the current offset
+ * and as many of the journal blocks that follow it as fit in the buffer, up to the next sparse extent
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_internal_usn_change_journal_read_buffer(
+     libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_internal_usn_change_journal_read_buffer";
+	size_t read_size      = 0;
+	off64_t read_offset   = 0;
+
+	if( libfsntfs_internal_usn_change_journal_get_read_range(
+	     internal_usn_change_journal,
+	     &read_offset,
+	     &read_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine read range.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsntfs_internal_usn_change_journal_read_buffer_at_offset(
+	     internal_usn_change_journal,
+	     read_offset,
+	     read_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read journal blocks at offset: 0x%08" PRIx64 ".",
+		 function,
+		 read_offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Fills the read buffer with $J data stream data at a specific offset
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_internal_usn_change_journal_read_buffer_at_offset(
+     libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal,
+     off64_t offset,
+     size_t read_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_internal_usn_change_journal_read_buffer_at_offset";
+	ssize_t read_count    = 0;
+
+	if( internal_usn_change_journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN change journal.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( read_size == 0 )
+	 || ( read_size > internal_usn_change_journal->buffer_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid read size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libfdata_stream_read_buffer_at_offset(
+	              internal_usn_change_journal->data_stream,
+	              (intptr_t *) internal_usn_change_journal->file_io_handle,
+	              internal_usn_change_journal->buffer_data,
+	              read_size,
+	              offset,
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data at offset: 0x%08" PRIx64 " from $J data stream.",
+		 function,
+		 offset );
+
+		internal_usn_change_journal->buffer_data_size = 0;
+
+		return( -1 );
+	}
+	internal_usn_change_journal->buffer_data_offset = offset;
+	internal_usn_change_journal->buffer_data_size   = read_size;
+
+	return( 1 );
 }
 
+/* Retrieves the data of the USN record at the current offset
+ * The USN record data references the read buffer and is valid until the next read
+ * The current offset is not advanced
+ * Returns 1 if successful, 0 if no more USN records are available or -1 on error
+ */
+int libfsntfs_internal_usn_change_journal_get_usn_record_data(
+     libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal,
+     const uint8_t **usn_record_data,
+     uint32_t *usn_record_size,
+     libcerror_error_t **error )
+{
+	static char *function         = "libfsntfs_internal_usn_change_journal_get_usn_record_data";
+	size64_t block_remaining      = 0;
+	size_t buffer_offset          = 0;
+	uint32_t safe_usn_record_size = 0;
+	int result                    = 0;
+
+	if( internal_usn_change_journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN change journal.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_usn_change_journal->journal_block_size < 60 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid USN change journal - journal block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( usn_record_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN record data.",
+		 function );
+
+		return( -1 );
+	}
+	if( usn_record_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN record size.",
+		 function );
+
+		return( -1 );
+	}
+	while( (size64_t) internal_usn_change_journal->data_offset < internal_usn_change_journal->data_size )
+	{
+		if( internal_usn_change_journal->data_offset < internal_usn_change_journal->extent_offset )
+		{
+			if( libfsntfs_internal_usn_change_journal_get_extent_at_offset(
+			     internal_usn_change_journal,
+			     internal_usn_change_journal->data_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve $J data stream extent at offset: 0x%08" PRIx64 ".",
+				 function,
+				 internal_usn_change_journal->data_offset );
+
+				return( -1 );
+			}
+		}
+		if( ( ( internal_usn_change_journal->extent_flags & LIBFSNTFS_EXTENT_FLAG_IS_SPARSE ) != 0 )
+		 || ( internal_usn_change_journal->data_offset >= ( internal_usn_change_journal->extent_offset + (off64_t) internal_usn_change_journal->extent_size ) ) )
+		{
+			result = libfsntfs_internal_usn_change_journal_skip_sparse_extents(
+			          internal_usn_change_journal,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to skip sparse $J data stream extents.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+		}
+		block_remaining = internal_usn_change_journal->journal_block_size
+		                - ( (size64_t) internal_usn_change_journal->data_offset % internal_usn_change_journal->journal_block_size );
+
+		/* The remainder of a journal block that is too small to contain an USN record is unused
+		 */
+		if( block_remaining < 60 )
+		{
+			internal_usn_change_journal->data_offset += (off64_t) block_remaining;
+
+			continue;
+		}
+		if( ( internal_usn_change_journal->data_offset < internal_usn_change_journal->buffer_data_offset )
+		 || ( ( internal_usn_change_journal->data_offset + 4 ) > ( internal_usn_change_journal->buffer_data_offset + (off64_t) internal_usn_change_journal->buffer_data_size ) ) )
+		{
+			if( libfsntfs_internal_usn_change_journal_read_buffer(
+			     internal_usn_change_journal,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read journal blocks.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		buffer_offset = (size_t) ( internal_usn_change_journal->data_offset - internal_usn_change_journal->buffer_data_offset );
+
+		if( ( buffer_offset + 4 ) > internal_usn_change_journal->buffer_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid USN change journal - read buffer offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( internal_usn_change_journal->buffer_data[ buffer_offset ] ),
+		 safe_usn_record_size );
+
+		/* The remainder of a journal block after the last USN record is filled with 0-byte values
+		 */
+		if( safe_usn_record_size == 0 )
+		{
+			internal_usn_change_journal->data_offset += (off64_t) block_remaining;
+
+			continue;
+		}
+		if( ( safe_usn_record_size < 60 )
+		 || ( (size64_t) safe_usn_record_size > block_remaining ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid USN record size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( buffer_offset + safe_usn_record_size ) > internal_usn_change_journal->buffer_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid USN record size value exceeds read buffer data size.",
+			 function );
+
+			return( -1 );
+		}
+		*usn_record_data = &( internal_usn_change_journal->buffer_data[ buffer_offset ] );
+		*usn_record_size = safe_usn_record_size;
+
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves the data of the USN record that precedes the current offset
+ * The USN record data references the read buffer and is valid until the next read
+ * The current offset is not changed
+ * Returns 1 if successful, 0 if no preceding USN records are available or -1 on error
+ */
+int libfsntfs_internal_usn_change_journal_get_previous_usn_record_data(
+     libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal,
+     const uint8_t **usn_record_data,
+     uint32_t *usn_record_size,
+     off64_t *usn_record_offset,
+     libcerror_error_t **error )
+{
+	static char *function         = "libfsntfs_internal_usn_change_journal_get_previous_usn_record_data";
+	size64_t block_data_size      = 0;
+	size_t buffer_offset          = 0;
+	size_t read_size              = 0;
+	off64_t block_offset          = 0;
+	off64_t end_offset            = 0;
+	off64_t previous_offset       = 0;
+	off64_t read_offset           = 0;
+	off64_t record_offset         = 0;
+	uint32_t safe_usn_record_size = 0;
+
+	if( internal_usn_change_journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN change journal.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_usn_change_journal->journal_block_size < 60 )
+	 || ( internal_usn_change_journal->journal_block_size > (size64_t) internal_usn_change_journal->buffer_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid USN change journal - journal block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( usn_record_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN record data.",
+		 function );
+
+		return( -1 );
+	}
+	if( usn_record_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN record size.",
+		 function );
+
+		return( -1 );
+	}
+	if( usn_record_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN record offset.",
+		 function );
+
+		return( -1 );
+	}
+	end_offset = internal_usn_change_journal->data_offset;
+
+	while( end_offset > 0 )
+	{
+		/* Determine the journal block that contains the last byte before the end offset
+		 */
+		block_offset = ( end_offset - 1 )
+		             - (off64_t) ( (size64_t) ( end_offset - 1 ) % internal_usn_change_journal->journal_block_size );
+
+		if( libfsntfs_internal_usn_change_journal_get_extent_at_offset(
+		     internal_usn_change_journal,
+		     end_offset - 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve $J data stream extent at offset: 0x%08" PRIx64 ".",
+			 function,
+			 end_offset - 1 );
+
+			return( -1 );
+		}
+		if( ( internal_usn_change_journal->extent_flags & LIBFSNTFS_EXTENT_FLAG_IS_SPARSE ) != 0 )
+		{
+			/* Sparse extents contain no USN records
+			 */
+			end_offset = internal_usn_change_journal->extent_offset;
+
+			continue;
+		}
+		block_data_size = (size64_t) ( end_offset - block_offset );
+
+		if( ( block_offset < internal_usn_change_journal->buffer_data_offset )
+		 || ( end_offset > ( internal_usn_change_journal->buffer_data_offset + (off64_t) internal_usn_change_journal->buffer_data_size ) ) )
+		{
+			/* Read the journal blocks that precede the end offset within the current extent
+			 */
+			read_offset = end_offset - (off64_t) internal_usn_change_journal->buffer_size;
+
+			if( read_offset < internal_usn_change_journal->extent_offset )
+			{
+				read_offset = internal_usn_change_journal->extent_offset;
+			}
+			if( read_offset > block_offset )
+			{
+				read_offset = block_offset;
+			}
+			read_offset -= (off64_t) ( (size64_t) read_offset % internal_usn_change_journal->journal_block_size );
+			read_size    = (size_t) ( end_offset - read_offset );
+
+			if( read_size > internal_usn_change_journal->buffer_size )
+			{
+				read_offset += (off64_t) internal_usn_change_journal->journal_block_size;
+				read_size   -= (size_t) internal_usn_change_journal->journal_block_size;
+			}
+			if( libfsntfs_internal_usn_change_journal_read_buffer_at_offset(
+			     internal_usn_change_journal,
+			     read_offset,
+			     read_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read journal blocks at offset: 0x%08" PRIx64 ".",
+				 function,
+				 read_offset );
+
+				return( -1 );
+			}
+		}
+		/* USN records can only be walked forward hence the last USN record
+		 * before the end offset is determined by walking the journal block
+		 */
+		previous_offset = -1;
+		record_offset   = block_offset;
+
+		while( ( end_offset - record_offset ) >= 60 )
+		{
+			if( ( internal_usn_change_journal->journal_block_size - ( (size64_t) ( record_offset - block_offset ) ) ) < 60 )
+			{
+				break;
+			}
+			buffer_offset = (size_t) ( record_offset - internal_usn_change_journal->buffer_data_offset );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 &( internal_usn_change_journal->buffer_data[ buffer_offset ] ),
+			 safe_usn_record_size );
+
+			if( safe_usn_record_size == 0 )
+			{
+				break;
+			}
+			if( ( safe_usn_record_size < 60 )
+			 || ( (size64_t) safe_usn_record_size > ( block_data_size - (size64_t) ( record_offset - block_offset ) ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid USN record size value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			previous_offset = record_offset;
+			record_offset  += safe_usn_record_size;
+		}
+		if( previous_offset >= 0 )
+		{
+			buffer_offset = (size_t) ( previous_offset - internal_usn_change_journal->buffer_data_offset );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 &( internal_usn_change_journal->buffer_data[ buffer_offset ] ),
+			 safe_usn_record_size );
+
+			*usn_record_data   = &( internal_usn_change_journal->buffer_data[ buffer_offset ] );
+			*usn_record_size   = safe_usn_record_size;
+			*usn_record_offset = previous_offset;
+
+			return( 1 );
+		}
+		end_offset = block_offset;
+	}
+	return( 0 );
+}
+
+/* Reads an USN record from the USN change journal
+ * Returns the number of bytes read if successful or -1 on error
+ */
+ssize_t libfsntfs_usn_change_journal_read_usn_record(
+         libfsntfs_usn_change_journal_t *usn_change_journal,
+         uint8_t *usn_record_data,
+         size_t usn_record_data_size,
+         libcerror_error_t **error )
+{
+	libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal = NULL;
+	const uint8_t *record_data                                           = NULL;
+	static char *function                                                = "libfsntfs_usn_change_journal_read_usn_record";
+	uint32_t usn_record_size                                             = 0;
+	int result                                                           = 0;
+
+	if( usn_change_journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN change journal.",
+		 function );
+
+		return( -1 );
+	}
+	internal_usn_change_journal = (libfsntfs_internal_usn_change_journal_t *) usn_change_journal;
+
+	if( usn_record_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN record data.",
+		 function );
+
+		return( -1 );
+	}
+	if( usn_record_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid USN record data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsntfs_internal_usn_change_journal_get_usn_record_data(
+	          internal_usn_change_journal,
+	          &record_data,
+	          &usn_record_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve USN record data.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( usn_record_data_size < usn_record_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: USN record data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     usn_record_data,
+	     record_data,
+	     (size_t) usn_record_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy USN record data.",
+		 function );
+
+		return( -1 );
+	}
+	internal_usn_change_journal->data_offset += usn_record_size;
+
+	return( (ssize_t) usn_record_size );
+}
+
+/* Reads the USN record that precedes the current offset from the USN change journal
+ * On success the current offset is set to the start of the USN record that was read,
+ * which allows to iterate the USN records from the newest to the oldest
+ * Returns the number of bytes read if successful, 0 if no preceding USN records are available or -1 on error
+ */
+ssize_t libfsntfs_usn_change_journal_read_previous_usn_record(
+         libfsntfs_usn_change_journal_t *usn_change_journal,
+         uint8_t *usn_record_data,
+         size_t usn_record_data_size,
+         libcerror_error_t **error )
+{
+	libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal = NULL;
+	const uint8_t *record_data                                           = NULL;
+	static char *function                                                = "libfsntfs_usn_change_journal_read_previous_usn_record";
+	off64_t usn_record_offset                                            = 0;
+	uint32_t usn_record_size                                             = 0;
+	int result                                                           = 0;
+
+	if( usn_change_journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN change journal.",
+		 function );
+
+		return( -1 );
+	}
+	internal_usn_change_journal = (libfsntfs_internal_usn_change_journal_t *) usn_change_journal;
+
+	if( usn_record_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN record data.",
+		 function );
+
+		return( -1 );
+	}
+	if( usn_record_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid USN record data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsntfs_internal_usn_change_journal_get_previous_usn_record_data(
+	          internal_usn_change_journal,
+	          &record_data,
+	          &usn_record_size,
+	          &usn_record_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve previous USN record data.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( usn_record_data_size < usn_record_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: USN record data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     usn_record_data,
+	     record_data,
+	     (size_t) usn_record_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy USN record data.",
+		 function );
+
+		return( -1 );
+	}
+	internal_usn_change_journal->data_offset = usn_record_offset;
+
+	return( (ssize_t) usn_record_size );
+}
+
+/* Reads as many consecutive USN records from the USN change journal as fit in the buffer
+ * The USN records are stored back-to-back, each USN record starts with its 32-bit record size
+ * Returns the number of bytes read if successful or -1 on error
+ */
+ssize_t libfsntfs_usn_change_journal_read_usn_records(
+         libfsntfs_usn_change_journal_t *usn_change_journal,
+         uint8_t *usn_records_data,
+         size_t usn_records_data_size,
+         libcerror_error_t **error )
+{
+	libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal = NULL;
+	const uint8_t *record_data                                           = NULL;
+	static char *function                                                = "libfsntfs_usn_change_journal_read_usn_records";
+	size_t usn_records_data_offset                                       = 0;
+	uint32_t usn_record_size                                             = 0;
+	int result                                                           = 0;
+
+	if( usn_change_journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN change journal.",
+		 function );
+
+		return( -1 );
+	}
+	internal_usn_change_journal = (libfsntfs_internal_usn_change_journal_t *) usn_change_journal;
+
+	if( usn_records_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN records data.",
+		 function );
+
+		return( -1 );
+	}
+	if( usn_records_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid USN records data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	while( usn_records_data_offset < usn_records_data_size )
+	{
+		result = libfsntfs_internal_usn_change_journal_get_usn_record_data(
+		          internal_usn_change_journal,
+		          &record_data,
+		          &usn_record_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve USN record data.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( (size_t) usn_record_size > ( usn_records_data_size - usn_records_data_offset ) )
+		{
+			if( usn_records_data_offset == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: USN records data size value too small.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+		}
+		if( memory_copy(
+		     &( usn_records_data[ usn_records_data_offset ] ),
+		     record_data,
+		     (size_t) usn_record_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy USN record data.",
+			 function );
+
+			return( -1 );
+		}
+		internal_usn_change_journal->data_offset += usn_record_size;
+		usn_records_data_offset                  += usn_record_size;
+	}
+	return( (ssize_t) usn_records_data_offset );
+}
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+
+/* Scans an USN record chunk for USN records
+ * Callback function for the thread pool of a parallel parse
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_internal_usn_change_journal_scan_usn_record_chunk(
+     libfsntfs_usn_record_chunk_t *usn_record_chunk,
+     libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal )
+{
+	libcerror_error_t *error = NULL;
+	uint8_t status           = LIBFSNTFS_USN_RECORD_CHUNK_STATUS_SCANNED;
+	int result               = 1;
+
+	if( usn_record_chunk == NULL )
+	{
+		return( -1 );
+	}
+	if( internal_usn_change_journal == NULL )
+	{
+		return( -1 );
+	}
+	if( libfsntfs_usn_record_chunk_scan(
+	     usn_record_chunk,
+	     internal_usn_change_journal->journal_block_size,
+	     &error ) != 1 )
+	{
+		libcerror_error_free(
+		 &error );
+
+		status = LIBFSNTFS_USN_RECORD_CHUNK_STATUS_FAILED;
+		result = -1;
+	}
+	if( libcthreads_mutex_grab(
+	     internal_usn_change_journal->scan_mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_free(
+		 &error );
+
+		return( -1 );
+	}
+	usn_record_chunk->status = status;
+
+	if( libcthreads_condition_broadcast(
+	     internal_usn_change_journal->scan_condition,
+	     &error ) != 1 )
+	{
+		libcerror_error_free(
+		 &error );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     internal_usn_change_journal->scan_mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_free(
+		 &error );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT ) */
+
+/* Parses the USN records from the current offset onwards
+ * The $J data stream is read in chunks of journal blocks that are scanned for USN records
+ * by a pool of worker threads. Records never span journal blocks hence every chunk is scanned
+ * on its own and data that does not contain a valid USN record is skipped until the next
+ * USN record header.
+ * The callback function is called for every USN record in order of update sequence number,
+ * it should return 1 to continue, 0 to stop or -1 on error
+ * The current offset is set to the end of the last USN record passed to the callback function
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_usn_change_journal_parse_usn_records(
+     libfsntfs_usn_change_journal_t *usn_change_journal,
+     int number_of_threads,
+     int (*callback_function)(
+            const uint8_t *usn_record_data,
+            size_t usn_record_data_size,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal = NULL;
+	libfsntfs_usn_record_chunk_t **usn_record_chunks                     = NULL;
+	libfsntfs_usn_record_chunk_t *usn_record_chunk                       = NULL;
+	const uint8_t *usn_record_data                                       = NULL;
+	static char *function                                                = "libfsntfs_usn_change_journal_parse_usn_records";
+	size_t read_size                                                     = 0;
+	ssize_t read_count                                                   = 0;
+	off64_t read_offset                                                  = 0;
+	off64_t start_offset                                                 = 0;
+	off64_t usn_record_offset                                            = 0;
+	uint32_t usn_record_size                                             = 0;
+	int chunk_index                                                      = 0;
+	int end_of_data                                                      = 0;
+	int first_chunk_index                                                = 0;
+	int maximum_number_of_chunks                                         = 0;
+	int number_of_pending_chunks                                         = 0;
+	int record_index                                                     = 0;
+	int result                                                           = 0;
+	int stop_parsing                                                     = 0;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *thread_pool                               = NULL;
+#endif
+
+	if( usn_change_journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN change journal.",
+		 function );
+
+		return( -1 );
+	}
+	internal_usn_change_journal = (libfsntfs_internal_usn_change_journal_t *) usn_change_journal;
+
+	if( ( internal_usn_change_journal->journal_block_size < 60 )
+	 || ( internal_usn_change_journal->journal_block_size > (size64_t) internal_usn_change_journal->buffer_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid USN change journal - journal block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > LIBFSNTFS_USN_CHANGE_JOURNAL_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	/* Without multi-threading support the chunks are scanned on the calling thread
+	 */
+	number_of_threads = 1;
+#endif
+	/* Keep twice as many chunks in flight as there are threads so that the threads
+	 * do not have to wait for the chunks to be read or the USN records to be passed
+	 */
+	maximum_number_of_chunks = number_of_threads * 2;
+
+	usn_record_chunks = (libfsntfs_usn_record_chunk_t **) memory_allocate(
+	                                                       sizeof( libfsntfs_usn_record_chunk_t * ) * maximum_number_of_chunks );
+
+	if( usn_record_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create USN record chunks.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     usn_record_chunks,
+	     0,
+	     sizeof( libfsntfs_usn_record_chunk_t * ) * maximum_number_of_chunks ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear USN record chunks.",
+		 function );
+
+		memory_free(
+		 usn_record_chunks );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		if( libcthreads_mutex_initialize(
+		     &( internal_usn_change_journal->scan_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create scan mutex.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_condition_initialize(
+		     &( internal_usn_change_journal->scan_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create scan condition.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_thread_pool_create(
+		     &thread_pool,
+		     NULL,
+		     number_of_threads,
+		     maximum_number_of_chunks,
+		     (int (*)(intptr_t *, void *)) &libfsntfs_internal_usn_change_journal_scan_usn_record_chunk,
+		     (void *) internal_usn_change_journal,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif /* defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT ) */
+
+	start_offset = internal_usn_change_journal->data_offset;
+
+	while( stop_parsing == 0 )
+	{
+		/* Read the chunks sequentially and hand them to the thread pool to be scanned
+		 */
+		while( ( end_of_data == 0 )
+		    && ( number_of_pending_chunks < maximum_number_of_chunks ) )
+		{
+			if( (size64_t) internal_usn_change_journal->data_offset >= internal_usn_change_journal->data_size )
+			{
+				end_of_data = 1;
+
+				break;
+			}
+			if( internal_usn_change_journal->data_offset < internal_usn_change_journal->extent_offset )
+			{
+				if( libfsntfs_internal_usn_change_journal_get_extent_at_offset(
+				     internal_usn_change_journal,
+				     internal_usn_change_journal->data_offset,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve $J data stream extent at offset: 0x%08" PRIx64 ".",
+					 function,
+					 internal_usn_change_journal->data_offset );
+
+					goto on_error;
+				}
+			}
+			if( ( ( internal_usn_change_journal->extent_flags & LIBFSNTFS_EXTENT_FLAG_IS_SPARSE ) != 0 )
+			 || ( internal_usn_change_journal->data_offset >= ( internal_usn_change_journal->extent_offset + (off64_t) internal_usn_change_journal->extent_size ) ) )
+			{
+				result = libfsntfs_internal_usn_change_journal_skip_sparse_extents(
+				          internal_usn_change_journal,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to skip sparse $J data stream extents.",
+					 function );
+
+					goto on_error;
+				}
+				else if( result == 0 )
+				{
+					end_of_data = 1;
+
+					break;
+				}
+			}
+			if( libfsntfs_internal_usn_change_journal_get_read_range(
+			     internal_usn_change_journal,
+			     &read_offset,
+			     &read_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine read range.",
+				 function );
+
+				goto on_error;
+			}
+			chunk_index = ( first_chunk_index + number_of_pending_chunks ) % maximum_number_of_chunks;
+
+			if( usn_record_chunks[ chunk_index ] == NULL )
+			{
+				if( libfsntfs_usn_record_chunk_initialize(
+				     &( usn_record_chunks[ chunk_index ] ),
+				     internal_usn_change_journal->buffer_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create USN record chunk: %d.",
+					 function,
+					 chunk_index );
+
+					goto on_error;
+				}
+			}
+			usn_record_chunk = usn_record_chunks[ chunk_index ];
+
+			if( read_size > usn_record_chunk->allocated_data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid read size value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			read_count = libfdata_stream_read_buffer_at_offset(
+			              internal_usn_change_journal->data_stream,
+			              (intptr_t *) internal_usn_change_journal->file_io_handle,
+			              usn_record_chunk->data,
+			              read_size,
+			              read_offset,
+			              0,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data at offset: 0x%08" PRIx64 " from $J data stream.",
+				 function,
+				 read_offset );
+
+				goto on_error;
+			}
+			usn_record_chunk->data_offset       = read_offset;
+			usn_record_chunk->data_size         = read_size;
+			usn_record_chunk->number_of_records = 0;
+			usn_record_chunk->status            = LIBFSNTFS_USN_RECORD_CHUNK_STATUS_PENDING;
+
+			internal_usn_change_journal->data_offset = read_offset + (off64_t) read_size;
+
+			number_of_pending_chunks++;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+			if( thread_pool != NULL )
+			{
+				if( libcthreads_thread_pool_push(
+				     thread_pool,
+				     (intptr_t *) usn_record_chunk,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to push USN record chunk: %d onto thread pool.",
+					 function,
+					 chunk_index );
+
+					/* The chunk was not handed to the thread pool
+					 */
+					number_of_pending_chunks--;
+
+					goto on_error;
+				}
+				continue;
+			}
+#endif
+			if( libfsntfs_usn_record_chunk_scan(
+			     usn_record_chunk,
+			     internal_usn_change_journal->journal_block_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to scan USN record chunk: %d.",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+			usn_record_chunk->status = LIBFSNTFS_USN_RECORD_CHUNK_STATUS_SCANNED;
+		}
+		if( number_of_pending_chunks == 0 )
+		{
+			break;
+		}
+		/* Pass the USN records of the first chunk in order of update sequence number
+		 */
+		usn_record_chunk = usn_record_chunks[ first_chunk_index ];
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+		if( thread_pool != NULL )
+		{
+			if( libcthreads_mutex_grab(
+			     internal_usn_change_journal->scan_mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab scan mutex.",
+				 function );
+
+				goto on_error;
+			}
+			while( usn_record_chunk->status == LIBFSNTFS_USN_RECORD_CHUNK_STATUS_PENDING )
+			{
+				if( libcthreads_condition_wait(
+				     internal_usn_change_journal->scan_condition,
+				     internal_usn_change_journal->scan_mutex,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to wait for scan condition.",
+					 function );
+
+					libcthreads_mutex_release(
+					 internal_usn_change_journal->scan_mutex,
+					 NULL );
+
+					goto on_error;
+				}
+			}
+			if( libcthreads_mutex_release(
+			     internal_usn_change_journal->scan_mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release scan mutex.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#endif /* defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT ) */
+
+		if( usn_record_chunk->status != LIBFSNTFS_USN_RECORD_CHUNK_STATUS_SCANNED )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan USN record chunk at offset: 0x%08" PRIx64 ".",
+			 function,
+			 usn_record_chunk->data_offset );
+
+			goto on_error;
+		}
+		for( record_index = 0;
+		     record_index < usn_record_chunk->number_of_records;
+		     record_index++ )
+		{
+			usn_record_offset = usn_record_chunk->data_offset + (off64_t) usn_record_chunk->record_offsets[ record_index ];
+
+			/* The first chunk starts at the journal block that contains the current offset
+			 */
+			if( usn_record_offset < start_offset )
+			{
+				continue;
+			}
+			if( libfsntfs_usn_record_chunk_get_usn_record_data(
+			     usn_record_chunk,
+			     record_index,
+			     &usn_record_data,
+			     &usn_record_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve USN record: %d data.",
+				 function,
+				 record_index );
+
+				goto on_error;
+			}
+			result = callback_function(
+			          usn_record_data,
+			          (size_t) usn_record_size,
+			          callback_data );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: callback function failed for USN record at offset: 0x%08" PRIx64 ".",
+				 function,
+				 usn_record_offset );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				internal_usn_change_journal->data_offset = usn_record_offset + (off64_t) usn_record_size;
+
+				stop_parsing = 1;
+
+				break;
+			}
+		}
+		first_chunk_index = ( first_chunk_index + 1 ) % maximum_number_of_chunks;
+
+		number_of_pending_chunks--;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( internal_usn_change_journal->scan_condition != NULL )
+	{
+		if( libcthreads_condition_free(
+		     &( internal_usn_change_journal->scan_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free scan condition.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( internal_usn_change_journal->scan_mutex != NULL )
+	{
+		if( libcthreads_mutex_free(
+		     &( internal_usn_change_journal->scan_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free scan mutex.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif /* defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT ) */
+
+	for( chunk_index = 0;
+	     chunk_index < maximum_number_of_chunks;
+	     chunk_index++ )
+	{
+		if( libfsntfs_usn_record_chunk_free(
+		     &( usn_record_chunks[ chunk_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free USN record chunk: %d.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 usn_record_chunks );
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	/* The thread pool is joined before the chunks are freed since the threads could still be scanning them
+	 */
+	if( thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	if( internal_usn_change_journal->scan_condition != NULL )
+	{
+		libcthreads_condition_free(
+		 &( internal_usn_change_journal->scan_condition ),
+		 NULL );
+	}
+	if( internal_usn_change_journal->scan_mutex != NULL )
+	{
+		libcthreads_mutex_free(
+		 &( internal_usn_change_journal->scan_mutex ),
+		 NULL );
+	}
+#endif /* defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT ) */
+
+	if( usn_record_chunks != NULL )
+	{
+		for( chunk_index = 0;
+		     chunk_index < maximum_number_of_chunks;
+		     chunk_index++ )
+		{
+			if( usn_record_chunks[ chunk_index ] != NULL )
+			{
+				libfsntfs_usn_record_chunk_free(
+				 &( usn_record_chunks[ chunk_index ] ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 usn_record_chunks );
+	}
+	return( -1 );
+}
+
+/* Retrieves the MFT entries that were changed since a specific update sequence number (USN)
+ * The callback function is called once for every MFT entry index, less than the number of MFT entries,
+ * that is referenced by an USN record at or after the update sequence number,
+ * it should return 1 to continue, 0 to stop or -1 on error
+ * The next update sequence number is the USN from which to continue on a next call
+ * Returns 1 if successful, 0 if the USN change journal no longer contains the update sequence number or -1 on error
+ */
+int libfsntfs_internal_usn_change_journal_get_changed_mft_entries(
+     libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal,
+     uint64_t update_sequence_number,
+     uint64_t number_of_mft_entries,
+     int (*callback_function)(
+            uint64_t mft_entry_index,
+            void *callback_data ),
+     void *callback_data,
+     uint64_t *next_update_sequence_number,
+     libcerror_error_t **error )
+{
+	const uint8_t *usn_record_data  = NULL;
+	uint8_t *changed_mft_entries    = NULL;
+	static char *function           = "libfsntfs_internal_usn_change_journal_get_changed_mft_entries";
+	size_t changed_mft_entries_size = 0;
+	uint64_t file_reference         = 0;
+	uint64_t mft_entry_index        = 0;
+	uint32_t usn_record_size        = 0;
+	uint8_t mft_entry_bit           = 0;
+	int result                      = 0;
+
+	if( internal_usn_change_journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN change journal.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_mft_entries == 0 )
+	 || ( ( number_of_mft_entries / 8 ) >= (uint64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of MFT entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+	if( next_update_sequence_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid next update sequence number.",
+		 function );
+
+		return( -1 );
+	}
+	/* An update sequence number beyond the end of the $J data stream is from another instance of the journal
+	 */
+	if( update_sequence_number > (uint64_t) internal_usn_change_journal->data_size )
+	{
+		return( 0 );
+	}
+	if( libfsntfs_usn_change_journal_seek_usn(
+	     (libfsntfs_usn_change_journal_t *) internal_usn_change_journal,
+	     update_sequence_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek update sequence number: %" PRIu64 ".",
+		 function,
+		 update_sequence_number );
+
+		return( -1 );
+	}
+	/* The USN records at the update sequence number were purged when it lies in a sparse extent
+	 */
+	if( (uint64_t) internal_usn_change_journal->data_offset != update_sequence_number )
+	{
+		return( 0 );
+	}
+	changed_mft_entries_size = (size_t) ( number_of_mft_entries / 8 ) + 1;
+
+	changed_mft_entries = (uint8_t *) memory_allocate(
+	                                   sizeof( uint8_t ) * changed_mft_entries_size );
+
+	if( changed_mft_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create changed MFT entries bitmap.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     changed_mft_entries,
+	     0,
+	     sizeof( uint8_t ) * changed_mft_entries_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear changed MFT entries bitmap.",
+		 function );
+
+		goto on_error;
+	}
+	do
+	{
+		result = libfsntfs_internal_usn_change_journal_get_usn_record_data(
+		          internal_usn_change_journal,
+		          &usn_record_data,
+		          &usn_record_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve USN record data.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		internal_usn_change_journal->data_offset += usn_record_size;
+
+		/* The file reference is stored at offset 8 of every USN record version,
+		 * for version 3 and 4 the lower 64-bit of the 128-bit file identifier contain the NTFS file reference
+		 */
+		byte_stream_copy_to_uint64_little_endian(
+		 &( usn_record_data[ 8 ] ),
+		 file_reference );
+
+		mft_entry_index = file_reference & 0xffffffffffffUL;
+
+		if( mft_entry_index >= number_of_mft_entries )
+		{
+			continue;
+		}
+		mft_entry_bit = (uint8_t) ( 1 << ( mft_entry_index % 8 ) );
+
+		if( ( changed_mft_entries[ mft_entry_index / 8 ] & mft_entry_bit ) != 0 )
+		{
+			continue;
+		}
+		changed_mft_entries[ mft_entry_index / 8 ] |= mft_entry_bit;
+
+		result = callback_function(
+		          mft_entry_index,
+		          callback_data );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: callback function failed for MFT entry: %" PRIu64 ".",
+			 function,
+			 mft_entry_index );
+
+			goto on_error;
+		}
+	}
+	while( result != 0 );
+
+	memory_free(
+	 changed_mft_entries );
+
+	*next_update_sequence_number = (uint64_t) internal_usn_change_journal->data_offset;
+
+	return( 1 );
+
+on_error:
+	if( changed_mft_entries != NULL )
+	{
+		memory_free(
+		 changed_mft_entries );
+	}
+	return( -1 );
+}
@@ -25,13 +25,16 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfsntfs_extent_data_handle.h"
 #include "libfsntfs_extern.h"
 #include "libfsntfs_libbfio.h"
 #include "libfsntfs_libcerror.h"
 #include "libfsntfs_libcthreads.h"
 #include "libfsntfs_libfdata.h"
 #include "libfsntfs_mft_attribute.h"
+#include "libfsntfs_mft_entry.h"
 #include "libfsntfs_types.h"
+#include "libfsntfs_usn_record_chunk.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -49,6 +52,10 @@ struct libfsntfs_internal_usn_change_journal
 	 */
 	libfsntfs_directory_entry_t *directory_entry;
 
+	/* The MFT entry
+	 */
+	libfsntfs_mft_entry_t *mft_entry;
+
 	/* The $J data stream
 	 */
 	libfdata_stream_t *data_stream;
@@ -61,6 +68,10 @@ struct libfsntfs_internal_usn_change_journal
 	 */
 	size64_t data_size;
 
+	/* The $J data stream extents
+	 */
+	libfsntfs_extent_data_handle_t *data_extents;
+
 	/* The number of extents
 	 */
 	int number_of_extents;
@@ -81,17 +92,35 @@ struct libfsntfs_internal_usn_change_journal
 	 */
 	uint32_t extent_flags;
 
-	/* The journal block data
+	/* The journal block size
 	 */
-	uint8_t *journal_block_data;
+	size64_t journal_block_size;
 
-	/* The journal block (data) offset
+	/* The read buffer data
 	 */
-	size_t journal_block_offset;
+	uint8_t *buffer_data;
 
-	/* The journal block size
+	/* The read buffer size
 	 */
-	size64_t journal_block_size;
+	size_t buffer_size;
+
+	/* The offset of the read buffer data in the $J data stream
+	 */
+	off64_t buffer_data_offset;
+
+	/* The number of bytes in the read buffer data
+	 */
+	size_t buffer_data_size;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	/* The mutex that protects the status of the USN record chunks during a parallel parse
+	 */
+	libcthreads_mutex_t *scan_mutex;
+
+	/* The condition that signals a scanned USN record chunk during a parallel parse
+	 */
+	libcthreads_condition_t *scan_condition;
+#endif
 };
 
 int libfsntfs_usn_change_journal_initialize(
@@ -99,6 +128,7 @@ int libfsntfs_usn_change_journal_initialize(
      libfsntfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      libfsntfs_directory_entry_t *directory_entry,
+     libfsntfs_mft_entry_t *mft_entry,
      libfsntfs_mft_attribute_t *data_attribute,
      libcerror_error_t **error );
 
@@ -113,6 +143,56 @@ int libfsntfs_usn_change_journal_get_offset(
      off64_t *offset,
      libcerror_error_t **error );
 
+LIBFSNTFS_EXTERN \
+int libfsntfs_usn_change_journal_get_size(
+     libfsntfs_usn_change_journal_t *usn_change_journal,
+     size64_t *size,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_usn_change_journal_seek_usn(
+     libfsntfs_usn_change_journal_t *usn_change_journal,
+     uint64_t update_sequence_number,
+     libcerror_error_t **error );
+
+int libfsntfs_internal_usn_change_journal_get_extent_at_offset(
+     libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal,
+     off64_t offset,
+     libcerror_error_t **error );
+
+int libfsntfs_internal_usn_change_journal_skip_sparse_extents(
+     libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal,
+     libcerror_error_t **error );
+
+int libfsntfs_internal_usn_change_journal_get_read_range(
+     libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal,
+     off64_t *read_offset,
+     size_t *read_size,
+     libcerror_error_t **error );
+
+int libfsntfs_internal_usn_change_journal_read_buffer(
+     libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal,
+     libcerror_error_t **error );
+
+int libfsntfs_internal_usn_change_journal_read_buffer_at_offset(
+     libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal,
+     off64_t offset,
+     size_t read_size,
+     libcerror_error_t **error );
+
+int libfsntfs_internal_usn_change_journal_get_usn_record_data(
+     libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal,
+     const uint8_t **usn_record_data,
+     uint32_t *usn_record_size,
+     libcerror_error_t **error );
+
+int libfsntfs_internal_usn_change_journal_get_previous_usn_record_data(
+     libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal,
+     const uint8_t **usn_record_data,
+     uint32_t *usn_record_size,
+     off64_t *usn_record_offset,
+     libcerror_error_t **error );
+
 LIBFSNTFS_EXTERN \
 ssize_t libfsntfs_usn_change_journal_read_usn_record(
          libfsntfs_usn_change_journal_t *usn_change_journal,
@@ -120,6 +200,50 @@ ssize_t libfsntfs_usn_change_journal_read_usn_record(
          size_t usn_record_data_size,
          libcerror_error_t **error );
 
+LIBFSNTFS_EXTERN \
+ssize_t libfsntfs_usn_change_journal_read_previous_usn_record(
+         libfsntfs_usn_change_journal_t *usn_change_journal,
+         uint8_t *usn_record_data,
+         size_t usn_record_data_size,
+         libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+ssize_t libfsntfs_usn_change_journal_read_usn_records(
+         libfsntfs_usn_change_journal_t *usn_change_journal,
+         uint8_t *usn_records_data,
+         size_t usn_records_data_size,
+         libcerror_error_t **error );
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+
+int libfsntfs_internal_usn_change_journal_scan_usn_record_chunk(
+     libfsntfs_usn_record_chunk_t *usn_record_chunk,
+     libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal );
+
+#endif /* defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT ) */
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_usn_change_journal_parse_usn_records(
+     libfsntfs_usn_change_journal_t *usn_change_journal,
+     int number_of_threads,
+     int (*callback_function)(
+            const uint8_t *usn_record_data,
+            size_t usn_record_data_size,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libfsntfs_internal_usn_change_journal_get_changed_mft_entries(
+     libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal,
+     uint64_t update_sequence_number,
+     uint64_t number_of_mft_entries,
+     int (*callback_function)(
+            uint64_t mft_entry_index,
+            void *callback_data ),
+     void *callback_data,
+     uint64_t *next_update_sequence_number,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
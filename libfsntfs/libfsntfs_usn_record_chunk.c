@@ -0,0 +1,546 @@
+/*
+ * USN record chunk functions
+ *
+ * Copyright (C) 2010-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsntfs_definitions.h"
+#include "libfsntfs_libcerror.h"
+#include "libfsntfs_usn_record_chunk.h"
+
+/* Creates an USN record chunk
+ * Make sure the value usn_record_chunk is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_usn_record_chunk_initialize(
+     libfsntfs_usn_record_chunk_t **usn_record_chunk,
+     size_t allocated_data_size,
+     libcerror_error_t **error )
+{
+	static char *function         = "libfsntfs_usn_record_chunk_initialize";
+	int maximum_number_of_records = 0;
+
+	if( usn_record_chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN record chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( *usn_record_chunk != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid USN record chunk value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( allocated_data_size == 0 )
+	 || ( allocated_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	 || ( (uint64_t) allocated_data_size > (uint64_t) UINT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid allocated data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* An USN record is at least 60 bytes in size and 8-byte aligned
+	 */
+	maximum_number_of_records = (int) ( allocated_data_size / 64 ) + 1;
+
+	*usn_record_chunk = memory_allocate_structure(
+	                     libfsntfs_usn_record_chunk_t );
+
+	if( *usn_record_chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create USN record chunk.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *usn_record_chunk,
+	     0,
+	     sizeof( libfsntfs_usn_record_chunk_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear USN record chunk.",
+		 function );
+
+		memory_free(
+		 *usn_record_chunk );
+
+		*usn_record_chunk = NULL;
+
+		return( -1 );
+	}
+	( *usn_record_chunk )->data = (uint8_t *) memory_allocate(
+	                                           sizeof( uint8_t ) * allocated_data_size );
+
+	if( ( *usn_record_chunk )->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	( *usn_record_chunk )->record_offsets = (uint32_t *) memory_allocate(
+	                                                      sizeof( uint32_t ) * maximum_number_of_records );
+
+	if( ( *usn_record_chunk )->record_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record offsets.",
+		 function );
+
+		goto on_error;
+	}
+	( *usn_record_chunk )->allocated_data_size       = allocated_data_size;
+	( *usn_record_chunk )->maximum_number_of_records = maximum_number_of_records;
+
+	return( 1 );
+
+on_error:
+	if( *usn_record_chunk != NULL )
+	{
+		if( ( *usn_record_chunk )->data != NULL )
+		{
+			memory_free(
+			 ( *usn_record_chunk )->data );
+		}
+		memory_free(
+		 *usn_record_chunk );
+
+		*usn_record_chunk = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an USN record chunk
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_usn_record_chunk_free(
+     libfsntfs_usn_record_chunk_t **usn_record_chunk,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_usn_record_chunk_free";
+
+	if( usn_record_chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN record chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( *usn_record_chunk != NULL )
+	{
+		memory_free(
+		 ( *usn_record_chunk )->record_offsets );
+
+		memory_free(
+		 ( *usn_record_chunk )->data );
+
+		memory_free(
+		 *usn_record_chunk );
+
+		*usn_record_chunk = NULL;
+	}
+	return( 1 );
+}
+
+/* Checks if the data contains an USN record that is stored at a specific offset
+ * The data size is the remainder of the journal block and bounds the USN record size
+ * Returns 1 if the data contains an USN record, 0 if not or -1 on error
+ */
+int libfsntfs_usn_record_chunk_check_usn_record(
+     const uint8_t *data,
+     size_t data_size,
+     off64_t usn_record_offset,
+     uint32_t *usn_record_size,
+     libcerror_error_t **error )
+{
+	static char *function           = "libfsntfs_usn_record_chunk_check_usn_record";
+	uint64_t update_sequence_number = 0;
+	uint32_t record_size            = 0;
+	uint16_t major_version          = 0;
+	size_t minimum_record_size      = 0;
+	size_t usn_data_offset          = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( usn_record_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid USN record offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( usn_record_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN record size.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < 60 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 data,
+	 record_size );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ 4 ] ),
+	 major_version );
+
+	switch( major_version )
+	{
+		case 2:
+			minimum_record_size = 60;
+			usn_data_offset     = 24;
+			break;
+
+		case 3:
+			minimum_record_size = 76;
+			usn_data_offset     = 40;
+			break;
+
+		case 4:
+			minimum_record_size = 64;
+			usn_data_offset     = 40;
+			break;
+
+		default:
+			return( 0 );
+	}
+	if( ( (size_t) record_size < minimum_record_size )
+	 || ( (size_t) record_size > data_size )
+	 || ( ( record_size % 8 ) != 0 ) )
+	{
+		return( 0 );
+	}
+	/* The update sequence number of an USN record is its offset in the $J data stream
+	 */
+	byte_stream_copy_to_uint64_little_endian(
+	 &( data[ usn_data_offset ] ),
+	 update_sequence_number );
+
+	if( update_sequence_number != (uint64_t) usn_record_offset )
+	{
+		return( 0 );
+	}
+	*usn_record_size = record_size;
+
+	return( 1 );
+}
+
+/* Scans the journal blocks in the chunk data for USN records
+ * Records never span journal blocks, hence every journal block can be scanned on its own.
+ * Data that does not contain a valid USN record is skipped until the next 8-byte aligned
+ * USN record header within the same journal block
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_usn_record_chunk_scan(
+     libfsntfs_usn_record_chunk_t *usn_record_chunk,
+     size64_t journal_block_size,
+     libcerror_error_t **error )
+{
+	static char *function    = "libfsntfs_usn_record_chunk_scan";
+	size_t block_end_offset  = 0;
+	size_t block_offset      = 0;
+	size_t data_offset       = 0;
+	uint32_t usn_record_size = 0;
+	int result               = 0;
+
+	if( usn_record_chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN record chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( usn_record_chunk->data_size > usn_record_chunk->allocated_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid USN record chunk - data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( journal_block_size < 60 )
+	 || ( journal_block_size > (size64_t) usn_record_chunk->allocated_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid journal block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( usn_record_chunk->data_offset < 0 )
+	 || ( ( (size64_t) usn_record_chunk->data_offset % journal_block_size ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid USN record chunk - data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	usn_record_chunk->number_of_records = 0;
+
+	for( block_offset = 0;
+	     block_offset < usn_record_chunk->data_size;
+	     block_offset += (size_t) journal_block_size )
+	{
+		block_end_offset = block_offset + (size_t) journal_block_size;
+
+		if( block_end_offset > usn_record_chunk->data_size )
+		{
+			block_end_offset = usn_record_chunk->data_size;
+		}
+		data_offset = block_offset;
+
+		while( ( data_offset + 60 ) <= block_end_offset )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( usn_record_chunk->data[ data_offset ] ),
+			 usn_record_size );
+
+			/* The remainder of a journal block after the last USN record is filled with 0-byte values
+			 */
+			if( usn_record_size == 0 )
+			{
+				break;
+			}
+			result = libfsntfs_usn_record_chunk_check_usn_record(
+			          &( usn_record_chunk->data[ data_offset ] ),
+			          block_end_offset - data_offset,
+			          usn_record_chunk->data_offset + (off64_t) data_offset,
+			          &usn_record_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to check USN record at offset: 0x%08" PRIx64 ".",
+				 function,
+				 usn_record_chunk->data_offset + (off64_t) data_offset );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				/* Resynchronize on the next 8-byte aligned USN record header
+				 */
+				data_offset += 8;
+
+				continue;
+			}
+			if( usn_record_chunk->number_of_records >= usn_record_chunk->maximum_number_of_records )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid number of records value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			usn_record_chunk->record_offsets[ usn_record_chunk->number_of_records ] = (uint32_t) data_offset;
+
+			usn_record_chunk->number_of_records += 1;
+
+			data_offset += usn_record_size;
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the data of a specific USN record found by the scan
+ * The USN record data references the chunk data
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_usn_record_chunk_get_usn_record_data(
+     libfsntfs_usn_record_chunk_t *usn_record_chunk,
+     int record_index,
+     const uint8_t **usn_record_data,
+     uint32_t *usn_record_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_usn_record_chunk_get_usn_record_data";
+	uint32_t record_size  = 0;
+	size_t record_offset  = 0;
+
+	if( usn_record_chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN record chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_index < 0 )
+	 || ( record_index >= usn_record_chunk->number_of_records ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( usn_record_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN record data.",
+		 function );
+
+		return( -1 );
+	}
+	if( usn_record_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN record size.",
+		 function );
+
+		return( -1 );
+	}
+	record_offset = (size_t) usn_record_chunk->record_offsets[ record_index ];
+
+	if( ( record_offset + 4 ) > usn_record_chunk->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( usn_record_chunk->data[ record_offset ] ),
+	 record_size );
+
+	if( (size_t) record_size > ( usn_record_chunk->data_size - record_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*usn_record_data = &( usn_record_chunk->data[ record_offset ] );
+	*usn_record_size = record_size;
+
+	return( 1 );
+}
+
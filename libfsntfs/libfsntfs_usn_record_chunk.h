@@ -0,0 +1,106 @@
+/*
+ * USN record chunk functions
+ *
+ * Copyright (C) 2010-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSNTFS_USN_RECORD_CHUNK_H )
+#define _LIBFSNTFS_USN_RECORD_CHUNK_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsntfs_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsntfs_usn_record_chunk libfsntfs_usn_record_chunk_t;
+
+/* A chunk of journal blocks of the USN change journal ($J) data stream
+ */
+struct libfsntfs_usn_record_chunk
+{
+	/* The offset of the chunk in the $J data stream
+	 */
+	off64_t data_offset;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The allocated data size
+	 */
+	size_t allocated_data_size;
+
+	/* The offsets of the USN records relative to the start of the data
+	 */
+	uint32_t *record_offsets;
+
+	/* The number of USN records
+	 */
+	int number_of_records;
+
+	/* The maximum number of USN records
+	 */
+	int maximum_number_of_records;
+
+	/* The status
+	 */
+	uint8_t status;
+};
+
+int libfsntfs_usn_record_chunk_initialize(
+     libfsntfs_usn_record_chunk_t **usn_record_chunk,
+     size_t allocated_data_size,
+     libcerror_error_t **error );
+
+int libfsntfs_usn_record_chunk_free(
+     libfsntfs_usn_record_chunk_t **usn_record_chunk,
+     libcerror_error_t **error );
+
+int libfsntfs_usn_record_chunk_check_usn_record(
+     const uint8_t *data,
+     size_t data_size,
+     off64_t usn_record_offset,
+     uint32_t *usn_record_size,
+     libcerror_error_t **error );
+
+int libfsntfs_usn_record_chunk_scan(
+     libfsntfs_usn_record_chunk_t *usn_record_chunk,
+     size64_t journal_block_size,
+     libcerror_error_t **error );
+
+int libfsntfs_usn_record_chunk_get_usn_record_data(
+     libfsntfs_usn_record_chunk_t *usn_record_chunk,
+     int record_index,
+     const uint8_t **usn_record_data,
+     uint32_t *usn_record_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSNTFS_USN_RECORD_CHUNK_H ) */
+
@@ -26,6 +26,7 @@
 #include <wide_string.h>
 
 #include "libfsntfs_attribute.h"
+#include "libfsntfs_bulk_read.h"
 #include "libfsntfs_debug.h"
 #include "libfsntfs_definitions.h"
 #include "libfsntfs_directory_entries_tree.h"
@@ -40,6 +41,12 @@
 #include "libfsntfs_libfdata.h"
 #include "libfsntfs_libuna.h"
 #include "libfsntfs_mft_entry.h"
+#include "libfsntfs_name_index.h"
+#include "libfsntfs_object_identifier_index.h"
+#include "libfsntfs_quota_index.h"
+#include "libfsntfs_read_thread_pool.h"
+#include "libfsntfs_reparse_point_index.h"
+#include "libfsntfs_statistics.h"
 #include "libfsntfs_usn_change_journal.h"
 #include "libfsntfs_volume.h"
 #include "libfsntfs_volume_header.h"
@@ -784,6 +791,214 @@ on_error:
 	return( -1 );
 }
 
+/* Clones (duplicates) an opened volume
+ * The destination volume reads the same data using a clone of the file IO handle
+ * of the source volume but has its own caches and locks, so that the source and
+ * destination volume can be read concurrently from different threads
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_volume_clone(
+     libfsntfs_volume_t **destination_volume,
+     libfsntfs_volume_t *source_volume,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle                    = NULL;
+	libfsntfs_internal_volume_t *internal_source_volume = NULL;
+	libfsntfs_internal_volume_t *internal_volume        = NULL;
+	libfsntfs_volume_t *volume                          = NULL;
+	static char *function                               = "libfsntfs_volume_clone";
+	int file_io_handle_is_open                          = 0;
+	int number_of_read_threads                          = 1;
+	int result                                          = 1;
+
+	if( destination_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_volume != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination volume value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_source_volume = (libfsntfs_internal_volume_t *) source_volume;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_source_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_source_volume->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid source volume - missing file IO handle.",
+		 function );
+
+		result = -1;
+	}
+	else if( libbfio_handle_clone(
+	          &file_io_handle,
+	          internal_source_volume->file_io_handle,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to clone file IO handle.",
+		 function );
+
+		result = -1;
+	}
+	if( internal_source_volume->io_handle != NULL )
+	{
+		number_of_read_threads = internal_source_volume->io_handle->number_of_read_threads;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_source_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     LIBBFIO_ACCESS_FLAG_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfsntfs_volume_initialize(
+	     &volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create volume.",
+		 function );
+
+		goto on_error;
+	}
+	internal_volume = (libfsntfs_internal_volume_t *) volume;
+
+	internal_volume->io_handle->number_of_read_threads = number_of_read_threads;
+
+	if( libfsntfs_internal_volume_open_read(
+	     internal_volume,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	internal_volume->file_io_handle                    = file_io_handle;
+	internal_volume->file_io_handle_created_in_library = 1;
+	internal_volume->file_io_handle_opened_in_library  = 1;
+
+	*destination_volume = volume;
+
+	return( 1 );
+
+on_error:
+	if( volume != NULL )
+	{
+		libfsntfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
 /* Closes a volume
  * Returns 0 if successful or -1 on error
  */
@@ -820,6 +1035,25 @@ int libfsntfs_volume_close(
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	/* Wait for the pending asynchronous reads before any of the handles they use is closed
+	 * This is done without holding the volume lock since the read callbacks can access the volume
+	 */
+	if( internal_volume->file_system != NULL )
+	{
+		if( libfsntfs_file_system_join_async_reads(
+		     internal_volume->file_system,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join asynchronous reads.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
@@ -833,6 +1067,24 @@ int libfsntfs_volume_close(
 
 		return( -1 );
 	}
+	/* The threads of the read thread pool are joined before the file IO handle is closed
+	 */
+	if( internal_volume->io_handle->read_thread_pool != NULL )
+	{
+		if( libfsntfs_read_thread_pool_free(
+		     &( internal_volume->io_handle->read_thread_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read thread pool.",
+			 function );
+
+			result = -1;
+		}
+	}
 #endif
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -984,6 +1236,70 @@ int libfsntfs_volume_close(
 			result = -1;
 		}
 	}
+	if( internal_volume->name_index != NULL )
+	{
+		if( libfsntfs_name_index_free(
+		     &( internal_volume->name_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free name index.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_volume->object_identifier_index != NULL )
+	{
+		if( libfsntfs_object_identifier_index_free(
+		     &( internal_volume->object_identifier_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free object identifier index.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_volume->reparse_point_index != NULL )
+	{
+		if( libfsntfs_reparse_point_index_free(
+		     &( internal_volume->reparse_point_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free reparse point index.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_volume->quota_index != NULL )
+	{
+		if( libfsntfs_quota_index_free(
+		     &( internal_volume->quota_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free quota index.",
+			 function );
+
+			result = -1;
+		}
+	}
 #if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_volume->read_write_lock,
@@ -1057,28 +1373,71 @@ int libfsntfs_internal_volume_open_read(
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "Reading volume header:\n" );
-	}
-#endif
-	if( libfsntfs_volume_header_initialize(
-	     &( internal_volume->volume_header ),
-	     error ) != 1 )
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( internal_volume->io_handle->read_thread_pool != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create volume header.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid internal volume - invalid IO handle - read thread pool value already set.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfsntfs_volume_header_read_file_io_handle(
-	     internal_volume->volume_header,
+	if( internal_volume->io_handle->number_of_read_threads > 1 )
+	{
+		/* If the file IO handle cannot be cloned, such as when it reads from
+		 * a file-like object, reads are done on the calling thread instead
+		 */
+		if( libfsntfs_read_thread_pool_initialize(
+		     &( internal_volume->io_handle->read_thread_pool ),
+		     file_io_handle,
+		     internal_volume->io_handle->number_of_read_threads,
+		     error ) != 1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: unable to create read thread pool, reading on the calling thread.\n",
+				 function );
+
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+	}
+#endif
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading volume header:\n" );
+	}
+#endif
+	if( libfsntfs_volume_header_initialize(
+	     &( internal_volume->volume_header ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create volume header.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsntfs_volume_header_read_file_io_handle(
+	     internal_volume->volume_header,
 	     file_io_handle,
 	     0,
 	     error ) != 1 )
@@ -1271,6 +1630,14 @@ on_error:
 		 &( internal_volume->volume_header ),
 		 NULL );
 	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( internal_volume->io_handle->read_thread_pool != NULL )
+	{
+		libfsntfs_read_thread_pool_free(
+		 &( internal_volume->io_handle->read_thread_pool ),
+		 NULL );
+	}
+#endif
 	return( -1 );
 }
 
@@ -1904,20 +2271,16 @@ int libfsntfs_volume_get_index_entry_size(
 	return( result );
 }
 
-/* Retrieves the size of the UTF-8 encoded name
- * The returned size includes the end of string character
- * This value is retrieved from the $VOLUME_NAME attribute of the $Volume metadata file
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Retrieves the number of threads used to keep reads in flight
+ * Returns 1 if successful or -1 on error
  */
-int libfsntfs_volume_get_utf8_name_size(
+int libfsntfs_volume_get_number_of_read_threads(
      libfsntfs_volume_t *volume,
-     size_t *utf8_string_size,
+     int *number_of_read_threads,
      libcerror_error_t **error )
 {
-	libfsntfs_attribute_t *volume_name_attribute = NULL;
 	libfsntfs_internal_volume_t *internal_volume = NULL;
-	static char *function                        = "libfsntfs_volume_get_utf8_name_size";
-	int result                                   = 0;
+	static char *function                        = "libfsntfs_volume_get_number_of_read_threads";
 
 	if( volume == NULL )
 	{
@@ -1932,56 +2295,47 @@ int libfsntfs_volume_get_utf8_name_size(
 	}
 	internal_volume = (libfsntfs_internal_volume_t *) volume;
 
-#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+	if( internal_volume->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	result = libfsntfs_internal_volume_get_volume_name_attribute(
-	          internal_volume,
-	          &volume_name_attribute,
-	          error );
-
-	if( result == -1 )
+	if( number_of_read_threads == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve volume name attribute.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of read threads.",
 		 function );
 
-		result = -1;
+		return( -1 );
 	}
-	else if( result != 0 )
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
 	{
-		if( libfsntfs_volume_name_attribute_get_utf8_name_size(
-		     volume_name_attribute,
-		     utf8_string_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve size of UTF-8 name from volume name attribute.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
 
-			result = -1;
-		}
+		return( -1 );
 	}
+#endif
+	*number_of_read_threads = internal_volume->io_handle->number_of_read_threads;
+
 #if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1989,30 +2343,30 @@ int libfsntfs_volume_get_utf8_name_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	return( result );
+	return( 1 );
 }
 
-/* Retrieves the UTF-8 encoded name
- * The size should include the end of string character
- * This value is retrieved from the $VOLUME_NAME attribute of the $Volume metadata file
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Sets the number of threads used to keep reads in flight
+ * Batches of reads, such as the prefetching of index nodes and bulk reads, are read by
+ * a pool of this many threads each with their own clone of the file IO handle. The pool
+ * is created when the volume is opened, hence the value must be set before the volume
+ * is opened. The default is 1, which reads on the calling thread. If the file IO handle
+ * cannot be cloned or without multi-threading support reads are done on the calling thread
+ * Returns 1 if successful or -1 on error
  */
-int libfsntfs_volume_get_utf8_name(
+int libfsntfs_volume_set_number_of_read_threads(
      libfsntfs_volume_t *volume,
-     uint8_t *utf8_string,
-     size_t utf8_string_size,
+     int number_of_read_threads,
      libcerror_error_t **error )
 {
-	libfsntfs_attribute_t *volume_name_attribute = NULL;
 	libfsntfs_internal_volume_t *internal_volume = NULL;
-	static char *function                        = "libfsntfs_volume_get_utf8_name";
-	int result                                   = 0;
+	static char *function                        = "libfsntfs_volume_set_number_of_read_threads";
 
 	if( volume == NULL )
 	{
@@ -2027,55 +2381,57 @@ int libfsntfs_volume_get_utf8_name(
 	}
 	internal_volume = (libfsntfs_internal_volume_t *) volume;
 
-#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+	if( internal_volume->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	result = libfsntfs_internal_volume_get_volume_name_attribute(
-	          internal_volume,
-	          &volume_name_attribute,
-	          error );
-
-	if( result == -1 )
+	if( internal_volume->file_io_handle != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve volume name attribute.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - file IO handle already set.",
 		 function );
 
-		result = -1;
+		return( -1 );
 	}
-	else if( result != 0 )
+	if( ( number_of_read_threads <= 0 )
+	 || ( number_of_read_threads > LIBFSNTFS_READ_QUEUE_MAXIMUM_NUMBER_OF_THREADS ) )
 	{
-		if( libfsntfs_volume_name_attribute_get_utf8_name(
-		     volume_name_attribute,
-		     utf8_string,
-		     utf8_string_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve UTF-8 name from volume name attribute.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of read threads value out of bounds.",
+		 function );
 
-			result = -1;
-		}
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
 	}
+#endif
+	internal_volume->io_handle->number_of_read_threads = number_of_read_threads;
+
 #if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_volume->read_write_lock,
@@ -2091,23 +2447,23 @@ int libfsntfs_volume_get_utf8_name(
 		return( -1 );
 	}
 #endif
-	return( result );
+	return( 1 );
 }
 
-/* Retrieves the size of the UTF-16 encoded name
- * The returned size includes the end of string character
- * This value is retrieved from the $VOLUME_NAME attribute of the $Volume metadata file
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Retrieves the statistics values
+ * The statistics are maintained for the lifetime of the volume while it is open
+ * and are cleared when the volume is closed. Clones of the volume maintain their own statistics
+ * Returns 1 if successful or -1 on error
  */
-int libfsntfs_volume_get_utf16_name_size(
+int libfsntfs_volume_get_statistics(
      libfsntfs_volume_t *volume,
-     size_t *utf16_string_size,
+     uint64_t *values,
+     int number_of_values,
      libcerror_error_t **error )
 {
-	libfsntfs_attribute_t *volume_name_attribute = NULL;
 	libfsntfs_internal_volume_t *internal_volume = NULL;
-	static char *function                        = "libfsntfs_volume_get_utf16_name_size";
-	int result                                   = 0;
+	static char *function                        = "libfsntfs_volume_get_statistics";
+	int result                                   = 1;
 
 	if( volume == NULL )
 	{
@@ -2122,8 +2478,19 @@ int libfsntfs_volume_get_utf16_name_size(
 	}
 	internal_volume = (libfsntfs_internal_volume_t *) volume;
 
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2131,47 +2498,29 @@ int libfsntfs_volume_get_utf16_name_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	result = libfsntfs_internal_volume_get_volume_name_attribute(
-	          internal_volume,
-	          &volume_name_attribute,
-	          error );
-
-	if( result == -1 )
+	if( libfsntfs_statistics_get_values(
+	     internal_volume->io_handle->statistics,
+	     values,
+	     number_of_values,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve volume name attribute.",
+		 "%s: unable to retrieve statistics values.",
 		 function );
 
 		result = -1;
 	}
-	else if( result != 0 )
-	{
-		if( libfsntfs_volume_name_attribute_get_utf16_name_size(
-		     volume_name_attribute,
-		     utf16_string_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve size of UTF-16 name from volume name attribute.",
-			 function );
-
-			result = -1;
-		}
-	}
 #if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2179,7 +2528,7 @@ int libfsntfs_volume_get_utf16_name_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -2188,23 +2537,39 @@ int libfsntfs_volume_get_utf16_name_size(
 	return( result );
 }
 
-/* Retrieves the UTF-16 encoded name
- * The size should include the end of string character
- * This value is retrieved from the $VOLUME_NAME attribute of the $Volume metadata file
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Reads the data of the default data stream (nameless $DATA attribute) of file entries
+ * The data is read in the order it is stored on the volume
+ * Returns 1 if successful or -1 on error
  */
-int libfsntfs_volume_get_utf16_name(
-     libfsntfs_volume_t *volume,
-     uint16_t *utf16_string,
-     size_t utf16_string_size,
+int libfsntfs_internal_volume_read_file_entries_data(
+     libfsntfs_internal_volume_t *internal_volume,
+     const uint64_t *mft_entry_indexes,
+     int number_of_mft_entry_indexes,
+     int (*callback_function)(
+            uint64_t mft_entry_index,
+            off64_t data_offset,
+            const uint8_t *data,
+            size_t data_size,
+            void *callback_data ),
+     int (*end_of_file_callback_function)(
+            uint64_t mft_entry_index,
+            size64_t data_size,
+            void *callback_data ),
+     void *callback_data,
      libcerror_error_t **error )
 {
-	libfsntfs_attribute_t *volume_name_attribute = NULL;
-	libfsntfs_internal_volume_t *internal_volume = NULL;
-	static char *function                        = "libfsntfs_volume_get_utf16_name";
-	int result                                   = 0;
+	libfsntfs_bulk_read_t *bulk_read    = NULL;
+	libfsntfs_file_entry_t *file_entry  = NULL;
+	libfsntfs_mft_entry_t *mft_entry    = NULL;
+	uint64_t *deferred_indexes          = NULL;
+	static char *function               = "libfsntfs_internal_volume_read_file_entries_data";
+	uint64_t base_record_file_reference = 0;
+	int deferred_index                  = 0;
+	int entry_index                     = 0;
+	int number_of_deferred_indexes      = 0;
+	int result                          = 0;
 
-	if( volume == NULL )
+	if( internal_volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -2215,179 +2580,302 @@ int libfsntfs_volume_get_utf16_name(
 
 		return( -1 );
 	}
-	internal_volume = (libfsntfs_internal_volume_t *) volume;
-
-#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+	if( internal_volume->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	result = libfsntfs_internal_volume_get_volume_name_attribute(
-	          internal_volume,
-	          &volume_name_attribute,
-	          error );
-
-	if( result == -1 )
+	if( mft_entry_indexes == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve volume name attribute.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MFT entry indexes.",
 		 function );
 
-		result = -1;
-	}
-	else if( result != 0 )
-	{
-		if( libfsntfs_volume_name_attribute_get_utf16_name(
-		     volume_name_attribute,
-		     utf16_string,
-		     utf16_string_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve UTF-16 name from volume name attribute.",
-			 function );
-
-			result = -1;
-		}
+		return( -1 );
 	}
-#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+	if( ( number_of_mft_entry_indexes <= 0 )
+	 || ( (size_t) number_of_mft_entry_indexes > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint64_t ) ) ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of MFT entry indexes value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	return( result );
-}
-
-/* Retrieves the version
- * Returns 1 if successful, 0 if not available or -1 on error
- */
-int libfsntfs_volume_get_version(
-     libfsntfs_volume_t *volume,
-     uint8_t *major_version,
-     uint8_t *minor_version,
-     libcerror_error_t **error )
-{
-	libfsntfs_attribute_t *volume_information_attribute = NULL;
-	libfsntfs_internal_volume_t *internal_volume        = NULL;
-	static char *function                               = "libfsntfs_volume_get_version";
-	int result                                          = 0;
+	deferred_indexes = (uint64_t *) memory_allocate(
+	                                 sizeof( uint64_t ) * number_of_mft_entry_indexes );
 
-	if( volume == NULL )
+	if( deferred_indexes == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid volume.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create deferred indexes.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	internal_volume = (libfsntfs_internal_volume_t *) volume;
-
-#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_volume->read_write_lock,
+	if( libfsntfs_bulk_read_initialize(
+	     &bulk_read,
+	     internal_volume->io_handle,
+	     callback_function,
+	     end_of_file_callback_function,
+	     callback_data,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create bulk read.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	result = libfsntfs_internal_volume_get_volume_information_attribute(
-	          internal_volume,
-	          &volume_information_attribute,
-	          error );
+	/* Resident data is passed to the callback function while the ranges
+	 * of the non-resident data are collected
+	 */
+	for( entry_index = 0;
+	     entry_index < number_of_mft_entry_indexes;
+	     entry_index++ )
+	{
+		if( libfsntfs_file_system_get_shared_mft_entry_by_index(
+		     internal_volume->file_system,
+		     internal_volume->file_io_handle,
+		     mft_entry_indexes[ entry_index ],
+		     &mft_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve MFT entry: %" PRIu64 ".",
+			 function,
+			 mft_entry_indexes[ entry_index ] );
 
-	if( result == -1 )
+			goto on_error;
+		}
+		result = libfsntfs_mft_entry_get_base_record_file_reference(
+		          mft_entry,
+		          &base_record_file_reference,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve base record file reference of MFT entry: %" PRIu64 ".",
+			 function,
+			 mft_entry_indexes[ entry_index ] );
+
+			goto on_error;
+		}
+		/* Only a base record has a default data stream
+		 */
+		if( ( result != 0 )
+		 && ( base_record_file_reference == 0 ) )
+		{
+			result = libfsntfs_bulk_read_append_mft_entry(
+			          bulk_read,
+			          mft_entry_indexes[ entry_index ],
+			          mft_entry,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append MFT entry: %" PRIu64 ".",
+				 function,
+				 mft_entry_indexes[ entry_index ] );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				deferred_indexes[ number_of_deferred_indexes++ ] = mft_entry_indexes[ entry_index ];
+			}
+		}
+		if( libfsntfs_mft_entry_free(
+		     &mft_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free MFT entry: %" PRIu64 ".",
+			 function,
+			 mft_entry_indexes[ entry_index ] );
+
+			goto on_error;
+		}
+	}
+	if( libfsntfs_bulk_read_read(
+	     bulk_read,
+	     internal_volume->file_io_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve volume information attribute.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data.",
 		 function );
 
-		result = -1;
+		goto on_error;
 	}
-	else if( result != 0 )
+	/* Compressed data streams are read by a file entry
+	 */
+	for( deferred_index = 0;
+	     deferred_index < number_of_deferred_indexes;
+	     deferred_index++ )
 	{
-		if( libfsntfs_volume_information_attribute_get_version(
-		     volume_information_attribute,
-		     major_version,
-		     minor_version,
+		if( libfsntfs_file_entry_initialize(
+		     &file_entry,
+		     internal_volume->io_handle,
+		     internal_volume->file_io_handle,
+		     internal_volume->file_system,
+		     deferred_indexes[ deferred_index ],
+		     NULL,
+		     0,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve version from volume information attribute.",
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file entry with MFT entry: %" PRIu64 ".",
+			 function,
+			 deferred_indexes[ deferred_index ] );
+
+			goto on_error;
+		}
+		if( libfsntfs_bulk_read_read_file_entry(
+		     bulk_read,
+		     deferred_indexes[ deferred_index ],
+		     file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data of MFT entry: %" PRIu64 ".",
+			 function,
+			 deferred_indexes[ deferred_index ] );
+
+			goto on_error;
+		}
+		if( libfsntfs_file_entry_free(
+		     &file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file entry.",
 			 function );
 
-			result = -1;
+			goto on_error;
 		}
 	}
-#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_volume->read_write_lock,
+	if( libfsntfs_bulk_read_free(
+	     &bulk_read,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free bulk read.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	return( result );
+	memory_free(
+	 deferred_indexes );
+
+	return( 1 );
+
+on_error:
+	if( file_entry != NULL )
+	{
+		libfsntfs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	if( mft_entry != NULL )
+	{
+		libfsntfs_mft_entry_free(
+		 &mft_entry,
+		 NULL );
+	}
+	if( bulk_read != NULL )
+	{
+		libfsntfs_bulk_read_free(
+		 &bulk_read,
+		 NULL );
+	}
+	if( deferred_indexes != NULL )
+	{
+		memory_free(
+		 deferred_indexes );
+	}
+	return( -1 );
 }
 
-/* Retrieves the serial number
+/* Reads the data of the default data stream (nameless $DATA attribute) of file entries
+ * The data is read in the order it is stored on the volume and is passed to
+ * the callback function in chunks together with the MFT entry index and the offset
+ * of the chunk in the data stream. Resident data is passed first, then
+ * the non-resident data in volume order, hence the chunks of a fragmented data stream
+ * can be passed out of order. Sparse and uninitialized ranges are passed as 0-byte
+ * values. Compressed data streams are passed last, in order. The data passed to
+ * the callback function is only valid during the call. The optional end of file
+ * callback function is called once for every base record MFT entry after all
+ * the data of its default data stream was passed, with the size of the data stream
+ * or 0 if it has none. The callback functions should return 1 to continue
  * Returns 1 if successful or -1 on error
  */
-int libfsntfs_volume_get_serial_number(
+int libfsntfs_volume_read_file_entries_data(
      libfsntfs_volume_t *volume,
-     uint64_t *serial_number,
+     const uint64_t *mft_entry_indexes,
+     int number_of_mft_entry_indexes,
+     int (*callback_function)(
+            uint64_t mft_entry_index,
+            off64_t data_offset,
+            const uint8_t *data,
+            size_t data_size,
+            void *callback_data ),
+     int (*end_of_file_callback_function)(
+            uint64_t mft_entry_index,
+            size64_t data_size,
+            void *callback_data ),
+     void *callback_data,
      libcerror_error_t **error )
 {
 	libfsntfs_internal_volume_t *internal_volume = NULL;
-	static char *function                        = "libfsntfs_volume_get_serial_number";
+	static char *function                        = "libfsntfs_volume_read_file_entries_data";
 	int result                                   = 1;
 
 	if( volume == NULL )
@@ -2404,7 +2892,7 @@ int libfsntfs_volume_get_serial_number(
 	internal_volume = (libfsntfs_internal_volume_t *) volume;
 
 #if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2412,28 +2900,32 @@ int libfsntfs_volume_get_serial_number(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( libfsntfs_volume_header_get_volume_serial_number(
-	     internal_volume->volume_header,
-	     serial_number,
+	if( libfsntfs_internal_volume_read_file_entries_data(
+	     internal_volume,
+	     mft_entry_indexes,
+	     number_of_mft_entry_indexes,
+	     callback_function,
+	     end_of_file_callback_function,
+	     callback_data,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve volume serial number.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file entries data.",
 		 function );
 
 		result = -1;
 	}
 #if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_release_for_write(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2441,7 +2933,7 @@ int libfsntfs_volume_get_serial_number(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
@@ -2450,17 +2942,20 @@ int libfsntfs_volume_get_serial_number(
 	return( result );
 }
 
-/* Retrieves the number of file entries (MFT entries)
- * Returns 1 if successful or -1 on error
+/* Retrieves the size of the UTF-8 encoded name
+ * The returned size includes the end of string character
+ * This value is retrieved from the $VOLUME_NAME attribute of the $Volume metadata file
+ * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libfsntfs_volume_get_number_of_file_entries(
+int libfsntfs_volume_get_utf8_name_size(
      libfsntfs_volume_t *volume,
-     uint64_t *number_of_file_entries,
+     size_t *utf8_string_size,
      libcerror_error_t **error )
 {
+	libfsntfs_attribute_t *volume_name_attribute = NULL;
 	libfsntfs_internal_volume_t *internal_volume = NULL;
-	static char *function                        = "libfsntfs_volume_get_number_of_file_entries";
-	int result                                   = 1;
+	static char *function                        = "libfsntfs_volume_get_utf8_name_size";
+	int result                                   = 0;
 
 	if( volume == NULL )
 	{
@@ -2476,7 +2971,7 @@ int libfsntfs_volume_get_number_of_file_entries(
 	internal_volume = (libfsntfs_internal_volume_t *) volume;
 
 #if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2484,28 +2979,47 @@ int libfsntfs_volume_get_number_of_file_entries(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( libfsntfs_file_system_get_number_of_mft_entries(
-	     internal_volume->file_system,
-	     number_of_file_entries,
-	     error ) != 1 )
+	result = libfsntfs_internal_volume_get_volume_name_attribute(
+	          internal_volume,
+	          &volume_name_attribute,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of MFT entries.",
+		 "%s: unable to retrieve volume name attribute.",
 		 function );
 
 		result = -1;
 	}
+	else if( result != 0 )
+	{
+		if( libfsntfs_volume_name_attribute_get_utf8_name_size(
+		     volume_name_attribute,
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size of UTF-8 name from volume name attribute.",
+			 function );
+
+			result = -1;
+		}
+	}
 #if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_release_for_write(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2513,7 +3027,7 @@ int libfsntfs_volume_get_number_of_file_entries(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
@@ -2522,18 +3036,21 @@ int libfsntfs_volume_get_number_of_file_entries(
 	return( result );
 }
 
-/* Retrieves the file entry of a specific MFT entry index
- * Returns 1 if successful or -1 on error
+/* Retrieves the UTF-8 encoded name
+ * The size should include the end of string character
+ * This value is retrieved from the $VOLUME_NAME attribute of the $Volume metadata file
+ * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libfsntfs_volume_get_file_entry_by_index(
+int libfsntfs_volume_get_utf8_name(
      libfsntfs_volume_t *volume,
-     uint64_t mft_entry_index,
-     libfsntfs_file_entry_t **file_entry,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
      libcerror_error_t **error )
 {
+	libfsntfs_attribute_t *volume_name_attribute = NULL;
 	libfsntfs_internal_volume_t *internal_volume = NULL;
-	static char *function                        = "libfsntfs_volume_get_file_entry_by_index";
-	int result                                   = 1;
+	static char *function                        = "libfsntfs_volume_get_utf8_name";
+	int result                                   = 0;
 
 	if( volume == NULL )
 	{
@@ -2548,28 +3065,6 @@ int libfsntfs_volume_get_file_entry_by_index(
 	}
 	internal_volume = (libfsntfs_internal_volume_t *) volume;
 
-	if( file_entry == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file entry.",
-		 function );
-
-		return( -1 );
-	}
-	if( *file_entry != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file entry value already set.",
-		 function );
-
-		return( -1 );
-	}
 #if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_volume->read_write_lock,
@@ -2585,26 +3080,40 @@ int libfsntfs_volume_get_file_entry_by_index(
 		return( -1 );
 	}
 #endif
-	if( libfsntfs_file_entry_initialize(
-	     file_entry,
-	     internal_volume->io_handle,
-	     internal_volume->file_io_handle,
-	     internal_volume->file_system,
-	     mft_entry_index,
-	     NULL,
-	     0,
-	     error ) != 1 )
+	result = libfsntfs_internal_volume_get_volume_name_attribute(
+	          internal_volume,
+	          &volume_name_attribute,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file entry with MFT entry: %" PRIu64 ".",
-		 function,
-		 mft_entry_index );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume name attribute.",
+		 function );
 
 		result = -1;
 	}
+	else if( result != 0 )
+	{
+		if( libfsntfs_volume_name_attribute_get_utf8_name(
+		     volume_name_attribute,
+		     utf8_string,
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 name from volume name attribute.",
+			 function );
+
+			result = -1;
+		}
+	}
 #if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_volume->read_write_lock,
@@ -2623,29 +3132,22 @@ int libfsntfs_volume_get_file_entry_by_index(
 	return( result );
 }
 
-/* Retrieves the MFT entry for an UTF-8 encoded path
- * A new directory_entry is allocated if a match is found
- * Returns 1 if successful, 0 if no such file entry or -1 on error
+/* Retrieves the size of the UTF-16 encoded name
+ * The returned size includes the end of string character
+ * This value is retrieved from the $VOLUME_NAME attribute of the $Volume metadata file
+ * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf8_path(
-     libfsntfs_internal_volume_t *internal_volume,
-     const uint8_t *utf8_string,
-     size_t utf8_string_length,
-     libfsntfs_mft_entry_t **mft_entry,
-     libfsntfs_directory_entry_t **directory_entry,
+int libfsntfs_volume_get_utf16_name_size(
+     libfsntfs_volume_t *volume,
+     size_t *utf16_string_size,
      libcerror_error_t **error )
 {
-	libfsntfs_directory_entries_tree_t *directory_entries_tree = NULL;
-	libfsntfs_directory_entry_t *safe_directory_entry          = NULL;
-	const uint8_t *utf8_string_segment                         = NULL;
-	static char *function                                      = "libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf8_path";
-	libuna_unicode_character_t unicode_character               = 0;
-	size_t utf8_string_index                                   = 0;
-	size_t utf8_string_segment_length                          = 0;
-	uint64_t mft_entry_index                                   = 0;
-	int result                                                 = 0;
+	libfsntfs_attribute_t *volume_name_attribute = NULL;
+	libfsntfs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsntfs_volume_get_utf16_name_size";
+	int result                                   = 0;
 
-	if( internal_volume == NULL )
+	if( volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -2656,308 +3158,2887 @@ int libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf8_path(
 
 		return( -1 );
 	}
-	if( utf8_string == NULL )
+	internal_volume = (libfsntfs_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-8 string.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf8_string_length > (size_t) SSIZE_MAX )
+#endif
+	result = libfsntfs_internal_volume_get_volume_name_attribute(
+	          internal_volume,
+	          &volume_name_attribute,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume name attribute.",
 		 function );
 
-		return( -1 );
+		result = -1;
 	}
-	if( mft_entry == NULL )
+	else if( result != 0 )
+	{
+		if( libfsntfs_volume_name_attribute_get_utf16_name_size(
+		     volume_name_attribute,
+		     utf16_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size of UTF-16 name from volume name attribute.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid MFT entry.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	if( directory_entry == NULL )
+#endif
+	return( result );
+}
+
+/* Retrieves the UTF-16 encoded name
+ * The size should include the end of string character
+ * This value is retrieved from the $VOLUME_NAME attribute of the $Volume metadata file
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsntfs_volume_get_utf16_name(
+     libfsntfs_volume_t *volume,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfsntfs_attribute_t *volume_name_attribute = NULL;
+	libfsntfs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsntfs_volume_get_utf16_name";
+	int result                                   = 0;
+
+	if( volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory entry.",
+		 "%s: invalid volume.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf8_string_length > 0 )
+	internal_volume = (libfsntfs_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
 	{
-		/* Ignore a leading separator
-		 */
-		if( utf8_string[ utf8_string_index ] == (uint8_t) LIBFSNTFS_SEPARATOR )
-		{
-			utf8_string_index++;
-		}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
 	}
-	if( libfsntfs_file_system_get_mft_entry_by_index(
-	     internal_volume->file_system,
-	     internal_volume->file_io_handle,
-	     LIBFSNTFS_MFT_ENTRY_INDEX_ROOT_DIRECTORY,
-	     mft_entry,
-	     error ) != 1 )
+#endif
+	result = libfsntfs_internal_volume_get_volume_name_attribute(
+	          internal_volume,
+	          &volume_name_attribute,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve MFT entry: 5.",
+		 "%s: unable to retrieve volume name attribute.",
 		 function );
 
-		goto on_error;
+		result = -1;
 	}
-	if( ( utf8_string_length == 0 )
+	else if( result != 0 )
+	{
+		if( libfsntfs_volume_name_attribute_get_utf16_name(
+		     volume_name_attribute,
+		     utf16_string,
+		     utf16_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-16 name from volume name attribute.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the version
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsntfs_volume_get_version(
+     libfsntfs_volume_t *volume,
+     uint8_t *major_version,
+     uint8_t *minor_version,
+     libcerror_error_t **error )
+{
+	libfsntfs_attribute_t *volume_information_attribute = NULL;
+	libfsntfs_internal_volume_t *internal_volume        = NULL;
+	static char *function                               = "libfsntfs_volume_get_version";
+	int result                                          = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsntfs_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfsntfs_internal_volume_get_volume_information_attribute(
+	          internal_volume,
+	          &volume_information_attribute,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume information attribute.",
+		 function );
+
+		result = -1;
+	}
+	else if( result != 0 )
+	{
+		if( libfsntfs_volume_information_attribute_get_version(
+		     volume_information_attribute,
+		     major_version,
+		     minor_version,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve version from volume information attribute.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the serial number
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_volume_get_serial_number(
+     libfsntfs_volume_t *volume,
+     uint64_t *serial_number,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsntfs_volume_get_serial_number";
+	int result                                   = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsntfs_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsntfs_volume_header_get_volume_serial_number(
+	     internal_volume->volume_header,
+	     serial_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume serial number.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of file entries (MFT entries)
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_volume_get_number_of_file_entries(
+     libfsntfs_volume_t *volume,
+     uint64_t *number_of_file_entries,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsntfs_volume_get_number_of_file_entries";
+	int result                                   = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsntfs_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsntfs_file_system_get_number_of_mft_entries(
+	     internal_volume->file_system,
+	     number_of_file_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of MFT entries.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the file entry of a specific MFT entry index
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_volume_get_file_entry_by_index(
+     libfsntfs_volume_t *volume,
+     uint64_t mft_entry_index,
+     libfsntfs_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsntfs_volume_get_file_entry_by_index";
+	int result                                   = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsntfs_internal_volume_t *) volume;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsntfs_file_entry_initialize(
+	     file_entry,
+	     internal_volume->io_handle,
+	     internal_volume->file_io_handle,
+	     internal_volume->file_system,
+	     mft_entry_index,
+	     NULL,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file entry with MFT entry: %" PRIu64 ".",
+		 function,
+		 mft_entry_index );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the MFT entry for an UTF-8 encoded path
+ * A new directory_entry is allocated if a match is found
+ * The MFT entry is a shared reference to a cached MFT entry that must be released
+ * with libfsntfs_mft_entry_free
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
+ */
+int libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf8_path(
+     libfsntfs_internal_volume_t *internal_volume,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfsntfs_mft_entry_t **mft_entry,
+     libfsntfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error )
+{
+	libfsntfs_directory_entries_tree_t *directory_entries_tree = NULL;
+	libfsntfs_directory_entry_t *safe_directory_entry          = NULL;
+	libfsntfs_mft_entry_t *safe_mft_entry                      = NULL;
+	const uint8_t *utf8_string_segment                         = NULL;
+	static char *function                                      = "libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf8_path";
+	libuna_unicode_character_t unicode_character               = 0;
+	size_t utf8_string_index                                   = 0;
+	size_t utf8_string_segment_length                          = 0;
+	uint64_t mft_entry_index                                   = 0;
+	int result                                                 = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( mft_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MFT entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > 0 )
+	{
+		/* Ignore a leading separator
+		 */
+		if( utf8_string[ utf8_string_index ] == (uint8_t) LIBFSNTFS_SEPARATOR )
+		{
+			utf8_string_index++;
+		}
+	}
+	if( libfsntfs_file_system_get_shared_mft_entry_by_index(
+	     internal_volume->file_system,
+	     internal_volume->file_io_handle,
+	     LIBFSNTFS_MFT_ENTRY_INDEX_ROOT_DIRECTORY,
+	     &safe_mft_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve MFT entry: 5.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( utf8_string_length == 0 )
 	 || ( utf8_string_length == 1 ) )
 	{
-		result = 1;
+		result = 1;
+	}
+	else while( utf8_string_index < utf8_string_length )
+	{
+		if( directory_entries_tree != NULL )
+		{
+			if( libfsntfs_directory_entries_tree_free(
+			     &directory_entries_tree,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free directory entries tree.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libfsntfs_directory_entries_tree_initialize(
+		     &directory_entries_tree,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create directory entries tree.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsntfs_directory_entries_tree_read_from_i30_index(
+		     directory_entries_tree,
+		     internal_volume->io_handle,
+		     internal_volume->file_io_handle,
+		     safe_mft_entry,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory entries tree from MFT entry: %" PRIu64 ".",
+			 function,
+			 mft_entry_index );
+
+			goto on_error;
+		}
+		utf8_string_segment        = &( utf8_string[ utf8_string_index ] );
+		utf8_string_segment_length = utf8_string_index;
+
+		while( utf8_string_index < utf8_string_length )
+		{
+			if( libuna_unicode_character_copy_from_utf8(
+			     &unicode_character,
+			     utf8_string,
+			     utf8_string_length,
+			     &utf8_string_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy UTF-8 string to Unicode character.",
+				 function );
+
+				goto on_error;
+			}
+			if( ( unicode_character == (libuna_unicode_character_t) LIBFSNTFS_SEPARATOR )
+			 || ( unicode_character == 0 ) )
+			{
+				utf8_string_segment_length += 1;
+
+				break;
+			}
+		}
+		utf8_string_segment_length = utf8_string_index - utf8_string_segment_length;
+
+		if( utf8_string_segment_length == 0 )
+		{
+			result = 0;
+		}
+		else
+		{
+			if( safe_directory_entry != NULL )
+			{
+				if( libfsntfs_directory_entry_free(
+				     &safe_directory_entry,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free directory entry.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			result = libfsntfs_directory_entries_tree_get_entry_by_utf8_name(
+			          directory_entries_tree,
+			          internal_volume->file_io_handle,
+			          utf8_string_segment,
+			          utf8_string_segment_length,
+			          &safe_directory_entry,
+			          error );
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry by UTF-8 name.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( libfsntfs_directory_entry_get_mft_entry_index(
+		     safe_directory_entry,
+		     &mft_entry_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve MFT entry index.",
+			 function );
+
+			goto on_error;
+		}
+		/* The directory entries tree is freed before the reference to the MFT entry
+		 * it was read from is released
+		 */
+		if( libfsntfs_directory_entries_tree_free(
+		     &directory_entries_tree,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory entries tree.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsntfs_mft_entry_free(
+		     &safe_mft_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release MFT entry.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsntfs_file_system_get_shared_mft_entry_by_index(
+		     internal_volume->file_system,
+		     internal_volume->file_io_handle,
+		     mft_entry_index,
+		     &safe_mft_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve MFT entry: %" PRIu64 ".",
+			 function,
+			 mft_entry_index );
+
+			goto on_error;
+		}
+	}
+	if( directory_entries_tree != NULL )
+	{
+		if( libfsntfs_directory_entries_tree_free(
+		     &directory_entries_tree,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory entries tree.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( result != 0 )
+	{
+		*mft_entry       = safe_mft_entry;
+		*directory_entry = safe_directory_entry;
+	}
+	else
+	{
+		if( safe_directory_entry != NULL )
+		{
+			if( libfsntfs_directory_entry_free(
+			     &safe_directory_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free directory entry.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libfsntfs_mft_entry_free(
+		     &safe_mft_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release MFT entry.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( result );
+
+on_error:
+	if( safe_directory_entry != NULL )
+	{
+		libfsntfs_directory_entry_free(
+		 &safe_directory_entry,
+		 NULL );
+	}
+	if( directory_entries_tree != NULL )
+	{
+		libfsntfs_directory_entries_tree_free(
+		 &directory_entries_tree,
+		 NULL );
+	}
+	if( safe_mft_entry != NULL )
+	{
+		libfsntfs_mft_entry_free(
+		 &safe_mft_entry,
+		 NULL );
+	}
+	*directory_entry = NULL;
+
+	return( -1 );
+}
+
+/* Retrieves the file entry for an UTF-8 encoded path
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
+ */
+int libfsntfs_volume_get_file_entry_by_utf8_path(
+     libfsntfs_volume_t *volume,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfsntfs_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libfsntfs_directory_entry_t *directory_entry = NULL;
+	libfsntfs_internal_volume_t *internal_volume = NULL;
+	libfsntfs_mft_entry_t *mft_entry             = NULL;
+	static char *function                        = "libfsntfs_volume_get_file_entry_by_utf8_path";
+	int result                                   = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsntfs_internal_volume_t *) volume;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf8_path(
+	          internal_volume,
+	          utf8_string,
+	          utf8_string_length,
+	          &mft_entry,
+	          &directory_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve MFT and directory entry by path.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		/* file_entry takes over management of directory_entry
+		 */
+		if( libfsntfs_file_entry_initialize(
+		     file_entry,
+		     internal_volume->io_handle,
+		     internal_volume->file_io_handle,
+		     internal_volume->file_system,
+		     (uint64_t) mft_entry->index,
+		     directory_entry,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file entry with MFT entry: %" PRIu32 ".",
+			 function,
+			 mft_entry->index );
+
+			goto on_error;
+		}
+		if( libfsntfs_mft_entry_free(
+		     &mft_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release MFT entry.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+	if( directory_entry != NULL )
+	{
+		libfsntfs_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	if( mft_entry != NULL )
+	{
+		libfsntfs_mft_entry_free(
+		 &mft_entry,
+		 NULL );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_volume->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the MFT entry for an UTF-16 encoded path
+ * A new directory_entry is allocated if a match is found
+ * The MFT entry is a shared reference to a cached MFT entry that must be released
+ * with libfsntfs_mft_entry_free
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
+ */
+int libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf16_path(
+     libfsntfs_internal_volume_t *internal_volume,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libfsntfs_mft_entry_t **mft_entry,
+     libfsntfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error )
+{
+	libfsntfs_directory_entries_tree_t *directory_entries_tree = NULL;
+	libfsntfs_directory_entry_t *safe_directory_entry          = NULL;
+	libfsntfs_mft_entry_t *safe_mft_entry                      = NULL;
+	const uint16_t *utf16_string_segment                       = NULL;
+	static char *function                                      = "libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf16_path";
+	libuna_unicode_character_t unicode_character               = 0;
+	size_t utf16_string_index                                  = 0;
+	size_t utf16_string_segment_length                         = 0;
+	uint64_t mft_entry_index                                   = 0;
+	int result                                                 = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( mft_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MFT entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > 0 )
+	{
+		/* Ignore a leading separator
+		 */
+		if( utf16_string[ utf16_string_index ] == (uint16_t) LIBFSNTFS_SEPARATOR )
+		{
+			utf16_string_index++;
+		}
+	}
+	if( libfsntfs_file_system_get_shared_mft_entry_by_index(
+	     internal_volume->file_system,
+	     internal_volume->file_io_handle,
+	     LIBFSNTFS_MFT_ENTRY_INDEX_ROOT_DIRECTORY,
+	     &safe_mft_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve MFT entry: 5.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( utf16_string_length == 0 )
+	 || ( utf16_string_length == 1 ) )
+	{
+		result = 1;
+	}
+	else while( utf16_string_index < utf16_string_length )
+	{
+		if( directory_entries_tree != NULL )
+		{
+			if( libfsntfs_directory_entries_tree_free(
+			     &directory_entries_tree,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free directory entries tree.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libfsntfs_directory_entries_tree_initialize(
+		     &directory_entries_tree,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create directory entries tree.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsntfs_directory_entries_tree_read_from_i30_index(
+		     directory_entries_tree,
+		     internal_volume->io_handle,
+		     internal_volume->file_io_handle,
+		     safe_mft_entry,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory entries tree from MFT entry: %" PRIu64 ".",
+			 function,
+			 mft_entry_index );
+
+			goto on_error;
+		}
+		utf16_string_segment        = &( utf16_string[ utf16_string_index ] );
+		utf16_string_segment_length = utf16_string_index;
+
+		while( utf16_string_index < utf16_string_length )
+		{
+			if( libuna_unicode_character_copy_from_utf16(
+			     &unicode_character,
+			     utf16_string,
+			     utf16_string_length,
+			     &utf16_string_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy UTF-16 string to Unicode character.",
+				 function );
+
+				goto on_error;
+			}
+			if( ( unicode_character == (libuna_unicode_character_t) LIBFSNTFS_SEPARATOR )
+			 || ( unicode_character == 0 ) )
+			{
+				utf16_string_segment_length += 1;
+
+				break;
+			}
+		}
+		utf16_string_segment_length = utf16_string_index - utf16_string_segment_length;
+
+		if( utf16_string_segment_length == 0 )
+		{
+			result = 0;
+		}
+		else
+		{
+			if( safe_directory_entry != NULL )
+			{
+				if( libfsntfs_directory_entry_free(
+				     &safe_directory_entry,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free directory entry.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			result = libfsntfs_directory_entries_tree_get_entry_by_utf16_name(
+			          directory_entries_tree,
+			          internal_volume->file_io_handle,
+			          utf16_string_segment,
+			          utf16_string_segment_length,
+			          &safe_directory_entry,
+			          error );
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry by UTF-16 name.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( libfsntfs_directory_entry_get_mft_entry_index(
+		     safe_directory_entry,
+		     &mft_entry_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve MFT entry index.",
+			 function );
+
+			goto on_error;
+		}
+		/* The directory entries tree is freed before the reference to the MFT entry
+		 * it was read from is released
+		 */
+		if( libfsntfs_directory_entries_tree_free(
+		     &directory_entries_tree,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory entries tree.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsntfs_mft_entry_free(
+		     &safe_mft_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release MFT entry.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsntfs_file_system_get_shared_mft_entry_by_index(
+		     internal_volume->file_system,
+		     internal_volume->file_io_handle,
+		     mft_entry_index,
+		     &safe_mft_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve MFT entry: %" PRIu64 ".",
+			 function,
+			 mft_entry_index );
+
+			goto on_error;
+		}
+	}
+	if( directory_entries_tree != NULL )
+	{
+		if( libfsntfs_directory_entries_tree_free(
+		     &directory_entries_tree,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory entries tree.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( result != 0 )
+	{
+		*mft_entry       = safe_mft_entry;
+		*directory_entry = safe_directory_entry;
+	}
+	else
+	{
+		if( safe_directory_entry != NULL )
+		{
+			if( libfsntfs_directory_entry_free(
+			     &safe_directory_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free directory entry.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libfsntfs_mft_entry_free(
+		     &safe_mft_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release MFT entry.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( result );
+
+on_error:
+	if( safe_directory_entry != NULL )
+	{
+		libfsntfs_directory_entry_free(
+		 &safe_directory_entry,
+		 NULL );
+	}
+	if( directory_entries_tree != NULL )
+	{
+		libfsntfs_directory_entries_tree_free(
+		 &directory_entries_tree,
+		 NULL );
+	}
+	if( safe_mft_entry != NULL )
+	{
+		libfsntfs_mft_entry_free(
+		 &safe_mft_entry,
+		 NULL );
+	}
+	*directory_entry = NULL;
+
+	return( -1 );
+}
+
+/* Retrieves the file entry for an UTF-16 encoded path
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
+ */
+int libfsntfs_volume_get_file_entry_by_utf16_path(
+     libfsntfs_volume_t *volume,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libfsntfs_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libfsntfs_directory_entry_t *directory_entry = NULL;
+	libfsntfs_internal_volume_t *internal_volume = NULL;
+	libfsntfs_mft_entry_t *mft_entry             = NULL;
+	static char *function                        = "libfsntfs_volume_get_file_entry_by_utf16_path";
+	int result                                   = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsntfs_internal_volume_t *) volume;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf16_path(
+	          internal_volume,
+	          utf16_string,
+	          utf16_string_length,
+	          &mft_entry,
+	          &directory_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve MFT and directory entry by path.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		/* file_entry takes over management of directory_entry
+		 */
+		if( libfsntfs_file_entry_initialize(
+		     file_entry,
+		     internal_volume->io_handle,
+		     internal_volume->file_io_handle,
+		     internal_volume->file_system,
+		     (uint64_t) mft_entry->index,
+		     directory_entry,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file entry with MFT entry: %" PRIu32 ".",
+			 function,
+			 mft_entry->index );
+
+			goto on_error;
+		}
+		if( libfsntfs_mft_entry_free(
+		     &mft_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release MFT entry.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+	if( directory_entry != NULL )
+	{
+		libfsntfs_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	if( mft_entry != NULL )
+	{
+		libfsntfs_mft_entry_free(
+		 &mft_entry,
+		 NULL );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_volume->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the root directory file entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_volume_get_root_directory(
+     libfsntfs_volume_t *volume,
+     libfsntfs_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsntfs_volume_get_root_directory";
+	int result                                   = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsntfs_internal_volume_t *) volume;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsntfs_file_entry_initialize(
+	     file_entry,
+	     internal_volume->io_handle,
+	     internal_volume->file_io_handle,
+	     internal_volume->file_system,
+	     LIBFSNTFS_MFT_ENTRY_INDEX_ROOT_DIRECTORY,
+	     NULL,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file entry from MFT entry: %d.",
+		 function,
+		 LIBFSNTFS_MFT_ENTRY_INDEX_ROOT_DIRECTORY );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the USN change journal
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsntfs_volume_get_usn_change_journal(
+     libfsntfs_volume_t *volume,
+     libfsntfs_usn_change_journal_t **usn_change_journal,
+     libcerror_error_t **error )
+{
+	libfsntfs_directory_entry_t *directory_entry = NULL;
+	libfsntfs_internal_volume_t *internal_volume = NULL;
+	libfsntfs_mft_attribute_t *data_attribute    = NULL;
+	libfsntfs_mft_entry_t *mft_entry             = NULL;
+	static char *function                        = "libfsntfs_volume_get_usn_change_journal";
+	int result                                   = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsntfs_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf8_path(
+	          internal_volume,
+	          (uint8_t *) "\\$Extend\\$UsnJrnl",
+	          17,
+	          &mft_entry,
+	          &directory_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve \\$Extend\\$UsnJrnl MFT and directory entry by path.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		result = libfsntfs_mft_entry_get_alternate_data_attribute_by_utf8_name(
+		          mft_entry,
+		          (uint8_t *) "$J",
+		          2,
+		          &data_attribute,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve $J data attribute.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			/* libfsntfs_usn_change_journal_initialize takes over management of directory_entry
+			 * and the reference to mft_entry, since the $J data stream references data_attribute
+			 */
+			if( libfsntfs_usn_change_journal_initialize(
+			     usn_change_journal,
+			     internal_volume->io_handle,
+			     internal_volume->file_io_handle,
+			     directory_entry,
+			     mft_entry,
+			     data_attribute,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create USN change journal.",
+				 function );
+
+				goto on_error;
+			}
+			directory_entry = NULL;
+			mft_entry       = NULL;
+		}
+		else
+		{
+			if( libfsntfs_directory_entry_free(
+			     &directory_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free directory entry.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfsntfs_mft_entry_free(
+			     &mft_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release MFT entry.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+	if( directory_entry != NULL )
+	{
+		libfsntfs_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	if( mft_entry != NULL )
+	{
+		libfsntfs_mft_entry_free(
+		 &mft_entry,
+		 NULL );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_volume->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the MFT entries that were changed since a specific update sequence number (USN)
+ * This allows to refresh a previously exported snapshot of the metadata of the volume
+ * by only re-reading the MFT entries that are referenced by the USN change journal ($UsnJrnl:$J)
+ * The callback function is called once for every changed MFT entry index,
+ * it should return 1 to continue, 0 to stop or -1 on error
+ * The next update sequence number is the USN to store with the refreshed snapshot
+ * Returns 1 if successful, 0 if the changes are not available or -1 on error
+ */
+int libfsntfs_volume_get_changed_mft_entries(
+     libfsntfs_volume_t *volume,
+     uint64_t update_sequence_number,
+     int (*callback_function)(
+            uint64_t mft_entry_index,
+            void *callback_data ),
+     void *callback_data,
+     uint64_t *next_update_sequence_number,
+     libcerror_error_t **error )
+{
+	libfsntfs_usn_change_journal_t *usn_change_journal = NULL;
+	static char *function                              = "libfsntfs_volume_get_changed_mft_entries";
+	uint64_t number_of_mft_entries                     = 0;
+	int result                                         = 0;
+
+	if( libfsntfs_volume_get_number_of_file_entries(
+	     volume,
+	     &number_of_mft_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of MFT entries.",
+		 function );
+
+		goto on_error;
+	}
+	result = libfsntfs_volume_get_usn_change_journal(
+	          volume,
+	          &usn_change_journal,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve USN change journal.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	result = libfsntfs_internal_usn_change_journal_get_changed_mft_entries(
+	          (libfsntfs_internal_usn_change_journal_t *) usn_change_journal,
+	          update_sequence_number,
+	          number_of_mft_entries,
+	          callback_function,
+	          callback_data,
+	          next_update_sequence_number,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve changed MFT entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsntfs_usn_change_journal_free(
+	     &usn_change_journal,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free USN change journal.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( usn_change_journal != NULL )
+	{
+		libfsntfs_usn_change_journal_free(
+		 &usn_change_journal,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Builds the name index of the volume
+ * MFT entries that cannot be read are not included in the name index
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_internal_volume_build_name_index(
+     libfsntfs_internal_volume_t *internal_volume,
+     libcerror_error_t **error )
+{
+	libfsntfs_mft_entry_t *mft_entry   = NULL;
+	libfsntfs_name_index_t *name_index = NULL;
+	static char *function              = "libfsntfs_internal_volume_build_name_index";
+	uint64_t mft_entry_index           = 0;
+	uint64_t number_of_mft_entries     = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->name_index != NULL )
+	{
+		return( 1 );
+	}
+	if( libfsntfs_file_system_get_number_of_mft_entries(
+	     internal_volume->file_system,
+	     &number_of_mft_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of MFT entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsntfs_name_index_initialize(
+	     &name_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create name index.",
+		 function );
+
+		goto on_error;
+	}
+	for( mft_entry_index = 0;
+	     mft_entry_index < number_of_mft_entries;
+	     mft_entry_index++ )
+	{
+		if( internal_volume->io_handle->abort != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: abort requested.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsntfs_file_system_get_mft_entry_by_index_no_cache(
+		     internal_volume->file_system,
+		     internal_volume->file_io_handle,
+		     mft_entry_index,
+		     &mft_entry,
+		     error ) != 1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+
+			continue;
+		}
+		if( libfsntfs_name_index_append_mft_entry(
+		     name_index,
+		     mft_entry,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append MFT entry: %" PRIu64 " to name index.",
+			 function,
+			 mft_entry_index );
+
+			goto on_error;
+		}
+		if( libfsntfs_mft_entry_free(
+		     &mft_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free MFT entry: %" PRIu64 ".",
+			 function,
+			 mft_entry_index );
+
+			goto on_error;
+		}
+	}
+	if( libfsntfs_name_index_build_suffixes(
+	     name_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build name index suffixes.",
+		 function );
+
+		goto on_error;
+	}
+	internal_volume->name_index = name_index;
+
+	return( 1 );
+
+on_error:
+	if( mft_entry != NULL )
+	{
+		libfsntfs_mft_entry_free(
+		 &mft_entry,
+		 NULL );
+	}
+	if( name_index != NULL )
+	{
+		libfsntfs_name_index_free(
+		 &name_index,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Builds the name index of the volume
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_volume_build_name_index(
+     libfsntfs_volume_t *volume,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsntfs_volume_build_name_index";
+	int result                                   = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsntfs_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsntfs_internal_volume_build_name_index(
+	     internal_volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build name index.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Searches the name index for file entries with a name that matches an UTF-8 encoded string
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_volume_search_name_index_utf8(
+     libfsntfs_volume_t *volume,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int search_type,
+     uint64_t *file_references,
+     int maximum_number_of_file_references,
+     int *number_of_file_references,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsntfs_volume_search_name_index_utf8";
+	int result                                   = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsntfs_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing name index.",
+		 function );
+
+		result = -1;
+	}
+	else if( libfsntfs_name_index_search_utf8(
+	          internal_volume->name_index,
+	          utf8_string,
+	          utf8_string_length,
+	          search_type,
+	          file_references,
+	          maximum_number_of_file_references,
+	          number_of_file_references,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to search name index.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Searches the name index for file entries with a name that matches an UTF-16 encoded string
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_volume_search_name_index_utf16(
+     libfsntfs_volume_t *volume,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     int search_type,
+     uint64_t *file_references,
+     int maximum_number_of_file_references,
+     int *number_of_file_references,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsntfs_volume_search_name_index_utf16";
+	int result                                   = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsntfs_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing name index.",
+		 function );
+
+		result = -1;
+	}
+	else if( libfsntfs_name_index_search_utf16(
+	          internal_volume->name_index,
+	          utf16_string,
+	          utf16_string_length,
+	          search_type,
+	          file_references,
+	          maximum_number_of_file_references,
+	          number_of_file_references,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to search name index.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads the object identifier index
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsntfs_internal_volume_read_object_identifier_index(
+     libfsntfs_internal_volume_t *internal_volume,
+     libcerror_error_t **error )
+{
+	libfsntfs_directory_entry_t *directory_entry                 = NULL;
+	libfsntfs_mft_entry_t *mft_entry                             = NULL;
+	libfsntfs_object_identifier_index_t *object_identifier_index = NULL;
+	static char *function                                        = "libfsntfs_internal_volume_read_object_identifier_index";
+	int result                                                   = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->object_identifier_index != NULL )
+	{
+		return( 1 );
+	}
+	result = libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf8_path(
+	          internal_volume,
+	          (uint8_t *) "\\$Extend\\$ObjId",
+	          15,
+	          &mft_entry,
+	          &directory_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve \\$Extend\\$ObjId MFT and directory entry by path.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libfsntfs_directory_entry_free(
+	     &directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsntfs_object_identifier_index_initialize(
+	     &object_identifier_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create object identifier index.",
+		 function );
+
+		goto on_error;
+	}
+	result = libfsntfs_object_identifier_index_read_o_index(
+	          object_identifier_index,
+	          internal_volume->io_handle,
+	          internal_volume->file_io_handle,
+	          mft_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read object identifier ($O) index.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsntfs_mft_entry_free(
+	     &mft_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release MFT entry.",
+		 function );
+
+		goto on_error;
 	}
-	else while( utf8_string_index < utf8_string_length )
+	if( result == 0 )
 	{
-		if( directory_entries_tree != NULL )
+		if( libfsntfs_object_identifier_index_free(
+		     &object_identifier_index,
+		     error ) != 1 )
 		{
-			if( libfsntfs_directory_entries_tree_free(
-			     &directory_entries_tree,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free directory entries tree.",
-				 function );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free object identifier index.",
+			 function );
 
-				goto on_error;
-			}
+			goto on_error;
 		}
-		if( libfsntfs_directory_entries_tree_initialize(
-		     &directory_entries_tree,
-		     error ) != 1 )
+		return( 0 );
+	}
+	internal_volume->object_identifier_index = object_identifier_index;
+
+	return( 1 );
+
+on_error:
+	if( object_identifier_index != NULL )
+	{
+		libfsntfs_object_identifier_index_free(
+		 &object_identifier_index,
+		 NULL );
+	}
+	if( directory_entry != NULL )
+	{
+		libfsntfs_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	if( mft_entry != NULL )
+	{
+		libfsntfs_mft_entry_free(
+		 &mft_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the file entry for a specific object identifier
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
+ */
+int libfsntfs_volume_get_file_entry_by_object_identifier(
+     libfsntfs_volume_t *volume,
+     const uint8_t *guid_data,
+     size_t guid_data_size,
+     libfsntfs_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsntfs_volume_get_file_entry_by_object_identifier";
+	uint64_t entry_file_reference                = 0;
+	uint64_t file_reference                      = 0;
+	int result                                   = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsntfs_internal_volume_t *) volume;
+
+	if( guid_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GUID data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( guid_data_size < 16 )
+	 || ( guid_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid GUID data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfsntfs_internal_volume_read_object_identifier_index(
+	          internal_volume,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read object identifier index.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		result = libfsntfs_object_identifier_index_get_file_reference_by_identifier(
+		          internal_volume->object_identifier_index,
+		          internal_volume->file_io_handle,
+		          guid_data,
+		          &file_reference,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create directory entries tree.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file reference by object identifier.",
 			 function );
 
 			goto on_error;
 		}
-		if( libfsntfs_directory_entries_tree_read_from_i30_index(
-		     directory_entries_tree,
+	}
+	if( result != 0 )
+	{
+		if( libfsntfs_file_entry_initialize(
+		     file_entry,
 		     internal_volume->io_handle,
 		     internal_volume->file_io_handle,
-		     *mft_entry,
+		     internal_volume->file_system,
+		     file_reference & 0xffffffffffffUL,
+		     NULL,
 		     0,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read directory entries tree from MFT entry: %" PRIu64 ".",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file entry with MFT entry: %" PRIu64 ".",
 			 function,
-			 mft_entry_index );
+			 file_reference & 0xffffffffffffUL );
 
 			goto on_error;
 		}
-		utf8_string_segment        = &( utf8_string[ utf8_string_index ] );
-		utf8_string_segment_length = utf8_string_index;
+		if( libfsntfs_mft_entry_get_file_reference(
+		     ( (libfsntfs_internal_file_entry_t *) *file_entry )->mft_entry,
+		     &entry_file_reference,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file reference from MFT entry: %" PRIu64 ".",
+			 function,
+			 file_reference & 0xffffffffffffUL );
 
-		while( utf8_string_index < utf8_string_length )
+			goto on_error;
+		}
+		/* The object identifier is stale if the MFT entry was reused
+		 */
+		if( entry_file_reference != file_reference )
 		{
-			if( libuna_unicode_character_copy_from_utf8(
-			     &unicode_character,
-			     utf8_string,
-			     utf8_string_length,
-			     &utf8_string_index,
+			if( libfsntfs_file_entry_free(
+			     file_entry,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy UTF-8 string to Unicode character.",
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file entry.",
 				 function );
 
 				goto on_error;
 			}
-			if( ( unicode_character == (libuna_unicode_character_t) LIBFSNTFS_SEPARATOR )
-			 || ( unicode_character == 0 ) )
-			{
-				utf8_string_segment_length += 1;
-
-				break;
-			}
-		}
-		utf8_string_segment_length = utf8_string_index - utf8_string_segment_length;
-
-		if( utf8_string_segment_length == 0 )
-		{
 			result = 0;
 		}
-		else
-		{
-			if( safe_directory_entry != NULL )
-			{
-				if( libfsntfs_directory_entry_free(
-				     &safe_directory_entry,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-					 "%s: unable to free directory entry.",
-					 function );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+	if( *file_entry != NULL )
+	{
+		libfsntfs_file_entry_free(
+		 file_entry,
+		 NULL );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_volume->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Reads the reparse point index
+ * If $Extend\$Reparse is not available the reparse point index is empty
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_internal_volume_read_reparse_point_index(
+     libfsntfs_internal_volume_t *internal_volume,
+     libcerror_error_t **error )
+{
+	libfsntfs_directory_entry_t *directory_entry         = NULL;
+	libfsntfs_mft_entry_t *mft_entry                     = NULL;
+	libfsntfs_reparse_point_index_t *reparse_point_index = NULL;
+	static char *function                                = "libfsntfs_internal_volume_read_reparse_point_index";
+	int result                                           = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
 
-					goto on_error;
-				}
-			}
-			result = libfsntfs_directory_entries_tree_get_entry_by_utf8_name(
-			          directory_entries_tree,
-			          internal_volume->file_io_handle,
-			          utf8_string_segment,
-			          utf8_string_segment_length,
-			          &safe_directory_entry,
-			          error );
-		}
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve directory entry by UTF-8 name.",
-			 function );
+		return( -1 );
+	}
+	if( internal_volume->reparse_point_index != NULL )
+	{
+		return( 1 );
+	}
+	if( libfsntfs_reparse_point_index_initialize(
+	     &reparse_point_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create reparse point index.",
+		 function );
 
-			goto on_error;
-		}
-		else if( result == 0 )
-		{
-			break;
-		}
-		if( libfsntfs_directory_entry_get_mft_entry_index(
-		     safe_directory_entry,
-		     &mft_entry_index,
+		goto on_error;
+	}
+	result = libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf8_path(
+	          internal_volume,
+	          (uint8_t *) "\\$Extend\\$Reparse",
+	          17,
+	          &mft_entry,
+	          &directory_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve \\$Extend\\$Reparse MFT and directory entry by path.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libfsntfs_directory_entry_free(
+		     &directory_entry,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve MFT entry index.",
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory entry.",
 			 function );
 
 			goto on_error;
 		}
-		if( libfsntfs_file_system_get_mft_entry_by_index(
-		     internal_volume->file_system,
+		if( libfsntfs_reparse_point_index_read_r_index(
+		     reparse_point_index,
+		     internal_volume->io_handle,
 		     internal_volume->file_io_handle,
-		     mft_entry_index,
 		     mft_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve MFT entry: %" PRIu64 ".",
-			 function,
-			 mft_entry_index );
-
-			goto on_error;
-		}
-	}
-	if( result != 0 )
-	{
-		*directory_entry = safe_directory_entry;
-	}
-	else if( safe_directory_entry != NULL )
-	{
-		if( libfsntfs_directory_entry_free(
-		     &safe_directory_entry,
-		     error ) != 1 )
+		     error ) == -1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free directory entry.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read reparse point ($R) index.",
 			 function );
 
 			goto on_error;
 		}
-	}
-	if( directory_entries_tree != NULL )
-	{
-		if( libfsntfs_directory_entries_tree_free(
-		     &directory_entries_tree,
+		if( libfsntfs_mft_entry_free(
+		     &mft_entry,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free directory entries tree.",
+			 "%s: unable to release MFT entry.",
 			 function );
 
 			goto on_error;
 		}
 	}
-	return( result );
+	internal_volume->reparse_point_index = reparse_point_index;
+
+	return( 1 );
 
 on_error:
-	if( safe_directory_entry != NULL )
+	if( reparse_point_index != NULL )
+	{
+		libfsntfs_reparse_point_index_free(
+		 &reparse_point_index,
+		 NULL );
+	}
+	if( directory_entry != NULL )
 	{
 		libfsntfs_directory_entry_free(
-		 &safe_directory_entry,
+		 &directory_entry,
 		 NULL );
 	}
-	if( directory_entries_tree != NULL )
+	if( mft_entry != NULL )
 	{
-		libfsntfs_directory_entries_tree_free(
-		 &directory_entries_tree,
+		libfsntfs_mft_entry_free(
+		 &mft_entry,
 		 NULL );
 	}
-	*directory_entry = NULL;
-
 	return( -1 );
 }
 
-/* Retrieves the file entry for an UTF-8 encoded path
- * Returns 1 if successful, 0 if no such file entry or -1 on error
+/* Retrieves the number of reparse points
+ * Returns 1 if successful or -1 on error
  */
-int libfsntfs_volume_get_file_entry_by_utf8_path(
+int libfsntfs_volume_get_number_of_reparse_points(
      libfsntfs_volume_t *volume,
-     const uint8_t *utf8_string,
-     size_t utf8_string_length,
-     libfsntfs_file_entry_t **file_entry,
+     int *number_of_reparse_points,
      libcerror_error_t **error )
 {
-	libfsntfs_directory_entry_t *directory_entry = NULL;
 	libfsntfs_internal_volume_t *internal_volume = NULL;
-	libfsntfs_mft_entry_t *mft_entry             = NULL;
-	static char *function                        = "libfsntfs_volume_get_file_entry_by_utf8_path";
-	int result                                   = 0;
+	static char *function                        = "libfsntfs_volume_get_number_of_reparse_points";
+	int result                                   = 1;
 
 	if( volume == NULL )
 	{
@@ -2972,28 +6053,93 @@ int libfsntfs_volume_get_file_entry_by_utf8_path(
 	}
 	internal_volume = (libfsntfs_internal_volume_t *) volume;
 
-	if( file_entry == NULL )
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file entry.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	if( *file_entry != NULL )
+#endif
+	if( libfsntfs_internal_volume_read_reparse_point_index(
+	     internal_volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read reparse point index.",
+		 function );
+
+		result = -1;
+	}
+	else if( libfsntfs_reparse_point_index_get_number_of_entries(
+	          internal_volume->reparse_point_index,
+	          number_of_reparse_points,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file entry value already set.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from reparse point index.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the tag and file reference of a specific reparse point
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_volume_get_reparse_point_by_index(
+     libfsntfs_volume_t *volume,
+     int reparse_point_index,
+     uint32_t *tag,
+     uint64_t *file_reference,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsntfs_volume_get_reparse_point_by_index";
+	int result                                   = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
 		 function );
 
 		return( -1 );
 	}
+	internal_volume = (libfsntfs_internal_volume_t *) volume;
+
 #if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_volume->read_write_lock,
@@ -3009,49 +6155,35 @@ int libfsntfs_volume_get_file_entry_by_utf8_path(
 		return( -1 );
 	}
 #endif
-	result = libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf8_path(
-	          internal_volume,
-	          utf8_string,
-	          utf8_string_length,
-	          &mft_entry,
-	          &directory_entry,
-	          error );
-
-	if( result == -1 )
+	if( libfsntfs_internal_volume_read_reparse_point_index(
+	     internal_volume,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve MFT and directory entry by path.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read reparse point index.",
 		 function );
 
-		goto on_error;
+		result = -1;
 	}
-	else if( result != 0 )
+	else if( libfsntfs_reparse_point_index_get_entry_by_index(
+	          internal_volume->reparse_point_index,
+	          reparse_point_index,
+	          tag,
+	          file_reference,
+	          error ) != 1 )
 	{
-		/* file_entry takes over management of directory_entry
-		 */
-		if( libfsntfs_file_entry_initialize(
-		     file_entry,
-		     internal_volume->io_handle,
-		     internal_volume->file_io_handle,
-		     internal_volume->file_system,
-		     (uint64_t) mft_entry->index,
-		     directory_entry,
-		     0,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create file entry with MFT entry: %" PRIu32 ".",
-			 function,
-			 mft_entry->index );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve reparse point: %d from reparse point index.",
+		 function,
+		 reparse_point_index );
 
-			goto on_error;
-		}
+		result = -1;
 	}
 #if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -3069,43 +6201,20 @@ int libfsntfs_volume_get_file_entry_by_utf8_path(
 	}
 #endif
 	return( result );
-
-on_error:
-	if( directory_entry != NULL )
-	{
-		libfsntfs_directory_entry_free(
-		 &directory_entry,
-		 NULL );
-	}
-#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
-	libcthreads_read_write_lock_release_for_write(
-	 internal_volume->read_write_lock,
-	 NULL );
-#endif
-	return( -1 );
 }
 
-/* Retrieves the MFT entry for an UTF-16 encoded path
- * A new directory_entry is allocated if a match is found
- * Returns 1 if successful, 0 if no such file entry or -1 on error
+/* Reads the quota index
+ * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf16_path(
+int libfsntfs_internal_volume_read_quota_index(
      libfsntfs_internal_volume_t *internal_volume,
-     const uint16_t *utf16_string,
-     size_t utf16_string_length,
-     libfsntfs_mft_entry_t **mft_entry,
-     libfsntfs_directory_entry_t **directory_entry,
      libcerror_error_t **error )
 {
-	libfsntfs_directory_entries_tree_t *directory_entries_tree = NULL;
-	libfsntfs_directory_entry_t *safe_directory_entry          = NULL;
-	const uint16_t *utf16_string_segment                       = NULL;
-	static char *function                                      = "libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf16_path";
-	libuna_unicode_character_t unicode_character               = 0;
-	size_t utf16_string_index                                  = 0;
-	size_t utf16_string_segment_length                         = 0;
-	uint64_t mft_entry_index                                   = 0;
-	int result                                                 = 0;
+	libfsntfs_directory_entry_t *directory_entry = NULL;
+	libfsntfs_mft_entry_t *mft_entry             = NULL;
+	libfsntfs_quota_index_t *quota_index         = NULL;
+	static char *function                        = "libfsntfs_internal_volume_read_quota_index";
+	int result                                   = 0;
 
 	if( internal_volume == NULL )
 	{
@@ -3118,307 +6227,145 @@ int libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf16_path(
 
 		return( -1 );
 	}
-	if( utf16_string == NULL )
+	if( internal_volume->quota_index != NULL )
+	{
+		return( 1 );
+	}
+	result = libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf8_path(
+	          internal_volume,
+	          (uint8_t *) "\\$Extend\\$Quota",
+	          15,
+	          &mft_entry,
+	          &directory_entry,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-16 string.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve \\$Extend\\$Quota MFT and directory entry by path.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( utf16_string_length > (size_t) SSIZE_MAX )
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libfsntfs_directory_entry_free(
+	     &directory_entry,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free directory entry.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( mft_entry == NULL )
+	if( libfsntfs_quota_index_initialize(
+	     &quota_index,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid MFT entry.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create quota index.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( directory_entry == NULL )
+	result = libfsntfs_quota_index_read(
+	          quota_index,
+	          internal_volume->io_handle,
+	          internal_volume->file_io_handle,
+	          mft_entry,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory entry.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read quota index.",
 		 function );
 
-		return( -1 );
-	}
-	if( utf16_string_length > 0 )
-	{
-		/* Ignore a leading separator
-		 */
-		if( utf16_string[ utf16_string_index ] == (uint16_t) LIBFSNTFS_SEPARATOR )
-		{
-			utf16_string_index++;
-		}
+		goto on_error;
 	}
-	if( libfsntfs_file_system_get_mft_entry_by_index(
-	     internal_volume->file_system,
-	     internal_volume->file_io_handle,
-	     LIBFSNTFS_MFT_ENTRY_INDEX_ROOT_DIRECTORY,
-	     mft_entry,
+	if( libfsntfs_mft_entry_free(
+	     &mft_entry,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve MFT entry: 5.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release MFT entry.",
 		 function );
 
-		goto on_error;
-	}
-	if( ( utf16_string_length == 0 )
-	 || ( utf16_string_length == 1 ) )
-	{
-		result = 1;
-	}
-	else while( utf16_string_index < utf16_string_length )
-	{
-		if( directory_entries_tree != NULL )
-		{
-			if( libfsntfs_directory_entries_tree_free(
-			     &directory_entries_tree,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free directory entries tree.",
-				 function );
-
-				goto on_error;
-			}
-		}
-		if( libfsntfs_directory_entries_tree_initialize(
-		     &directory_entries_tree,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create directory entries tree.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfsntfs_directory_entries_tree_read_from_i30_index(
-		     directory_entries_tree,
-		     internal_volume->io_handle,
-		     internal_volume->file_io_handle,
-		     *mft_entry,
-		     0,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read directory entries tree from MFT entry: %" PRIu64 ".",
-			 function,
-			 mft_entry_index );
-
-			goto on_error;
-		}
-		utf16_string_segment        = &( utf16_string[ utf16_string_index ] );
-		utf16_string_segment_length = utf16_string_index;
-
-		while( utf16_string_index < utf16_string_length )
-		{
-			if( libuna_unicode_character_copy_from_utf16(
-			     &unicode_character,
-			     utf16_string,
-			     utf16_string_length,
-			     &utf16_string_index,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy UTF-16 string to Unicode character.",
-				 function );
-
-				goto on_error;
-			}
-			if( ( unicode_character == (libuna_unicode_character_t) LIBFSNTFS_SEPARATOR )
-			 || ( unicode_character == 0 ) )
-			{
-				utf16_string_segment_length += 1;
-
-				break;
-			}
-		}
-		utf16_string_segment_length = utf16_string_index - utf16_string_segment_length;
-
-		if( utf16_string_segment_length == 0 )
-		{
-			result = 0;
-		}
-		else
-		{
-			if( safe_directory_entry != NULL )
-			{
-				if( libfsntfs_directory_entry_free(
-				     &safe_directory_entry,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-					 "%s: unable to free directory entry.",
-					 function );
-
-					goto on_error;
-				}
-			}
-			result = libfsntfs_directory_entries_tree_get_entry_by_utf16_name(
-			          directory_entries_tree,
-			          internal_volume->file_io_handle,
-			          utf16_string_segment,
-			          utf16_string_segment_length,
-			          &safe_directory_entry,
-			          error );
-		}
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve directory entry by UTF-16 name.",
-			 function );
-
-			goto on_error;
-		}
-		else if( result == 0 )
-		{
-			break;
-		}
-		if( libfsntfs_directory_entry_get_mft_entry_index(
-		     safe_directory_entry,
-		     &mft_entry_index,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve MFT entry index.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfsntfs_file_system_get_mft_entry_by_index(
-		     internal_volume->file_system,
-		     internal_volume->file_io_handle,
-		     mft_entry_index,
-		     mft_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve MFT entry: %" PRIu64 ".",
-			 function,
-			 mft_entry_index );
-
-			goto on_error;
-		}
-	}
-	if( result != 0 )
-	{
-		*directory_entry = safe_directory_entry;
-	}
-	else if( safe_directory_entry != NULL )
-	{
-		if( libfsntfs_directory_entry_free(
-		     &safe_directory_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free directory entry.",
-			 function );
-
-			goto on_error;
-		}
+		goto on_error;
 	}
-	if( directory_entries_tree != NULL )
+	if( result == 0 )
 	{
-		if( libfsntfs_directory_entries_tree_free(
-		     &directory_entries_tree,
+		if( libfsntfs_quota_index_free(
+		     &quota_index,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free directory entries tree.",
+			 "%s: unable to free quota index.",
 			 function );
 
 			goto on_error;
 		}
+		return( 0 );
 	}
-	return( result );
+	internal_volume->quota_index = quota_index;
+
+	return( 1 );
 
 on_error:
-	if( safe_directory_entry != NULL )
+	if( quota_index != NULL )
+	{
+		libfsntfs_quota_index_free(
+		 &quota_index,
+		 NULL );
+	}
+	if( directory_entry != NULL )
 	{
 		libfsntfs_directory_entry_free(
-		 &safe_directory_entry,
+		 &directory_entry,
 		 NULL );
 	}
-	if( directory_entries_tree != NULL )
+	if( mft_entry != NULL )
 	{
-		libfsntfs_directory_entries_tree_free(
-		 &directory_entries_tree,
+		libfsntfs_mft_entry_free(
+		 &mft_entry,
 		 NULL );
 	}
-	*directory_entry = NULL;
-
 	return( -1 );
 }
 
-/* Retrieves the file entry for an UTF-16 encoded path
- * Returns 1 if successful, 0 if no such file entry or -1 on error
+/* Retrieves the quota owner identifier for a specific SID
+ * Returns 1 if successful, 0 if no such SID or -1 on error
  */
-int libfsntfs_volume_get_file_entry_by_utf16_path(
+int libfsntfs_volume_get_quota_owner_identifier_by_sid(
      libfsntfs_volume_t *volume,
-     const uint16_t *utf16_string,
-     size_t utf16_string_length,
-     libfsntfs_file_entry_t **file_entry,
+     const uint8_t *sid_data,
+     size_t sid_data_size,
+     uint32_t *owner_identifier,
      libcerror_error_t **error )
 {
-	libfsntfs_directory_entry_t *directory_entry = NULL;
 	libfsntfs_internal_volume_t *internal_volume = NULL;
-	libfsntfs_mft_entry_t *mft_entry             = NULL;
-	static char *function                        = "libfsntfs_volume_get_file_entry_by_utf16_path";
+	static char *function                        = "libfsntfs_volume_get_quota_owner_identifier_by_sid";
 	int result                                   = 0;
 
 	if( volume == NULL )
@@ -3434,24 +6381,36 @@ int libfsntfs_volume_get_file_entry_by_utf16_path(
 	}
 	internal_volume = (libfsntfs_internal_volume_t *) volume;
 
-	if( file_entry == NULL )
+	if( sid_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file entry.",
+		 "%s: invalid SID data.",
 		 function );
 
 		return( -1 );
 	}
-	if( *file_entry != NULL )
+	if( ( sid_data_size < 8 )
+	 || ( sid_data_size > (size_t) SSIZE_MAX ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file entry value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid SID data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( owner_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid owner identifier.",
 		 function );
 
 		return( -1 );
@@ -3471,48 +6430,37 @@ int libfsntfs_volume_get_file_entry_by_utf16_path(
 		return( -1 );
 	}
 #endif
-	result = libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf16_path(
+	result = libfsntfs_internal_volume_read_quota_index(
 	          internal_volume,
-	          utf16_string,
-	          utf16_string_length,
-	          &mft_entry,
-	          &directory_entry,
 	          error );
 
 	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve MFT and directory entry by path.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read quota index.",
 		 function );
-
-		goto on_error;
 	}
 	else if( result != 0 )
 	{
-		/* file_entry takes over management of directory_entry
-		 */
-		if( libfsntfs_file_entry_initialize(
-		     file_entry,
-		     internal_volume->io_handle,
-		     internal_volume->file_io_handle,
-		     internal_volume->file_system,
-		     (uint64_t) mft_entry->index,
-		     directory_entry,
-		     0,
-		     error ) != 1 )
+		result = libfsntfs_quota_index_get_owner_identifier_by_sid(
+		          internal_volume->quota_index,
+		          internal_volume->file_io_handle,
+		          sid_data,
+		          sid_data_size,
+		          owner_identifier,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create file entry with MFT entry: %" PRIu32 ".",
-			 function,
-			 mft_entry->index );
-
-			goto on_error;
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve owner identifier by SID.",
+			 function );
 		}
 	}
 #if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
@@ -3531,33 +6479,22 @@ int libfsntfs_volume_get_file_entry_by_utf16_path(
 	}
 #endif
 	return( result );
-
-on_error:
-	if( directory_entry != NULL )
-	{
-		libfsntfs_directory_entry_free(
-		 &directory_entry,
-		 NULL );
-	}
-#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
-	libcthreads_read_write_lock_release_for_write(
-	 internal_volume->read_write_lock,
-	 NULL );
-#endif
-	return( -1 );
 }
 
-/* Retrieves the root directory file entry
- * Returns 1 if successful or -1 on error
+/* Retrieves the quota usage and limits for a specific owner identifier
+ * Returns 1 if successful, 0 if no such owner identifier or -1 on error
  */
-int libfsntfs_volume_get_root_directory(
+int libfsntfs_volume_get_quota_by_owner_identifier(
      libfsntfs_volume_t *volume,
-     libfsntfs_file_entry_t **file_entry,
+     uint32_t owner_identifier,
+     uint64_t *bytes_used,
+     uint64_t *warning_limit,
+     uint64_t *hard_limit,
      libcerror_error_t **error )
 {
 	libfsntfs_internal_volume_t *internal_volume = NULL;
-	static char *function                        = "libfsntfs_volume_get_root_directory";
-	int result                                   = 1;
+	static char *function                        = "libfsntfs_volume_get_quota_by_owner_identifier";
+	int result                                   = 0;
 
 	if( volume == NULL )
 	{
@@ -3572,109 +6509,39 @@ int libfsntfs_volume_get_root_directory(
 	}
 	internal_volume = (libfsntfs_internal_volume_t *) volume;
 
-	if( file_entry == NULL )
+	if( bytes_used == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file entry.",
-		 function );
-
-		return( -1 );
-	}
-	if( *file_entry != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file entry value already set.",
-		 function );
-
-		return( -1 );
-	}
-#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: invalid bytes used.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	if( libfsntfs_file_entry_initialize(
-	     file_entry,
-	     internal_volume->io_handle,
-	     internal_volume->file_io_handle,
-	     internal_volume->file_system,
-	     LIBFSNTFS_MFT_ENTRY_INDEX_ROOT_DIRECTORY,
-	     NULL,
-	     0,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file entry from MFT entry: %d.",
-		 function,
-		 LIBFSNTFS_MFT_ENTRY_INDEX_ROOT_DIRECTORY );
-
-		result = -1;
-	}
-#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+	if( warning_limit == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid warning limit.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	return( result );
-}
-
-/* Retrieves the USN change journal
- * Returns 1 if successful, 0 if not available or -1 on error
- */
-int libfsntfs_volume_get_usn_change_journal(
-     libfsntfs_volume_t *volume,
-     libfsntfs_usn_change_journal_t **usn_change_journal,
-     libcerror_error_t **error )
-{
-	libfsntfs_directory_entry_t *directory_entry = NULL;
-	libfsntfs_internal_volume_t *internal_volume = NULL;
-	libfsntfs_mft_attribute_t *data_attribute    = NULL;
-	libfsntfs_mft_entry_t *mft_entry             = NULL;
-	static char *function                        = "libfsntfs_volume_get_usn_change_journal";
-	int result                                   = 0;
-
-	if( volume == NULL )
+	if( hard_limit == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid volume.",
+		 "%s: invalid hard limit.",
 		 function );
 
 		return( -1 );
 	}
-	internal_volume = (libfsntfs_internal_volume_t *) volume;
-
 #if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_volume->read_write_lock,
@@ -3690,32 +6557,28 @@ int libfsntfs_volume_get_usn_change_journal(
 		return( -1 );
 	}
 #endif
-	result = libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf8_path(
+	result = libfsntfs_internal_volume_read_quota_index(
 	          internal_volume,
-	          (uint8_t *) "\\$Extend\\$UsnJrnl",
-	          17,
-	          &mft_entry,
-	          &directory_entry,
 	          error );
 
 	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve \\$Extend\\$UsnJrnl MFT and directory entry by path.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read quota index.",
 		 function );
-
-		goto on_error;
 	}
 	else if( result != 0 )
 	{
-		result = libfsntfs_mft_entry_get_alternate_data_attribute_by_utf8_name(
-		          mft_entry,
-		          (uint8_t *) "$J",
-		          2,
-		          &data_attribute,
+		result = libfsntfs_quota_index_get_quota_by_owner_identifier(
+		          internal_volume->quota_index,
+		          internal_volume->file_io_handle,
+		          owner_identifier,
+		          bytes_used,
+		          warning_limit,
+		          hard_limit,
 		          error );
 
 		if( result == -1 )
@@ -3724,48 +6587,9 @@ int libfsntfs_volume_get_usn_change_journal(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve $J data attribute.",
-			 function );
-
-			goto on_error;
-		}
-		else if( result != 0 )
-		{
-			/* libfsntfs_usn_change_journal_initialize takes over management of directory_entry
-			 */
-			if( libfsntfs_usn_change_journal_initialize(
-			     usn_change_journal,
-			     internal_volume->io_handle,
-			     internal_volume->file_io_handle,
-			     directory_entry,
-			     data_attribute,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create USN change journal.",
-				 function );
-
-				goto on_error;
-			}
-		}
-		else
-		{
-			if( libfsntfs_directory_entry_free(
-			     &directory_entry,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free directory entry.",
-				 function );
-
-				goto on_error;
-			}
+			 "%s: unable to retrieve quota by owner identifier: %" PRIu32 ".",
+			 function,
+			 owner_identifier );
 		}
 	}
 #if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
@@ -3784,19 +6608,5 @@ int libfsntfs_volume_get_usn_change_journal(
 	}
 #endif
 	return( result );
-
-on_error:
-	if( directory_entry != NULL )
-	{
-		libfsntfs_directory_entry_free(
-		 &directory_entry,
-		 NULL );
-	}
-#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
-	libcthreads_read_write_lock_release_for_write(
-	 internal_volume->read_write_lock,
-	 NULL );
-#endif
-	return( -1 );
 }
 
@@ -34,6 +34,10 @@
 #include "libfsntfs_libcthreads.h"
 #include "libfsntfs_mft.h"
 #include "libfsntfs_mft_entry.h"
+#include "libfsntfs_name_index.h"
+#include "libfsntfs_object_identifier_index.h"
+#include "libfsntfs_quota_index.h"
+#include "libfsntfs_reparse_point_index.h"
 #include "libfsntfs_types.h"
 #include "libfsntfs_volume_header.h"
 
@@ -89,6 +93,22 @@ struct libfsntfs_internal_volume
 	 */
 	libfsntfs_file_system_t *file_system;
 
+	/* The name index
+	 */
+	libfsntfs_name_index_t *name_index;
+
+	/* The object identifier index
+	 */
+	libfsntfs_object_identifier_index_t *object_identifier_index;
+
+	/* The reparse point index
+	 */
+	libfsntfs_reparse_point_index_t *reparse_point_index;
+
+	/* The quota index
+	 */
+	libfsntfs_quota_index_t *quota_index;
+
 #if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
 	/* The read/write lock
 	 */
@@ -136,6 +156,12 @@ int libfsntfs_volume_open_file_io_handle(
      int access_flags,
      libcerror_error_t **error );
 
+LIBFSNTFS_EXTERN \
+int libfsntfs_volume_clone(
+     libfsntfs_volume_t **destination_volume,
+     libfsntfs_volume_t *source_volume,
+     libcerror_error_t **error );
+
 LIBFSNTFS_EXTERN \
 int libfsntfs_volume_close(
      libfsntfs_volume_t *volume,
@@ -195,6 +221,60 @@ int libfsntfs_volume_get_index_entry_size(
      size32_t *index_entry_size,
      libcerror_error_t **error );
 
+LIBFSNTFS_EXTERN \
+int libfsntfs_volume_get_number_of_read_threads(
+     libfsntfs_volume_t *volume,
+     int *number_of_read_threads,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_volume_set_number_of_read_threads(
+     libfsntfs_volume_t *volume,
+     int number_of_read_threads,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_volume_get_statistics(
+     libfsntfs_volume_t *volume,
+     uint64_t *values,
+     int number_of_values,
+     libcerror_error_t **error );
+
+int libfsntfs_internal_volume_read_file_entries_data(
+     libfsntfs_internal_volume_t *internal_volume,
+     const uint64_t *mft_entry_indexes,
+     int number_of_mft_entry_indexes,
+     int (*callback_function)(
+            uint64_t mft_entry_index,
+            off64_t data_offset,
+            const uint8_t *data,
+            size_t data_size,
+            void *callback_data ),
+     int (*end_of_file_callback_function)(
+            uint64_t mft_entry_index,
+            size64_t data_size,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_volume_read_file_entries_data(
+     libfsntfs_volume_t *volume,
+     const uint64_t *mft_entry_indexes,
+     int number_of_mft_entry_indexes,
+     int (*callback_function)(
+            uint64_t mft_entry_index,
+            off64_t data_offset,
+            const uint8_t *data,
+            size_t data_size,
+            void *callback_data ),
+     int (*end_of_file_callback_function)(
+            uint64_t mft_entry_index,
+            size64_t data_size,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
 LIBFSNTFS_EXTERN \
 int libfsntfs_volume_get_utf8_name_size(
      libfsntfs_volume_t *volume,
@@ -291,6 +371,99 @@ int libfsntfs_volume_get_usn_change_journal(
      libfsntfs_usn_change_journal_t **usn_change_journal,
      libcerror_error_t **error );
 
+LIBFSNTFS_EXTERN \
+int libfsntfs_volume_get_changed_mft_entries(
+     libfsntfs_volume_t *volume,
+     uint64_t update_sequence_number,
+     int (*callback_function)(
+            uint64_t mft_entry_index,
+            void *callback_data ),
+     void *callback_data,
+     uint64_t *next_update_sequence_number,
+     libcerror_error_t **error );
+
+int libfsntfs_internal_volume_build_name_index(
+     libfsntfs_internal_volume_t *internal_volume,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_volume_build_name_index(
+     libfsntfs_volume_t *volume,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_volume_search_name_index_utf8(
+     libfsntfs_volume_t *volume,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int search_type,
+     uint64_t *file_references,
+     int maximum_number_of_file_references,
+     int *number_of_file_references,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_volume_search_name_index_utf16(
+     libfsntfs_volume_t *volume,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     int search_type,
+     uint64_t *file_references,
+     int maximum_number_of_file_references,
+     int *number_of_file_references,
+     libcerror_error_t **error );
+
+int libfsntfs_internal_volume_read_object_identifier_index(
+     libfsntfs_internal_volume_t *internal_volume,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_volume_get_file_entry_by_object_identifier(
+     libfsntfs_volume_t *volume,
+     const uint8_t *guid_data,
+     size_t guid_data_size,
+     libfsntfs_file_entry_t **file_entry,
+     libcerror_error_t **error );
+
+int libfsntfs_internal_volume_read_reparse_point_index(
+     libfsntfs_internal_volume_t *internal_volume,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_volume_get_number_of_reparse_points(
+     libfsntfs_volume_t *volume,
+     int *number_of_reparse_points,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_volume_get_reparse_point_by_index(
+     libfsntfs_volume_t *volume,
+     int reparse_point_index,
+     uint32_t *tag,
+     uint64_t *file_reference,
+     libcerror_error_t **error );
+
+int libfsntfs_internal_volume_read_quota_index(
+     libfsntfs_internal_volume_t *internal_volume,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_volume_get_quota_owner_identifier_by_sid(
+     libfsntfs_volume_t *volume,
+     const uint8_t *sid_data,
+     size_t sid_data_size,
+     uint32_t *owner_identifier,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_volume_get_quota_by_owner_identifier(
+     libfsntfs_volume_t *volume,
+     uint32_t owner_identifier,
+     uint64_t *bytes_used,
+     uint64_t *warning_limit,
+     uint64_t *hard_limit,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -52,6 +52,7 @@
 #include "pyfsntfs_usn_change_journal.h"
 #include "pyfsntfs_volume.h"
 #include "pyfsntfs_volume_file_entries.h"
+#include "pyfsntfs_volume_mft_records.h"
 #include "pyfsntfs_volume_information_attribute.h"
 #include "pyfsntfs_volume_name_attribute.h"
 
@@ -870,6 +871,23 @@ PyMODINIT_FUNC initpyfsntfs(
 	 "_volume_file_entries",
 	 (PyObject *) &pyfsntfs_volume_file_entries_type_object );
 
+	/* Setup the volume MFT records type object
+	 */
+	pyfsntfs_volume_mft_records_type_object.tp_new = PyType_GenericNew;
+
+	if( PyType_Ready(
+	     &pyfsntfs_volume_mft_records_type_object ) < 0 )
+	{
+		goto on_error;
+	}
+	Py_IncRef(
+	 (PyObject *) &pyfsntfs_volume_mft_records_type_object );
+
+	PyModule_AddObject(
+	 module,
+	 "_volume_mft_records",
+	 (PyObject *) &pyfsntfs_volume_mft_records_type_object );
+
 	/* Setup the $VOLUME_INFORMATION attribute type object
 	 */
 	pyfsntfs_volume_information_attribute_type_object.tp_new = PyType_GenericNew;
@@ -52,10 +52,26 @@ PyMethodDef pyfsntfs_data_stream_object_methods[] = {
 	  "\n"
 	  "Reads a buffer of data stream data at a specific offset." },
 
+	{ "readinto",
+	  (PyCFunction) pyfsntfs_data_stream_readinto,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "readinto(buffer) -> Integer\n"
+	  "\n"
+	  "Reads data stream data into a writable buffer, such as a bytearray or memoryview.\n"
+	  "Returns the number of bytes read." },
+
+	{ "readinto_at_offset",
+	  (PyCFunction) pyfsntfs_data_stream_readinto_at_offset,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "readinto_at_offset(buffer, offset) -> Integer\n"
+	  "\n"
+	  "Reads data stream data at a specific offset into a writable buffer, such as a bytearray or memoryview.\n"
+	  "Returns the number of bytes read." },
+
 	{ "seek_offset",
 	  (PyCFunction) pyfsntfs_data_stream_seek_offset,
 	  METH_VARARGS | METH_KEYWORDS,
-	  "seek_offset(offset, whence) -> None\n"
+	  "seek_offset(offset, whence) -> Integer\n"
 	  "\n"
 	  "Seeks an offset within the data stream data." },
 
@@ -75,10 +91,45 @@ PyMethodDef pyfsntfs_data_stream_object_methods[] = {
 	  "\n"
 	  "Reads a buffer of data stream data." },
 
+	{ "readall",
+	  (PyCFunction) pyfsntfs_data_stream_read_buffer,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "readall() -> String\n"
+	  "\n"
+	  "Reads the remaining data stream data." },
+
+	{ "readable",
+	  (PyCFunction) pyfsntfs_data_stream_readable,
+	  METH_NOARGS,
+	  "readable() -> Boolean\n"
+	  "\n"
+	  "Determines if the data stream data is readable." },
+
+	{ "seekable",
+	  (PyCFunction) pyfsntfs_data_stream_seekable,
+	  METH_NOARGS,
+	  "seekable() -> Boolean\n"
+	  "\n"
+	  "Determines if the data stream data is seekable." },
+
+	{ "writable",
+	  (PyCFunction) pyfsntfs_data_stream_writable,
+	  METH_NOARGS,
+	  "writable() -> Boolean\n"
+	  "\n"
+	  "Determines if the data stream data is writable." },
+
+	{ "close",
+	  (PyCFunction) pyfsntfs_data_stream_close,
+	  METH_NOARGS,
+	  "close() -> None\n"
+	  "\n"
+	  "Closes the data stream data." },
+
 	{ "seek",
 	  (PyCFunction) pyfsntfs_data_stream_seek_offset,
 	  METH_VARARGS | METH_KEYWORDS,
-	  "seek(offset, whence) -> None\n"
+	  "seek(offset, whence) -> Integer\n"
 	  "\n"
 	  "Seeks an offset within the data stream data." },
 
@@ -128,6 +179,12 @@ PyMethodDef pyfsntfs_data_stream_object_methods[] = {
 
 PyGetSetDef pyfsntfs_data_stream_object_get_set_definitions[] = {
 
+	{ "closed",
+	  (getter) pyfsntfs_data_stream_get_closed,
+	  (setter) 0,
+	  "Value to indicate the data stream data is closed.",
+	  NULL },
+
 	{ "size",
 	  (getter) pyfsntfs_data_stream_get_size,
 	  (setter) 0,
@@ -841,6 +898,177 @@ PyObject *pyfsntfs_data_stream_read_buffer_at_offset(
 	return( string_object );
 }
 
+/* Reads data from the data stream into a writable buffer
+ * Returns a Python object holding the number of bytes read if successful or NULL on error
+ */
+PyObject *pyfsntfs_data_stream_readinto(
+           pyfsntfs_data_stream_t *pyfsntfs_data_stream,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	Py_buffer buffer;
+
+	libcerror_error_t *error    = NULL;
+	PyObject *buffer_object     = NULL;
+	PyObject *integer_object    = NULL;
+	static char *function       = "pyfsntfs_data_stream_readinto";
+	static char *keyword_list[] = { "buffer", NULL };
+	ssize_t read_count          = 0;
+
+	if( pyfsntfs_data_stream == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid pyfsntfs data stream.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyfsntfs_data_stream->data_stream == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid pyfsntfs data stream - missing libfsntfs data stream.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "O",
+	     keyword_list,
+	     &buffer_object ) == 0 )
+	{
+		return( NULL );
+	}
+	if( PyObject_GetBuffer(
+	     buffer_object,
+	     &buffer,
+	     PyBUF_WRITABLE ) != 0 )
+	{
+		return( NULL );
+	}
+	/* The data is read directly into the memory of the buffer object
+	 */
+	Py_BEGIN_ALLOW_THREADS
+
+	read_count = libfsntfs_data_stream_read_buffer(
+	              pyfsntfs_data_stream->data_stream,
+	              (uint8_t *) buffer.buf,
+	              (size_t) buffer.len,
+	              &error );
+
+	Py_END_ALLOW_THREADS
+
+	PyBuffer_Release(
+	 &buffer );
+
+	if( read_count <= -1 )
+	{
+		pyfsntfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to read data.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	integer_object = pyfsntfs_integer_signed_new_from_64bit(
+	                  (int64_t) read_count );
+
+	return( integer_object );
+}
+
+/* Reads data at a specific offset from the data stream into a writable buffer
+ * Returns a Python object holding the number of bytes read if successful or NULL on error
+ */
+PyObject *pyfsntfs_data_stream_readinto_at_offset(
+           pyfsntfs_data_stream_t *pyfsntfs_data_stream,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	Py_buffer buffer;
+
+	libcerror_error_t *error    = NULL;
+	PyObject *buffer_object     = NULL;
+	PyObject *integer_object    = NULL;
+	static char *function       = "pyfsntfs_data_stream_readinto_at_offset";
+	static char *keyword_list[] = { "buffer", "offset", NULL };
+	off64_t read_offset         = 0;
+	ssize_t read_count          = 0;
+
+	if( pyfsntfs_data_stream == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid pyfsntfs data stream.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyfsntfs_data_stream->data_stream == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid pyfsntfs data stream - missing libfsntfs data stream.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "OL",
+	     keyword_list,
+	     &buffer_object,
+	     &read_offset ) == 0 )
+	{
+		return( NULL );
+	}
+	if( PyObject_GetBuffer(
+	     buffer_object,
+	     &buffer,
+	     PyBUF_WRITABLE ) != 0 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	read_count = libfsntfs_data_stream_read_buffer_at_offset(
+	              pyfsntfs_data_stream->data_stream,
+	              (uint8_t *) buffer.buf,
+	              (size_t) buffer.len,
+	              (off64_t) read_offset,
+	              &error );
+
+	Py_END_ALLOW_THREADS
+
+	PyBuffer_Release(
+	 &buffer );
+
+	if( read_count <= -1 )
+	{
+		pyfsntfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to read data.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	integer_object = pyfsntfs_integer_signed_new_from_64bit(
+	                  (int64_t) read_count );
+
+	return( integer_object );
+}
+
 /* Seeks a certain offset in the data stream data
  * Returns a Python object holding the offset if successful or NULL on error
  */
@@ -850,6 +1078,7 @@ PyObject *pyfsntfs_data_stream_seek_offset(
            PyObject *keywords )
 {
 	libcerror_error_t *error    = NULL;
+	PyObject *integer_object    = NULL;
 	static char *function       = "pyfsntfs_data_stream_seek_offset";
 	static char *keyword_list[] = { "offset", "whence", NULL };
 	off64_t offset              = 0;
@@ -906,10 +1135,10 @@ PyObject *pyfsntfs_data_stream_seek_offset(
 
 		return( NULL );
 	}
-	Py_IncRef(
-	 Py_None );
+	integer_object = pyfsntfs_integer_signed_new_from_64bit(
+	                  (int64_t) offset );
 
-	return( Py_None );
+	return( integer_object );
 }
 
 /* Retrieves the offset
@@ -964,6 +1193,145 @@ PyObject *pyfsntfs_data_stream_get_offset(
 	return( integer_object );
 }
 
+/* Determines if the data stream data is readable
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsntfs_data_stream_readable(
+           pyfsntfs_data_stream_t *pyfsntfs_data_stream,
+           PyObject *arguments PYFSNTFS_ATTRIBUTE_UNUSED )
+{
+	static char *function = "pyfsntfs_data_stream_readable";
+
+	PYFSNTFS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsntfs_data_stream == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid data stream.",
+		 function );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 (PyObject *) Py_True );
+
+	return( Py_True );
+}
+
+/* Determines if the data stream data is seekable
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsntfs_data_stream_seekable(
+           pyfsntfs_data_stream_t *pyfsntfs_data_stream,
+           PyObject *arguments PYFSNTFS_ATTRIBUTE_UNUSED )
+{
+	static char *function = "pyfsntfs_data_stream_seekable";
+
+	PYFSNTFS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsntfs_data_stream == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid data stream.",
+		 function );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 (PyObject *) Py_True );
+
+	return( Py_True );
+}
+
+/* Determines if the data stream data is writable
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsntfs_data_stream_writable(
+           pyfsntfs_data_stream_t *pyfsntfs_data_stream,
+           PyObject *arguments PYFSNTFS_ATTRIBUTE_UNUSED )
+{
+	static char *function = "pyfsntfs_data_stream_writable";
+
+	PYFSNTFS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsntfs_data_stream == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid data stream.",
+		 function );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 (PyObject *) Py_False );
+
+	return( Py_False );
+}
+
+/* Closes the data stream data
+ * The libfsntfs data stream is freed together with the Python object,
+ * hence this function only exists for io.RawIOBase compatibility
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsntfs_data_stream_close(
+           pyfsntfs_data_stream_t *pyfsntfs_data_stream,
+           PyObject *arguments PYFSNTFS_ATTRIBUTE_UNUSED )
+{
+	static char *function = "pyfsntfs_data_stream_close";
+
+	PYFSNTFS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsntfs_data_stream == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid data stream.",
+		 function );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
+/* Determines if the data stream data is closed
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsntfs_data_stream_get_closed(
+           pyfsntfs_data_stream_t *pyfsntfs_data_stream,
+           PyObject *arguments PYFSNTFS_ATTRIBUTE_UNUSED )
+{
+	static char *function = "pyfsntfs_data_stream_get_closed";
+
+	PYFSNTFS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsntfs_data_stream == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid data stream.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyfsntfs_data_stream->data_stream == NULL )
+	{
+		Py_IncRef(
+		 (PyObject *) Py_True );
+
+		return( Py_True );
+	}
+	Py_IncRef(
+	 (PyObject *) Py_False );
+
+	return( Py_False );
+}
+
 /* Retrieves the size
  * Returns a Python object if successful or NULL on error
  */
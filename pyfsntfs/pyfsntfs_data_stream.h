@@ -72,6 +72,16 @@ PyObject *pyfsntfs_data_stream_read_buffer_at_offset(
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pyfsntfs_data_stream_readinto(
+           pyfsntfs_data_stream_t *pyfsntfs_data_stream,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyfsntfs_data_stream_readinto_at_offset(
+           pyfsntfs_data_stream_t *pyfsntfs_data_stream,
+           PyObject *arguments,
+           PyObject *keywords );
+
 PyObject *pyfsntfs_data_stream_seek_offset(
            pyfsntfs_data_stream_t *pyfsntfs_data_stream,
            PyObject *arguments,
@@ -81,6 +91,26 @@ PyObject *pyfsntfs_data_stream_get_offset(
            pyfsntfs_data_stream_t *pyfsntfs_data_stream,
            PyObject *arguments );
 
+PyObject *pyfsntfs_data_stream_readable(
+           pyfsntfs_data_stream_t *pyfsntfs_data_stream,
+           PyObject *arguments );
+
+PyObject *pyfsntfs_data_stream_seekable(
+           pyfsntfs_data_stream_t *pyfsntfs_data_stream,
+           PyObject *arguments );
+
+PyObject *pyfsntfs_data_stream_writable(
+           pyfsntfs_data_stream_t *pyfsntfs_data_stream,
+           PyObject *arguments );
+
+PyObject *pyfsntfs_data_stream_close(
+           pyfsntfs_data_stream_t *pyfsntfs_data_stream,
+           PyObject *arguments );
+
+PyObject *pyfsntfs_data_stream_get_closed(
+           pyfsntfs_data_stream_t *pyfsntfs_data_stream,
+           PyObject *arguments );
+
 PyObject *pyfsntfs_data_stream_get_size(
            pyfsntfs_data_stream_t *pyfsntfs_data_stream,
            PyObject *arguments );
@@ -66,10 +66,26 @@ PyMethodDef pyfsntfs_file_entry_object_methods[] = {
 	  "\n"
 	  "Reads a buffer of file entry data at a specific offset." },
 
+	{ "readinto",
+	  (PyCFunction) pyfsntfs_file_entry_readinto,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "readinto(buffer) -> Integer\n"
+	  "\n"
+	  "Reads file entry data into a writable buffer, such as a bytearray or memoryview.\n"
+	  "Returns the number of bytes read." },
+
+	{ "readinto_at_offset",
+	  (PyCFunction) pyfsntfs_file_entry_readinto_at_offset,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "readinto_at_offset(buffer, offset) -> Integer\n"
+	  "\n"
+	  "Reads file entry data at a specific offset into a writable buffer, such as a bytearray or memoryview.\n"
+	  "Returns the number of bytes read." },
+
 	{ "seek_offset",
 	  (PyCFunction) pyfsntfs_file_entry_seek_offset,
 	  METH_VARARGS | METH_KEYWORDS,
-	  "seek_offset(offset, whence) -> None\n"
+	  "seek_offset(offset, whence) -> Integer\n"
 	  "\n"
 	  "Seeks an offset within the file entry data." },
 
@@ -89,10 +105,45 @@ PyMethodDef pyfsntfs_file_entry_object_methods[] = {
 	  "\n"
 	  "Reads a buffer of file entry data." },
 
+	{ "readall",
+	  (PyCFunction) pyfsntfs_file_entry_read_buffer,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "readall() -> String\n"
+	  "\n"
+	  "Reads the remaining file entry data." },
+
+	{ "readable",
+	  (PyCFunction) pyfsntfs_file_entry_readable,
+	  METH_NOARGS,
+	  "readable() -> Boolean\n"
+	  "\n"
+	  "Determines if the file entry data is readable." },
+
+	{ "seekable",
+	  (PyCFunction) pyfsntfs_file_entry_seekable,
+	  METH_NOARGS,
+	  "seekable() -> Boolean\n"
+	  "\n"
+	  "Determines if the file entry data is seekable." },
+
+	{ "writable",
+	  (PyCFunction) pyfsntfs_file_entry_writable,
+	  METH_NOARGS,
+	  "writable() -> Boolean\n"
+	  "\n"
+	  "Determines if the file entry data is writable." },
+
+	{ "close",
+	  (PyCFunction) pyfsntfs_file_entry_close,
+	  METH_NOARGS,
+	  "close() -> None\n"
+	  "\n"
+	  "Closes the file entry data." },
+
 	{ "seek",
 	  (PyCFunction) pyfsntfs_file_entry_seek_offset,
 	  METH_VARARGS | METH_KEYWORDS,
-	  "seek(offset, whence) -> None\n"
+	  "seek(offset, whence) -> Integer\n"
 	  "\n"
 	  "Seeks an offset within the file entry data." },
 
@@ -367,6 +418,12 @@ PyMethodDef pyfsntfs_file_entry_object_methods[] = {
 
 PyGetSetDef pyfsntfs_file_entry_object_get_set_definitions[] = {
 
+	{ "closed",
+	  (getter) pyfsntfs_file_entry_get_closed,
+	  (setter) 0,
+	  "Value to indicate the file entry data is closed.",
+	  NULL },
+
 	{ "size",
 	  (getter) pyfsntfs_file_entry_get_size,
 	  (setter) 0,
@@ -1252,6 +1309,239 @@ PyObject *pyfsntfs_file_entry_read_buffer_at_offset(
 	return( string_object );
 }
 
+/* Reads data from the file entry into a writable buffer
+ * Returns a Python object holding the number of bytes read if successful or NULL on error
+ */
+PyObject *pyfsntfs_file_entry_readinto(
+           pyfsntfs_file_entry_t *pyfsntfs_file_entry,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	Py_buffer buffer;
+
+	libcerror_error_t *error    = NULL;
+	PyObject *buffer_object     = NULL;
+	PyObject *integer_object    = NULL;
+	static char *function       = "pyfsntfs_file_entry_readinto";
+	static char *keyword_list[] = { "buffer", NULL };
+	ssize_t read_count          = 0;
+	int result                  = 0;
+
+	if( pyfsntfs_file_entry == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid pyfsntfs file entry.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyfsntfs_file_entry->file_entry == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid pyfsntfs file entry - missing libfsntfs file entry.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "O",
+	     keyword_list,
+	     &buffer_object ) == 0 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfsntfs_file_entry_has_default_data_stream(
+	          pyfsntfs_file_entry->file_entry,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result == -1 )
+	{
+		pyfsntfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to determine if file entry has default data stream.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	else if( result == 0 )
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: missing default data stream.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyObject_GetBuffer(
+	     buffer_object,
+	     &buffer,
+	     PyBUF_WRITABLE ) != 0 )
+	{
+		return( NULL );
+	}
+	/* The data is read directly into the memory of the buffer object
+	 */
+	Py_BEGIN_ALLOW_THREADS
+
+	read_count = libfsntfs_file_entry_read_buffer(
+	              pyfsntfs_file_entry->file_entry,
+	              (uint8_t *) buffer.buf,
+	              (size_t) buffer.len,
+	              &error );
+
+	Py_END_ALLOW_THREADS
+
+	PyBuffer_Release(
+	 &buffer );
+
+	if( read_count <= -1 )
+	{
+		pyfsntfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to read data.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	integer_object = pyfsntfs_integer_signed_new_from_64bit(
+	                  (int64_t) read_count );
+
+	return( integer_object );
+}
+
+/* Reads data at a specific offset from the file entry into a writable buffer
+ * Returns a Python object holding the number of bytes read if successful or NULL on error
+ */
+PyObject *pyfsntfs_file_entry_readinto_at_offset(
+           pyfsntfs_file_entry_t *pyfsntfs_file_entry,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	Py_buffer buffer;
+
+	libcerror_error_t *error    = NULL;
+	PyObject *buffer_object     = NULL;
+	PyObject *integer_object    = NULL;
+	static char *function       = "pyfsntfs_file_entry_readinto_at_offset";
+	static char *keyword_list[] = { "buffer", "offset", NULL };
+	off64_t read_offset         = 0;
+	ssize_t read_count          = 0;
+	int result                  = 0;
+
+	if( pyfsntfs_file_entry == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid pyfsntfs file entry.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyfsntfs_file_entry->file_entry == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid pyfsntfs file entry - missing libfsntfs file entry.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "OL",
+	     keyword_list,
+	     &buffer_object,
+	     &read_offset ) == 0 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfsntfs_file_entry_has_default_data_stream(
+	          pyfsntfs_file_entry->file_entry,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result == -1 )
+	{
+		pyfsntfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to determine if file entry has default data stream.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	else if( result == 0 )
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: missing default data stream.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyObject_GetBuffer(
+	     buffer_object,
+	     &buffer,
+	     PyBUF_WRITABLE ) != 0 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	read_count = libfsntfs_file_entry_read_buffer_at_offset(
+	              pyfsntfs_file_entry->file_entry,
+	              (uint8_t *) buffer.buf,
+	              (size_t) buffer.len,
+	              (off64_t) read_offset,
+	              &error );
+
+	Py_END_ALLOW_THREADS
+
+	PyBuffer_Release(
+	 &buffer );
+
+	if( read_count <= -1 )
+	{
+		pyfsntfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to read data.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	integer_object = pyfsntfs_integer_signed_new_from_64bit(
+	                  (int64_t) read_count );
+
+	return( integer_object );
+}
+
 /* Seeks a certain offset in the file entry data
  * Returns a Python object holding the offset if successful or NULL on error
  */
@@ -1261,6 +1551,7 @@ PyObject *pyfsntfs_file_entry_seek_offset(
            PyObject *keywords )
 {
 	libcerror_error_t *error    = NULL;
+	PyObject *integer_object    = NULL;
 	static char *function       = "pyfsntfs_file_entry_seek_offset";
 	static char *keyword_list[] = { "offset", "whence", NULL };
 	off64_t offset              = 0;
@@ -1348,10 +1639,10 @@ PyObject *pyfsntfs_file_entry_seek_offset(
 
 		return( NULL );
 	}
-	Py_IncRef(
-	 Py_None );
+	integer_object = pyfsntfs_integer_signed_new_from_64bit(
+	                  (int64_t) offset );
 
-	return( Py_None );
+	return( integer_object );
 }
 
 /* Retrieves the offset
@@ -1436,6 +1727,145 @@ PyObject *pyfsntfs_file_entry_get_offset(
 	return( integer_object );
 }
 
+/* Determines if the file entry data is readable
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsntfs_file_entry_readable(
+           pyfsntfs_file_entry_t *pyfsntfs_file_entry,
+           PyObject *arguments PYFSNTFS_ATTRIBUTE_UNUSED )
+{
+	static char *function = "pyfsntfs_file_entry_readable";
+
+	PYFSNTFS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsntfs_file_entry == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 (PyObject *) Py_True );
+
+	return( Py_True );
+}
+
+/* Determines if the file entry data is seekable
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsntfs_file_entry_seekable(
+           pyfsntfs_file_entry_t *pyfsntfs_file_entry,
+           PyObject *arguments PYFSNTFS_ATTRIBUTE_UNUSED )
+{
+	static char *function = "pyfsntfs_file_entry_seekable";
+
+	PYFSNTFS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsntfs_file_entry == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 (PyObject *) Py_True );
+
+	return( Py_True );
+}
+
+/* Determines if the file entry data is writable
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsntfs_file_entry_writable(
+           pyfsntfs_file_entry_t *pyfsntfs_file_entry,
+           PyObject *arguments PYFSNTFS_ATTRIBUTE_UNUSED )
+{
+	static char *function = "pyfsntfs_file_entry_writable";
+
+	PYFSNTFS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsntfs_file_entry == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 (PyObject *) Py_False );
+
+	return( Py_False );
+}
+
+/* Closes the file entry data
+ * The libfsntfs file entry is freed together with the Python object,
+ * hence this function only exists for io.RawIOBase compatibility
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsntfs_file_entry_close(
+           pyfsntfs_file_entry_t *pyfsntfs_file_entry,
+           PyObject *arguments PYFSNTFS_ATTRIBUTE_UNUSED )
+{
+	static char *function = "pyfsntfs_file_entry_close";
+
+	PYFSNTFS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsntfs_file_entry == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
+/* Determines if the file entry data is closed
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsntfs_file_entry_get_closed(
+           pyfsntfs_file_entry_t *pyfsntfs_file_entry,
+           PyObject *arguments PYFSNTFS_ATTRIBUTE_UNUSED )
+{
+	static char *function = "pyfsntfs_file_entry_get_closed";
+
+	PYFSNTFS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsntfs_file_entry == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyfsntfs_file_entry->file_entry == NULL )
+	{
+		Py_IncRef(
+		 (PyObject *) Py_True );
+
+		return( Py_True );
+	}
+	Py_IncRef(
+	 (PyObject *) Py_False );
+
+	return( Py_False );
+}
+
 /* Retrieves the size
  * Returns a Python object if successful or NULL on error
  */
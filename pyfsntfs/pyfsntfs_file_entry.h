@@ -73,6 +73,16 @@ PyObject *pyfsntfs_file_entry_read_buffer_at_offset(
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pyfsntfs_file_entry_readinto(
+           pyfsntfs_file_entry_t *pyfsntfs_file_entry,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyfsntfs_file_entry_readinto_at_offset(
+           pyfsntfs_file_entry_t *pyfsntfs_file_entry,
+           PyObject *arguments,
+           PyObject *keywords );
+
 PyObject *pyfsntfs_file_entry_seek_offset(
            pyfsntfs_file_entry_t *pyfsntfs_file_entry,
            PyObject *arguments,
@@ -82,6 +92,26 @@ PyObject *pyfsntfs_file_entry_get_offset(
            pyfsntfs_file_entry_t *pyfsntfs_file_entry,
            PyObject *arguments );
 
+PyObject *pyfsntfs_file_entry_readable(
+           pyfsntfs_file_entry_t *pyfsntfs_file_entry,
+           PyObject *arguments );
+
+PyObject *pyfsntfs_file_entry_seekable(
+           pyfsntfs_file_entry_t *pyfsntfs_file_entry,
+           PyObject *arguments );
+
+PyObject *pyfsntfs_file_entry_writable(
+           pyfsntfs_file_entry_t *pyfsntfs_file_entry,
+           PyObject *arguments );
+
+PyObject *pyfsntfs_file_entry_close(
+           pyfsntfs_file_entry_t *pyfsntfs_file_entry,
+           PyObject *arguments );
+
+PyObject *pyfsntfs_file_entry_get_closed(
+           pyfsntfs_file_entry_t *pyfsntfs_file_entry,
+           PyObject *arguments );
+
 PyObject *pyfsntfs_file_entry_get_size(
            pyfsntfs_file_entry_t *pyfsntfs_file_entry,
            PyObject *arguments );
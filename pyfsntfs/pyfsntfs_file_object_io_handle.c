@@ -244,6 +244,8 @@ int pyfsntfs_file_object_io_handle_free(
 }
 
 /* Clones (duplicates) the file object IO handle and its attributes
+ * Cloning is not supported since a clone would share the current offset of the file-like
+ * object and the GIL is released between the seek and the read of a clone
  * Returns 1 if succesful or -1 on error
  */
 int pyfsntfs_file_object_io_handle_clone(
@@ -281,32 +283,14 @@ int pyfsntfs_file_object_io_handle_clone(
 
 		return( 1 );
 	}
-	if( pyfsntfs_file_object_io_handle_initialize(
-	     destination_file_object_io_handle,
-	     source_file_object_io_handle->file_object,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file object IO handle.",
-		 function );
-
-		return( -1 );
-	}
-	if( *destination_file_object_io_handle == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing destination file object IO handle.",
-		 function );
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: unsupported clone of file object IO handle, the clone would share the offset of the file-like object.",
+	 function );
 
-		return( -1 );
-	}
-	return( 1 );
+	return( -1 );
 }
 
 /* Opens the file object IO handle
@@ -45,6 +45,20 @@ PyMethodDef pyfsntfs_usn_change_journal_object_methods[] = {
 	  "\n"
 	  "Returns the current offset within the USN change journal data." },
 
+	{ "get_size",
+	  (PyCFunction) pyfsntfs_usn_change_journal_get_size,
+	  METH_NOARGS,
+	  "get_size() -> Integer\n"
+	  "\n"
+	  "Returns the size of the USN change journal data, which corresponds to the next USN." },
+
+	{ "seek_usn",
+	  (PyCFunction) pyfsntfs_usn_change_journal_seek_usn,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "seek_usn(update_sequence_number) -> None\n"
+	  "\n"
+	  "Seeks the USN record with the update sequence number (USN)." },
+
 	{ "read_usn_record",
 	  (PyCFunction) pyfsntfs_usn_change_journal_read_usn_record,
 	  METH_NOARGS,
@@ -52,6 +66,13 @@ PyMethodDef pyfsntfs_usn_change_journal_object_methods[] = {
 	  "\n"
 	  "Reads USN record data." },
 
+	{ "read_previous_usn_record",
+	  (PyCFunction) pyfsntfs_usn_change_journal_read_previous_usn_record,
+	  METH_NOARGS,
+	  "read_previous_usn_record() -> String\n"
+	  "\n"
+	  "Reads the data of the USN record that precedes the current offset." },
+
 	/* Sentinel */
 	{ NULL, NULL, 0, NULL }
 };
@@ -362,6 +383,119 @@ PyObject *pyfsntfs_usn_change_journal_get_offset(
 	return( integer_object );
 }
 
+/* Retrieves the size
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsntfs_usn_change_journal_get_size(
+           pyfsntfs_usn_change_journal_t *pyfsntfs_usn_change_journal,
+           PyObject *arguments PYFSNTFS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	PyObject *integer_object = NULL;
+	static char *function    = "pyfsntfs_usn_change_journal_get_size";
+	size64_t size            = 0;
+	int result               = 0;
+
+	PYFSNTFS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsntfs_usn_change_journal == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid USN change journal.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfsntfs_usn_change_journal_get_size(
+	          pyfsntfs_usn_change_journal->usn_change_journal,
+	          &size,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfsntfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve size.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	integer_object = pyfsntfs_integer_unsigned_new_from_64bit(
+	                  (uint64_t) size );
+
+	return( integer_object );
+}
+
+/* Seeks the USN record with a specific update sequence number (USN)
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsntfs_usn_change_journal_seek_usn(
+           pyfsntfs_usn_change_journal_t *pyfsntfs_usn_change_journal,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	libcerror_error_t *error                  = NULL;
+	static char *function                     = "pyfsntfs_usn_change_journal_seek_usn";
+	static char *keyword_list[]               = { "update_sequence_number", NULL };
+	unsigned long long update_sequence_number = 0;
+	int result                                = 0;
+
+	if( pyfsntfs_usn_change_journal == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid USN change journal.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "K",
+	     keyword_list,
+	     &update_sequence_number ) == 0 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfsntfs_usn_change_journal_seek_usn(
+	          pyfsntfs_usn_change_journal->usn_change_journal,
+	          (uint64_t) update_sequence_number,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfsntfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to seek USN: %" PRIu64 ".",
+		 function,
+		 (uint64_t) update_sequence_number );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
 /* Reads an USN record
  * Returns a Python object holding the data if successful or NULL on error
  */
@@ -468,3 +602,99 @@ PyObject *pyfsntfs_usn_change_journal_read_usn_record(
 	return( string_object );
 }
 
+/* Reads the USN record that precedes the current offset
+ * Returns a Python object holding the data if successful or NULL on error
+ */
+PyObject *pyfsntfs_usn_change_journal_read_previous_usn_record(
+           pyfsntfs_usn_change_journal_t *pyfsntfs_usn_change_journal,
+           PyObject *arguments PYFSNTFS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error  = NULL;
+	PyObject *string_object   = NULL;
+	static char *function     = "pyfsntfs_usn_change_journal_read_previous_usn_record";
+	char *usn_record_data     = NULL;
+	size_t journal_block_size = 0x1000;
+	ssize_t read_count        = 0;
+
+	PYFSNTFS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsntfs_usn_change_journal == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid USN change journal.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyfsntfs_usn_change_journal->usn_change_journal == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid USN change journal - missing libfsntfs USN change journal.",
+		 function );
+
+		return( NULL );
+	}
+#if PY_MAJOR_VERSION >= 3
+	string_object = PyBytes_FromStringAndSize(
+	                 NULL,
+	                 journal_block_size );
+
+	usn_record_data = PyBytes_AsString(
+	                   string_object );
+#else
+	/* Note that a size of 0 is not supported
+	 */
+	string_object = PyString_FromStringAndSize(
+	                 NULL,
+	                 journal_block_size );
+
+	usn_record_data = PyString_AsString(
+	                   string_object );
+#endif
+	Py_BEGIN_ALLOW_THREADS
+
+	read_count = libfsntfs_usn_change_journal_read_previous_usn_record(
+	              pyfsntfs_usn_change_journal->usn_change_journal,
+	              (uint8_t *) usn_record_data,
+	              (size_t) journal_block_size,
+	              &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( read_count <= -1 )
+	{
+		pyfsntfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to read data.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		Py_DecRef(
+		 (PyObject *) string_object );
+
+		return( NULL );
+	}
+	/* Need to resize the string here in case journal_block_size was not fully read.
+	 */
+#if PY_MAJOR_VERSION >= 3
+	if( _PyBytes_Resize(
+	     &string_object,
+	     (Py_ssize_t) read_count ) != 0 )
+#else
+	if( _PyString_Resize(
+	     &string_object,
+	     (Py_ssize_t) read_count ) != 0 )
+#endif
+	{
+		Py_DecRef(
+		 (PyObject *) string_object );
+
+		return( NULL );
+	}
+	return( string_object );
+}
@@ -66,10 +66,23 @@ PyObject *pyfsntfs_usn_change_journal_get_offset(
            pyfsntfs_usn_change_journal_t *pyfsntfs_usn_change_journal,
            PyObject *arguments );
 
+PyObject *pyfsntfs_usn_change_journal_get_size(
+           pyfsntfs_usn_change_journal_t *pyfsntfs_usn_change_journal,
+           PyObject *arguments );
+
+PyObject *pyfsntfs_usn_change_journal_seek_usn(
+           pyfsntfs_usn_change_journal_t *pyfsntfs_usn_change_journal,
+           PyObject *arguments,
+           PyObject *keywords );
+
 PyObject *pyfsntfs_usn_change_journal_read_usn_record(
            pyfsntfs_usn_change_journal_t *pyfsntfs_usn_change_journal,
            PyObject *arguments );
 
+PyObject *pyfsntfs_usn_change_journal_read_previous_usn_record(
+           pyfsntfs_usn_change_journal_t *pyfsntfs_usn_change_journal,
+           PyObject *arguments );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -39,6 +39,7 @@
 #include "pyfsntfs_usn_change_journal.h"
 #include "pyfsntfs_volume.h"
 #include "pyfsntfs_volume_file_entries.h"
+#include "pyfsntfs_volume_mft_records.h"
 
 #if !defined( LIBFSNTFS_HAVE_BFIO )
 
@@ -83,6 +84,16 @@ PyMethodDef pyfsntfs_volume_object_methods[] = {
 	  "\n"
 	  "Closes a volume." },
 
+	{ "clone",
+	  (PyCFunction) pyfsntfs_volume_clone,
+	  METH_NOARGS,
+	  "clone() -> Object\n"
+	  "\n"
+	  "Clones an opened volume.\t"
+	  "The clone has its own file handle, caches and locks. Use a clone per thread to read\t"
+	  "a volume concurrently from multiple threads. Volumes opened using a file-like\t"
+	  "object cannot be cloned, since the clones would share the offset of that object." },
+
 	/* Functions to access the volume values */
 
 	{ "get_bytes_per_sector",
@@ -127,6 +138,14 @@ PyMethodDef pyfsntfs_volume_object_methods[] = {
 	  "\n"
 	  "Retrieves the serial number." },
 
+	{ "get_statistics",
+	  (PyCFunction) pyfsntfs_volume_get_statistics,
+	  METH_NOARGS,
+	  "get_statistics() -> Dictionary\n"
+	  "\n"
+	  "Retrieves the statistics, such as the number of MFT entries and index nodes read,\n"
+	  "the number of bytes read and the time spent in decompression in nano seconds." },
+
 	/* Functions to access the file entries */
 
 	{ "get_number_of_file_entries",
@@ -143,6 +162,17 @@ PyMethodDef pyfsntfs_volume_object_methods[] = {
 	  "\n"
 	  "Retrieves a specific file entry." },
 
+	{ "iter_mft_records",
+	  (PyCFunction) pyfsntfs_volume_iter_mft_records,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "iter_mft_records(batch_size=1024) -> Object\n"
+	  "\n"
+	  "Retrieves an iterator of batches of MFT records.\t"
+	  "Every batch is a list of at most batch size tuples of: MFT entry index, sequence number, is allocated,\t"
+	  "file attribute flags, parent file reference, name, size, $STANDARD_INFORMATION creation, modification,\t"
+	  "access and entry modification time and $FILE_NAME creation, modification, access and entry modification time.\t"
+	  "The times are FILETIME values, values that are not available are None and empty MFT entries are skipped." },
+
 	{ "get_root_directory",
 	  (PyCFunction) pyfsntfs_volume_get_root_directory,
 	  METH_NOARGS,
@@ -424,6 +454,87 @@ void pyfsntfs_volume_free(
 	 (PyObject*) pyfsntfs_volume );
 }
 
+/* Clones a volume
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsntfs_volume_clone(
+           pyfsntfs_volume_t *pyfsntfs_volume,
+           PyObject *arguments PYFSNTFS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error                 = NULL;
+	pyfsntfs_volume_t *pyfsntfs_volume_clone = NULL;
+	static char *function                    = "pyfsntfs_volume_clone";
+	int result                               = 0;
+
+	PYFSNTFS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsntfs_volume == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid volume.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyfsntfs_volume->file_io_handle != NULL )
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: unable to clone volume opened using a file-like object.",
+		 function );
+
+		return( NULL );
+	}
+	pyfsntfs_volume_clone = PyObject_New(
+	                         struct pyfsntfs_volume,
+	                         &pyfsntfs_volume_type_object );
+
+	if( pyfsntfs_volume_clone == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create volume.",
+		 function );
+
+		goto on_error;
+	}
+	pyfsntfs_volume_clone->volume         = NULL;
+	pyfsntfs_volume_clone->file_io_handle = NULL;
+
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfsntfs_volume_clone(
+	          &( pyfsntfs_volume_clone->volume ),
+	          pyfsntfs_volume->volume,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfsntfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to clone volume.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	return( (PyObject *) pyfsntfs_volume_clone );
+
+on_error:
+	if( pyfsntfs_volume_clone != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) pyfsntfs_volume_clone );
+	}
+	return( NULL );
+}
+
 /* Signals the volume to abort the current activity
  * Returns a Python object if successful or NULL on error
  */
@@ -1240,6 +1351,128 @@ PyObject *pyfsntfs_volume_get_serial_number(
 	return( integer_object );
 }
 
+/* The names of the statistics values
+ */
+static const char *pyfsntfs_volume_statistics_value_names[ LIBFSNTFS_STATISTICS_NUMBER_OF_VALUES ] = {
+	"mft_entry_lookups",
+	"mft_entries_read",
+	"mft_entry_fixup_failures",
+	"index_node_lookups",
+	"index_nodes_read",
+	"mft_bytes_read",
+	"index_bytes_read",
+	"data_bytes_read",
+	"compressed_bytes_read",
+	"lznt1_decompression_time",
+	"lzx_decompression_time",
+	"lzxpress_huffman_decompression_time",
+	"path_hint_cache_hits",
+	"path_hint_cache_misses" };
+
+/* Retrieves the statistics
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsntfs_volume_get_statistics(
+           pyfsntfs_volume_t *pyfsntfs_volume,
+           PyObject *arguments PYFSNTFS_ATTRIBUTE_UNUSED )
+{
+	uint64_t values[ LIBFSNTFS_STATISTICS_NUMBER_OF_VALUES ];
+
+	PyObject *dictionary_object = NULL;
+	PyObject *integer_object    = NULL;
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyfsntfs_volume_get_statistics";
+	int result                  = 0;
+	int value_index             = 0;
+
+	PYFSNTFS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsntfs_volume == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid volume.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfsntfs_volume_get_statistics(
+	          pyfsntfs_volume->volume,
+	          values,
+	          LIBFSNTFS_STATISTICS_NUMBER_OF_VALUES,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfsntfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve statistics.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	dictionary_object = PyDict_New();
+
+	if( dictionary_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create dictionary object.",
+		 function );
+
+		return( NULL );
+	}
+	for( value_index = 0;
+	     value_index < LIBFSNTFS_STATISTICS_NUMBER_OF_VALUES;
+	     value_index++ )
+	{
+		integer_object = pyfsntfs_integer_unsigned_new_from_64bit(
+		                  values[ value_index ] );
+
+		if( integer_object == NULL )
+		{
+			goto on_error;
+		}
+		if( PyDict_SetItemString(
+		     dictionary_object,
+		     pyfsntfs_volume_statistics_value_names[ value_index ],
+		     integer_object ) != 0 )
+		{
+			PyErr_Format(
+			 PyExc_IOError,
+			 "%s: unable to set statistics value: %s.",
+			 function,
+			 pyfsntfs_volume_statistics_value_names[ value_index ] );
+
+			goto on_error;
+		}
+		Py_DecRef(
+		 integer_object );
+
+		integer_object = NULL;
+	}
+	return( dictionary_object );
+
+on_error:
+	if( integer_object != NULL )
+	{
+		Py_DecRef(
+		 integer_object );
+	}
+	Py_DecRef(
+	 dictionary_object );
+
+	return( NULL );
+}
+
 /* Retrieves the number of file entries
  * Returns a Python object if successful or NULL on error
  */
@@ -1454,6 +1687,88 @@ PyObject *pyfsntfs_volume_get_file_entries(
 	return( volume_file_entries_object );
 }
 
+/* Retrieves an iterator of batches of MFT records
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsntfs_volume_iter_mft_records(
+           pyfsntfs_volume_t *pyfsntfs_volume,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	libcerror_error_t *error            = NULL;
+	PyObject *volume_mft_records_object = NULL;
+	static char *function               = "pyfsntfs_volume_iter_mft_records";
+	static char *keyword_list[]         = { "batch_size", NULL };
+	uint64_t number_of_file_entries     = 0;
+	int batch_size                      = 1024;
+	int result                          = 0;
+
+	if( pyfsntfs_volume == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid volume.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "|i",
+	     keyword_list,
+	     &batch_size ) == 0 )
+	{
+		return( NULL );
+	}
+	if( batch_size <= 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid batch size value zero or less.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfsntfs_volume_get_number_of_file_entries(
+	          pyfsntfs_volume->volume,
+	          &number_of_file_entries,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfsntfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of file entries.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	volume_mft_records_object = pyfsntfs_volume_mft_records_new(
+	                             pyfsntfs_volume,
+	                             number_of_file_entries,
+	                             batch_size );
+
+	if( volume_mft_records_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create volume MFT records object.",
+		 function );
+
+		return( NULL );
+	}
+	return( volume_mft_records_object );
+}
+
 /* Retrieves the file entry specified by the path
  * Returns a Python object if successful or NULL on error
  */
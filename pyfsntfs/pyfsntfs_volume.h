@@ -59,6 +59,10 @@ int pyfsntfs_volume_init(
 void pyfsntfs_volume_free(
       pyfsntfs_volume_t *pyfsntfs_volume );
 
+PyObject *pyfsntfs_volume_clone(
+           pyfsntfs_volume_t *pyfsntfs_volume,
+           PyObject *arguments );
+
 PyObject *pyfsntfs_volume_signal_abort(
            pyfsntfs_volume_t *pyfsntfs_volume,
            PyObject *arguments );
@@ -101,6 +105,10 @@ PyObject *pyfsntfs_volume_get_serial_number(
            pyfsntfs_volume_t *pyfsntfs_volume,
            PyObject *arguments );
 
+PyObject *pyfsntfs_volume_get_statistics(
+           pyfsntfs_volume_t *pyfsntfs_volume,
+           PyObject *arguments );
+
 PyObject *pyfsntfs_volume_get_number_of_file_entries(
            pyfsntfs_volume_t *pyfsntfs_volume,
            PyObject *arguments );
@@ -118,6 +126,11 @@ PyObject *pyfsntfs_volume_get_file_entries(
            pyfsntfs_volume_t *pyfsntfs_volume,
            PyObject *arguments );
 
+PyObject *pyfsntfs_volume_iter_mft_records(
+           pyfsntfs_volume_t *pyfsntfs_volume,
+           PyObject *arguments,
+           PyObject *keywords );
+
 PyObject *pyfsntfs_volume_get_file_entry_by_path(
            pyfsntfs_volume_t *pyfsntfs_volume,
            PyObject *arguments,
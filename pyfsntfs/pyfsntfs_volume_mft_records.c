@@ -0,0 +1,1126 @@
+/*
+ * Python object definition of the volume MFT records batch iterator
+ *
+ * Copyright (C) 2010-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( HAVE_WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pyfsntfs_error.h"
+#include "pyfsntfs_integer.h"
+#include "pyfsntfs_libcerror.h"
+#include "pyfsntfs_libfsntfs.h"
+#include "pyfsntfs_python.h"
+#include "pyfsntfs_volume.h"
+#include "pyfsntfs_volume_mft_records.h"
+
+PyTypeObject pyfsntfs_volume_mft_records_type_object = {
+	PyVarObject_HEAD_INIT( NULL, 0 )
+
+	/* tp_name */
+	"pyfsntfs._volume_mft_records",
+	/* tp_basicsize */
+	sizeof( pyfsntfs_volume_mft_records_t ),
+	/* tp_itemsize */
+	0,
+	/* tp_dealloc */
+	(destructor) pyfsntfs_volume_mft_records_free,
+	/* tp_print */
+	0,
+	/* tp_getattr */
+	0,
+	/* tp_setattr */
+	0,
+	/* tp_compare */
+	0,
+	/* tp_repr */
+	0,
+	/* tp_as_number */
+	0,
+	/* tp_as_sequence */
+	0,
+	/* tp_as_mapping */
+	0,
+	/* tp_hash */
+	0,
+	/* tp_call */
+	0,
+	/* tp_str */
+	0,
+	/* tp_getattro */
+	0,
+	/* tp_setattro */
+	0,
+	/* tp_as_buffer */
+	0,
+	/* tp_flags */
+	Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_ITER,
+	/* tp_doc */
+	"internal pyfsntfs volume MFT records batch iterator object",
+	/* tp_traverse */
+	0,
+	/* tp_clear */
+	0,
+	/* tp_richcompare */
+	0,
+	/* tp_weaklistoffset */
+	0,
+	/* tp_iter */
+	(getiterfunc) pyfsntfs_volume_mft_records_iter,
+	/* tp_iternext */
+	(iternextfunc) pyfsntfs_volume_mft_records_iternext,
+	/* tp_methods */
+	0,
+	/* tp_members */
+	0,
+	/* tp_getset */
+	0,
+	/* tp_base */
+	0,
+	/* tp_dict */
+	0,
+	/* tp_descr_get */
+	0,
+	/* tp_descr_set */
+	0,
+	/* tp_dictoffset */
+	0,
+	/* tp_init */
+	(initproc) pyfsntfs_volume_mft_records_init,
+	/* tp_alloc */
+	0,
+	/* tp_new */
+	0,
+	/* tp_free */
+	0,
+	/* tp_is_gc */
+	0,
+	/* tp_bases */
+	NULL,
+	/* tp_mro */
+	NULL,
+	/* tp_cache */
+	NULL,
+	/* tp_subclasses */
+	NULL,
+	/* tp_weaklist */
+	NULL,
+	/* tp_del */
+	0
+};
+
+/* Creates a new volume MFT records object
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsntfs_volume_mft_records_new(
+           pyfsntfs_volume_t *volume_object,
+           uint64_t number_of_mft_entries,
+           int batch_size )
+{
+	pyfsntfs_volume_mft_records_t *pyfsntfs_volume_mft_records = NULL;
+	static char *function                                     = "pyfsntfs_volume_mft_records_new";
+
+	if( volume_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid volume object.",
+		 function );
+
+		return( NULL );
+	}
+	if( ( batch_size <= 0 )
+	 || ( (size_t) batch_size > (size_t) ( SSIZE_MAX / sizeof( pyfsntfs_mft_record_values_t ) ) ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid batch size value out of bounds.",
+		 function );
+
+		return( NULL );
+	}
+	/* Make sure the volume MFT records values are initialized
+	 */
+	pyfsntfs_volume_mft_records = PyObject_New(
+	                               struct pyfsntfs_volume_mft_records,
+	                               &pyfsntfs_volume_mft_records_type_object );
+
+	if( pyfsntfs_volume_mft_records == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to initialize volume MFT records.",
+		 function );
+
+		goto on_error;
+	}
+	if( pyfsntfs_volume_mft_records_init(
+	     pyfsntfs_volume_mft_records ) != 0 )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to initialize volume MFT records.",
+		 function );
+
+		goto on_error;
+	}
+	pyfsntfs_volume_mft_records->record_values = (pyfsntfs_mft_record_values_t *) PyMem_Malloc(
+	                                              sizeof( pyfsntfs_mft_record_values_t ) * batch_size );
+
+	if( pyfsntfs_volume_mft_records->record_values == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create record values.",
+		 function );
+
+		goto on_error;
+	}
+	pyfsntfs_volume_mft_records->volume_object         = volume_object;
+	pyfsntfs_volume_mft_records->batch_size            = batch_size;
+	pyfsntfs_volume_mft_records->number_of_mft_entries = number_of_mft_entries;
+
+	Py_IncRef(
+	 (PyObject *) pyfsntfs_volume_mft_records->volume_object );
+
+	return( (PyObject *) pyfsntfs_volume_mft_records );
+
+on_error:
+	if( pyfsntfs_volume_mft_records != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) pyfsntfs_volume_mft_records );
+	}
+	return( NULL );
+}
+
+/* Intializes a volume MFT records object
+ * Returns 0 if successful or -1 on error
+ */
+int pyfsntfs_volume_mft_records_init(
+     pyfsntfs_volume_mft_records_t *pyfsntfs_volume_mft_records )
+{
+	static char *function = "pyfsntfs_volume_mft_records_init";
+
+	if( pyfsntfs_volume_mft_records == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid volume MFT records.",
+		 function );
+
+		return( -1 );
+	}
+	/* Make sure the volume MFT records values are initialized
+	 */
+	pyfsntfs_volume_mft_records->volume_object         = NULL;
+	pyfsntfs_volume_mft_records->record_values         = NULL;
+	pyfsntfs_volume_mft_records->batch_size            = 0;
+	pyfsntfs_volume_mft_records->mft_entry_index       = 0;
+	pyfsntfs_volume_mft_records->number_of_mft_entries = 0;
+
+	return( 0 );
+}
+
+/* Frees a volume MFT records object
+ */
+void pyfsntfs_volume_mft_records_free(
+      pyfsntfs_volume_mft_records_t *pyfsntfs_volume_mft_records )
+{
+	struct _typeobject *ob_type = NULL;
+	static char *function       = "pyfsntfs_volume_mft_records_free";
+
+	if( pyfsntfs_volume_mft_records == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid volume MFT records.",
+		 function );
+
+		return;
+	}
+	ob_type = Py_TYPE(
+	           pyfsntfs_volume_mft_records );
+
+	if( ob_type == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: missing ob_type.",
+		 function );
+
+		return;
+	}
+	if( ob_type->tp_free == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid ob_type - missing tp_free.",
+		 function );
+
+		return;
+	}
+	if( pyfsntfs_volume_mft_records->record_values != NULL )
+	{
+		PyMem_Free(
+		 pyfsntfs_volume_mft_records->record_values );
+	}
+	if( pyfsntfs_volume_mft_records->volume_object != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) pyfsntfs_volume_mft_records->volume_object );
+	}
+	ob_type->tp_free(
+	 (PyObject*) pyfsntfs_volume_mft_records );
+}
+
+/* Reads the record values of a specific MFT entry
+ * This function does not use the Python API and can be called without holding the GIL
+ * Returns 1 if successful, 0 if the MFT entry is empty or -1 on error
+ */
+int pyfsntfs_volume_mft_records_read_record_values(
+     libfsntfs_volume_t *volume,
+     uint64_t mft_entry_index,
+     pyfsntfs_mft_record_values_t *record_values,
+     libcerror_error_t **error )
+{
+	libfsntfs_attribute_t *attribute           = NULL;
+	libfsntfs_attribute_t *file_name_attribute = NULL;
+	libfsntfs_file_entry_t *file_entry         = NULL;
+	static char *function                      = "pyfsntfs_volume_mft_records_read_record_values";
+	size_t name_size                           = 0;
+	uint32_t attribute_type                    = 0;
+	uint8_t file_name_space                    = 0;
+	uint8_t name_space                         = 0;
+	int attribute_index                        = 0;
+	int number_of_attributes                   = 0;
+	int result                                 = 0;
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsntfs_volume_get_file_entry_by_index(
+	     volume,
+	     mft_entry_index,
+	     &file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry: %" PRIu64 ".",
+		 function,
+		 mft_entry_index );
+
+		goto on_error;
+	}
+	result = libfsntfs_file_entry_is_empty(
+	          file_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if file entry is empty.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libfsntfs_file_entry_free(
+		     &file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file entry.",
+			 function );
+
+			goto on_error;
+		}
+		return( 0 );
+	}
+	record_values->mft_entry_index = mft_entry_index;
+	record_values->size            = 0;
+	record_values->name_size       = 0;
+	record_values->value_flags     = 0;
+
+	if( libfsntfs_file_entry_get_file_reference(
+	     file_entry,
+	     &( record_values->file_reference ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file reference.",
+		 function );
+
+		goto on_error;
+	}
+	result = libfsntfs_file_entry_is_allocated(
+	          file_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if file entry is allocated.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		record_values->value_flags |= PYFSNTFS_MFT_RECORD_VALUE_FLAG_IS_ALLOCATED;
+	}
+	result = libfsntfs_file_entry_get_file_attribute_flags(
+	          file_entry,
+	          &( record_values->file_attribute_flags ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file attribute flags.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		record_values->value_flags |= PYFSNTFS_MFT_RECORD_VALUE_FLAG_HAS_STANDARD_INFORMATION;
+
+		if( libfsntfs_file_entry_get_creation_time(
+		     file_entry,
+		     &( record_values->standard_information_times[ 0 ] ),
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve creation time.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsntfs_file_entry_get_modification_time(
+		     file_entry,
+		     &( record_values->standard_information_times[ 1 ] ),
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve modification time.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsntfs_file_entry_get_access_time(
+		     file_entry,
+		     &( record_values->standard_information_times[ 2 ] ),
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve access time.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsntfs_file_entry_get_entry_modification_time(
+		     file_entry,
+		     &( record_values->standard_information_times[ 3 ] ),
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry modification time.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfsntfs_file_entry_get_size(
+	     file_entry,
+	     &( record_values->size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsntfs_file_entry_get_number_of_attributes(
+	     file_entry,
+	     &number_of_attributes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of attributes.",
+		 function );
+
+		goto on_error;
+	}
+	/* Use the first $FILE_NAME attribute, but prefer a long name over a name
+	 * that is only in the DOS name space (0x02)
+	 */
+	for( attribute_index = 0;
+	     attribute_index < number_of_attributes;
+	     attribute_index++ )
+	{
+		if( libfsntfs_file_entry_get_attribute_by_index(
+		     file_entry,
+		     attribute_index,
+		     &attribute,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve attribute: %d.",
+			 function,
+			 attribute_index );
+
+			goto on_error;
+		}
+		if( libfsntfs_attribute_get_type(
+		     attribute,
+		     &attribute_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve attribute: %d type.",
+			 function,
+			 attribute_index );
+
+			goto on_error;
+		}
+		if( attribute_type == LIBFSNTFS_ATTRIBUTE_TYPE_FILE_NAME )
+		{
+			if( libfsntfs_file_name_attribute_get_name_space(
+			     attribute,
+			     &name_space,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve attribute: %d name space.",
+				 function,
+				 attribute_index );
+
+				goto on_error;
+			}
+			if( ( file_name_attribute == NULL )
+			 || ( ( file_name_space == 0x02 )
+			  && ( name_space != 0x02 ) ) )
+			{
+				if( file_name_attribute != NULL )
+				{
+					if( libfsntfs_attribute_free(
+					     &file_name_attribute,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free $FILE_NAME attribute.",
+						 function );
+
+						goto on_error;
+					}
+				}
+				file_name_attribute = attribute;
+				file_name_space     = name_space;
+				attribute           = NULL;
+			}
+		}
+		if( attribute != NULL )
+		{
+			if( libfsntfs_attribute_free(
+			     &attribute,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free attribute: %d.",
+				 function,
+				 attribute_index );
+
+				goto on_error;
+			}
+		}
+	}
+	if( file_name_attribute != NULL )
+	{
+		record_values->value_flags |= PYFSNTFS_MFT_RECORD_VALUE_FLAG_HAS_FILE_NAME;
+
+		if( libfsntfs_file_name_attribute_get_parent_file_reference(
+		     file_name_attribute,
+		     &( record_values->parent_file_reference ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve parent file reference.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsntfs_file_name_attribute_get_creation_time(
+		     file_name_attribute,
+		     &( record_values->file_name_times[ 0 ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve $FILE_NAME creation time.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsntfs_file_name_attribute_get_modification_time(
+		     file_name_attribute,
+		     &( record_values->file_name_times[ 1 ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve $FILE_NAME modification time.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsntfs_file_name_attribute_get_access_time(
+		     file_name_attribute,
+		     &( record_values->file_name_times[ 2 ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve $FILE_NAME access time.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsntfs_file_name_attribute_get_entry_modification_time(
+		     file_name_attribute,
+		     &( record_values->file_name_times[ 3 ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve $FILE_NAME entry modification time.",
+			 function );
+
+			goto on_error;
+		}
+		result = libfsntfs_file_name_attribute_get_utf8_name_size(
+		          file_name_attribute,
+		          &name_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 name size.",
+			 function );
+
+			goto on_error;
+		}
+		else if( ( result != 0 )
+		      && ( name_size > 0 ) )
+		{
+			if( name_size > PYFSNTFS_MFT_RECORD_MAXIMUM_NAME_SIZE )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid UTF-8 name size value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfsntfs_file_name_attribute_get_utf8_name(
+			     file_name_attribute,
+			     record_values->name,
+			     name_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve UTF-8 name.",
+				 function );
+
+				goto on_error;
+			}
+			record_values->name_size = name_size;
+		}
+		if( libfsntfs_attribute_free(
+		     &file_name_attribute,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free $FILE_NAME attribute.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfsntfs_file_entry_free(
+	     &file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file entry.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_name_attribute != NULL )
+	{
+		libfsntfs_attribute_free(
+		 &file_name_attribute,
+		 NULL );
+	}
+	if( attribute != NULL )
+	{
+		libfsntfs_attribute_free(
+		 &attribute,
+		 NULL );
+	}
+	if( file_entry != NULL )
+	{
+		libfsntfs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Creates a record tuple from the record values
+ * The tuple contains: MFT entry index, sequence number, is allocated, file attribute flags,
+ * parent file reference, name, size, 4 x $STANDARD_INFORMATION times and 4 x $FILE_NAME times
+ * where the times are FILETIME values and unavailable values are None
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsntfs_volume_mft_records_get_record_tuple(
+           pyfsntfs_mft_record_values_t *record_values )
+{
+	PyObject *tuple_object = NULL;
+	PyObject *value_object = NULL;
+	static char *function  = "pyfsntfs_volume_mft_records_get_record_tuple";
+	Py_ssize_t value_index = 0;
+	int time_index         = 0;
+
+	if( record_values == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid record values.",
+		 function );
+
+		return( NULL );
+	}
+	tuple_object = PyTuple_New(
+	                15 );
+
+	if( tuple_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create tuple object.",
+		 function );
+
+		goto on_error;
+	}
+	for( value_index = 0;
+	     value_index < 15;
+	     value_index++ )
+	{
+		value_object = NULL;
+
+		switch( value_index )
+		{
+			case 0:
+				value_object = pyfsntfs_integer_unsigned_new_from_64bit(
+				                record_values->mft_entry_index );
+				break;
+
+			case 1:
+				value_object = pyfsntfs_integer_unsigned_new_from_64bit(
+				                record_values->file_reference >> 48 );
+				break;
+
+			case 2:
+				value_object = PyBool_FromLong(
+				                (long) ( record_values->value_flags & PYFSNTFS_MFT_RECORD_VALUE_FLAG_IS_ALLOCATED ) );
+				break;
+
+			case 3:
+				if( ( record_values->value_flags & PYFSNTFS_MFT_RECORD_VALUE_FLAG_HAS_STANDARD_INFORMATION ) != 0 )
+				{
+					value_object = pyfsntfs_integer_unsigned_new_from_64bit(
+					                (uint64_t) record_values->file_attribute_flags );
+				}
+				break;
+
+			case 4:
+				if( ( record_values->value_flags & PYFSNTFS_MFT_RECORD_VALUE_FLAG_HAS_FILE_NAME ) != 0 )
+				{
+					value_object = pyfsntfs_integer_unsigned_new_from_64bit(
+					                record_values->parent_file_reference );
+				}
+				break;
+
+			case 5:
+				if( record_values->name_size > 0 )
+				{
+					/* Pass the string length to PyUnicode_DecodeUTF8 otherwise it makes
+					 * the end of string character is part of the string
+					 */
+					value_object = PyUnicode_DecodeUTF8(
+					                (char *) record_values->name,
+					                (Py_ssize_t) record_values->name_size - 1,
+					                NULL );
+
+					if( value_object == NULL )
+					{
+						PyErr_Format(
+						 PyExc_IOError,
+						 "%s: unable to convert UTF-8 name into Unicode.",
+						 function );
+
+						goto on_error;
+					}
+				}
+				break;
+
+			case 6:
+				value_object = pyfsntfs_integer_unsigned_new_from_64bit(
+				                (uint64_t) record_values->size );
+				break;
+
+			case 7:
+			case 8:
+			case 9:
+			case 10:
+				if( ( record_values->value_flags & PYFSNTFS_MFT_RECORD_VALUE_FLAG_HAS_STANDARD_INFORMATION ) != 0 )
+				{
+					time_index = (int) value_index - 7;
+
+					value_object = pyfsntfs_integer_unsigned_new_from_64bit(
+					                record_values->standard_information_times[ time_index ] );
+				}
+				break;
+
+			default:
+				if( ( record_values->value_flags & PYFSNTFS_MFT_RECORD_VALUE_FLAG_HAS_FILE_NAME ) != 0 )
+				{
+					time_index = (int) value_index - 11;
+
+					value_object = pyfsntfs_integer_unsigned_new_from_64bit(
+					                record_values->file_name_times[ time_index ] );
+				}
+				break;
+		}
+		if( value_object == NULL )
+		{
+			if( PyErr_Occurred() != NULL )
+			{
+				goto on_error;
+			}
+			Py_IncRef(
+			 Py_None );
+
+			value_object = Py_None;
+		}
+		/* The tuple object takes over the reference of the value object
+		 */
+		if( PyTuple_SetItem(
+		     tuple_object,
+		     value_index,
+		     value_object ) != 0 )
+		{
+			goto on_error;
+		}
+	}
+	return( tuple_object );
+
+on_error:
+	if( tuple_object != NULL )
+	{
+		Py_DecRef(
+		 tuple_object );
+	}
+	return( NULL );
+}
+
+/* The volume MFT records iter() function
+ */
+PyObject *pyfsntfs_volume_mft_records_iter(
+           pyfsntfs_volume_mft_records_t *pyfsntfs_volume_mft_records )
+{
+	static char *function = "pyfsntfs_volume_mft_records_iter";
+
+	if( pyfsntfs_volume_mft_records == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid volume MFT records.",
+		 function );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 (PyObject *) pyfsntfs_volume_mft_records );
+
+	return( (PyObject *) pyfsntfs_volume_mft_records );
+}
+
+/* The volume MFT records iternext() function
+ * Returns a list of record tuples of at most batch size non-empty MFT entries
+ */
+PyObject *pyfsntfs_volume_mft_records_iternext(
+           pyfsntfs_volume_mft_records_t *pyfsntfs_volume_mft_records )
+{
+	libcerror_error_t *error                     = NULL;
+	libfsntfs_volume_t *volume                   = NULL;
+	pyfsntfs_mft_record_values_t *record_values = NULL;
+	PyObject *list_object                        = NULL;
+	PyObject *tuple_object                       = NULL;
+	static char *function                        = "pyfsntfs_volume_mft_records_iternext";
+	uint64_t mft_entry_index                     = 0;
+	uint64_t number_of_mft_entries               = 0;
+	int batch_size                               = 0;
+	int number_of_records                        = 0;
+	int record_index                             = 0;
+	int result                                   = 0;
+
+	if( pyfsntfs_volume_mft_records == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid volume MFT records.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyfsntfs_volume_mft_records->volume_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid volume MFT records - missing volume object.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyfsntfs_volume_mft_records->record_values == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid volume MFT records - missing record values.",
+		 function );
+
+		return( NULL );
+	}
+	volume                = pyfsntfs_volume_mft_records->volume_object->volume;
+	record_values         = pyfsntfs_volume_mft_records->record_values;
+	batch_size            = pyfsntfs_volume_mft_records->batch_size;
+	mft_entry_index       = pyfsntfs_volume_mft_records->mft_entry_index;
+	number_of_mft_entries = pyfsntfs_volume_mft_records->number_of_mft_entries;
+
+	/* The MFT entries of the batch are read without holding the GIL
+	 */
+	Py_BEGIN_ALLOW_THREADS
+
+	while( ( number_of_records < batch_size )
+	    && ( mft_entry_index < number_of_mft_entries ) )
+	{
+		result = pyfsntfs_volume_mft_records_read_record_values(
+		          volume,
+		          mft_entry_index,
+		          &( record_values[ number_of_records ] ),
+		          &error );
+
+		if( result == -1 )
+		{
+			break;
+		}
+		else if( result != 0 )
+		{
+			number_of_records++;
+		}
+		mft_entry_index++;
+	}
+	Py_END_ALLOW_THREADS
+
+	if( result == -1 )
+	{
+		/* Return the records read so far, the failing MFT entry is
+		 * read again and reported by the next call
+		 */
+		if( number_of_records == 0 )
+		{
+			pyfsntfs_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to read MFT entry: %" PRIu64 ".",
+			 function,
+			 mft_entry_index );
+
+			libcerror_error_free(
+			 &error );
+
+			/* Skip the failing MFT entry so the iteration can be continued
+			 */
+			pyfsntfs_volume_mft_records->mft_entry_index = mft_entry_index + 1;
+
+			return( NULL );
+		}
+		libcerror_error_free(
+		 &error );
+	}
+	pyfsntfs_volume_mft_records->mft_entry_index = mft_entry_index;
+
+	if( number_of_records == 0 )
+	{
+		PyErr_SetNone(
+		 PyExc_StopIteration );
+
+		return( NULL );
+	}
+	list_object = PyList_New(
+	               (Py_ssize_t) number_of_records );
+
+	if( list_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create list object.",
+		 function );
+
+		goto on_error;
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		tuple_object = pyfsntfs_volume_mft_records_get_record_tuple(
+		                &( record_values[ record_index ] ) );
+
+		if( tuple_object == NULL )
+		{
+			goto on_error;
+		}
+		/* The list object takes over the reference of the tuple object
+		 */
+		if( PyList_SetItem(
+		     list_object,
+		     (Py_ssize_t) record_index,
+		     tuple_object ) != 0 )
+		{
+			goto on_error;
+		}
+	}
+	return( list_object );
+
+on_error:
+	if( list_object != NULL )
+	{
+		Py_DecRef(
+		 list_object );
+	}
+	return( NULL );
+}
+
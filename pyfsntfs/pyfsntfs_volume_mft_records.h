@@ -0,0 +1,156 @@
+/*
+ * Python object definition of the volume MFT records batch iterator
+ *
+ * Copyright (C) 2010-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PYFSNTFS_VOLUME_MFT_RECORDS_H )
+#define _PYFSNTFS_VOLUME_MFT_RECORDS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pyfsntfs_libcerror.h"
+#include "pyfsntfs_libfsntfs.h"
+#include "pyfsntfs_python.h"
+#include "pyfsntfs_volume.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum size of an UTF-8 encoded name including the end of string character,
+ * a $FILE_NAME attribute name contains at most 255 UTF-16 characters
+ */
+#define PYFSNTFS_MFT_RECORD_MAXIMUM_NAME_SIZE	( ( 255 * 3 ) + 1 )
+
+enum PYFSNTFS_MFT_RECORD_VALUE_FLAGS
+{
+	PYFSNTFS_MFT_RECORD_VALUE_FLAG_IS_ALLOCATED		= 0x01,
+	PYFSNTFS_MFT_RECORD_VALUE_FLAG_HAS_STANDARD_INFORMATION	= 0x02,
+	PYFSNTFS_MFT_RECORD_VALUE_FLAG_HAS_FILE_NAME		= 0x04
+};
+
+typedef struct pyfsntfs_mft_record_values pyfsntfs_mft_record_values_t;
+
+struct pyfsntfs_mft_record_values
+{
+	/* The MFT entry index
+	 */
+	uint64_t mft_entry_index;
+
+	/* The file reference
+	 */
+	uint64_t file_reference;
+
+	/* The parent file reference
+	 */
+	uint64_t parent_file_reference;
+
+	/* The size of the default data stream
+	 */
+	size64_t size;
+
+	/* The $STANDARD_INFORMATION creation, modification, access and entry modification times
+	 */
+	uint64_t standard_information_times[ 4 ];
+
+	/* The $FILE_NAME creation, modification, access and entry modification times
+	 */
+	uint64_t file_name_times[ 4 ];
+
+	/* The file attribute flags
+	 */
+	uint32_t file_attribute_flags;
+
+	/* The UTF-8 encoded name
+	 */
+	uint8_t name[ PYFSNTFS_MFT_RECORD_MAXIMUM_NAME_SIZE ];
+
+	/* The name size
+	 */
+	size_t name_size;
+
+	/* The value flags
+	 */
+	uint8_t value_flags;
+};
+
+typedef struct pyfsntfs_volume_mft_records pyfsntfs_volume_mft_records_t;
+
+struct pyfsntfs_volume_mft_records
+{
+	/* Python object initialization
+	 */
+	PyObject_HEAD
+
+	/* The volume object
+	 */
+	pyfsntfs_volume_t *volume_object;
+
+	/* The record values of the current batch
+	 */
+	pyfsntfs_mft_record_values_t *record_values;
+
+	/* The batch size
+	 */
+	int batch_size;
+
+	/* The (current) MFT entry index
+	 */
+	uint64_t mft_entry_index;
+
+	/* The number of MFT entries
+	 */
+	uint64_t number_of_mft_entries;
+};
+
+extern PyTypeObject pyfsntfs_volume_mft_records_type_object;
+
+PyObject *pyfsntfs_volume_mft_records_new(
+           pyfsntfs_volume_t *volume_object,
+           uint64_t number_of_mft_entries,
+           int batch_size );
+
+int pyfsntfs_volume_mft_records_init(
+     pyfsntfs_volume_mft_records_t *pyfsntfs_volume_mft_records );
+
+void pyfsntfs_volume_mft_records_free(
+      pyfsntfs_volume_mft_records_t *pyfsntfs_volume_mft_records );
+
+int pyfsntfs_volume_mft_records_read_record_values(
+     libfsntfs_volume_t *volume,
+     uint64_t mft_entry_index,
+     pyfsntfs_mft_record_values_t *record_values,
+     libcerror_error_t **error );
+
+PyObject *pyfsntfs_volume_mft_records_get_record_tuple(
+           pyfsntfs_mft_record_values_t *record_values );
+
+PyObject *pyfsntfs_volume_mft_records_iter(
+           pyfsntfs_volume_mft_records_t *pyfsntfs_volume_mft_records );
+
+PyObject *pyfsntfs_volume_mft_records_iternext(
+           pyfsntfs_volume_mft_records_t *pyfsntfs_volume_mft_records );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PYFSNTFS_VOLUME_MFT_RECORDS_H ) */
+
@@ -0,0 +1,494 @@
+/*
+ * Library async_read type test program
+ *
+ * Copyright (C) 2010-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsntfs_test_libcerror.h"
+#include "fsntfs_test_libfsntfs.h"
+#include "fsntfs_test_macros.h"
+#include "fsntfs_test_memory.h"
+#include "fsntfs_test_unused.h"
+
+#include "../libfsntfs/libfsntfs_async_read.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+
+/* Callback function for the libfsntfs_async_read tests
+ */
+void fsntfs_test_async_read_callback(
+      libfsntfs_file_entry_t *file_entry FSNTFS_TEST_ATTRIBUTE_UNUSED,
+      void *buffer FSNTFS_TEST_ATTRIBUTE_UNUSED,
+      ssize_t read_count FSNTFS_TEST_ATTRIBUTE_UNUSED,
+      void *callback_data FSNTFS_TEST_ATTRIBUTE_UNUSED )
+{
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( file_entry )
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( buffer )
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( read_count )
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( callback_data )
+}
+
+/* Tests the libfsntfs_async_read_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_async_read_initialize(
+     void )
+{
+	uint8_t buffer[ 16 ];
+
+	libcerror_error_t *error           = NULL;
+	libfsntfs_async_read_t *async_read = NULL;
+	libfsntfs_file_entry_t *file_entry = (libfsntfs_file_entry_t *) 0x12345678UL;
+	int result                         = 0;
+
+#if defined( HAVE_FSNTFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests    = 1;
+	int number_of_memset_fail_tests    = 1;
+	int test_number                    = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_async_read_initialize(
+	          &async_read,
+	          file_entry,
+	          buffer,
+	          16,
+	          0,
+	          &fsntfs_test_async_read_callback,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "async_read",
+	 async_read );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_async_read_free(
+	          &async_read,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "async_read",
+	 async_read );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_async_read_initialize(
+	          NULL,
+	          file_entry,
+	          buffer,
+	          16,
+	          0,
+	          &fsntfs_test_async_read_callback,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	async_read = (libfsntfs_async_read_t *) 0x12345678UL;
+
+	result = libfsntfs_async_read_initialize(
+	          &async_read,
+	          file_entry,
+	          buffer,
+	          16,
+	          0,
+	          &fsntfs_test_async_read_callback,
+	          NULL,
+	          &error );
+
+	async_read = NULL;
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_async_read_initialize(
+	          &async_read,
+	          NULL,
+	          buffer,
+	          16,
+	          0,
+	          &fsntfs_test_async_read_callback,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_async_read_initialize(
+	          &async_read,
+	          file_entry,
+	          NULL,
+	          16,
+	          0,
+	          &fsntfs_test_async_read_callback,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_async_read_initialize(
+	          &async_read,
+	          file_entry,
+	          buffer,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &fsntfs_test_async_read_callback,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_async_read_initialize(
+	          &async_read,
+	          file_entry,
+	          buffer,
+	          16,
+	          -1,
+	          &fsntfs_test_async_read_callback,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_async_read_initialize(
+	          &async_read,
+	          file_entry,
+	          buffer,
+	          16,
+	          0,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSNTFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsntfs_async_read_initialize with malloc failing
+		 */
+		fsntfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsntfs_async_read_initialize(
+		          &async_read,
+		          file_entry,
+		          buffer,
+		          16,
+		          0,
+		          &fsntfs_test_async_read_callback,
+		          NULL,
+		          &error );
+
+		if( fsntfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsntfs_test_malloc_attempts_before_fail = -1;
+
+			if( async_read != NULL )
+			{
+				libfsntfs_async_read_free(
+				 &async_read,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSNTFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSNTFS_TEST_ASSERT_IS_NULL(
+			 "async_read",
+			 async_read );
+
+			FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsntfs_async_read_initialize with memset failing
+		 */
+		fsntfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsntfs_async_read_initialize(
+		          &async_read,
+		          file_entry,
+		          buffer,
+		          16,
+		          0,
+		          &fsntfs_test_async_read_callback,
+		          NULL,
+		          &error );
+
+		if( fsntfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsntfs_test_memset_attempts_before_fail = -1;
+
+			if( async_read != NULL )
+			{
+				libfsntfs_async_read_free(
+				 &async_read,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSNTFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSNTFS_TEST_ASSERT_IS_NULL(
+			 "async_read",
+			 async_read );
+
+			FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSNTFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( async_read != NULL )
+	{
+		libfsntfs_async_read_free(
+		 &async_read,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_async_read_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_async_read_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsntfs_async_read_free(
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_async_read_execute function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_async_read_execute(
+     void )
+{
+	int result = 0;
+
+	/* Test error cases
+	 */
+	result = libfsntfs_async_read_execute(
+	          NULL,
+	          NULL );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSNTFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSNTFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_async_read_initialize",
+	 fsntfs_test_async_read_initialize );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_async_read_free",
+	 fsntfs_test_async_read_free );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_async_read_execute",
+	 fsntfs_test_async_read_execute );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
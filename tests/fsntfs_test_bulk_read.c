@@ -0,0 +1,1270 @@
+/*
+ * Library bulk_read type test program
+ *
+ * Copyright (C) 2010-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsntfs_test_functions.h"
+#include "fsntfs_test_libbfio.h"
+#include "fsntfs_test_libcerror.h"
+#include "fsntfs_test_libfsntfs.h"
+#include "fsntfs_test_macros.h"
+#include "fsntfs_test_memory.h"
+#include "fsntfs_test_unused.h"
+
+#include "../libfsntfs/libfsntfs_bulk_read.h"
+#include "../libfsntfs/libfsntfs_io_handle.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+
+/* Test callback function that counts the number of bytes passed
+ * Returns 1 if successful or -1 on error
+ */
+int fsntfs_test_bulk_read_callback(
+     uint64_t mft_entry_index FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     off64_t data_offset FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     const uint8_t *data FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     size_t data_size,
+     void *callback_data )
+{
+	size_t *total_data_size = (size_t *) callback_data;
+
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( mft_entry_index )
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( data_offset )
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( data )
+
+	if( total_data_size == NULL )
+	{
+		return( -1 );
+	}
+	*total_data_size += data_size;
+
+	return( 1 );
+}
+
+typedef struct fsntfs_test_bulk_read_values fsntfs_test_bulk_read_values_t;
+
+/* The values of the bulk read test callback functions
+ */
+struct fsntfs_test_bulk_read_values
+{
+	/* The data offsets of the chunks of MFT entry 5 in the order they were passed
+	 */
+	off64_t data_offsets[ 8 ];
+
+	/* The number of chunks of MFT entry 5
+	 */
+	int number_of_chunks;
+
+	/* The size of the data passed per MFT entry, 5 and 7
+	 */
+	size64_t data_sizes[ 2 ];
+
+	/* The number of times the end of file was passed per MFT entry, 5 and 7
+	 */
+	int number_of_end_of_files[ 2 ];
+};
+
+/* Test callback function that checks the data passed for MFT entries 5 and 7
+ * The data of the volume consists of 4096-byte blocks filled with the block number + 1
+ * Returns 1 if successful or -1 on error
+ */
+int fsntfs_test_bulk_read_read_callback(
+     uint64_t mft_entry_index,
+     off64_t data_offset,
+     const uint8_t *data,
+     size_t data_size,
+     void *callback_data )
+{
+	fsntfs_test_bulk_read_values_t *values = (fsntfs_test_bulk_read_values_t *) callback_data;
+	uint8_t expected_value                 = 0;
+	int file_index                         = 0;
+
+	if( ( values == NULL )
+	 || ( data == NULL )
+	 || ( data_size == 0 ) )
+	{
+		return( -1 );
+	}
+	if( mft_entry_index == 5 )
+	{
+		/* MFT entry 5 consists of block 2, a sparse block and block 0
+		 */
+		if( data_offset < 4096 )
+		{
+			expected_value = 3;
+		}
+		else if( data_offset < 8192 )
+		{
+			expected_value = 0;
+		}
+		else
+		{
+			expected_value = 1;
+		}
+		if( values->number_of_chunks >= 8 )
+		{
+			return( -1 );
+		}
+		values->data_offsets[ values->number_of_chunks++ ] = data_offset;
+
+		file_index = 0;
+	}
+	else if( mft_entry_index == 7 )
+	{
+		/* MFT entry 7 consists of block 1
+		 */
+		expected_value = 2;
+		file_index     = 1;
+	}
+	else
+	{
+		return( -1 );
+	}
+	/* No data should be passed after the end of file
+	 */
+	if( values->number_of_end_of_files[ file_index ] != 0 )
+	{
+		return( -1 );
+	}
+	if( ( data[ 0 ] != expected_value )
+	 || ( data[ data_size - 1 ] != expected_value ) )
+	{
+		return( -1 );
+	}
+	values->data_sizes[ file_index ] += data_size;
+
+	return( 1 );
+}
+
+/* Test end of file callback function that checks all data was passed for MFT entries 5 and 7
+ * Returns 1 if successful or -1 on error
+ */
+int fsntfs_test_bulk_read_read_end_of_file_callback(
+     uint64_t mft_entry_index,
+     size64_t data_size,
+     void *callback_data )
+{
+	fsntfs_test_bulk_read_values_t *values = (fsntfs_test_bulk_read_values_t *) callback_data;
+	int file_index                         = 0;
+
+	if( values == NULL )
+	{
+		return( -1 );
+	}
+	if( mft_entry_index == 5 )
+	{
+		file_index = 0;
+	}
+	else if( mft_entry_index == 7 )
+	{
+		file_index = 1;
+	}
+	else
+	{
+		return( -1 );
+	}
+	if( values->data_sizes[ file_index ] != data_size )
+	{
+		return( -1 );
+	}
+	values->number_of_end_of_files[ file_index ] += 1;
+
+	return( 1 );
+}
+
+/* Tests the libfsntfs_bulk_read_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_bulk_read_initialize(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libfsntfs_bulk_read_t *bulk_read = NULL;
+	libfsntfs_io_handle_t *io_handle = NULL;
+	size_t total_data_size           = 0;
+	int result                       = 0;
+
+#if defined( HAVE_FSNTFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests  = 3;
+	int number_of_memset_fail_tests  = 2;
+	int test_number                  = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = libfsntfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_bulk_read_initialize(
+	          &bulk_read,
+	          io_handle,
+	          &fsntfs_test_bulk_read_callback,
+	          NULL,
+	          &total_data_size,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "bulk_read",
+	 bulk_read );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_bulk_read_free(
+	          &bulk_read,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "bulk_read",
+	 bulk_read );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_bulk_read_initialize(
+	          NULL,
+	          io_handle,
+	          &fsntfs_test_bulk_read_callback,
+	          NULL,
+	          &total_data_size,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	bulk_read = (libfsntfs_bulk_read_t *) 0x12345678UL;
+
+	result = libfsntfs_bulk_read_initialize(
+	          &bulk_read,
+	          io_handle,
+	          &fsntfs_test_bulk_read_callback,
+	          NULL,
+	          &total_data_size,
+	          &error );
+
+	bulk_read = NULL;
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_bulk_read_initialize(
+	          &bulk_read,
+	          NULL,
+	          &fsntfs_test_bulk_read_callback,
+	          NULL,
+	          &total_data_size,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_bulk_read_initialize(
+	          &bulk_read,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          &total_data_size,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSNTFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsntfs_bulk_read_initialize with malloc failing
+		 */
+		fsntfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsntfs_bulk_read_initialize(
+		          &bulk_read,
+		          io_handle,
+		          &fsntfs_test_bulk_read_callback,
+		          NULL,
+		          &total_data_size,
+		          &error );
+
+		if( fsntfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsntfs_test_malloc_attempts_before_fail = -1;
+
+			if( bulk_read != NULL )
+			{
+				libfsntfs_bulk_read_free(
+				 &bulk_read,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSNTFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSNTFS_TEST_ASSERT_IS_NULL(
+			 "bulk_read",
+			 bulk_read );
+
+			FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsntfs_bulk_read_initialize with memset failing
+		 */
+		fsntfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsntfs_bulk_read_initialize(
+		          &bulk_read,
+		          io_handle,
+		          &fsntfs_test_bulk_read_callback,
+		          NULL,
+		          &total_data_size,
+		          &error );
+
+		if( fsntfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsntfs_test_memset_attempts_before_fail = -1;
+
+			if( bulk_read != NULL )
+			{
+				libfsntfs_bulk_read_free(
+				 &bulk_read,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSNTFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSNTFS_TEST_ASSERT_IS_NULL(
+			 "bulk_read",
+			 bulk_read );
+
+			FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSNTFS_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libfsntfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( bulk_read != NULL )
+	{
+		libfsntfs_bulk_read_free(
+		 &bulk_read,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsntfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_bulk_read_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_bulk_read_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsntfs_bulk_read_free(
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_bulk_read_append_range function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_bulk_read_append_range(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libfsntfs_bulk_read_t *bulk_read = NULL;
+	libfsntfs_io_handle_t *io_handle = NULL;
+	size_t total_data_size           = 0;
+	int range_index                  = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfsntfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_bulk_read_initialize(
+	          &bulk_read,
+	          io_handle,
+	          &fsntfs_test_bulk_read_callback,
+	          NULL,
+	          &total_data_size,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "bulk_read",
+	 bulk_read );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( range_index = 0;
+	     range_index < 300;
+	     range_index++ )
+	{
+		result = libfsntfs_bulk_read_append_range(
+		          bulk_read,
+		          (uint64_t) range_index,
+		          0,
+		          (off64_t) ( 300 - range_index ) * 4096,
+		          4096,
+		          &error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSNTFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "bulk_read->number_of_ranges",
+	 bulk_read->number_of_ranges,
+	 300 );
+
+	result = libfsntfs_bulk_read_append_range(
+	          bulk_read,
+	          300,
+	          0,
+	          -1,
+	          4096,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_bulk_read_append_range(
+	          NULL,
+	          0,
+	          0,
+	          0,
+	          4096,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_bulk_read_append_range(
+	          bulk_read,
+	          0,
+	          -1,
+	          0,
+	          4096,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_bulk_read_append_range(
+	          bulk_read,
+	          0,
+	          0,
+	          -2,
+	          4096,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_bulk_read_append_range(
+	          bulk_read,
+	          0,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsntfs_bulk_read_free(
+	          &bulk_read,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "bulk_read",
+	 bulk_read );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( bulk_read != NULL )
+	{
+		libfsntfs_bulk_read_free(
+		 &bulk_read,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsntfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_bulk_read_range_compare function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_bulk_read_range_compare(
+     void )
+{
+	libfsntfs_bulk_read_range_t first_range;
+	libfsntfs_bulk_read_range_t second_range;
+
+	int result = 0;
+
+	first_range.mft_entry_index  = 5;
+	first_range.data_offset      = 0;
+	first_range.volume_offset    = 8192;
+	first_range.size             = 4096;
+
+	second_range.mft_entry_index = 5;
+	second_range.data_offset     = 4096;
+	second_range.volume_offset   = 4096;
+	second_range.size            = 4096;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_bulk_read_range_compare(
+	          &first_range,
+	          &second_range );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfsntfs_bulk_read_range_compare(
+	          &second_range,
+	          &first_range );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	result = libfsntfs_bulk_read_range_compare(
+	          &first_range,
+	          &first_range );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Ranges filled with 0-byte values are sorted by MFT entry index and data offset
+	 */
+	first_range.volume_offset  = -1;
+	second_range.volume_offset = -1;
+
+	result = libfsntfs_bulk_read_range_compare(
+	          &first_range,
+	          &second_range );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	second_range.volume_offset = 0;
+
+	result = libfsntfs_bulk_read_range_compare(
+	          &first_range,
+	          &second_range );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libfsntfs_bulk_read_read function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_bulk_read_read(
+     void )
+{
+	uint8_t volume_data[ 16384 ];
+
+	fsntfs_test_bulk_read_values_t values;
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libfsntfs_bulk_read_t *bulk_read = NULL;
+	libfsntfs_io_handle_t *io_handle = NULL;
+	void *memset_result              = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	memset_result = memory_set(
+	                 &values,
+	                 0,
+	                 sizeof( fsntfs_test_bulk_read_values_t ) );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	memset_result = memory_set(
+	                 &( volume_data[ 0 ] ),
+	                 1,
+	                 4096 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	memset_result = memory_set(
+	                 &( volume_data[ 4096 ] ),
+	                 2,
+	                 4096 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	memset_result = memory_set(
+	                 &( volume_data[ 8192 ] ),
+	                 3,
+	                 4096 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	memset_result = memory_set(
+	                 &( volume_data[ 12288 ] ),
+	                 4,
+	                 4096 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	result = libfsntfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_bulk_read_initialize(
+	          &bulk_read,
+	          io_handle,
+	          &fsntfs_test_bulk_read_read_callback,
+	          &fsntfs_test_bulk_read_read_end_of_file_callback,
+	          &values,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "bulk_read",
+	 bulk_read );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* MFT entry 5 consists of block 2, a sparse block and block 0
+	 */
+	result = libfsntfs_bulk_read_append_range(
+	          bulk_read,
+	          5,
+	          0,
+	          8192,
+	          4096,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_bulk_read_append_range(
+	          bulk_read,
+	          5,
+	          4096,
+	          -1,
+	          4096,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_bulk_read_append_range(
+	          bulk_read,
+	          5,
+	          8192,
+	          0,
+	          4096,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* MFT entry 7 consists of block 1
+	 */
+	result = libfsntfs_bulk_read_append_range(
+	          bulk_read,
+	          7,
+	          0,
+	          4096,
+	          4096,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "bulk_read->number_of_files",
+	 bulk_read->number_of_files,
+	 2 );
+
+	/* Initialize file IO handle
+	 */
+	result = fsntfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          volume_data,
+	          16384,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_bulk_read_read(
+	          bulk_read,
+	          file_io_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The chunks of a file are passed in volume order, with the sparse ranges first
+	 */
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "values.number_of_chunks",
+	 values.number_of_chunks,
+	 3 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "values.data_offsets[ 0 ]",
+	 (int64_t) values.data_offsets[ 0 ],
+	 (int64_t) 4096 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "values.data_offsets[ 1 ]",
+	 (int64_t) values.data_offsets[ 1 ],
+	 (int64_t) 8192 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "values.data_offsets[ 2 ]",
+	 (int64_t) values.data_offsets[ 2 ],
+	 (int64_t) 0 );
+
+	/* The end of file is passed once, after all data of a file was passed
+	 */
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "values.data_sizes[ 0 ]",
+	 (uint64_t) values.data_sizes[ 0 ],
+	 (uint64_t) 12288 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "values.number_of_end_of_files[ 0 ]",
+	 values.number_of_end_of_files[ 0 ],
+	 1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "values.data_sizes[ 1 ]",
+	 (uint64_t) values.data_sizes[ 1 ],
+	 (uint64_t) 4096 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "values.number_of_end_of_files[ 1 ]",
+	 values.number_of_end_of_files[ 1 ],
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_bulk_read_read(
+	          NULL,
+	          file_io_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up file IO handle
+	 */
+	result = fsntfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfsntfs_bulk_read_free(
+	          &bulk_read,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "bulk_read",
+	 bulk_read );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( bulk_read != NULL )
+	{
+		libfsntfs_bulk_read_free(
+		 &bulk_read,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsntfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSNTFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSNTFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_bulk_read_initialize",
+	 fsntfs_test_bulk_read_initialize );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_bulk_read_free",
+	 fsntfs_test_bulk_read_free );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_bulk_read_append_range",
+	 fsntfs_test_bulk_read_append_range );
+
+	/* TODO: add tests for libfsntfs_bulk_read_append_mft_entry */
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_bulk_read_range_compare",
+	 fsntfs_test_bulk_read_range_compare );
+
+	/* TODO: add tests for libfsntfs_bulk_read_pass_buffer */
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_bulk_read_read",
+	 fsntfs_test_bulk_read_read );
+
+	/* TODO: add tests for libfsntfs_bulk_read_read_file_entry */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -36,6 +36,7 @@
 
 #include "../libfsntfs/libfsntfs_cluster_block_stream.h"
 #include "../libfsntfs/libfsntfs_definitions.h"
+#include "../libfsntfs/libfsntfs_extent_data_handle.h"
 #include "../libfsntfs/libfsntfs_io_handle.h"
 #include "../libfsntfs/libfsntfs_mft_attribute.h"
 
@@ -916,6 +917,7 @@ int fsntfs_test_cluster_block_stream_initialize_from_compressed_stream(
 	 */
 	result = libfsntfs_cluster_block_stream_initialize_from_compressed_stream(
 	          &cluster_block_stream,
+	          io_handle,
 	          compressed_data_stream,
 	          mft_attribute,
 	          LIBFSNTFS_COMPRESSION_METHOD_LZXPRESS_HUFFMAN,
@@ -972,6 +974,7 @@ int fsntfs_test_cluster_block_stream_initialize_from_compressed_stream(
 	 */
 	result = libfsntfs_cluster_block_stream_initialize_from_compressed_stream(
 	          NULL,
+	          io_handle,
 	          compressed_data_stream,
 	          mft_attribute,
 	          LIBFSNTFS_COMPRESSION_METHOD_LZXPRESS_HUFFMAN,
@@ -992,6 +995,7 @@ int fsntfs_test_cluster_block_stream_initialize_from_compressed_stream(
 	result = libfsntfs_cluster_block_stream_initialize_from_compressed_stream(
 	          &cluster_block_stream,
 	          NULL,
+	          compressed_data_stream,
 	          mft_attribute,
 	          LIBFSNTFS_COMPRESSION_METHOD_LZXPRESS_HUFFMAN,
 	          &error );
@@ -1010,6 +1014,27 @@ int fsntfs_test_cluster_block_stream_initialize_from_compressed_stream(
 
 	result = libfsntfs_cluster_block_stream_initialize_from_compressed_stream(
 	          &cluster_block_stream,
+	          io_handle,
+	          NULL,
+	          mft_attribute,
+	          LIBFSNTFS_COMPRESSION_METHOD_LZXPRESS_HUFFMAN,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_cluster_block_stream_initialize_from_compressed_stream(
+	          &cluster_block_stream,
+	          io_handle,
 	          compressed_data_stream,
 	          NULL,
 	          LIBFSNTFS_COMPRESSION_METHOD_LZXPRESS_HUFFMAN,
@@ -1039,6 +1064,7 @@ int fsntfs_test_cluster_block_stream_initialize_from_compressed_stream(
 
 		result = libfsntfs_cluster_block_stream_initialize_from_compressed_stream(
 		          &cluster_block_stream,
+		          io_handle,
 		          compressed_data_stream,
 		          mft_attribute,
 		          LIBFSNTFS_COMPRESSION_METHOD_LZXPRESS_HUFFMAN,
@@ -1450,6 +1476,454 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsntfs_cluster_block_stream_get_range_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_cluster_block_stream_get_range_offset(
+     void )
+{
+	uint8_t buffer[ 16384 ];
+
+	libcerror_error_t *error                      = NULL;
+	libfdata_stream_t *cluster_block_stream       = NULL;
+	libfsntfs_extent_data_handle_t *extents_index = NULL;
+	off64_t offset                                = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libfsntfs_cluster_block_stream_initialize_from_data(
+	          &cluster_block_stream,
+	          buffer,
+	          16384,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "cluster_block_stream",
+	 cluster_block_stream );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_extent_data_handle_initialize(
+	          &extents_index,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extents_index",
+	 extents_index );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_extent_data_handle_append_extent(
+	          extents_index,
+	          8192,
+	          4096,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_extent_data_handle_append_extent(
+	          extents_index,
+	          0,
+	          8192,
+	          LIBFSNTFS_EXTENT_FLAG_IS_SPARSE,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_extent_data_handle_append_extent(
+	          extents_index,
+	          16384,
+	          4096,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The data consists of 4096 bytes of data, 8192 bytes sparse and 4096 bytes of data
+	 */
+	offset = libfsntfs_cluster_block_stream_get_range_offset(
+	          cluster_block_stream,
+	          extents_index,
+	          0,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libfsntfs_cluster_block_stream_get_range_offset(
+	          cluster_block_stream,
+	          extents_index,
+	          0,
+	          1,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 4096 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libfsntfs_cluster_block_stream_get_range_offset(
+	          cluster_block_stream,
+	          extents_index,
+	          1024,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 1024 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libfsntfs_cluster_block_stream_get_range_offset(
+	          cluster_block_stream,
+	          extents_index,
+	          4096,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 12288 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libfsntfs_cluster_block_stream_get_range_offset(
+	          cluster_block_stream,
+	          extents_index,
+	          5000,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 12288 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libfsntfs_cluster_block_stream_get_range_offset(
+	          cluster_block_stream,
+	          extents_index,
+	          5000,
+	          1,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 5000 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libfsntfs_cluster_block_stream_get_range_offset(
+	          cluster_block_stream,
+	          extents_index,
+	          12288,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 12288 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The end of the data is considered the start of a sparse range
+	 */
+	offset = libfsntfs_cluster_block_stream_get_range_offset(
+	          cluster_block_stream,
+	          extents_index,
+	          12288,
+	          1,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 16384 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libfsntfs_cluster_block_stream_get_range_offset(
+	          cluster_block_stream,
+	          extents_index,
+	          16000,
+	          1,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 16384 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* An offset at or beyond the end of the data is kept
+	 */
+	offset = libfsntfs_cluster_block_stream_get_range_offset(
+	          cluster_block_stream,
+	          extents_index,
+	          16384,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 16384 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libfsntfs_cluster_block_stream_get_range_offset(
+	          cluster_block_stream,
+	          extents_index,
+	          16384,
+	          1,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 16384 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libfsntfs_cluster_block_stream_get_range_offset(
+	          cluster_block_stream,
+	          extents_index,
+	          20480,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 20480 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libfsntfs_cluster_block_stream_get_range_offset(
+	          cluster_block_stream,
+	          extents_index,
+	          20480,
+	          1,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 20480 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a stream without an extents index, which consists of data only
+	 */
+	offset = libfsntfs_cluster_block_stream_get_range_offset(
+	          cluster_block_stream,
+	          NULL,
+	          5000,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 5000 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libfsntfs_cluster_block_stream_get_range_offset(
+	          cluster_block_stream,
+	          NULL,
+	          5000,
+	          1,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 16384 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	offset = libfsntfs_cluster_block_stream_get_range_offset(
+	          cluster_block_stream,
+	          extents_index,
+	          -1,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offset = libfsntfs_cluster_block_stream_get_range_offset(
+	          NULL,
+	          extents_index,
+	          0,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsntfs_extent_data_handle_free(
+	          &extents_index,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "extents_index",
+	 extents_index );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_stream_free(
+	          &cluster_block_stream,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "cluster_block_stream",
+	 cluster_block_stream );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extents_index != NULL )
+	{
+		libfsntfs_extent_data_handle_free(
+		 &extents_index,
+		 NULL );
+	}
+	if( cluster_block_stream != NULL )
+	{
+		libfdata_stream_free(
+		 &cluster_block_stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
 
 /* The main program
@@ -1489,6 +1963,14 @@ int main(
 	 "libfsntfs_cluster_block_stream_initialize",
 	 fsntfs_test_cluster_block_stream_initialize );
 
+	/* TODO: add tests for libfsntfs_cluster_block_stream_initialize_extents_index */
+
+	/* TODO: add tests for libfsntfs_cluster_block_stream_read_chunk_at_offset */
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_cluster_block_stream_get_range_offset",
+	 fsntfs_test_cluster_block_stream_get_range_offset );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -0,0 +1,1293 @@
+/*
+ * Library extent_data_handle type test program
+ *
+ * Copyright (C) 2010-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsntfs_test_libcerror.h"
+#include "fsntfs_test_libfsntfs.h"
+#include "fsntfs_test_macros.h"
+#include "fsntfs_test_memory.h"
+#include "fsntfs_test_unused.h"
+
+#include "../libfsntfs/libfsntfs_extent_data_handle.h"
+#include "../libfsntfs/libfsntfs_libfdata.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+
+/* Creates an extent data handle with 3 sparse extents of 4096, 8192 and 4096 bytes
+ * Returns 1 if successful or -1 on error
+ */
+int fsntfs_test_extent_data_handle_initialize_with_extents(
+     libfsntfs_extent_data_handle_t **extent_data_handle,
+     libcerror_error_t **error )
+{
+	int result = 0;
+
+	result = libfsntfs_extent_data_handle_initialize(
+	          extent_data_handle,
+	          error );
+
+	if( result == 1 )
+	{
+		result = libfsntfs_extent_data_handle_append_extent(
+		          *extent_data_handle,
+		          0,
+		          4096,
+		          LIBFDATA_RANGE_FLAG_IS_SPARSE,
+		          error );
+	}
+	if( result == 1 )
+	{
+		result = libfsntfs_extent_data_handle_append_extent(
+		          *extent_data_handle,
+		          0,
+		          8192,
+		          LIBFDATA_RANGE_FLAG_IS_SPARSE,
+		          error );
+	}
+	if( result == 1 )
+	{
+		result = libfsntfs_extent_data_handle_append_extent(
+		          *extent_data_handle,
+		          0,
+		          4096,
+		          LIBFDATA_RANGE_FLAG_IS_SPARSE,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libfsntfs_extent_data_handle_free(
+		 extent_data_handle,
+		 NULL );
+	}
+	return( result );
+}
+
+/* Tests the libfsntfs_extent_data_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_extent_data_handle_initialize(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libfsntfs_extent_data_handle_t *extent_data_handle = NULL;
+	int result                                         = 0;
+
+#if defined( HAVE_FSNTFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests                    = 1;
+	int number_of_memset_fail_tests                    = 1;
+	int test_number                                    = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_extent_data_handle_initialize(
+	          &extent_data_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_data_handle",
+	 extent_data_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_extent_data_handle_free(
+	          &extent_data_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "extent_data_handle",
+	 extent_data_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_extent_data_handle_initialize(
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	extent_data_handle = (libfsntfs_extent_data_handle_t *) 0x12345678UL;
+
+	result = libfsntfs_extent_data_handle_initialize(
+	          &extent_data_handle,
+	          &error );
+
+	extent_data_handle = NULL;
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSNTFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsntfs_extent_data_handle_initialize with malloc failing
+		 */
+		fsntfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsntfs_extent_data_handle_initialize(
+		          &extent_data_handle,
+		          &error );
+
+		if( fsntfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsntfs_test_malloc_attempts_before_fail = -1;
+
+			if( extent_data_handle != NULL )
+			{
+				libfsntfs_extent_data_handle_free(
+				 &extent_data_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSNTFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSNTFS_TEST_ASSERT_IS_NULL(
+			 "extent_data_handle",
+			 extent_data_handle );
+
+			FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsntfs_extent_data_handle_initialize with memset failing
+		 */
+		fsntfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsntfs_extent_data_handle_initialize(
+		          &extent_data_handle,
+		          &error );
+
+		if( fsntfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsntfs_test_memset_attempts_before_fail = -1;
+
+			if( extent_data_handle != NULL )
+			{
+				libfsntfs_extent_data_handle_free(
+				 &extent_data_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSNTFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSNTFS_TEST_ASSERT_IS_NULL(
+			 "extent_data_handle",
+			 extent_data_handle );
+
+			FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSNTFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_data_handle != NULL )
+	{
+		libfsntfs_extent_data_handle_free(
+		 &extent_data_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_extent_data_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_extent_data_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsntfs_extent_data_handle_free(
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_extent_data_handle_append_extent function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_extent_data_handle_append_extent(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libfsntfs_extent_data_handle_t *extent_data_handle = NULL;
+	int extent_index                                   = 0;
+	int number_of_extents                              = 0;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfsntfs_extent_data_handle_initialize(
+	          &extent_data_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_data_handle",
+	 extent_data_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( extent_index = 0;
+	     extent_index < 64;
+	     extent_index++ )
+	{
+		result = libfsntfs_extent_data_handle_append_extent(
+		          extent_data_handle,
+		          (off64_t) extent_index * 8192,
+		          4096,
+		          0,
+		          &error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSNTFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Extents of size 0 are ignored
+	 */
+	result = libfsntfs_extent_data_handle_append_extent(
+	          extent_data_handle,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_extent_data_handle_get_number_of_extents(
+	          extent_data_handle,
+	          &number_of_extents,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extents",
+	 number_of_extents,
+	 64 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "extent_data_handle->data_size",
+	 extent_data_handle->data_size,
+	 (uint64_t) 64 * 4096 );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_extent_data_handle_append_extent(
+	          NULL,
+	          0,
+	          4096,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_extent_data_handle_append_extent(
+	          extent_data_handle,
+	          -1,
+	          4096,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_extent_data_handle_append_extent(
+	          extent_data_handle,
+	          0,
+	          (size64_t) INT64_MAX,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsntfs_extent_data_handle_free(
+	          &extent_data_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "extent_data_handle",
+	 extent_data_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_data_handle != NULL )
+	{
+		libfsntfs_extent_data_handle_free(
+		 &extent_data_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_extent_data_handle_get_extent_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_extent_data_handle_get_extent_by_index(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libfsntfs_extent_data_handle_t *extent_data_handle = NULL;
+	size64_t extent_size                               = 0;
+	off64_t extent_offset                              = 0;
+	uint32_t extent_flags                              = 0;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = fsntfs_test_extent_data_handle_initialize_with_extents(
+	          &extent_data_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_data_handle",
+	 extent_data_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_extent_data_handle_get_extent_by_index(
+	          extent_data_handle,
+	          2,
+	          &extent_offset,
+	          &extent_size,
+	          &extent_flags,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "extent_offset",
+	 (int64_t) extent_offset,
+	 (int64_t) 12288 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "extent_size",
+	 (uint64_t) extent_size,
+	 (uint64_t) 4096 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT32(
+	 "extent_flags",
+	 extent_flags,
+	 (uint32_t) LIBFDATA_RANGE_FLAG_IS_SPARSE );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_extent_data_handle_get_extent_by_index(
+	          NULL,
+	          0,
+	          &extent_offset,
+	          &extent_size,
+	          &extent_flags,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_extent_data_handle_get_extent_by_index(
+	          extent_data_handle,
+	          3,
+	          &extent_offset,
+	          &extent_size,
+	          &extent_flags,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_extent_data_handle_get_extent_by_index(
+	          extent_data_handle,
+	          0,
+	          NULL,
+	          &extent_size,
+	          &extent_flags,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_extent_data_handle_get_extent_by_index(
+	          extent_data_handle,
+	          0,
+	          &extent_offset,
+	          NULL,
+	          &extent_flags,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_extent_data_handle_get_extent_by_index(
+	          extent_data_handle,
+	          0,
+	          &extent_offset,
+	          &extent_size,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsntfs_extent_data_handle_free(
+	          &extent_data_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "extent_data_handle",
+	 extent_data_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_data_handle != NULL )
+	{
+		libfsntfs_extent_data_handle_free(
+		 &extent_data_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_extent_data_handle_get_extent_index_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_extent_data_handle_get_extent_index_at_offset(
+     void )
+{
+	off64_t test_offsets[ 7 ]                          = { 0, 4096, 12287, 12288, 2048, 16383, 8192 };
+	int expected_extent_indexes[ 7 ]                   = { 0, 1, 1, 2, 0, 2, 1 };
+
+	libcerror_error_t *error                           = NULL;
+	libfsntfs_extent_data_handle_t *extent_data_handle = NULL;
+	int extent_index                                   = 0;
+	int result                                         = 0;
+	int test_index                                     = 0;
+
+	/* Initialize test
+	 */
+	result = fsntfs_test_extent_data_handle_initialize_with_extents(
+	          &extent_data_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_data_handle",
+	 extent_data_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases, both sequential and random access
+	 */
+	for( test_index = 0;
+	     test_index < 7;
+	     test_index++ )
+	{
+		extent_index = -1;
+
+		result = libfsntfs_extent_data_handle_get_extent_index_at_offset(
+		          extent_data_handle,
+		          test_offsets[ test_index ],
+		          &extent_index,
+		          &error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "extent_index",
+		 extent_index,
+		 expected_extent_indexes[ test_index ] );
+
+		FSNTFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfsntfs_extent_data_handle_get_extent_index_at_offset(
+	          extent_data_handle,
+	          16384,
+	          &extent_index,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_extent_data_handle_get_extent_index_at_offset(
+	          NULL,
+	          0,
+	          &extent_index,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_extent_data_handle_get_extent_index_at_offset(
+	          extent_data_handle,
+	          -1,
+	          &extent_index,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_extent_data_handle_get_extent_index_at_offset(
+	          extent_data_handle,
+	          0,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsntfs_extent_data_handle_free(
+	          &extent_data_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "extent_data_handle",
+	 extent_data_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_data_handle != NULL )
+	{
+		libfsntfs_extent_data_handle_free(
+		 &extent_data_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_extent_data_handle_read_segment_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_extent_data_handle_read_segment_data(
+     void )
+{
+	uint8_t segment_data[ 8192 ];
+
+	libcerror_error_t *error                           = NULL;
+	libfsntfs_extent_data_handle_t *extent_data_handle = NULL;
+	ssize_t read_count                                 = 0;
+	off64_t offset                                     = 0;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = fsntfs_test_extent_data_handle_initialize_with_extents(
+	          &extent_data_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_data_handle",
+	 extent_data_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases, a read that spans multiple sparse extents
+	 */
+	offset = libfsntfs_extent_data_handle_seek_segment_offset(
+	          extent_data_handle,
+	          NULL,
+	          0,
+	          0,
+	          2048,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 2048 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libfsntfs_extent_data_handle_read_segment_data(
+	              extent_data_handle,
+	              NULL,
+	              0,
+	              0,
+	              segment_data,
+	              8192,
+	              0,
+	              0,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 8192 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT8(
+	 "segment_data[ 8191 ]",
+	 segment_data[ 8191 ],
+	 (uint8_t) 0 );
+
+	/* Test reading at the end of the data
+	 */
+	offset = libfsntfs_extent_data_handle_seek_segment_offset(
+	          extent_data_handle,
+	          NULL,
+	          0,
+	          0,
+	          16384,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 16384 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libfsntfs_extent_data_handle_read_segment_data(
+	              extent_data_handle,
+	              NULL,
+	              0,
+	              0,
+	              segment_data,
+	              8192,
+	              0,
+	              0,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libfsntfs_extent_data_handle_read_segment_data(
+	              NULL,
+	              NULL,
+	              0,
+	              0,
+	              segment_data,
+	              8192,
+	              0,
+	              0,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsntfs_extent_data_handle_read_segment_data(
+	              extent_data_handle,
+	              NULL,
+	              0,
+	              0,
+	              NULL,
+	              8192,
+	              0,
+	              0,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsntfs_extent_data_handle_read_segment_data(
+	              extent_data_handle,
+	              NULL,
+	              0,
+	              0,
+	              segment_data,
+	              (size_t) SSIZE_MAX + 1,
+	              0,
+	              0,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsntfs_extent_data_handle_free(
+	          &extent_data_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "extent_data_handle",
+	 extent_data_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_data_handle != NULL )
+	{
+		libfsntfs_extent_data_handle_free(
+		 &extent_data_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_extent_data_handle_seek_segment_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_extent_data_handle_seek_segment_offset(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libfsntfs_extent_data_handle_t *extent_data_handle = NULL;
+	off64_t offset                                     = 0;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfsntfs_extent_data_handle_initialize(
+	          &extent_data_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_data_handle",
+	 extent_data_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	offset = libfsntfs_extent_data_handle_seek_segment_offset(
+	          extent_data_handle,
+	          NULL,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	offset = libfsntfs_extent_data_handle_seek_segment_offset(
+	          NULL,
+	          NULL,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offset = libfsntfs_extent_data_handle_seek_segment_offset(
+	          extent_data_handle,
+	          NULL,
+	          0,
+	          0,
+	          -1,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsntfs_extent_data_handle_free(
+	          &extent_data_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "extent_data_handle",
+	 extent_data_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_data_handle != NULL )
+	{
+		libfsntfs_extent_data_handle_free(
+		 &extent_data_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSNTFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSNTFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_extent_data_handle_initialize",
+	 fsntfs_test_extent_data_handle_initialize );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_extent_data_handle_free",
+	 fsntfs_test_extent_data_handle_free );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_extent_data_handle_append_extent",
+	 fsntfs_test_extent_data_handle_append_extent );
+
+	/* TODO add tests for libfsntfs_extent_data_handle_append_data_runs */
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_extent_data_handle_get_extent_by_index",
+	 fsntfs_test_extent_data_handle_get_extent_by_index );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_extent_data_handle_get_extent_index_at_offset",
+	 fsntfs_test_extent_data_handle_get_extent_index_at_offset );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_extent_data_handle_read_segment_data",
+	 fsntfs_test_extent_data_handle_read_segment_data );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_extent_data_handle_seek_segment_offset",
+	 fsntfs_test_extent_data_handle_seek_segment_offset );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
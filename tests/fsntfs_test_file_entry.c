@@ -1970,6 +1970,14 @@ on_error:
 
 /* TODO: add tests for libfsntfs_internal_file_entry_get_standard_information_attribute */
 
+/* TODO: add tests for libfsntfs_internal_file_entry_read_directory_entries_tree */
+
+/* TODO: add tests for libfsntfs_internal_file_entry_read_data_extents */
+
+/* TODO: add tests for libfsntfs_internal_file_entry_read_resident_data */
+
+/* TODO: add tests for libfsntfs_internal_file_entry_seek_resident_data_offset */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
 
 /* Tests the libfsntfs_file_entry_get_file_reference function
@@ -7510,6 +7518,340 @@ on_error:
 	return( 0 );
 }
 
+/* Callback function for the libfsntfs_file_entry_read_buffer_at_offset_async tests
+ */
+void fsntfs_test_file_entry_read_buffer_at_offset_async_callback(
+      libfsntfs_file_entry_t *file_entry FSNTFS_TEST_ATTRIBUTE_UNUSED,
+      void *buffer FSNTFS_TEST_ATTRIBUTE_UNUSED,
+      ssize_t read_count FSNTFS_TEST_ATTRIBUTE_UNUSED,
+      void *callback_data FSNTFS_TEST_ATTRIBUTE_UNUSED )
+{
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( file_entry )
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( buffer )
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( read_count )
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( callback_data )
+}
+
+/* Tests the libfsntfs_file_entry_read_buffer_at_offset_async function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_file_entry_read_buffer_at_offset_async(
+     libfsntfs_file_entry_t *file_entry )
+{
+	uint8_t buffer[ FSNTFS_TEST_FILE_ENTRY_READ_BUFFER_SIZE ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsntfs_file_entry_read_buffer_at_offset_async(
+	          NULL,
+	          buffer,
+	          FSNTFS_TEST_FILE_ENTRY_READ_BUFFER_SIZE,
+	          0,
+	          &fsntfs_test_file_entry_read_buffer_at_offset_async_callback,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_file_entry_read_buffer_at_offset_async(
+	          file_entry,
+	          NULL,
+	          FSNTFS_TEST_FILE_ENTRY_READ_BUFFER_SIZE,
+	          0,
+	          &fsntfs_test_file_entry_read_buffer_at_offset_async_callback,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_file_entry_read_buffer_at_offset_async(
+	          file_entry,
+	          buffer,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &fsntfs_test_file_entry_read_buffer_at_offset_async_callback,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_file_entry_read_buffer_at_offset_async(
+	          file_entry,
+	          buffer,
+	          FSNTFS_TEST_FILE_ENTRY_READ_BUFFER_SIZE,
+	          -1,
+	          &fsntfs_test_file_entry_read_buffer_at_offset_async_callback,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_file_entry_read_buffer_at_offset_async(
+	          file_entry,
+	          buffer,
+	          FSNTFS_TEST_FILE_ENTRY_READ_BUFFER_SIZE,
+	          0,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_file_entry_read_chunk_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_file_entry_read_chunk_at_offset(
+     libfsntfs_file_entry_t *file_entry )
+{
+	uint8_t buffer[ FSNTFS_TEST_FILE_ENTRY_READ_BUFFER_SIZE ];
+
+	libcerror_error_t *error = NULL;
+	size64_t data_size       = 0;
+	ssize_t read_count       = 0;
+	off64_t read_offset      = 0;
+	uint8_t is_sparse        = 0;
+	int result               = 0;
+
+	/* Determine size
+	 */
+	result = libfsntfs_file_entry_get_size(
+	          file_entry,
+	          &data_size,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	while( (size64_t) read_offset < data_size )
+	{
+		read_count = libfsntfs_file_entry_read_chunk_at_offset(
+		              file_entry,
+		              buffer,
+		              FSNTFS_TEST_FILE_ENTRY_READ_BUFFER_SIZE,
+		              read_offset,
+		              &is_sparse,
+		              &error );
+
+		FSNTFS_TEST_ASSERT_GREATER_THAN_INT(
+		 "read_count",
+		 (int) read_count,
+		 0 );
+
+		/* A chunk does not cross a multiple of the buffer size
+		 */
+		FSNTFS_TEST_ASSERT_LESS_THAN_UINT64(
+		 "chunk_end_offset",
+		 (uint64_t) ( ( read_offset % FSNTFS_TEST_FILE_ENTRY_READ_BUFFER_SIZE ) + read_count ),
+		 (uint64_t) FSNTFS_TEST_FILE_ENTRY_READ_BUFFER_SIZE + 1 );
+
+		FSNTFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		read_offset += read_count;
+	}
+	read_count = libfsntfs_file_entry_read_chunk_at_offset(
+	              file_entry,
+	              buffer,
+	              FSNTFS_TEST_FILE_ENTRY_READ_BUFFER_SIZE,
+	              (off64_t) data_size,
+	              &is_sparse,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libfsntfs_file_entry_read_chunk_at_offset(
+	              NULL,
+	              buffer,
+	              FSNTFS_TEST_FILE_ENTRY_READ_BUFFER_SIZE,
+	              0,
+	              &is_sparse,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsntfs_file_entry_read_chunk_at_offset(
+	              file_entry,
+	              NULL,
+	              FSNTFS_TEST_FILE_ENTRY_READ_BUFFER_SIZE,
+	              0,
+	              &is_sparse,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsntfs_file_entry_read_chunk_at_offset(
+	              file_entry,
+	              buffer,
+	              0,
+	              0,
+	              &is_sparse,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsntfs_file_entry_read_chunk_at_offset(
+	              file_entry,
+	              buffer,
+	              FSNTFS_TEST_FILE_ENTRY_READ_BUFFER_SIZE,
+	              -1,
+	              &is_sparse,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsntfs_file_entry_read_chunk_at_offset(
+	              file_entry,
+	              buffer,
+	              FSNTFS_TEST_FILE_ENTRY_READ_BUFFER_SIZE,
+	              0,
+	              NULL,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libfsntfs_file_entry_seek_offset function
  * Returns 1 if successful or 0 if not
  */
@@ -7584,6 +7926,78 @@ int fsntfs_test_file_entry_seek_offset(
 	 "error",
 	 error );
 
+	offset = libfsntfs_file_entry_seek_offset(
+	          file_entry,
+	          0,
+	          LIBFSNTFS_SEEK_HOLE,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	FSNTFS_TEST_ASSERT_LESS_THAN_UINT64(
+	 "offset",
+	 (uint64_t) offset,
+	 (uint64_t) ( size + 1 ) );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libfsntfs_file_entry_seek_offset(
+	          file_entry,
+	          0,
+	          LIBFSNTFS_SEEK_DATA,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	FSNTFS_TEST_ASSERT_LESS_THAN_UINT64(
+	 "offset",
+	 (uint64_t) offset,
+	 (uint64_t) ( size + 1 ) );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* An offset beyond the end of the data is kept
+	 */
+	offset = libfsntfs_file_entry_seek_offset(
+	          file_entry,
+	          (off64_t) ( size + 512 ),
+	          LIBFSNTFS_SEEK_DATA,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) ( size + 512 ) );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libfsntfs_file_entry_seek_offset(
+	          file_entry,
+	          (off64_t) ( size + 512 ),
+	          LIBFSNTFS_SEEK_HOLE,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) ( size + 512 ) );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Reset offset to 0
 	 */
 	offset = libfsntfs_file_entry_seek_offset(
@@ -7639,6 +8053,24 @@ int fsntfs_test_file_entry_seek_offset(
 	libcerror_error_free(
 	 &error );
 
+	offset = libfsntfs_file_entry_seek_offset(
+	          file_entry,
+	          -1,
+	          LIBFSNTFS_SEEK_HOLE,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
 	offset = libfsntfs_file_entry_seek_offset(
 	          file_entry,
 	          -1,
@@ -8565,6 +8997,14 @@ int main(
 
 	/* TODO: add tests for libfsntfs_internal_file_entry_get_standard_information_attribute */
 
+	/* TODO: add tests for libfsntfs_internal_file_entry_read_directory_entries_tree */
+
+	/* TODO: add tests for libfsntfs_internal_file_entry_read_data_extents */
+
+	/* TODO: add tests for libfsntfs_internal_file_entry_read_resident_data */
+
+	/* TODO: add tests for libfsntfs_internal_file_entry_seek_resident_data_offset */
+
 	FSNTFS_TEST_RUN_WITH_ARGS(
 	 "libfsntfs_file_entry_file_reference",
 	 fsntfs_test_file_entry_get_file_reference,
@@ -8746,6 +9186,16 @@ int main(
 	 fsntfs_test_file_entry_read_buffer_at_offset,
 	 file_entry );
 
+	FSNTFS_TEST_RUN_WITH_ARGS(
+	 "libfsntfs_file_entry_read_buffer_at_offset_async",
+	 fsntfs_test_file_entry_read_buffer_at_offset_async,
+	 file_entry );
+
+	FSNTFS_TEST_RUN_WITH_ARGS(
+	 "libfsntfs_file_entry_read_chunk_at_offset",
+	 fsntfs_test_file_entry_read_chunk_at_offset,
+	 file_entry );
+
 	FSNTFS_TEST_RUN_WITH_ARGS(
 	 "libfsntfs_file_entry_seek_offset",
 	 fsntfs_test_file_entry_seek_offset,
@@ -1591,8 +1591,6 @@ int main(
 
 	/* TODO add tests for libfsntfs_file_system_get_number_of_mft_entries */
 
-	/* TODO add tests for libfsntfs_file_system_get_mft_entry_by_index */
-
 	/* TODO add tests for libfsntfs_file_system_get_mft_entry_by_index_no_cache */
 
 	/* TODO add tests for libfsntfs_file_system_get_security_descriptor_values_by_identifier */
@@ -22,6 +22,7 @@
 #include <common.h>
 #include <byte_stream.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -530,6 +531,187 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsntfs_index_entry_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_index_entry_read_data(
+     void )
+{
+	uint8_t index_entry_data[ 4096 ];
+
+	libcerror_error_t *error             = NULL;
+	libfsntfs_index_entry_t *index_entry = NULL;
+	void *memcpy_result                  = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfsntfs_index_entry_initialize(
+	          &index_entry,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "index_entry",
+	 index_entry );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The fix-up values are applied to the data hence use a copy
+	 */
+	memcpy_result = memory_copy(
+	                 index_entry_data,
+	                 fsntfs_test_index_entry_data1,
+	                 sizeof( uint8_t ) * 4096 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memcpy_result",
+	 memcpy_result );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_index_entry_read_data(
+	          NULL,
+	          index_entry_data,
+	          4096,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_index_entry_read_data(
+	          index_entry,
+	          NULL,
+	          4096,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_index_entry_read_data(
+	          index_entry,
+	          index_entry_data,
+	          8,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_index_entry_read_data(
+	          index_entry,
+	          index_entry_data,
+	          4096,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "index_entry->node",
+	 index_entry->node );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_index_entry_read_data(
+	          index_entry,
+	          index_entry_data,
+	          4096,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsntfs_index_entry_free(
+	          &index_entry,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "index_entry",
+	 index_entry );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index_entry != NULL )
+	{
+		libfsntfs_index_entry_free(
+		 &index_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libfsntfs_index_entry_read_file_io_handle function
  * Returns 1 if successful or 0 if not
  */
@@ -862,6 +1044,10 @@ int main(
 	 "libfsntfs_index_entry_free",
 	 fsntfs_test_index_entry_free );
 
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_index_entry_read_data",
+	 fsntfs_test_index_entry_read_data );
+
 	FSNTFS_TEST_RUN(
 	 "libfsntfs_index_entry_read_file_io_handle",
 	 fsntfs_test_index_entry_read_file_io_handle );
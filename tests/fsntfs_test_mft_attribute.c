@@ -640,71 +640,6 @@ int fsntfs_test_mft_attribute_read_data(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_FSNTFS_TEST_MEMORY )
-
-	/* Test libfsntfs_mft_attribute_read_data with malloc failing
-	 */
-	fsntfs_test_malloc_attempts_before_fail = 0;
-
-	result = libfsntfs_mft_attribute_read_data(
-	          mft_attribute,
-	          io_handle,
-	          fsntfs_test_mft_attribute_data1,
-	          88,
-	          &error );
-
-	if( fsntfs_test_malloc_attempts_before_fail != -1 )
-	{
-		fsntfs_test_malloc_attempts_before_fail = -1;
-	}
-	else
-	{
-		FSNTFS_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		FSNTFS_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
-#if defined( OPTIMIZATION_DISABLED )
-
-	/* Test libfsntfs_mft_attribute_read_data with memcpy failing
-	 */
-	fsntfs_test_memcpy_attempts_before_fail = 0;
-
-	result = libfsntfs_mft_attribute_read_data(
-	          mft_attribute,
-	          io_handle,
-	          fsntfs_test_mft_attribute_data1,
-	          88,
-	          &error );
-
-	if( fsntfs_test_memcpy_attempts_before_fail != -1 )
-	{
-		fsntfs_test_memcpy_attempts_before_fail = -1;
-	}
-	else
-	{
-		FSNTFS_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		FSNTFS_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( OPTIMIZATION_DISABLED ) */
-#endif /* defined( HAVE_FSNTFS_TEST_MEMORY ) */
-
 	/* Test error case where size value is invalid
 	 */
 	byte_stream_copy_from_uint32_little_endian(
@@ -963,6 +898,187 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsntfs_mft_attribute_read_data_runs function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_mft_attribute_read_data_runs(
+     libfsntfs_mft_attribute_t *mft_attribute )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "mft_attribute->data_runs",
+	 mft_attribute->data_runs );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "mft_attribute->data_runs_state",
+	 mft_attribute->data_runs_state,
+	 LIBFSNTFS_MFT_ATTRIBUTE_DATA_RUNS_STATE_NOT_DECODED );
+
+	result = libfsntfs_mft_attribute_read_data_runs(
+	          mft_attribute,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "mft_attribute->data_runs",
+	 mft_attribute->data_runs );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "mft_attribute->data_runs_state",
+	 mft_attribute->data_runs_state,
+	 LIBFSNTFS_MFT_ATTRIBUTE_DATA_RUNS_STATE_DECODED );
+
+	/* Test reading the data runs a second time
+	 */
+	result = libfsntfs_mft_attribute_read_data_runs(
+	          mft_attribute,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_mft_attribute_read_data_runs(
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_mft_attribute_copy_data_to_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_mft_attribute_copy_data_to_buffer(
+     libfsntfs_mft_attribute_t *mft_attribute )
+{
+	uint8_t utf8_name[ 5 ]   = { '$', 'S', 'D', 'H', 0 };
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_mft_attribute_copy_data_to_buffer(
+	          mft_attribute,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "mft_attribute->data_buffer",
+	 mft_attribute->data_buffer );
+
+	result = ( mft_attribute->name == mft_attribute->data_buffer );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfsntfs_mft_attribute_compare_name_with_utf8_string(
+	          mft_attribute,
+	          utf8_name,
+	          5,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test copying the data to the buffer a second time
+	 */
+	result = libfsntfs_mft_attribute_copy_data_to_buffer(
+	          mft_attribute,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_mft_attribute_copy_data_to_buffer(
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libfsntfs_mft_attribute_data_is_resident function
  * Returns 1 if successful or 0 if not
  */
@@ -2182,6 +2298,104 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsntfs_mft_attribute_get_data_run_index_at_vcn function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_mft_attribute_get_data_run_index_at_vcn(
+     libfsntfs_mft_attribute_t *mft_attribute )
+{
+	libcerror_error_t *error = NULL;
+	int data_run_index       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	data_run_index = -1;
+
+	result = libfsntfs_mft_attribute_get_data_run_index_at_vcn(
+	          mft_attribute,
+	          0,
+	          &data_run_index,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "data_run_index",
+	 data_run_index,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_mft_attribute_get_data_run_index_at_vcn(
+	          mft_attribute,
+	          0xffffffffffffffffULL,
+	          &data_run_index,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_mft_attribute_get_data_run_index_at_vcn(
+	          NULL,
+	          0,
+	          &data_run_index,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_mft_attribute_get_data_run_index_at_vcn(
+	          mft_attribute,
+	          0,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libfsntfs_mft_attribute_get_data_run_by_index function
  * Returns 1 if successful or 0 if not
  */
@@ -2657,11 +2871,21 @@ int main(
 	 fsntfs_test_mft_attribute_get_data,
 	 mft_attribute1 );
 
+	FSNTFS_TEST_RUN_WITH_ARGS(
+	 "libfsntfs_mft_attribute_read_data_runs",
+	 fsntfs_test_mft_attribute_read_data_runs,
+	 mft_attribute2 );
+
 	FSNTFS_TEST_RUN_WITH_ARGS(
 	 "libfsntfs_mft_attribute_get_number_of_data_runs",
 	 fsntfs_test_mft_attribute_get_number_of_data_runs,
 	 mft_attribute2 );
 
+	FSNTFS_TEST_RUN_WITH_ARGS(
+	 "libfsntfs_mft_attribute_get_data_run_index_at_vcn",
+	 fsntfs_test_mft_attribute_get_data_run_index_at_vcn,
+	 mft_attribute2 );
+
 	FSNTFS_TEST_RUN_WITH_ARGS(
 	 "libfsntfs_mft_attribute_get_data_run_by_index",
 	 fsntfs_test_mft_attribute_get_data_run_by_index,
@@ -2672,6 +2896,13 @@ int main(
 	 fsntfs_test_mft_attribute_get_data_extents_array,
 	 mft_attribute2 );
 
+	/* Run last since this changes the name of mft_attribute1 to reference the data buffer
+	 */
+	FSNTFS_TEST_RUN_WITH_ARGS(
+	 "libfsntfs_mft_attribute_copy_data_to_buffer",
+	 fsntfs_test_mft_attribute_copy_data_to_buffer,
+	 mft_attribute1 );
+
 	/* TODO add tests for libfsntfs_mft_attribute_get_next_attribute */
 
 	/* TODO add tests for libfsntfs_mft_attribute_append_to_chain */
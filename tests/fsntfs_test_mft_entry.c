@@ -530,6 +530,136 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsntfs_mft_entry_add_reference function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_mft_entry_add_reference(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libfsntfs_mft_entry_t *mft_entry        = NULL;
+	libfsntfs_mft_entry_t *shared_mft_entry = NULL;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libfsntfs_mft_entry_initialize(
+	          &mft_entry,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "mft_entry",
+	 mft_entry );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_mft_entry_add_reference(
+	          mft_entry,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "mft_entry->number_of_references",
+	 mft_entry->number_of_references,
+	 2 );
+
+	shared_mft_entry = mft_entry;
+
+	/* Releasing a reference should not free the MFT entry
+	 */
+	result = libfsntfs_mft_entry_free(
+	          &shared_mft_entry,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "shared_mft_entry",
+	 shared_mft_entry );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "mft_entry->number_of_references",
+	 mft_entry->number_of_references,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_mft_entry_add_reference(
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsntfs_mft_entry_free(
+	          &mft_entry,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "mft_entry",
+	 mft_entry );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( mft_entry != NULL )
+	{
+		libfsntfs_mft_entry_free(
+		 &mft_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libfsntfs_mft_entry_read_data function
  * Returns 1 if successful or 0 if not
  */
@@ -2431,6 +2561,10 @@ int main(
 	 "libfsntfs_mft_entry_free",
 	 fsntfs_test_mft_entry_free );
 
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_mft_entry_add_reference",
+	 fsntfs_test_mft_entry_add_reference );
+
 	FSNTFS_TEST_RUN(
 	 "libfsntfs_mft_entry_read_data",
 	 fsntfs_test_mft_entry_read_data );
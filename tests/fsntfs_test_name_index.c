@@ -0,0 +1,1333 @@
+/*
+ * Library name_index type test program
+ *
+ * Copyright (C) 2010-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsntfs_test_libcerror.h"
+#include "fsntfs_test_libfsntfs.h"
+#include "fsntfs_test_macros.h"
+#include "fsntfs_test_memory.h"
+#include "fsntfs_test_unused.h"
+
+#include "../libfsntfs/libfsntfs_definitions.h"
+#include "../libfsntfs/libfsntfs_name_index.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+
+uint8_t fsntfs_test_name_index_utf16_stream_boot[ 10 ] = {
+	'$', 0, 'B', 0, 'o', 0, 'o', 0, 't', 0 };
+
+uint8_t fsntfs_test_name_index_utf16_stream_readme[ 20 ] = {
+	'R', 0, 'e', 0, 'a', 0, 'd', 0, 'M', 0, 'e', 0, '.', 0, 't', 0, 'x', 0, 't', 0 };
+
+uint8_t fsntfs_test_name_index_utf16_stream_readme_short[ 20 ] = {
+	'R', 0, 'E', 0, 'A', 0, 'D', 0, 'M', 0, 'E', 0, '.', 0, 'T', 0, 'X', 0, 'T', 0 };
+
+uint8_t fsntfs_test_name_index_utf16_stream_thread[ 14 ] = {
+	't', 0, 'h', 0, 'r', 0, 'e', 0, 'a', 0, 'd', 0, 0, 0 };
+
+/* Creates a name index with test names
+ * Returns 1 if successful or -1 on error
+ */
+int fsntfs_test_name_index_create(
+     libfsntfs_name_index_t **name_index,
+     libcerror_error_t **error )
+{
+	if( libfsntfs_name_index_initialize(
+	     name_index,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libfsntfs_name_index_append_name(
+	     *name_index,
+	     0x0001000000000007UL,
+	     fsntfs_test_name_index_utf16_stream_boot,
+	     10,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfsntfs_name_index_append_name(
+	     *name_index,
+	     0x0003000000000040UL,
+	     fsntfs_test_name_index_utf16_stream_readme,
+	     20,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfsntfs_name_index_append_name(
+	     *name_index,
+	     0x0003000000000040UL,
+	     fsntfs_test_name_index_utf16_stream_readme_short,
+	     20,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfsntfs_name_index_append_name(
+	     *name_index,
+	     0x0002000000000020UL,
+	     fsntfs_test_name_index_utf16_stream_thread,
+	     14,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfsntfs_name_index_build_suffixes(
+	     *name_index,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libfsntfs_name_index_free(
+	 name_index,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Tests the libfsntfs_name_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_name_index_initialize(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libfsntfs_name_index_t *name_index = NULL;
+	int result                         = 0;
+
+#if defined( HAVE_FSNTFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests    = 1;
+	int number_of_memset_fail_tests    = 1;
+	int test_number                    = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_name_index_initialize(
+	          &name_index,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "name_index",
+	 name_index );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_name_index_free(
+	          &name_index,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "name_index",
+	 name_index );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_name_index_initialize(
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	name_index = (libfsntfs_name_index_t *) 0x12345678UL;
+
+	result = libfsntfs_name_index_initialize(
+	          &name_index,
+	          &error );
+
+	name_index = NULL;
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSNTFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsntfs_name_index_initialize with malloc failing
+		 */
+		fsntfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsntfs_name_index_initialize(
+		          &name_index,
+		          &error );
+
+		if( fsntfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsntfs_test_malloc_attempts_before_fail = -1;
+
+			if( name_index != NULL )
+			{
+				libfsntfs_name_index_free(
+				 &name_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSNTFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSNTFS_TEST_ASSERT_IS_NULL(
+			 "name_index",
+			 name_index );
+
+			FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsntfs_name_index_initialize with memset failing
+		 */
+		fsntfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsntfs_name_index_initialize(
+		          &name_index,
+		          &error );
+
+		if( fsntfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsntfs_test_memset_attempts_before_fail = -1;
+
+			if( name_index != NULL )
+			{
+				libfsntfs_name_index_free(
+				 &name_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSNTFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSNTFS_TEST_ASSERT_IS_NULL(
+			 "name_index",
+			 name_index );
+
+			FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSNTFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name_index != NULL )
+	{
+		libfsntfs_name_index_free(
+		 &name_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_name_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_name_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsntfs_name_index_free(
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_name_index_append_name function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_name_index_append_name(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libfsntfs_name_index_t *name_index = NULL;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfsntfs_name_index_initialize(
+	          &name_index,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "name_index",
+	 name_index );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_name_index_append_name(
+	          name_index,
+	          0x0002000000000020UL,
+	          fsntfs_test_name_index_utf16_stream_thread,
+	          14,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "name_index->number_of_entries",
+	 name_index->number_of_entries,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT32(
+	 "name_index->entries[ 0 ].name_length",
+	 name_index->entries[ 0 ].name_length,
+	 6 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT32(
+	 "name_index->names_length",
+	 name_index->names_length,
+	 7 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT16(
+	 "name_index->names[ 0 ]",
+	 name_index->names[ 0 ],
+	 (uint16_t) 'T' );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_name_index_append_name(
+	          NULL,
+	          0x0002000000000020UL,
+	          fsntfs_test_name_index_utf16_stream_thread,
+	          14,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_name_index_append_name(
+	          name_index,
+	          0x0002000000000020UL,
+	          NULL,
+	          14,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_name_index_append_name(
+	          name_index,
+	          0x0002000000000020UL,
+	          fsntfs_test_name_index_utf16_stream_thread,
+	          13,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test append after the suffixes were built
+	 */
+	result = libfsntfs_name_index_build_suffixes(
+	          name_index,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_name_index_append_name(
+	          name_index,
+	          0x0002000000000020UL,
+	          fsntfs_test_name_index_utf16_stream_thread,
+	          14,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsntfs_name_index_free(
+	          &name_index,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "name_index",
+	 name_index );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name_index != NULL )
+	{
+		libfsntfs_name_index_free(
+		 &name_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_name_index_build_suffixes function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_name_index_build_suffixes(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libfsntfs_name_index_t *name_index = NULL;
+	uint32_t suffix_index              = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = fsntfs_test_name_index_create(
+	          &name_index,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "name_index",
+	 name_index );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	FSNTFS_TEST_ASSERT_EQUAL_UINT32(
+	 "name_index->number_of_suffixes",
+	 name_index->number_of_suffixes,
+	 31 );
+
+	for( suffix_index = 1;
+	     suffix_index < name_index->number_of_suffixes;
+	     suffix_index++ )
+	{
+		result = libfsntfs_name_index_compare_suffixes(
+		          name_index->names,
+		          name_index->suffixes[ suffix_index - 1 ],
+		          name_index->suffixes[ suffix_index ] );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+	}
+	/* Test error cases
+	 */
+	result = libfsntfs_name_index_build_suffixes(
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_name_index_build_suffixes(
+	          name_index,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsntfs_name_index_free(
+	          &name_index,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "name_index",
+	 name_index );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name_index != NULL )
+	{
+		libfsntfs_name_index_free(
+		 &name_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_name_index_glob_match function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_name_index_glob_match(
+     void )
+{
+	uint16_t name[ 10 ]      = { 'R', 'E', 'A', 'D', 'M', 'E', '.', 'T', 'X', 'T' };
+	uint16_t pattern1[ 5 ]   = { '*', '.', 'T', 'X', 'T' };
+	uint16_t pattern2[ 4 ]   = { 'R', '*', 'E', '*' };
+	uint16_t pattern3[ 10 ]  = { 'R', 'E', 'A', 'D', 'M', 'E', '.', 'T', 'X', '?' };
+	uint16_t pattern4[ 5 ]   = { '*', '.', 'D', 'O', 'C' };
+	uint16_t pattern5[ 1 ]   = { '*' };
+	int result               = 0;
+
+	result = libfsntfs_name_index_glob_match(
+	          name,
+	          10,
+	          pattern1,
+	          5 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfsntfs_name_index_glob_match(
+	          name,
+	          10,
+	          pattern2,
+	          4 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfsntfs_name_index_glob_match(
+	          name,
+	          10,
+	          pattern3,
+	          10 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfsntfs_name_index_glob_match(
+	          name,
+	          10,
+	          pattern4,
+	          5 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfsntfs_name_index_glob_match(
+	          name,
+	          10,
+	          pattern5,
+	          1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfsntfs_name_index_glob_match(
+	          name,
+	          10,
+	          pattern3,
+	          9 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libfsntfs_name_index_search_utf8 function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_name_index_search_utf8(
+     void )
+{
+	uint64_t file_references[ 4 ];
+
+	libcerror_error_t *error           = NULL;
+	libfsntfs_name_index_t *name_index = NULL;
+	int number_of_file_references      = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = fsntfs_test_name_index_create(
+	          &name_index,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "name_index",
+	 name_index );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test substring search, which matches both names of the same file entry only once
+	 */
+	result = libfsntfs_name_index_search_utf8(
+	          name_index,
+	          (uint8_t *) "adme",
+	          4,
+	          LIBFSNTFS_NAME_SEARCH_TYPE_SUBSTRING,
+	          file_references,
+	          4,
+	          &number_of_file_references,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_file_references",
+	 number_of_file_references,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "file_references[ 0 ]",
+	 file_references[ 0 ],
+	 (uint64_t) 0x0003000000000040UL );
+
+	/* Test substring search that matches multiple file entries
+	 */
+	result = libfsntfs_name_index_search_utf8(
+	          name_index,
+	          (uint8_t *) "T",
+	          1,
+	          LIBFSNTFS_NAME_SEARCH_TYPE_SUBSTRING,
+	          file_references,
+	          4,
+	          &number_of_file_references,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_file_references",
+	 number_of_file_references,
+	 3 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "file_references[ 0 ]",
+	 file_references[ 0 ],
+	 (uint64_t) 0x0001000000000007UL );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "file_references[ 2 ]",
+	 file_references[ 2 ],
+	 (uint64_t) 0x0003000000000040UL );
+
+	/* Test substring search without matches
+	 */
+	result = libfsntfs_name_index_search_utf8(
+	          name_index,
+	          (uint8_t *) "bootx",
+	          5,
+	          LIBFSNTFS_NAME_SEARCH_TYPE_SUBSTRING,
+	          file_references,
+	          4,
+	          &number_of_file_references,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_file_references",
+	 number_of_file_references,
+	 0 );
+
+	/* Test glob search
+	 */
+	result = libfsntfs_name_index_search_utf8(
+	          name_index,
+	          (uint8_t *) "*.txt",
+	          5,
+	          LIBFSNTFS_NAME_SEARCH_TYPE_GLOB,
+	          file_references,
+	          4,
+	          &number_of_file_references,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_file_references",
+	 number_of_file_references,
+	 1 );
+
+	/* Test glob search with wildcards only
+	 */
+	result = libfsntfs_name_index_search_utf8(
+	          name_index,
+	          (uint8_t *) "?????",
+	          5,
+	          LIBFSNTFS_NAME_SEARCH_TYPE_GLOB,
+	          file_references,
+	          4,
+	          &number_of_file_references,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_file_references",
+	 number_of_file_references,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "file_references[ 0 ]",
+	 file_references[ 0 ],
+	 (uint64_t) 0x0001000000000007UL );
+
+	/* Test search that only retrieves the number of file references
+	 */
+	result = libfsntfs_name_index_search_utf8(
+	          name_index,
+	          (uint8_t *) "e",
+	          1,
+	          LIBFSNTFS_NAME_SEARCH_TYPE_SUBSTRING,
+	          NULL,
+	          0,
+	          &number_of_file_references,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_file_references",
+	 number_of_file_references,
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_name_index_search_utf8(
+	          NULL,
+	          (uint8_t *) "e",
+	          1,
+	          LIBFSNTFS_NAME_SEARCH_TYPE_SUBSTRING,
+	          file_references,
+	          4,
+	          &number_of_file_references,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_name_index_search_utf8(
+	          name_index,
+	          NULL,
+	          1,
+	          LIBFSNTFS_NAME_SEARCH_TYPE_SUBSTRING,
+	          file_references,
+	          4,
+	          &number_of_file_references,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_name_index_search_utf8(
+	          name_index,
+	          (uint8_t *) "e",
+	          0,
+	          LIBFSNTFS_NAME_SEARCH_TYPE_SUBSTRING,
+	          file_references,
+	          4,
+	          &number_of_file_references,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_name_index_search_utf8(
+	          name_index,
+	          (uint8_t *) "e",
+	          1,
+	          -1,
+	          file_references,
+	          4,
+	          &number_of_file_references,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_name_index_search_utf8(
+	          name_index,
+	          (uint8_t *) "e",
+	          1,
+	          LIBFSNTFS_NAME_SEARCH_TYPE_SUBSTRING,
+	          NULL,
+	          4,
+	          &number_of_file_references,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_name_index_search_utf8(
+	          name_index,
+	          (uint8_t *) "e",
+	          1,
+	          LIBFSNTFS_NAME_SEARCH_TYPE_SUBSTRING,
+	          file_references,
+	          4,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsntfs_name_index_free(
+	          &name_index,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "name_index",
+	 name_index );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name_index != NULL )
+	{
+		libfsntfs_name_index_free(
+		 &name_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_name_index_search_utf16 function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_name_index_search_utf16(
+     void )
+{
+	uint16_t utf16_string[ 4 ] = { 'b', 'o', 'o', 't' };
+	uint64_t file_references[ 4 ];
+
+	libcerror_error_t *error           = NULL;
+	libfsntfs_name_index_t *name_index = NULL;
+	int number_of_file_references      = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = fsntfs_test_name_index_create(
+	          &name_index,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "name_index",
+	 name_index );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_name_index_search_utf16(
+	          name_index,
+	          utf16_string,
+	          4,
+	          LIBFSNTFS_NAME_SEARCH_TYPE_SUBSTRING,
+	          file_references,
+	          4,
+	          &number_of_file_references,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_file_references",
+	 number_of_file_references,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "file_references[ 0 ]",
+	 file_references[ 0 ],
+	 (uint64_t) 0x0001000000000007UL );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_name_index_search_utf16(
+	          name_index,
+	          NULL,
+	          4,
+	          LIBFSNTFS_NAME_SEARCH_TYPE_SUBSTRING,
+	          file_references,
+	          4,
+	          &number_of_file_references,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_name_index_search_utf16(
+	          name_index,
+	          utf16_string,
+	          0,
+	          LIBFSNTFS_NAME_SEARCH_TYPE_SUBSTRING,
+	          file_references,
+	          4,
+	          &number_of_file_references,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsntfs_name_index_free(
+	          &name_index,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "name_index",
+	 name_index );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name_index != NULL )
+	{
+		libfsntfs_name_index_free(
+		 &name_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSNTFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSNTFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_name_index_initialize",
+	 fsntfs_test_name_index_initialize );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_name_index_free",
+	 fsntfs_test_name_index_free );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_name_index_append_name",
+	 fsntfs_test_name_index_append_name );
+
+	/* TODO: add tests for libfsntfs_name_index_append_mft_entry */
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_name_index_build_suffixes",
+	 fsntfs_test_name_index_build_suffixes );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_name_index_glob_match",
+	 fsntfs_test_name_index_glob_match );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_name_index_search_utf8",
+	 fsntfs_test_name_index_search_utf8 );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_name_index_search_utf16",
+	 fsntfs_test_name_index_search_utf16 );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
@@ -0,0 +1,654 @@
+/*
+ * Library object_identifier_index type test program
+ *
+ * Copyright (C) 2010-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsntfs_test_libcdata.h"
+#include "fsntfs_test_libcerror.h"
+#include "fsntfs_test_libfsntfs.h"
+#include "fsntfs_test_macros.h"
+#include "fsntfs_test_memory.h"
+#include "fsntfs_test_unused.h"
+
+#include "../libfsntfs/libfsntfs_index_value.h"
+#include "../libfsntfs/libfsntfs_object_identifier_index.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+
+uint8_t fsntfs_test_object_identifier_index_key_data1[ 16 ] = {
+	0xd2, 0x8a, 0x1d, 0x8b, 0x5c, 0x4e, 0xe9, 0x11, 0xa5, 0x47, 0x08, 0x00, 0x27, 0x5a, 0x1d, 0x7e };
+
+uint8_t fsntfs_test_object_identifier_index_value_data1[ 56 ] = {
+	0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd2, 0x8a, 0x1d, 0x8b, 0x5c, 0x4e, 0xe9, 0x11,
+	0xa5, 0x47, 0x08, 0x00, 0x27, 0x5a, 0x1d, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* Tests the libfsntfs_object_identifier_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_object_identifier_index_initialize(
+     void )
+{
+	libcerror_error_t *error                                     = NULL;
+	libfsntfs_object_identifier_index_t *object_identifier_index = NULL;
+	int result                                                   = 0;
+
+#if defined( HAVE_FSNTFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests                              = 1;
+	int number_of_memset_fail_tests                              = 1;
+	int test_number                                              = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_object_identifier_index_initialize(
+	          &object_identifier_index,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "object_identifier_index",
+	 object_identifier_index );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_object_identifier_index_free(
+	          &object_identifier_index,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "object_identifier_index",
+	 object_identifier_index );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_object_identifier_index_initialize(
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	object_identifier_index = (libfsntfs_object_identifier_index_t *) 0x12345678UL;
+
+	result = libfsntfs_object_identifier_index_initialize(
+	          &object_identifier_index,
+	          &error );
+
+	object_identifier_index = NULL;
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSNTFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsntfs_object_identifier_index_initialize with malloc failing
+		 */
+		fsntfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsntfs_object_identifier_index_initialize(
+		          &object_identifier_index,
+		          &error );
+
+		if( fsntfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsntfs_test_malloc_attempts_before_fail = -1;
+
+			if( object_identifier_index != NULL )
+			{
+				libfsntfs_object_identifier_index_free(
+				 &object_identifier_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSNTFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSNTFS_TEST_ASSERT_IS_NULL(
+			 "object_identifier_index",
+			 object_identifier_index );
+
+			FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsntfs_object_identifier_index_initialize with memset failing
+		 */
+		fsntfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsntfs_object_identifier_index_initialize(
+		          &object_identifier_index,
+		          &error );
+
+		if( fsntfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsntfs_test_memset_attempts_before_fail = -1;
+
+			if( object_identifier_index != NULL )
+			{
+				libfsntfs_object_identifier_index_free(
+				 &object_identifier_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSNTFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSNTFS_TEST_ASSERT_IS_NULL(
+			 "object_identifier_index",
+			 object_identifier_index );
+
+			FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSNTFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( object_identifier_index != NULL )
+	{
+		libfsntfs_object_identifier_index_free(
+		 &object_identifier_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_object_identifier_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_object_identifier_index_free(
+     void )
+{
+	libcerror_error_t *error                                     = NULL;
+	int result                                                   = 0;
+
+	/* Test error cases
+	 */
+	result = libfsntfs_object_identifier_index_free(
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_object_identifier_index_compare_key function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_object_identifier_index_compare_key(
+     void )
+{
+	uint8_t object_identifier[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_object_identifier_index_compare_key(
+	          fsntfs_test_object_identifier_index_key_data1,
+	          16,
+	          fsntfs_test_object_identifier_index_key_data1,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBCDATA_COMPARE_EQUAL );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The values are compared as 32-bit little-endian values
+	 */
+	result = memory_copy(
+	          object_identifier,
+	          fsntfs_test_object_identifier_index_key_data1,
+	          16 ) == NULL;
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	object_identifier[ 0 ] = 0xff;
+	object_identifier[ 3 ] = 0x00;
+
+	result = libfsntfs_object_identifier_index_compare_key(
+	          fsntfs_test_object_identifier_index_key_data1,
+	          16,
+	          object_identifier,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBCDATA_COMPARE_LESS );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	object_identifier[ 3 ] = 0x8c;
+
+	result = libfsntfs_object_identifier_index_compare_key(
+	          fsntfs_test_object_identifier_index_key_data1,
+	          16,
+	          object_identifier,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBCDATA_COMPARE_GREATER );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_object_identifier_index_compare_key(
+	          NULL,
+	          16,
+	          object_identifier,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_object_identifier_index_compare_key(
+	          fsntfs_test_object_identifier_index_key_data1,
+	          8,
+	          object_identifier,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_object_identifier_index_compare_key(
+	          fsntfs_test_object_identifier_index_key_data1,
+	          16,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_object_identifier_index_get_file_reference_from_index_value function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_object_identifier_index_get_file_reference_from_index_value(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfsntfs_index_value_t *index_value = NULL;
+	uint64_t file_reference              = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfsntfs_index_value_initialize(
+	          &index_value,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "index_value",
+	 index_value );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The data offset is 0x20 and the data size is 56
+	 */
+	index_value->file_reference  = 0x0000000000380020UL;
+	index_value->key_data_size   = 16;
+	index_value->value_data      = fsntfs_test_object_identifier_index_value_data1;
+	index_value->value_data_size = 56;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_object_identifier_index_get_file_reference_from_index_value(
+	          index_value,
+	          &file_reference,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "file_reference",
+	 file_reference,
+	 (uint64_t) 0x0003000000000040UL );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_object_identifier_index_get_file_reference_from_index_value(
+	          NULL,
+	          &file_reference,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_object_identifier_index_get_file_reference_from_index_value(
+	          index_value,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a data offset that points into the key data
+	 */
+	index_value->file_reference = 0x0000000000380018UL;
+
+	result = libfsntfs_object_identifier_index_get_file_reference_from_index_value(
+	          index_value,
+	          &file_reference,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a value data size that is too small
+	 */
+	index_value->file_reference  = 0x0000000000380020UL;
+	index_value->value_data_size = 32;
+
+	result = libfsntfs_object_identifier_index_get_file_reference_from_index_value(
+	          index_value,
+	          &file_reference,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	index_value->value_data      = NULL;
+	index_value->value_data_size = 0;
+
+	result = libfsntfs_index_value_free(
+	          &index_value,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "index_value",
+	 index_value );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index_value != NULL )
+	{
+		index_value->value_data = NULL;
+
+		libfsntfs_index_value_free(
+		 &index_value,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSNTFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSNTFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_object_identifier_index_initialize",
+	 fsntfs_test_object_identifier_index_initialize );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_object_identifier_index_free",
+	 fsntfs_test_object_identifier_index_free );
+
+	/* TODO: add tests for libfsntfs_object_identifier_index_read_o_index */
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_object_identifier_index_compare_key",
+	 fsntfs_test_object_identifier_index_compare_key );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_object_identifier_index_get_file_reference_from_index_value",
+	 fsntfs_test_object_identifier_index_get_file_reference_from_index_value );
+
+	/* TODO: add tests for libfsntfs_object_identifier_index_get_file_reference_from_index_node_by_identifier */
+
+	/* TODO: add tests for libfsntfs_object_identifier_index_get_file_reference_by_identifier */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
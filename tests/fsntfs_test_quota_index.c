@@ -0,0 +1,776 @@
+/*
+ * Library quota_index type test program
+ *
+ * Copyright (C) 2010-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsntfs_test_libcdata.h"
+#include "fsntfs_test_libcerror.h"
+#include "fsntfs_test_libfsntfs.h"
+#include "fsntfs_test_macros.h"
+#include "fsntfs_test_memory.h"
+#include "fsntfs_test_unused.h"
+
+#include "../libfsntfs/libfsntfs_index_value.h"
+#include "../libfsntfs/libfsntfs_quota_index.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+
+/* S-1-5-21-1-2-3-1000
+ */
+uint8_t fsntfs_test_quota_index_sid_data1[ 28 ] = {
+	0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xe8, 0x03, 0x00, 0x00 };
+
+uint8_t fsntfs_test_quota_index_owner_identifier_data1[ 4 ] = {
+	0x02, 0x01, 0x00, 0x00 };
+
+uint8_t fsntfs_test_quota_index_value_data1[ 52 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x00, 0x00, 0x00 };
+
+/* Tests the libfsntfs_quota_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_quota_index_initialize(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfsntfs_quota_index_t *quota_index = NULL;
+	int result                           = 0;
+
+#if defined( HAVE_FSNTFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests      = 1;
+	int number_of_memset_fail_tests      = 1;
+	int test_number                      = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_quota_index_initialize(
+	          &quota_index,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "quota_index",
+	 quota_index );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_quota_index_free(
+	          &quota_index,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "quota_index",
+	 quota_index );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_quota_index_initialize(
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	quota_index = (libfsntfs_quota_index_t *) 0x12345678UL;
+
+	result = libfsntfs_quota_index_initialize(
+	          &quota_index,
+	          &error );
+
+	quota_index = NULL;
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSNTFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsntfs_quota_index_initialize with malloc failing
+		 */
+		fsntfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsntfs_quota_index_initialize(
+		          &quota_index,
+		          &error );
+
+		if( fsntfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsntfs_test_malloc_attempts_before_fail = -1;
+
+			if( quota_index != NULL )
+			{
+				libfsntfs_quota_index_free(
+				 &quota_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSNTFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSNTFS_TEST_ASSERT_IS_NULL(
+			 "quota_index",
+			 quota_index );
+
+			FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsntfs_quota_index_initialize with memset failing
+		 */
+		fsntfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsntfs_quota_index_initialize(
+		          &quota_index,
+		          &error );
+
+		if( fsntfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsntfs_test_memset_attempts_before_fail = -1;
+
+			if( quota_index != NULL )
+			{
+				libfsntfs_quota_index_free(
+				 &quota_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSNTFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSNTFS_TEST_ASSERT_IS_NULL(
+			 "quota_index",
+			 quota_index );
+
+			FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSNTFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( quota_index != NULL )
+	{
+		libfsntfs_quota_index_free(
+		 &quota_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_quota_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_quota_index_free(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	int result                           = 0;
+
+	/* Test error cases
+	 */
+	result = libfsntfs_quota_index_free(
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_quota_index_compare_key function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_quota_index_compare_key(
+     void )
+{
+	uint8_t owner_identifier_data[ 4 ] = {
+		0x01, 0x02, 0x00, 0x00 };
+
+	uint8_t sid_data[ 28 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases with the COLLATION_NTOFS_ULONG collation type
+	 */
+	result = libfsntfs_quota_index_compare_key(
+	          16,
+	          fsntfs_test_quota_index_owner_identifier_data1,
+	          4,
+	          fsntfs_test_quota_index_owner_identifier_data1,
+	          4,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBCDATA_COMPARE_EQUAL );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The values are compared as 32-bit little-endian values
+	 */
+	result = libfsntfs_quota_index_compare_key(
+	          16,
+	          fsntfs_test_quota_index_owner_identifier_data1,
+	          4,
+	          owner_identifier_data,
+	          4,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBCDATA_COMPARE_GREATER );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_quota_index_compare_key(
+	          16,
+	          owner_identifier_data,
+	          4,
+	          fsntfs_test_quota_index_owner_identifier_data1,
+	          4,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBCDATA_COMPARE_LESS );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases with the COLLATION_NTOFS_SID collation type
+	 */
+	result = libfsntfs_quota_index_compare_key(
+	          17,
+	          fsntfs_test_quota_index_sid_data1,
+	          28,
+	          fsntfs_test_quota_index_sid_data1,
+	          28,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBCDATA_COMPARE_EQUAL );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_quota_index_compare_key(
+	          17,
+	          fsntfs_test_quota_index_sid_data1,
+	          28,
+	          fsntfs_test_quota_index_sid_data1,
+	          24,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBCDATA_COMPARE_LESS );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_copy(
+	          sid_data,
+	          fsntfs_test_quota_index_sid_data1,
+	          28 ) == NULL;
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	sid_data[ 24 ] = 0xe9;
+
+	result = libfsntfs_quota_index_compare_key(
+	          17,
+	          fsntfs_test_quota_index_sid_data1,
+	          28,
+	          sid_data,
+	          28,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBCDATA_COMPARE_GREATER );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_quota_index_compare_key(
+	          16,
+	          NULL,
+	          4,
+	          owner_identifier_data,
+	          4,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_quota_index_compare_key(
+	          16,
+	          fsntfs_test_quota_index_owner_identifier_data1,
+	          4,
+	          NULL,
+	          4,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_quota_index_compare_key(
+	          16,
+	          fsntfs_test_quota_index_sid_data1,
+	          28,
+	          owner_identifier_data,
+	          4,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_quota_index_compare_key(
+	          19,
+	          fsntfs_test_quota_index_owner_identifier_data1,
+	          4,
+	          owner_identifier_data,
+	          4,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_quota_index_get_data_from_index_value function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_quota_index_get_data_from_index_value(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfsntfs_index_value_t *index_value = NULL;
+	const uint8_t *data                  = NULL;
+	size_t data_size                     = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfsntfs_index_value_initialize(
+	          &index_value,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "index_value",
+	 index_value );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The data offset is 0x14 and the data size is 52
+	 */
+	index_value->file_reference  = 0x0000000000340014UL;
+	index_value->key_data_size   = 4;
+	index_value->value_data      = fsntfs_test_quota_index_value_data1;
+	index_value->value_data_size = 52;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_quota_index_get_data_from_index_value(
+	          index_value,
+	          &data,
+	          &data_size,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INTPTR(
+	 "data",
+	 (intptr_t) data,
+	 (intptr_t) fsntfs_test_quota_index_value_data1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 52 );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_quota_index_get_data_from_index_value(
+	          NULL,
+	          &data,
+	          &data_size,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_quota_index_get_data_from_index_value(
+	          index_value,
+	          NULL,
+	          &data_size,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_quota_index_get_data_from_index_value(
+	          index_value,
+	          &data,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a data offset that points into the key data
+	 */
+	index_value->file_reference = 0x0000000000340010UL;
+
+	result = libfsntfs_quota_index_get_data_from_index_value(
+	          index_value,
+	          &data,
+	          &data_size,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a data size that exceeds the value data size
+	 */
+	index_value->file_reference = 0x0000000000380014UL;
+
+	result = libfsntfs_quota_index_get_data_from_index_value(
+	          index_value,
+	          &data,
+	          &data_size,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	index_value->value_data      = NULL;
+	index_value->value_data_size = 0;
+
+	result = libfsntfs_index_value_free(
+	          &index_value,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "index_value",
+	 index_value );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index_value != NULL )
+	{
+		index_value->value_data = NULL;
+
+		libfsntfs_index_value_free(
+		 &index_value,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSNTFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSNTFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_quota_index_initialize",
+	 fsntfs_test_quota_index_initialize );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_quota_index_free",
+	 fsntfs_test_quota_index_free );
+
+	/* TODO: add tests for libfsntfs_quota_index_read_index */
+
+	/* TODO: add tests for libfsntfs_quota_index_read */
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_quota_index_compare_key",
+	 fsntfs_test_quota_index_compare_key );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_quota_index_get_data_from_index_value",
+	 fsntfs_test_quota_index_get_data_from_index_value );
+
+	/* TODO: add tests for libfsntfs_quota_index_get_index_value_from_index_node */
+
+	/* TODO: add tests for libfsntfs_quota_index_get_owner_identifier_by_sid */
+
+	/* TODO: add tests for libfsntfs_quota_index_get_quota_by_owner_identifier */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,811 @@
+/*
+ * Library read_thread_pool type test program
+ *
+ * Copyright (C) 2010-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsntfs_test_functions.h"
+#include "fsntfs_test_libbfio.h"
+#include "fsntfs_test_libcerror.h"
+#include "fsntfs_test_libfsntfs.h"
+#include "fsntfs_test_macros.h"
+#include "fsntfs_test_memory.h"
+#include "fsntfs_test_unused.h"
+
+#include "../libfsntfs/libfsntfs_read_queue.h"
+#include "../libfsntfs/libfsntfs_read_thread_pool.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) && defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+
+/* Tests the libfsntfs_read_thread_pool_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_read_thread_pool_initialize(
+     void )
+{
+	uint8_t file_data[ 4096 ];
+
+	libbfio_handle_t *file_io_handle               = NULL;
+	libcerror_error_t *error                       = NULL;
+	libfsntfs_read_thread_pool_t *read_thread_pool = NULL;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 file_data,
+	 0,
+	 4096 );
+
+	result = fsntfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          file_data,
+	          4096,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_read_thread_pool_initialize(
+	          &read_thread_pool,
+	          file_io_handle,
+	          4,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "read_thread_pool",
+	 read_thread_pool );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "read_thread_pool->number_of_threads",
+	 read_thread_pool->number_of_threads,
+	 4 );
+
+	result = libfsntfs_read_thread_pool_free(
+	          &read_thread_pool,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "read_thread_pool",
+	 read_thread_pool );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_read_thread_pool_initialize(
+	          NULL,
+	          file_io_handle,
+	          4,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_thread_pool = (libfsntfs_read_thread_pool_t *) 0x12345678UL;
+
+	result = libfsntfs_read_thread_pool_initialize(
+	          &read_thread_pool,
+	          file_io_handle,
+	          4,
+	          &error );
+
+	read_thread_pool = NULL;
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_read_thread_pool_initialize(
+	          &read_thread_pool,
+	          NULL,
+	          4,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "read_thread_pool",
+	 read_thread_pool );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_read_thread_pool_initialize(
+	          &read_thread_pool,
+	          file_io_handle,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "read_thread_pool",
+	 read_thread_pool );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = fsntfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_thread_pool != NULL )
+	{
+		libfsntfs_read_thread_pool_free(
+		 &read_thread_pool,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_read_thread_pool_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_read_thread_pool_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsntfs_read_thread_pool_free(
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_read_thread_pool_wait_for_busy_threads function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_read_thread_pool_wait_for_busy_threads(
+     void )
+{
+	uint8_t file_data[ 512 ];
+
+	libbfio_handle_t *file_io_handle               = NULL;
+	libcerror_error_t *error                       = NULL;
+	libfsntfs_read_thread_pool_t *read_thread_pool = NULL;
+	int number_of_idle_threads                     = 0;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 file_data,
+	 0,
+	 512 );
+
+	result = fsntfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          file_data,
+	          512,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_read_thread_pool_initialize(
+	          &read_thread_pool,
+	          file_io_handle,
+	          2,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "read_thread_pool",
+	 read_thread_pool );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * Threads that have not been pushed onto the thread pool are not waited for
+	 */
+	read_thread_pool->number_of_busy_threads = 2;
+	number_of_idle_threads                   = 2;
+
+	result = libfsntfs_read_thread_pool_wait_for_busy_threads(
+	          read_thread_pool,
+	          &number_of_idle_threads,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_idle_threads",
+	 number_of_idle_threads,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "read_thread_pool->number_of_busy_threads",
+	 read_thread_pool->number_of_busy_threads,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_read_thread_pool_wait_for_busy_threads(
+	          NULL,
+	          &number_of_idle_threads,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_read_thread_pool_wait_for_busy_threads(
+	          read_thread_pool,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsntfs_read_thread_pool_free(
+	          &read_thread_pool,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "read_thread_pool",
+	 read_thread_pool );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsntfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_thread_pool != NULL )
+	{
+		libfsntfs_read_thread_pool_free(
+		 &read_thread_pool,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_read_thread_pool_read function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_read_thread_pool_read(
+     void )
+{
+	uint8_t file_data[ 4096 ];
+	uint8_t read_data[ 4096 ];
+
+	libbfio_handle_t *file_io_handle               = NULL;
+	libcerror_error_t *error                       = NULL;
+	libfsntfs_read_queue_t *read_queue             = NULL;
+	libfsntfs_read_thread_pool_t *read_thread_pool = NULL;
+	size_t data_offset                             = 0;
+	int number_of_requests                         = 0;
+	int request_index                              = 0;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < 4096;
+	     data_offset++ )
+	{
+		file_data[ data_offset ] = (uint8_t) ( data_offset % 251 );
+	}
+	result = fsntfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          file_data,
+	          4096,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_read_thread_pool_initialize(
+	          &read_thread_pool,
+	          file_io_handle,
+	          4,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "read_thread_pool",
+	 read_thread_pool );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_read_queue_initialize(
+	          &read_queue,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "read_queue",
+	 read_queue );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The same thread pool reads multiple read queues, with more and less
+	 * requests than threads, the requests are appended in reverse order
+	 */
+	for( number_of_requests = 16;
+	     number_of_requests >= 2;
+	     number_of_requests /= 2 )
+	{
+		result = libfsntfs_read_queue_empty(
+		          read_queue,
+		          &error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSNTFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		memory_set(
+		 read_data,
+		 0,
+		 4096 );
+
+		for( request_index = number_of_requests - 1;
+		     request_index >= 0;
+		     request_index-- )
+		{
+			result = libfsntfs_read_queue_append_request(
+			          read_queue,
+			          (off64_t) request_index * 256,
+			          &( read_data[ request_index * 256 ] ),
+			          256,
+			          &error );
+
+			FSNTFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FSNTFS_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = libfsntfs_read_thread_pool_read(
+		          read_thread_pool,
+		          read_queue,
+		          &error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSNTFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          read_data,
+		          file_data,
+		          (size_t) number_of_requests * 256 );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test read beyond the end of the data
+	 */
+	result = libfsntfs_read_queue_append_request(
+	          read_queue,
+	          4000,
+	          read_data,
+	          256,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_read_thread_pool_read(
+	          read_thread_pool,
+	          read_queue,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_read_thread_pool_read(
+	          NULL,
+	          read_queue,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_read_thread_pool_read(
+	          read_thread_pool,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsntfs_read_queue_free(
+	          &read_queue,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "read_queue",
+	 read_queue );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_read_thread_pool_free(
+	          &read_thread_pool,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "read_thread_pool",
+	 read_thread_pool );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsntfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_queue != NULL )
+	{
+		libfsntfs_read_queue_free(
+		 &read_queue,
+		 NULL );
+	}
+	if( read_thread_pool != NULL )
+	{
+		libfsntfs_read_thread_pool_free(
+		 &read_thread_pool,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) && defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSNTFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSNTFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) && defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_read_thread_pool_initialize",
+	 fsntfs_test_read_thread_pool_initialize );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_read_thread_pool_free",
+	 fsntfs_test_read_thread_pool_free );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_read_thread_pool_wait_for_busy_threads",
+	 fsntfs_test_read_thread_pool_wait_for_busy_threads );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_read_thread_pool_read",
+	 fsntfs_test_read_thread_pool_read );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) && defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,931 @@
+/*
+ * Library reparse_point_index type test program
+ *
+ * Copyright (C) 2010-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsntfs_test_libcerror.h"
+#include "fsntfs_test_libfsntfs.h"
+#include "fsntfs_test_macros.h"
+#include "fsntfs_test_memory.h"
+#include "fsntfs_test_unused.h"
+
+#include "../libfsntfs/libfsntfs_index_value.h"
+#include "../libfsntfs/libfsntfs_reparse_point_index.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+
+uint8_t fsntfs_test_reparse_point_index_key_data1[ 12 ] = {
+	0x0c, 0x00, 0x00, 0xa0, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00 };
+
+/* Tests the libfsntfs_reparse_point_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_reparse_point_index_initialize(
+     void )
+{
+	libcerror_error_t *error                             = NULL;
+	libfsntfs_reparse_point_index_t *reparse_point_index = NULL;
+	int result                                           = 0;
+
+#if defined( HAVE_FSNTFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests                      = 1;
+	int number_of_memset_fail_tests                      = 1;
+	int test_number                                      = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_reparse_point_index_initialize(
+	          &reparse_point_index,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "reparse_point_index",
+	 reparse_point_index );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_reparse_point_index_free(
+	          &reparse_point_index,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "reparse_point_index",
+	 reparse_point_index );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_reparse_point_index_initialize(
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	reparse_point_index = (libfsntfs_reparse_point_index_t *) 0x12345678UL;
+
+	result = libfsntfs_reparse_point_index_initialize(
+	          &reparse_point_index,
+	          &error );
+
+	reparse_point_index = NULL;
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSNTFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsntfs_reparse_point_index_initialize with malloc failing
+		 */
+		fsntfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsntfs_reparse_point_index_initialize(
+		          &reparse_point_index,
+		          &error );
+
+		if( fsntfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsntfs_test_malloc_attempts_before_fail = -1;
+
+			if( reparse_point_index != NULL )
+			{
+				libfsntfs_reparse_point_index_free(
+				 &reparse_point_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSNTFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSNTFS_TEST_ASSERT_IS_NULL(
+			 "reparse_point_index",
+			 reparse_point_index );
+
+			FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsntfs_reparse_point_index_initialize with memset failing
+		 */
+		fsntfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsntfs_reparse_point_index_initialize(
+		          &reparse_point_index,
+		          &error );
+
+		if( fsntfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsntfs_test_memset_attempts_before_fail = -1;
+
+			if( reparse_point_index != NULL )
+			{
+				libfsntfs_reparse_point_index_free(
+				 &reparse_point_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSNTFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSNTFS_TEST_ASSERT_IS_NULL(
+			 "reparse_point_index",
+			 reparse_point_index );
+
+			FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSNTFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( reparse_point_index != NULL )
+	{
+		libfsntfs_reparse_point_index_free(
+		 &reparse_point_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_reparse_point_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_reparse_point_index_free(
+     void )
+{
+	libcerror_error_t *error                             = NULL;
+	int result                                           = 0;
+
+	/* Test error cases
+	 */
+	result = libfsntfs_reparse_point_index_free(
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_reparse_point_index_append_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_reparse_point_index_append_entry(
+     void )
+{
+	libcerror_error_t *error                             = NULL;
+	libfsntfs_reparse_point_index_t *reparse_point_index = NULL;
+	int entry_index                                      = 0;
+	int result                                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfsntfs_reparse_point_index_initialize(
+	          &reparse_point_index,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "reparse_point_index",
+	 reparse_point_index );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( entry_index = 0;
+	     entry_index < 1000;
+	     entry_index++ )
+	{
+		result = libfsntfs_reparse_point_index_append_entry(
+		          reparse_point_index,
+		          0xa000000cUL,
+		          (uint64_t) entry_index,
+		          &error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSNTFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "reparse_point_index->number_of_entries",
+	 reparse_point_index->number_of_entries,
+	 1000 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "reparse_point_index->entries[ 999 ].file_reference",
+	 reparse_point_index->entries[ 999 ].file_reference,
+	 (uint64_t) 999 );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_reparse_point_index_append_entry(
+	          NULL,
+	          0xa000000cUL,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsntfs_reparse_point_index_free(
+	          &reparse_point_index,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "reparse_point_index",
+	 reparse_point_index );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( reparse_point_index != NULL )
+	{
+		libfsntfs_reparse_point_index_free(
+		 &reparse_point_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_reparse_point_index_get_values_from_index_value function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_reparse_point_index_get_values_from_index_value(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfsntfs_index_value_t *index_value = NULL;
+	uint64_t file_reference              = 0;
+	uint32_t tag                         = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfsntfs_index_value_initialize(
+	          &index_value,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "index_value",
+	 index_value );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	index_value->key_data      = fsntfs_test_reparse_point_index_key_data1;
+	index_value->key_data_size = 12;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_reparse_point_index_get_values_from_index_value(
+	          index_value,
+	          &tag,
+	          &file_reference,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT32(
+	 "tag",
+	 tag,
+	 (uint32_t) 0xa000000cUL );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "file_reference",
+	 file_reference,
+	 (uint64_t) 0x000500000000002aUL );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_reparse_point_index_get_values_from_index_value(
+	          NULL,
+	          &tag,
+	          &file_reference,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_reparse_point_index_get_values_from_index_value(
+	          index_value,
+	          NULL,
+	          &file_reference,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_reparse_point_index_get_values_from_index_value(
+	          index_value,
+	          &tag,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a key data size that is too small
+	 */
+	index_value->key_data_size = 8;
+
+	result = libfsntfs_reparse_point_index_get_values_from_index_value(
+	          index_value,
+	          &tag,
+	          &file_reference,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	index_value->key_data      = NULL;
+	index_value->key_data_size = 0;
+
+	result = libfsntfs_index_value_free(
+	          &index_value,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "index_value",
+	 index_value );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index_value != NULL )
+	{
+		index_value->key_data = NULL;
+
+		libfsntfs_index_value_free(
+		 &index_value,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_reparse_point_index_get_number_of_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_reparse_point_index_get_number_of_entries(
+     libfsntfs_reparse_point_index_t *reparse_point_index )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_entries    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_reparse_point_index_get_number_of_entries(
+	          reparse_point_index,
+	          &number_of_entries,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_reparse_point_index_get_number_of_entries(
+	          NULL,
+	          &number_of_entries,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_reparse_point_index_get_number_of_entries(
+	          reparse_point_index,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_reparse_point_index_get_entry_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_reparse_point_index_get_entry_by_index(
+     libfsntfs_reparse_point_index_t *reparse_point_index )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t file_reference  = 0;
+	uint32_t tag             = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_reparse_point_index_get_entry_by_index(
+	          reparse_point_index,
+	          0,
+	          &tag,
+	          &file_reference,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT32(
+	 "tag",
+	 tag,
+	 (uint32_t) 0xa000000cUL );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "file_reference",
+	 file_reference,
+	 (uint64_t) 0x000500000000002aUL );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_reparse_point_index_get_entry_by_index(
+	          NULL,
+	          0,
+	          &tag,
+	          &file_reference,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_reparse_point_index_get_entry_by_index(
+	          reparse_point_index,
+	          -1,
+	          &tag,
+	          &file_reference,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_reparse_point_index_get_entry_by_index(
+	          reparse_point_index,
+	          1,
+	          &tag,
+	          &file_reference,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_reparse_point_index_get_entry_by_index(
+	          reparse_point_index,
+	          0,
+	          NULL,
+	          &file_reference,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_reparse_point_index_get_entry_by_index(
+	          reparse_point_index,
+	          0,
+	          &tag,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSNTFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSNTFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+	libcerror_error_t *error                             = NULL;
+	libfsntfs_reparse_point_index_t *reparse_point_index = NULL;
+	int result                                           = 0;
+#endif
+
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_reparse_point_index_initialize",
+	 fsntfs_test_reparse_point_index_initialize );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_reparse_point_index_free",
+	 fsntfs_test_reparse_point_index_free );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_reparse_point_index_append_entry",
+	 fsntfs_test_reparse_point_index_append_entry );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_reparse_point_index_get_values_from_index_value",
+	 fsntfs_test_reparse_point_index_get_values_from_index_value );
+
+	/* TODO: add tests for libfsntfs_reparse_point_index_read_from_index_node */
+
+	/* TODO: add tests for libfsntfs_reparse_point_index_read_r_index */
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize reparse_point_index for tests
+	 */
+	result = libfsntfs_reparse_point_index_initialize(
+	          &reparse_point_index,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "reparse_point_index",
+	 reparse_point_index );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_reparse_point_index_append_entry(
+	          reparse_point_index,
+	          0xa000000cUL,
+	          0x000500000000002aUL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_RUN_WITH_ARGS(
+	 "libfsntfs_reparse_point_index_get_number_of_entries",
+	 fsntfs_test_reparse_point_index_get_number_of_entries,
+	 reparse_point_index );
+
+	FSNTFS_TEST_RUN_WITH_ARGS(
+	 "libfsntfs_reparse_point_index_get_entry_by_index",
+	 fsntfs_test_reparse_point_index_get_entry_by_index,
+	 reparse_point_index );
+
+	/* Clean up
+	 */
+	result = libfsntfs_reparse_point_index_free(
+	          &reparse_point_index,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "reparse_point_index",
+	 reparse_point_index );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( reparse_point_index != NULL )
+	{
+		libfsntfs_reparse_point_index_free(
+		 &reparse_point_index,
+		 NULL );
+	}
+#endif
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,438 @@
+/*
+ * Library statistics functions test program
+ *
+ * Copyright (C) 2010-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsntfs_test_libcerror.h"
+#include "fsntfs_test_libfsntfs.h"
+#include "fsntfs_test_macros.h"
+#include "fsntfs_test_unused.h"
+
+#include "../libfsntfs/libfsntfs_definitions.h"
+#include "../libfsntfs/libfsntfs_statistics.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+
+/* Tests the libfsntfs_statistics_add_value macro
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_statistics_add_value(
+     void )
+{
+	uint64_t statistics[ LIBFSNTFS_STATISTICS_NUMBER_OF_VALUES ];
+
+	void *memset_result = NULL;
+
+	/* Initialize test
+	 */
+	memset_result = memory_set(
+	                 statistics,
+	                 0,
+	                 sizeof( uint64_t ) * LIBFSNTFS_STATISTICS_NUMBER_OF_VALUES );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	/* Test regular cases
+	 */
+	libfsntfs_statistics_add_value(
+	 statistics,
+	 LIBFSNTFS_STATISTICS_VALUE_MFT_BYTES_READ,
+	 1024 );
+
+	libfsntfs_statistics_add_value(
+	 statistics,
+	 LIBFSNTFS_STATISTICS_VALUE_MFT_BYTES_READ,
+	 1024 );
+
+	libfsntfs_statistics_add_value(
+	 statistics,
+	 LIBFSNTFS_STATISTICS_VALUE_MFT_ENTRIES_READ,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics[ LIBFSNTFS_STATISTICS_VALUE_MFT_BYTES_READ ]",
+	 statistics[ LIBFSNTFS_STATISTICS_VALUE_MFT_BYTES_READ ],
+	 (uint64_t) 2048 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics[ LIBFSNTFS_STATISTICS_VALUE_MFT_ENTRIES_READ ]",
+	 statistics[ LIBFSNTFS_STATISTICS_VALUE_MFT_ENTRIES_READ ],
+	 (uint64_t) 1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics[ LIBFSNTFS_STATISTICS_VALUE_INDEX_NODES_READ ]",
+	 statistics[ LIBFSNTFS_STATISTICS_VALUE_INDEX_NODES_READ ],
+	 (uint64_t) 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libfsntfs_statistics_start_timing function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_statistics_start_timing(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t start_timestamp = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_statistics_start_timing(
+	          &start_timestamp,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_statistics_start_timing(
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_statistics_add_decompression_time function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_statistics_add_decompression_time(
+     void )
+{
+	uint64_t statistics[ LIBFSNTFS_STATISTICS_NUMBER_OF_VALUES ];
+
+	libcerror_error_t *error = NULL;
+	void *memset_result      = NULL;
+	uint64_t start_timestamp = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	memset_result = memory_set(
+	                 statistics,
+	                 0,
+	                 sizeof( uint64_t ) * LIBFSNTFS_STATISTICS_NUMBER_OF_VALUES );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	result = libfsntfs_statistics_start_timing(
+	          &start_timestamp,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_statistics_add_decompression_time(
+	          statistics,
+	          LIBFSNTFS_COMPRESSION_METHOD_LZNT1,
+	          start_timestamp,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics[ LIBFSNTFS_STATISTICS_VALUE_LZX_DECOMPRESSION_TIME ]",
+	 statistics[ LIBFSNTFS_STATISTICS_VALUE_LZX_DECOMPRESSION_TIME ],
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_statistics_add_decompression_time(
+	          statistics,
+	          0xffffffffUL,
+	          start_timestamp,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_statistics_add_decompression_time(
+	          NULL,
+	          LIBFSNTFS_COMPRESSION_METHOD_LZNT1,
+	          start_timestamp,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_statistics_get_values function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_statistics_get_values(
+     void )
+{
+	uint64_t statistics[ LIBFSNTFS_STATISTICS_NUMBER_OF_VALUES ];
+	uint64_t values[ LIBFSNTFS_STATISTICS_NUMBER_OF_VALUES + 2 ];
+
+	libcerror_error_t *error = NULL;
+	void *memset_result      = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	memset_result = memory_set(
+	                 statistics,
+	                 0,
+	                 sizeof( uint64_t ) * LIBFSNTFS_STATISTICS_NUMBER_OF_VALUES );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	memset_result = memory_set(
+	                 values,
+	                 0xff,
+	                 sizeof( uint64_t ) * ( LIBFSNTFS_STATISTICS_NUMBER_OF_VALUES + 2 ) );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	statistics[ LIBFSNTFS_STATISTICS_VALUE_PATH_HINT_CACHE_HITS ] = 5;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_statistics_get_values(
+	          statistics,
+	          values,
+	          LIBFSNTFS_STATISTICS_NUMBER_OF_VALUES + 1,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "values[ LIBFSNTFS_STATISTICS_VALUE_PATH_HINT_CACHE_HITS ]",
+	 values[ LIBFSNTFS_STATISTICS_VALUE_PATH_HINT_CACHE_HITS ],
+	 (uint64_t) 5 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "values[ LIBFSNTFS_STATISTICS_NUMBER_OF_VALUES ]",
+	 values[ LIBFSNTFS_STATISTICS_NUMBER_OF_VALUES ],
+	 (uint64_t) 0 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "values[ LIBFSNTFS_STATISTICS_NUMBER_OF_VALUES + 1 ]",
+	 values[ LIBFSNTFS_STATISTICS_NUMBER_OF_VALUES + 1 ],
+	 (uint64_t) 0xffffffffffffffffULL );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_statistics_get_values(
+	          NULL,
+	          values,
+	          LIBFSNTFS_STATISTICS_NUMBER_OF_VALUES,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_statistics_get_values(
+	          statistics,
+	          NULL,
+	          LIBFSNTFS_STATISTICS_NUMBER_OF_VALUES,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_statistics_get_values(
+	          statistics,
+	          values,
+	          -1,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSNTFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSNTFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_statistics_add_value",
+	 fsntfs_test_statistics_add_value );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_statistics_start_timing",
+	 fsntfs_test_statistics_start_timing );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_statistics_add_decompression_time",
+	 fsntfs_test_statistics_add_decompression_time );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_statistics_get_values",
+	 fsntfs_test_statistics_get_values );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -55,6 +56,7 @@ int fsntfs_test_usn_change_journal_initialize(
 	libfsntfs_attribute_t *data_attribute              = NULL;
 	libfsntfs_directory_entry_t *directory_entry       = NULL;
 	libfsntfs_io_handle_t *io_handle                   = NULL;
+	libfsntfs_mft_entry_t *mft_entry                   = NULL;
 	libfsntfs_usn_change_journal_t *usn_change_journal = NULL;
 	int result                                         = 0;
 
@@ -92,6 +94,7 @@ int fsntfs_test_usn_change_journal_initialize(
 	          io_handle,
 	          file_io_handle,
 	          directory_entry,
+	          mft_entry,
 	          data_attribute,
 	          &error );
 
@@ -132,6 +135,7 @@ int fsntfs_test_usn_change_journal_initialize(
 	          io_handle,
 	          file_io_handle,
 	          directory_entry,
+	          mft_entry,
 	          data_attribute,
 	          &error );
 
@@ -154,6 +158,7 @@ int fsntfs_test_usn_change_journal_initialize(
 	          io_handle,
 	          file_io_handle,
 	          directory_entry,
+	          mft_entry,
 	          data_attribute,
 	          &error );
 
@@ -186,6 +191,7 @@ int fsntfs_test_usn_change_journal_initialize(
 		          io_handle,
 		          file_io_handle,
 		          directory_entry,
+		          mft_entry,
 		          data_attribute,
 		          &error );
 
@@ -232,6 +238,7 @@ int fsntfs_test_usn_change_journal_initialize(
 		          io_handle,
 		          file_io_handle,
 		          directory_entry,
+		          mft_entry,
 		          data_attribute,
 		          &error );
 
@@ -369,6 +376,403 @@ on_error:
 
 #if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
 
+/* Tests the libfsntfs_usn_change_journal_get_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_usn_change_journal_get_size(
+     void )
+{
+	libfsntfs_internal_usn_change_journal_t internal_usn_change_journal;
+
+	libcerror_error_t *error = NULL;
+	size64_t size            = 0;
+	int result               = 0;
+
+	if( memory_set(
+	     &internal_usn_change_journal,
+	     0,
+	     sizeof( libfsntfs_internal_usn_change_journal_t ) ) == NULL )
+	{
+		return( 0 );
+	}
+	internal_usn_change_journal.data_size = 0x2000;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_usn_change_journal_get_size(
+	          (libfsntfs_usn_change_journal_t *) &internal_usn_change_journal,
+	          &size,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 size,
+	 (uint64_t) 0x2000 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_usn_change_journal_get_size(
+	          NULL,
+	          &size,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_usn_change_journal_get_size(
+	          (libfsntfs_usn_change_journal_t *) &internal_usn_change_journal,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_usn_change_journal_seek_usn function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_usn_change_journal_seek_usn(
+     void )
+{
+	libfsntfs_internal_usn_change_journal_t internal_usn_change_journal;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	if( memory_set(
+	     &internal_usn_change_journal,
+	     0,
+	     sizeof( libfsntfs_internal_usn_change_journal_t ) ) == NULL )
+	{
+		return( 0 );
+	}
+	internal_usn_change_journal.journal_block_size = 0x1000;
+	internal_usn_change_journal.data_size          = 0x2000;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_usn_change_journal_seek_usn(
+	          (libfsntfs_usn_change_journal_t *) &internal_usn_change_journal,
+	          0x3000,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "internal_usn_change_journal.data_offset",
+	 (int64_t) internal_usn_change_journal.data_offset,
+	 (int64_t) 0x2000 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_usn_change_journal_seek_usn(
+	          NULL,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_usn_change_journal_read_previous_usn_record function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_usn_change_journal_read_previous_usn_record(
+     void )
+{
+	uint8_t usn_record_data[ 256 ];
+
+	libfsntfs_internal_usn_change_journal_t internal_usn_change_journal;
+
+	libcerror_error_t *error = NULL;
+	ssize_t read_count       = 0;
+
+	if( memory_set(
+	     &internal_usn_change_journal,
+	     0,
+	     sizeof( libfsntfs_internal_usn_change_journal_t ) ) == NULL )
+	{
+		return( 0 );
+	}
+	internal_usn_change_journal.journal_block_size = 0x1000;
+	internal_usn_change_journal.buffer_size        = 0x2000;
+
+	/* Test regular cases
+	 */
+	read_count = libfsntfs_usn_change_journal_read_previous_usn_record(
+	              (libfsntfs_usn_change_journal_t *) &internal_usn_change_journal,
+	              usn_record_data,
+	              256,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libfsntfs_usn_change_journal_read_previous_usn_record(
+	              NULL,
+	              usn_record_data,
+	              256,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsntfs_usn_change_journal_read_previous_usn_record(
+	              (libfsntfs_usn_change_journal_t *) &internal_usn_change_journal,
+	              NULL,
+	              256,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	internal_usn_change_journal.journal_block_size = 0;
+
+	read_count = libfsntfs_usn_change_journal_read_previous_usn_record(
+	              (libfsntfs_usn_change_journal_t *) &internal_usn_change_journal,
+	              usn_record_data,
+	              256,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_usn_change_journal_read_usn_records function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_usn_change_journal_read_usn_records(
+     void )
+{
+	uint8_t usn_records_data[ 256 ];
+
+	libfsntfs_internal_usn_change_journal_t internal_usn_change_journal;
+
+	libcerror_error_t *error = NULL;
+	ssize_t read_count       = 0;
+
+	if( memory_set(
+	     &internal_usn_change_journal,
+	     0,
+	     sizeof( libfsntfs_internal_usn_change_journal_t ) ) == NULL )
+	{
+		return( 0 );
+	}
+	internal_usn_change_journal.journal_block_size = 0x1000;
+
+	/* Test regular cases
+	 */
+	read_count = libfsntfs_usn_change_journal_read_usn_records(
+	              (libfsntfs_usn_change_journal_t *) &internal_usn_change_journal,
+	              usn_records_data,
+	              256,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libfsntfs_usn_change_journal_read_usn_records(
+	              NULL,
+	              usn_records_data,
+	              256,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsntfs_usn_change_journal_read_usn_records(
+	              (libfsntfs_usn_change_journal_t *) &internal_usn_change_journal,
+	              NULL,
+	              256,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsntfs_usn_change_journal_read_usn_records(
+	              (libfsntfs_usn_change_journal_t *) &internal_usn_change_journal,
+	              usn_records_data,
+	              (size_t) SSIZE_MAX + 1,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	internal_usn_change_journal.journal_block_size = 0;
+	internal_usn_change_journal.data_size          = 0x1000;
+
+	read_count = libfsntfs_usn_change_journal_read_usn_records(
+	              (libfsntfs_usn_change_journal_t *) &internal_usn_change_journal,
+	              usn_records_data,
+	              256,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
 
 /* The main program
@@ -400,8 +804,24 @@ int main(
 
 	/* TODO: add tests for libfsntfs_usn_change_journal_get_offset */
 
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_usn_change_journal_get_size",
+	 fsntfs_test_usn_change_journal_get_size );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_usn_change_journal_seek_usn",
+	 fsntfs_test_usn_change_journal_seek_usn );
+
 	/* TODO: add tests for libfsntfs_usn_change_journal_read_usn_record */
 
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_usn_change_journal_read_previous_usn_record",
+	 fsntfs_test_usn_change_journal_read_previous_usn_record );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_usn_change_journal_read_usn_records",
+	 fsntfs_test_usn_change_journal_read_usn_records );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -0,0 +1,787 @@
+/*
+ * Library usn_record_chunk type test program
+ *
+ * Copyright (C) 2010-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsntfs_test_libcerror.h"
+#include "fsntfs_test_libfsntfs.h"
+#include "fsntfs_test_macros.h"
+#include "fsntfs_test_memory.h"
+#include "fsntfs_test_unused.h"
+
+#include "../libfsntfs/libfsntfs_usn_record_chunk.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+
+/* Writes the header of an USN record into the buffer
+ */
+void fsntfs_test_usn_record_chunk_write_usn_record(
+      uint8_t *data,
+      uint32_t record_size,
+      uint16_t major_version,
+      uint64_t update_sequence_number )
+{
+	byte_stream_copy_from_uint32_little_endian(
+	 data,
+	 record_size );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( data[ 4 ] ),
+	 major_version );
+
+	if( major_version == 2 )
+	{
+		byte_stream_copy_from_uint64_little_endian(
+		 &( data[ 24 ] ),
+		 update_sequence_number );
+	}
+	else
+	{
+		byte_stream_copy_from_uint64_little_endian(
+		 &( data[ 40 ] ),
+		 update_sequence_number );
+	}
+}
+
+/* Tests the libfsntfs_usn_record_chunk_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_usn_record_chunk_initialize(
+     void )
+{
+	libcerror_error_t *error                       = NULL;
+	libfsntfs_usn_record_chunk_t *usn_record_chunk = NULL;
+	int result                                     = 0;
+
+#if defined( HAVE_FSNTFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests                = 3;
+	int number_of_memset_fail_tests                = 1;
+	int test_number                                = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_usn_record_chunk_initialize(
+	          &usn_record_chunk,
+	          0x2000,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "usn_record_chunk",
+	 usn_record_chunk );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_usn_record_chunk_free(
+	          &usn_record_chunk,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "usn_record_chunk",
+	 usn_record_chunk );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_usn_record_chunk_initialize(
+	          NULL,
+	          0x2000,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	usn_record_chunk = (libfsntfs_usn_record_chunk_t *) 0x12345678UL;
+
+	result = libfsntfs_usn_record_chunk_initialize(
+	          &usn_record_chunk,
+	          0x2000,
+	          &error );
+
+	usn_record_chunk = NULL;
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_usn_record_chunk_initialize(
+	          &usn_record_chunk,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSNTFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsntfs_usn_record_chunk_initialize with malloc failing
+		 */
+		fsntfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsntfs_usn_record_chunk_initialize(
+		          &usn_record_chunk,
+		          0x2000,
+		          &error );
+
+		if( fsntfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsntfs_test_malloc_attempts_before_fail = -1;
+
+			if( usn_record_chunk != NULL )
+			{
+				libfsntfs_usn_record_chunk_free(
+				 &usn_record_chunk,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSNTFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSNTFS_TEST_ASSERT_IS_NULL(
+			 "usn_record_chunk",
+			 usn_record_chunk );
+
+			FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsntfs_usn_record_chunk_initialize with memset failing
+		 */
+		fsntfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsntfs_usn_record_chunk_initialize(
+		          &usn_record_chunk,
+		          0x2000,
+		          &error );
+
+		if( fsntfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsntfs_test_memset_attempts_before_fail = -1;
+
+			if( usn_record_chunk != NULL )
+			{
+				libfsntfs_usn_record_chunk_free(
+				 &usn_record_chunk,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSNTFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSNTFS_TEST_ASSERT_IS_NULL(
+			 "usn_record_chunk",
+			 usn_record_chunk );
+
+			FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSNTFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( usn_record_chunk != NULL )
+	{
+		libfsntfs_usn_record_chunk_free(
+		 &usn_record_chunk,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_usn_record_chunk_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_usn_record_chunk_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsntfs_usn_record_chunk_free(
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_usn_record_chunk_check_usn_record function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_usn_record_chunk_check_usn_record(
+     void )
+{
+	uint8_t usn_record_data[ 128 ];
+
+	libcerror_error_t *error = NULL;
+	uint32_t usn_record_size = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	if( memory_set(
+	     usn_record_data,
+	     0,
+	     128 ) == NULL )
+	{
+		return( 0 );
+	}
+	fsntfs_test_usn_record_chunk_write_usn_record(
+	 usn_record_data,
+	 0x60,
+	 2,
+	 0x1000 );
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_usn_record_chunk_check_usn_record(
+	          usn_record_data,
+	          128,
+	          0x1000,
+	          &usn_record_size,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT32(
+	 "usn_record_size",
+	 usn_record_size,
+	 (uint32_t) 0x60 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with an update sequence number that does not match the offset
+	 */
+	result = libfsntfs_usn_record_chunk_check_usn_record(
+	          usn_record_data,
+	          128,
+	          0x2000,
+	          &usn_record_size,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a record size that exceeds the data size
+	 */
+	result = libfsntfs_usn_record_chunk_check_usn_record(
+	          usn_record_data,
+	          64,
+	          0x1000,
+	          &usn_record_size,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_usn_record_chunk_check_usn_record(
+	          NULL,
+	          128,
+	          0x1000,
+	          &usn_record_size,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_usn_record_chunk_check_usn_record(
+	          usn_record_data,
+	          (size_t) SSIZE_MAX + 1,
+	          0x1000,
+	          &usn_record_size,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_usn_record_chunk_check_usn_record(
+	          usn_record_data,
+	          128,
+	          -1,
+	          &usn_record_size,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_usn_record_chunk_check_usn_record(
+	          usn_record_data,
+	          128,
+	          0x1000,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_usn_record_chunk_scan function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_usn_record_chunk_scan(
+     void )
+{
+	libcerror_error_t *error                       = NULL;
+	libfsntfs_usn_record_chunk_t *usn_record_chunk = NULL;
+	const uint8_t *usn_record_data                 = NULL;
+	uint32_t usn_record_size                       = 0;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfsntfs_usn_record_chunk_initialize(
+	          &usn_record_chunk,
+	          0x2000,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "usn_record_chunk",
+	 usn_record_chunk );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( memory_set(
+	     usn_record_chunk->data,
+	     0,
+	     0x2000 ) == NULL )
+	{
+		goto on_error;
+	}
+	usn_record_chunk->data_offset = 0x1000;
+	usn_record_chunk->data_size   = 0x2000;
+
+	/* The first journal block contains a record, 8 bytes of corrupted data and another record
+	 */
+	fsntfs_test_usn_record_chunk_write_usn_record(
+	 usn_record_chunk->data,
+	 0x60,
+	 2,
+	 0x1000 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( usn_record_chunk->data[ 0x60 ] ),
+	 0xffffffffUL );
+
+	fsntfs_test_usn_record_chunk_write_usn_record(
+	 &( usn_record_chunk->data[ 0x68 ] ),
+	 0x58,
+	 2,
+	 0x1068 );
+
+	/* The second journal block contains a record
+	 */
+	fsntfs_test_usn_record_chunk_write_usn_record(
+	 &( usn_record_chunk->data[ 0x1000 ] ),
+	 0x50,
+	 3,
+	 0x2000 );
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_usn_record_chunk_scan(
+	          usn_record_chunk,
+	          0x1000,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "usn_record_chunk->number_of_records",
+	 usn_record_chunk->number_of_records,
+	 3 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_usn_record_chunk_get_usn_record_data(
+	          usn_record_chunk,
+	          1,
+	          &usn_record_data,
+	          &usn_record_size,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT32(
+	 "usn_record_size",
+	 usn_record_size,
+	 (uint32_t) 0x58 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_usn_record_chunk_get_usn_record_data(
+	          usn_record_chunk,
+	          2,
+	          &usn_record_data,
+	          &usn_record_size,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT32(
+	 "usn_record_size",
+	 usn_record_size,
+	 (uint32_t) 0x50 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_usn_record_chunk_scan(
+	          NULL,
+	          0x1000,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_usn_record_chunk_scan(
+	          usn_record_chunk,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	usn_record_chunk->data_offset = 0x800;
+
+	result = libfsntfs_usn_record_chunk_scan(
+	          usn_record_chunk,
+	          0x1000,
+	          &error );
+
+	usn_record_chunk->data_offset = 0x1000;
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_usn_record_chunk_get_usn_record_data(
+	          usn_record_chunk,
+	          -1,
+	          &usn_record_data,
+	          &usn_record_size,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsntfs_usn_record_chunk_free(
+	          &usn_record_chunk,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "usn_record_chunk",
+	 usn_record_chunk );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( usn_record_chunk != NULL )
+	{
+		libfsntfs_usn_record_chunk_free(
+		 &usn_record_chunk,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSNTFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSNTFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_usn_record_chunk_initialize",
+	 fsntfs_test_usn_record_chunk_initialize );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_usn_record_chunk_free",
+	 fsntfs_test_usn_record_chunk_free );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_usn_record_chunk_check_usn_record",
+	 fsntfs_test_usn_record_chunk_check_usn_record );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_usn_record_chunk_scan",
+	 fsntfs_test_usn_record_chunk_scan );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
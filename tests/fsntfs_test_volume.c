@@ -20,7 +20,9 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -37,6 +39,7 @@
 #include "fsntfs_test_libfsntfs.h"
 #include "fsntfs_test_macros.h"
 #include "fsntfs_test_memory.h"
+#include "fsntfs_test_unused.h"
 
 #include "../libfsntfs/libfsntfs_directory_entry.h"
 #include "../libfsntfs/libfsntfs_mft_entry.h"
@@ -1188,20 +1191,77 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfsntfs_volume_signal_abort function
+#define FSNTFS_TEST_VOLUME_NUMBER_OF_ASYNC_READS	16
+
+/* Callback function for the libfsntfs_volume_close with pending asynchronous reads test
+ */
+void fsntfs_test_volume_close_async_read_callback(
+      libfsntfs_file_entry_t *file_entry FSNTFS_TEST_ATTRIBUTE_UNUSED,
+      void *buffer FSNTFS_TEST_ATTRIBUTE_UNUSED,
+      ssize_t read_count,
+      void *callback_data )
+{
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( file_entry )
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( buffer )
+
+	/* Every read has its own read count so no locking is needed
+	 */
+	*( (ssize_t *) callback_data ) = read_count;
+}
+
+/* Tests the libfsntfs_volume_close function with pending asynchronous reads
  * Returns 1 if successful or 0 if not
  */
-int fsntfs_test_volume_signal_abort(
-     libfsntfs_volume_t *volume )
+int fsntfs_test_volume_close_with_pending_async_reads(
+     const system_character_t *source )
 {
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	uint8_t buffers[ FSNTFS_TEST_VOLUME_NUMBER_OF_ASYNC_READS ][ 512 ];
+	ssize_t read_counts[ FSNTFS_TEST_VOLUME_NUMBER_OF_ASYNC_READS ];
 
-	/* Test regular cases
+	libcerror_error_t *error           = NULL;
+	libfsntfs_file_entry_t *file_entry = NULL;
+	libfsntfs_volume_t *volume         = NULL;
+	int read_index                     = 0;
+	int result                         = 0;
+
+	for( read_index = 0;
+	     read_index < FSNTFS_TEST_VOLUME_NUMBER_OF_ASYNC_READS;
+	     read_index++ )
+	{
+		read_counts[ read_index ] = -2;
+	}
+	/* Initialize test
 	 */
-	result = libfsntfs_volume_signal_abort(
+	result = libfsntfs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libfsntfs_volume_open_wide(
+	          volume,
+	          source,
+	          LIBFSNTFS_OPEN_READ,
+	          &error );
+#else
+	result = libfsntfs_volume_open(
 	          volume,
+	          source,
+	          LIBFSNTFS_OPEN_READ,
 	          &error );
+#endif
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1212,97 +1272,107 @@ int fsntfs_test_volume_signal_abort(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* The $MFT file entry is used since it always has data
 	 */
-	result = libfsntfs_volume_signal_abort(
-	          NULL,
+	result = libfsntfs_volume_get_file_entry_by_index(
+	          volume,
+	          0,
+	          &file_entry,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_entry",
+	 file_entry );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	return( 1 );
-
-on_error:
-	if( error != NULL )
+	/* Test close with pending asynchronous reads
+	 */
+	for( read_index = 0;
+	     read_index < FSNTFS_TEST_VOLUME_NUMBER_OF_ASYNC_READS;
+	     read_index++ )
 	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+		result = libfsntfs_file_entry_read_buffer_at_offset_async(
+		          file_entry,
+		          buffers[ read_index ],
+		          512,
+		          (off64_t) read_index * 512,
+		          &fsntfs_test_volume_close_async_read_callback,
+		          (void *) &( read_counts[ read_index ] ),
+		          &error );
 
-/* Tests the libfsntfs_volume_get_bytes_per_sector function
- * Returns 1 if successful or 0 if not
- */
-int fsntfs_test_volume_get_bytes_per_sector(
-     libfsntfs_volume_t *volume )
-{
-	libcerror_error_t *error  = NULL;
-	uint16_t bytes_per_sector = 0;
-	int result                = 0;
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	/* Test regular cases
-	 */
-	result = libfsntfs_volume_get_bytes_per_sector(
+		FSNTFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfsntfs_volume_close(
 	          volume,
-	          &bytes_per_sector,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
 
 	FSNTFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Every read must have completed successfully before the volume was closed
 	 */
-	result = libfsntfs_volume_get_bytes_per_sector(
-	          NULL,
-	          &bytes_per_sector,
+	for( read_index = 0;
+	     read_index < FSNTFS_TEST_VOLUME_NUMBER_OF_ASYNC_READS;
+	     read_index++ )
+	{
+		FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_counts[ read_index ],
+		 (ssize_t) 512 );
+	}
+	/* Clean up
+	 */
+	result = libfsntfs_file_entry_free(
+	          &file_entry,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	FSNTFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libfsntfs_volume_get_bytes_per_sector(
-	          volume,
-	          NULL,
+	result = libfsntfs_volume_free(
+	          &volume,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
 	return( 1 );
 
 on_error:
@@ -1311,24 +1381,38 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( file_entry != NULL )
+	{
+		libfsntfs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	if( volume != NULL )
+	{
+		libfsntfs_volume_free(
+		 &volume,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libfsntfs_volume_get_cluster_block_size function
+/* Tests the libfsntfs_volume_clone function
  * Returns 1 if successful or 0 if not
  */
-int fsntfs_test_volume_get_cluster_block_size(
+int fsntfs_test_volume_clone(
      libfsntfs_volume_t *volume )
 {
-	libcerror_error_t *error    = NULL;
-	size32_t cluster_block_size = 0;
-	int result                  = 0;
+	libcerror_error_t *error                    = NULL;
+	libfsntfs_volume_t *destination_volume      = NULL;
+	uint64_t destination_number_of_file_entries = 0;
+	uint64_t number_of_file_entries             = 0;
+	int result                                  = 0;
 
 	/* Test regular cases
 	 */
-	result = libfsntfs_volume_get_cluster_block_size(
+	result = libfsntfs_volume_clone(
+	          &destination_volume,
 	          volume,
-	          &cluster_block_size,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
@@ -1336,72 +1420,49 @@ int fsntfs_test_volume_get_cluster_block_size(
 	 result,
 	 1 );
 
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "destination_volume",
+	 destination_volume );
+
 	FSNTFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libfsntfs_volume_get_cluster_block_size(
-	          NULL,
-	          &cluster_block_size,
+	result = libfsntfs_volume_get_number_of_file_entries(
+	          volume,
+	          &number_of_file_entries,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	FSNTFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libfsntfs_volume_get_cluster_block_size(
-	          volume,
-	          NULL,
+	result = libfsntfs_volume_get_number_of_file_entries(
+	          destination_volume,
+	          &destination_number_of_file_entries,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "destination_number_of_file_entries",
+	 destination_number_of_file_entries,
+	 number_of_file_entries );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-/* Tests the libfsntfs_volume_get_mft_entry_size function
- * Returns 1 if successful or 0 if not
- */
-int fsntfs_test_volume_get_mft_entry_size(
-     libfsntfs_volume_t *volume )
-{
-	libcerror_error_t *error = NULL;
-	size32_t mft_entry_size  = 0;
-	int result               = 0;
-
-	/* Test regular cases
-	 */
-	result = libfsntfs_volume_get_mft_entry_size(
-	          volume,
-	          &mft_entry_size,
+	result = libfsntfs_volume_free(
+	          &destination_volume,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
@@ -1409,15 +1470,19 @@ int fsntfs_test_volume_get_mft_entry_size(
 	 result,
 	 1 );
 
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "destination_volume",
+	 destination_volume );
+
 	FSNTFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
 	/* Test error cases
 	 */
-	result = libfsntfs_volume_get_mft_entry_size(
+	result = libfsntfs_volume_clone(
 	          NULL,
-	          &mft_entry_size,
+	          volume,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
@@ -1432,8 +1497,29 @@ int fsntfs_test_volume_get_mft_entry_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libfsntfs_volume_get_mft_entry_size(
+	destination_volume = (libfsntfs_volume_t *) 0x12345678UL;
+
+	result = libfsntfs_volume_clone(
+	          &destination_volume,
 	          volume,
+	          &error );
+
+	destination_volume = NULL;
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_volume_clone(
+	          &destination_volume,
 	          NULL,
 	          &error );
 
@@ -1457,24 +1543,28 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( destination_volume != NULL )
+	{
+		libfsntfs_volume_free(
+		 &destination_volume,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libfsntfs_volume_get_index_entry_size function
+/* Tests the libfsntfs_volume_signal_abort function
  * Returns 1 if successful or 0 if not
  */
-int fsntfs_test_volume_get_index_entry_size(
+int fsntfs_test_volume_signal_abort(
      libfsntfs_volume_t *volume )
 {
-	libcerror_error_t *error  = NULL;
-	size32_t index_entry_size = 0;
-	int result                = 0;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libfsntfs_volume_get_index_entry_size(
+	result = libfsntfs_volume_signal_abort(
 	          volume,
-	          &index_entry_size,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
@@ -1488,9 +1578,8 @@ int fsntfs_test_volume_get_index_entry_size(
 
 	/* Test error cases
 	 */
-	result = libfsntfs_volume_get_index_entry_size(
+	result = libfsntfs_volume_signal_abort(
 	          NULL,
-	          &index_entry_size,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
@@ -1505,12 +1594,68 @@ int fsntfs_test_volume_get_index_entry_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libfsntfs_volume_get_index_entry_size(
-	          volume,
-	          NULL,
-	          &error );
+	return( 1 );
 
-	FSNTFS_TEST_ASSERT_EQUAL_INT(
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_volume_get_bytes_per_sector function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_volume_get_bytes_per_sector(
+     libfsntfs_volume_t *volume )
+{
+	libcerror_error_t *error  = NULL;
+	uint16_t bytes_per_sector = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_volume_get_bytes_per_sector(
+	          volume,
+	          &bytes_per_sector,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_volume_get_bytes_per_sector(
+	          NULL,
+	          &bytes_per_sector,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_volume_get_bytes_per_sector(
+	          volume,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 -1 );
@@ -1533,21 +1678,21 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfsntfs_volume_get_utf8_name_size function
+/* Tests the libfsntfs_volume_get_cluster_block_size function
  * Returns 1 if successful or 0 if not
  */
-int fsntfs_test_volume_get_utf8_name_size(
+int fsntfs_test_volume_get_cluster_block_size(
      libfsntfs_volume_t *volume )
 {
-	libcerror_error_t *error = NULL;
-	size_t utf8_name_size    = 0;
-	int result               = 0;
+	libcerror_error_t *error    = NULL;
+	size32_t cluster_block_size = 0;
+	int result                  = 0;
 
 	/* Test regular cases
 	 */
-	result = libfsntfs_volume_get_utf8_name_size(
+	result = libfsntfs_volume_get_cluster_block_size(
 	          volume,
-	          &utf8_name_size,
+	          &cluster_block_size,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
@@ -1561,9 +1706,9 @@ int fsntfs_test_volume_get_utf8_name_size(
 
 	/* Test error cases
 	 */
-	result = libfsntfs_volume_get_utf8_name_size(
+	result = libfsntfs_volume_get_cluster_block_size(
 	          NULL,
-	          &utf8_name_size,
+	          &cluster_block_size,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
@@ -1578,7 +1723,7 @@ int fsntfs_test_volume_get_utf8_name_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libfsntfs_volume_get_utf8_name_size(
+	result = libfsntfs_volume_get_cluster_block_size(
 	          volume,
 	          NULL,
 	          &error );
@@ -1606,23 +1751,21 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfsntfs_volume_get_utf8_name function
+/* Tests the libfsntfs_volume_get_mft_entry_size function
  * Returns 1 if successful or 0 if not
  */
-int fsntfs_test_volume_get_utf8_name(
+int fsntfs_test_volume_get_mft_entry_size(
      libfsntfs_volume_t *volume )
 {
-	uint8_t utf8_name[ 512 ];
-
 	libcerror_error_t *error = NULL;
+	size32_t mft_entry_size  = 0;
 	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libfsntfs_volume_get_utf8_name(
+	result = libfsntfs_volume_get_mft_entry_size(
 	          volume,
-	          utf8_name,
-	          512,
+	          &mft_entry_size,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
@@ -1636,10 +1779,9 @@ int fsntfs_test_volume_get_utf8_name(
 
 	/* Test error cases
 	 */
-	result = libfsntfs_volume_get_utf8_name(
+	result = libfsntfs_volume_get_mft_entry_size(
 	          NULL,
-	          utf8_name,
-	          512,
+	          &mft_entry_size,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
@@ -1654,10 +1796,9 @@ int fsntfs_test_volume_get_utf8_name(
 	libcerror_error_free(
 	 &error );
 
-	result = libfsntfs_volume_get_utf8_name(
+	result = libfsntfs_volume_get_mft_entry_size(
 	          volume,
 	          NULL,
-	          512,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
@@ -1672,10 +1813,48 @@ int fsntfs_test_volume_get_utf8_name(
 	libcerror_error_free(
 	 &error );
 
-	result = libfsntfs_volume_get_utf8_name(
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_volume_get_index_entry_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_volume_get_index_entry_size(
+     libfsntfs_volume_t *volume )
+{
+	libcerror_error_t *error  = NULL;
+	size32_t index_entry_size = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_volume_get_index_entry_size(
 	          volume,
-	          utf8_name,
-	          0,
+	          &index_entry_size,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_volume_get_index_entry_size(
+	          NULL,
+	          &index_entry_size,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
@@ -1690,10 +1869,9 @@ int fsntfs_test_volume_get_utf8_name(
 	libcerror_error_free(
 	 &error );
 
-	result = libfsntfs_volume_get_utf8_name(
+	result = libfsntfs_volume_get_index_entry_size(
 	          volume,
-	          utf8_name,
-	          (size_t) SSIZE_MAX + 1,
+	          NULL,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
@@ -1719,21 +1897,25 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfsntfs_volume_get_utf16_name_size function
+/* Tests the libfsntfs_volume_get_statistics function
  * Returns 1 if successful or 0 if not
  */
-int fsntfs_test_volume_get_utf16_name_size(
+int fsntfs_test_volume_get_statistics(
      libfsntfs_volume_t *volume )
 {
+	uint64_t values[ LIBFSNTFS_STATISTICS_NUMBER_OF_VALUES + 1 ];
+
 	libcerror_error_t *error = NULL;
-	size_t utf16_name_size   = 0;
 	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libfsntfs_volume_get_utf16_name_size(
+	values[ LIBFSNTFS_STATISTICS_NUMBER_OF_VALUES ] = 0xffffffffffffffffULL;
+
+	result = libfsntfs_volume_get_statistics(
 	          volume,
-	          &utf16_name_size,
+	          values,
+	          LIBFSNTFS_STATISTICS_NUMBER_OF_VALUES + 1,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
@@ -1745,11 +1927,17 @@ int fsntfs_test_volume_get_utf16_name_size(
 	 "error",
 	 error );
 
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "values[ LIBFSNTFS_STATISTICS_NUMBER_OF_VALUES ]",
+	 values[ LIBFSNTFS_STATISTICS_NUMBER_OF_VALUES ],
+	 (uint64_t) 0 );
+
 	/* Test error cases
 	 */
-	result = libfsntfs_volume_get_utf16_name_size(
+	result = libfsntfs_volume_get_statistics(
 	          NULL,
-	          &utf16_name_size,
+	          values,
+	          LIBFSNTFS_STATISTICS_NUMBER_OF_VALUES,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
@@ -1764,9 +1952,28 @@ int fsntfs_test_volume_get_utf16_name_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libfsntfs_volume_get_utf16_name_size(
+	result = libfsntfs_volume_get_statistics(
 	          volume,
 	          NULL,
+	          LIBFSNTFS_STATISTICS_NUMBER_OF_VALUES,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_volume_get_statistics(
+	          volume,
+	          values,
+	          -1,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
@@ -1792,23 +1999,52 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfsntfs_volume_get_utf16_name function
+/* Test callback function that counts the number of bytes passed
+ * Returns 1 if successful or -1 on error
+ */
+int fsntfs_test_volume_read_file_entries_data_callback(
+     uint64_t mft_entry_index FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     off64_t data_offset FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     const uint8_t *data FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     size_t data_size,
+     void *callback_data )
+{
+	size64_t *total_data_size = (size64_t *) callback_data;
+
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( mft_entry_index )
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( data_offset )
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( data )
+
+	if( total_data_size == NULL )
+	{
+		return( -1 );
+	}
+	*total_data_size += data_size;
+
+	return( 1 );
+}
+
+/* Tests the libfsntfs_volume_read_file_entries_data function
  * Returns 1 if successful or 0 if not
  */
-int fsntfs_test_volume_get_utf16_name(
+int fsntfs_test_volume_read_file_entries_data(
      libfsntfs_volume_t *volume )
 {
-	uint16_t utf16_name[ 512 ];
+	uint64_t mft_entry_indexes[ 3 ] = { 3, 7, 10 };
 
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	libcerror_error_t *error        = NULL;
+	size64_t total_data_size        = 0;
+	int result                      = 0;
 
 	/* Test regular cases
 	 */
-	result = libfsntfs_volume_get_utf16_name(
+	result = libfsntfs_volume_read_file_entries_data(
 	          volume,
-	          utf16_name,
-	          512,
+	          mft_entry_indexes,
+	          3,
+	          &fsntfs_test_volume_read_file_entries_data_callback,
+	          NULL,
+	          &total_data_size,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
@@ -1822,10 +2058,13 @@ int fsntfs_test_volume_get_utf16_name(
 
 	/* Test error cases
 	 */
-	result = libfsntfs_volume_get_utf16_name(
+	result = libfsntfs_volume_read_file_entries_data(
 	          NULL,
-	          utf16_name,
-	          512,
+	          mft_entry_indexes,
+	          3,
+	          &fsntfs_test_volume_read_file_entries_data_callback,
+	          NULL,
+	          &total_data_size,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
@@ -1840,10 +2079,13 @@ int fsntfs_test_volume_get_utf16_name(
 	libcerror_error_free(
 	 &error );
 
-	result = libfsntfs_volume_get_utf16_name(
+	result = libfsntfs_volume_read_file_entries_data(
 	          volume,
 	          NULL,
-	          512,
+	          3,
+	          &fsntfs_test_volume_read_file_entries_data_callback,
+	          NULL,
+	          &total_data_size,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
@@ -1858,10 +2100,13 @@ int fsntfs_test_volume_get_utf16_name(
 	libcerror_error_free(
 	 &error );
 
-	result = libfsntfs_volume_get_utf16_name(
+	result = libfsntfs_volume_read_file_entries_data(
 	          volume,
-	          utf16_name,
+	          mft_entry_indexes,
 	          0,
+	          &fsntfs_test_volume_read_file_entries_data_callback,
+	          NULL,
+	          &total_data_size,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
@@ -1876,10 +2121,13 @@ int fsntfs_test_volume_get_utf16_name(
 	libcerror_error_free(
 	 &error );
 
-	result = libfsntfs_volume_get_utf16_name(
+	result = libfsntfs_volume_read_file_entries_data(
 	          volume,
-	          utf16_name,
-	          (size_t) SSIZE_MAX + 1,
+	          mft_entry_indexes,
+	          3,
+	          NULL,
+	          NULL,
+	          &total_data_size,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
@@ -1905,21 +2153,21 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfsntfs_volume_get_serial_number function
+/* Tests the libfsntfs_volume_get_utf8_name_size function
  * Returns 1 if successful or 0 if not
  */
-int fsntfs_test_volume_get_serial_number(
+int fsntfs_test_volume_get_utf8_name_size(
      libfsntfs_volume_t *volume )
 {
 	libcerror_error_t *error = NULL;
-	uint64_t serial_number   = 0;
+	size_t utf8_name_size    = 0;
 	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libfsntfs_volume_get_serial_number(
+	result = libfsntfs_volume_get_utf8_name_size(
 	          volume,
-	          &serial_number,
+	          &utf8_name_size,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
@@ -1933,9 +2181,9 @@ int fsntfs_test_volume_get_serial_number(
 
 	/* Test error cases
 	 */
-	result = libfsntfs_volume_get_serial_number(
+	result = libfsntfs_volume_get_utf8_name_size(
 	          NULL,
-	          &serial_number,
+	          &utf8_name_size,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
@@ -1950,7 +2198,7 @@ int fsntfs_test_volume_get_serial_number(
 	libcerror_error_free(
 	 &error );
 
-	result = libfsntfs_volume_get_serial_number(
+	result = libfsntfs_volume_get_utf8_name_size(
 	          volume,
 	          NULL,
 	          &error );
@@ -1978,21 +2226,23 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfsntfs_volume_get_number_of_file_entries function
+/* Tests the libfsntfs_volume_get_utf8_name function
  * Returns 1 if successful or 0 if not
  */
-int fsntfs_test_volume_get_number_of_file_entries(
+int fsntfs_test_volume_get_utf8_name(
      libfsntfs_volume_t *volume )
 {
-	libcerror_error_t *error        = NULL;
-	uint64_t number_of_file_entries = 0;
-	int result                      = 0;
+	uint8_t utf8_name[ 512 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libfsntfs_volume_get_number_of_file_entries(
+	result = libfsntfs_volume_get_utf8_name(
 	          volume,
-	          &number_of_file_entries,
+	          utf8_name,
+	          512,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
@@ -2006,9 +2256,10 @@ int fsntfs_test_volume_get_number_of_file_entries(
 
 	/* Test error cases
 	 */
-	result = libfsntfs_volume_get_number_of_file_entries(
+	result = libfsntfs_volume_get_utf8_name(
 	          NULL,
-	          &number_of_file_entries,
+	          utf8_name,
+	          512,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
@@ -2023,9 +2274,10 @@ int fsntfs_test_volume_get_number_of_file_entries(
 	libcerror_error_free(
 	 &error );
 
-	result = libfsntfs_volume_get_number_of_file_entries(
+	result = libfsntfs_volume_get_utf8_name(
 	          volume,
 	          NULL,
+	          512,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
@@ -2040,71 +2292,28 @@ int fsntfs_test_volume_get_number_of_file_entries(
 	libcerror_error_free(
 	 &error );
 
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-/* Tests the libfsntfs_volume_get_file_entry_by_index function
- * Returns 1 if successful or 0 if not
- */
-int fsntfs_test_volume_get_file_entry_by_index(
-     libfsntfs_volume_t *volume )
-{
-	libcerror_error_t *error           = NULL;
-	libfsntfs_file_entry_t *file_entry = NULL;
-	int result                         = 0;
-
-	/* Test regular cases
-	 */
-	result = libfsntfs_volume_get_file_entry_by_index(
+	result = libfsntfs_volume_get_utf8_name(
 	          volume,
+	          utf8_name,
 	          0,
-	          &file_entry,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
-	 "file_entry",
-	 file_entry );
-
-	FSNTFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfsntfs_file_entry_free(
-	          &file_entry,
-	          &error );
-
-	FSNTFS_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	FSNTFS_TEST_ASSERT_IS_NULL(
-	 "file_entry",
-	 file_entry );
-
-	FSNTFS_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	libcerror_error_free(
+	 &error );
 
-	/* Test error cases
-	 */
-	result = libfsntfs_volume_get_file_entry_by_index(
-	          NULL,
-	          0,
-	          &file_entry,
+	result = libfsntfs_volume_get_utf8_name(
+	          volume,
+	          utf8_name,
+	          (size_t) SSIZE_MAX + 1,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
@@ -2112,10 +2321,6 @@ int fsntfs_test_volume_get_file_entry_by_index(
 	 result,
 	 -1 );
 
-	FSNTFS_TEST_ASSERT_IS_NULL(
-	 "file_entry",
-	 file_entry );
-
 	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2123,32 +2328,48 @@ int fsntfs_test_volume_get_file_entry_by_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libfsntfs_volume_get_file_entry_by_index(
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_volume_get_utf16_name_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_volume_get_utf16_name_size(
+     libfsntfs_volume_t *volume )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf16_name_size   = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_volume_get_utf16_name_size(
 	          volume,
-	          0xffffffffffffffffUL,
-	          &file_entry,
+	          &utf16_name_size,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	FSNTFS_TEST_ASSERT_IS_NULL(
-	 "file_entry",
-	 file_entry );
-
-	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libfsntfs_volume_get_file_entry_by_index(
-	          volume,
-	          0,
+	/* Test error cases
+	 */
+	result = libfsntfs_volume_get_utf16_name_size(
 	          NULL,
+	          &utf16_name_size,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
@@ -2156,10 +2377,6 @@ int fsntfs_test_volume_get_file_entry_by_index(
 	 result,
 	 -1 );
 
-	FSNTFS_TEST_ASSERT_IS_NULL(
-	 "file_entry",
-	 file_entry );
-
 	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2167,16 +2384,11 @@ int fsntfs_test_volume_get_file_entry_by_index(
 	libcerror_error_free(
 	 &error );
 
-	file_entry = (libfsntfs_file_entry_t *) 0x12345678UL;
-
-	result = libfsntfs_volume_get_file_entry_by_index(
+	result = libfsntfs_volume_get_utf16_name_size(
 	          volume,
-	          0,
-	          &file_entry,
+	          NULL,
 	          &error );
 
-	file_entry = NULL;
-
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -2197,37 +2409,26 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( file_entry != NULL )
-	{
-		libfsntfs_file_entry_free(
-		 &file_entry,
-		 NULL );
-	}
 	return( 0 );
 }
 
-#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
-
-/* Tests the libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf8_path function
+/* Tests the libfsntfs_volume_get_utf16_name function
  * Returns 1 if successful or 0 if not
  */
-int fsntfs_test_internal_volume_get_mft_and_directory_entry_by_utf8_path(
+int fsntfs_test_volume_get_utf16_name(
      libfsntfs_volume_t *volume )
 {
-	uint8_t utf8_path[ 6 ]                       = { '\\', '$', 'M', 'F', 'T', 0 };
-	libcerror_error_t *error                     = NULL;
-	libfsntfs_directory_entry_t *directory_entry = NULL;
-	libfsntfs_mft_entry_t *mft_entry             = NULL;
-	int result                                   = 0;
+	uint16_t utf16_name[ 512 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf8_path(
-	          (libfsntfs_internal_volume_t *) volume,
-	          utf8_path,
-	          5,
-	          &mft_entry,
-	          &directory_entry,
+	result = libfsntfs_volume_get_utf16_name(
+	          volume,
+	          utf16_name,
+	          512,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
@@ -2235,43 +2436,34 @@ int fsntfs_test_internal_volume_get_mft_and_directory_entry_by_utf8_path(
 	 result,
 	 1 );
 
-	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
-	 "mft_entry",
-	 mft_entry );
-
-	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
-	 "directory_entry",
-	 directory_entry );
-
 	FSNTFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfsntfs_directory_entry_free(
-	          &directory_entry,
+	/* Test error cases
+	 */
+	result = libfsntfs_volume_get_utf16_name(
+	          NULL,
+	          utf16_name,
+	          512,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	FSNTFS_TEST_ASSERT_IS_NULL(
-	 "directory_entry",
-	 directory_entry );
+	 -1 );
 
-	FSNTFS_TEST_ASSERT_IS_NULL(
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf8_path(
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_volume_get_utf16_name(
+	          volume,
 	          NULL,
-	          utf8_path,
-	          5,
-	          &mft_entry,
-	          &directory_entry,
+	          512,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
@@ -2286,12 +2478,10 @@ int fsntfs_test_internal_volume_get_mft_and_directory_entry_by_utf8_path(
 	libcerror_error_free(
 	 &error );
 
-	result = libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf8_path(
-	          (libfsntfs_internal_volume_t *) volume,
-	          NULL,
-	          5,
-	          &mft_entry,
-	          &directory_entry,
+	result = libfsntfs_volume_get_utf16_name(
+	          volume,
+	          utf16_name,
+	          0,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
@@ -2306,12 +2496,10 @@ int fsntfs_test_internal_volume_get_mft_and_directory_entry_by_utf8_path(
 	libcerror_error_free(
 	 &error );
 
-	result = libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf8_path(
-	          (libfsntfs_internal_volume_t *) volume,
-	          utf8_path,
+	result = libfsntfs_volume_get_utf16_name(
+	          volume,
+	          utf16_name,
 	          (size_t) SSIZE_MAX + 1,
-	          &mft_entry,
-	          &directory_entry,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
@@ -2326,32 +2514,48 @@ int fsntfs_test_internal_volume_get_mft_and_directory_entry_by_utf8_path(
 	libcerror_error_free(
 	 &error );
 
-	result = libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf8_path(
-	          (libfsntfs_internal_volume_t *) volume,
-	          utf8_path,
-	          5,
-	          NULL,
-	          &directory_entry,
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_volume_get_serial_number function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_volume_get_serial_number(
+     libfsntfs_volume_t *volume )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t serial_number   = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_volume_get_serial_number(
+	          volume,
+	          &serial_number,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	FSNTFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf8_path(
-	          (libfsntfs_internal_volume_t *) volume,
-	          utf8_path,
-	          5,
-	          &mft_entry,
+	/* Test error cases
+	 */
+	result = libfsntfs_volume_get_serial_number(
 	          NULL,
+	          &serial_number,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
@@ -2366,18 +2570,11 @@ int fsntfs_test_internal_volume_get_mft_and_directory_entry_by_utf8_path(
 	libcerror_error_free(
 	 &error );
 
-	directory_entry = (libfsntfs_directory_entry_t *) 0x12345678UL;
-
-	result = libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf8_path(
-	          (libfsntfs_internal_volume_t *) volume,
-	          utf8_path,
-	          5,
-	          &mft_entry,
+	result = libfsntfs_volume_get_serial_number(
+	          volume,
 	          NULL,
 	          &error );
 
-	directory_entry = NULL;
-
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -2398,34 +2595,97 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( directory_entry != NULL )
+	return( 0 );
+}
+
+/* Tests the libfsntfs_volume_get_number_of_file_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_volume_get_number_of_file_entries(
+     libfsntfs_volume_t *volume )
+{
+	libcerror_error_t *error        = NULL;
+	uint64_t number_of_file_entries = 0;
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_volume_get_number_of_file_entries(
+	          volume,
+	          &number_of_file_entries,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_volume_get_number_of_file_entries(
+	          NULL,
+	          &number_of_file_entries,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_volume_get_number_of_file_entries(
+	          volume,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
 	{
-		libfsntfs_directory_entry_free(
-		 &directory_entry,
-		 NULL );
+		libcerror_error_free(
+		 &error );
 	}
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
-
-/* Tests the libfsntfs_volume_get_file_entry_by_utf8_path function
+/* Tests the libfsntfs_volume_get_file_entry_by_index function
  * Returns 1 if successful or 0 if not
  */
-int fsntfs_test_volume_get_file_entry_by_utf8_path(
+int fsntfs_test_volume_get_file_entry_by_index(
      libfsntfs_volume_t *volume )
 {
-	uint8_t utf8_path[ 6 ]             = { '\\', '$', 'M', 'F', 'T', 0 };
 	libcerror_error_t *error           = NULL;
 	libfsntfs_file_entry_t *file_entry = NULL;
 	int result                         = 0;
 
 	/* Test regular cases
 	 */
-	result = libfsntfs_volume_get_file_entry_by_utf8_path(
+	result = libfsntfs_volume_get_file_entry_by_index(
 	          volume,
-	          utf8_path,
-	          5,
+	          0,
 	          &file_entry,
 	          &error );
 
@@ -2461,10 +2721,9 @@ int fsntfs_test_volume_get_file_entry_by_utf8_path(
 
 	/* Test error cases
 	 */
-	result = libfsntfs_volume_get_file_entry_by_utf8_path(
+	result = libfsntfs_volume_get_file_entry_by_index(
 	          NULL,
-	          utf8_path,
-	          5,
+	          0,
 	          &file_entry,
 	          &error );
 
@@ -2484,10 +2743,9 @@ int fsntfs_test_volume_get_file_entry_by_utf8_path(
 	libcerror_error_free(
 	 &error );
 
-	result = libfsntfs_volume_get_file_entry_by_utf8_path(
+	result = libfsntfs_volume_get_file_entry_by_index(
 	          volume,
-	          NULL,
-	          5,
+	          0xffffffffffffffffUL,
 	          &file_entry,
 	          &error );
 
@@ -2507,10 +2765,9 @@ int fsntfs_test_volume_get_file_entry_by_utf8_path(
 	libcerror_error_free(
 	 &error );
 
-	result = libfsntfs_volume_get_file_entry_by_utf8_path(
+	result = libfsntfs_volume_get_file_entry_by_index(
 	          volume,
-	          utf8_path,
-	          5,
+	          0,
 	          NULL,
 	          &error );
 
@@ -2532,10 +2789,9 @@ int fsntfs_test_volume_get_file_entry_by_utf8_path(
 
 	file_entry = (libfsntfs_file_entry_t *) 0x12345678UL;
 
-	result = libfsntfs_volume_get_file_entry_by_utf8_path(
+	result = libfsntfs_volume_get_file_entry_by_index(
 	          volume,
-	          utf8_path,
-	          5,
+	          0,
 	          &file_entry,
 	          &error );
 
@@ -2546,10 +2802,6 @@ int fsntfs_test_volume_get_file_entry_by_utf8_path(
 	 result,
 	 -1 );
 
-	FSNTFS_TEST_ASSERT_IS_NULL(
-	 "file_entry",
-	 file_entry );
-
 	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2576,13 +2828,13 @@ on_error:
 
 #if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
 
-/* Tests the libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf16_path function
+/* Tests the libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf8_path function
  * Returns 1 if successful or 0 if not
  */
-int fsntfs_test_internal_volume_get_mft_and_directory_entry_by_utf16_path(
+int fsntfs_test_internal_volume_get_mft_and_directory_entry_by_utf8_path(
      libfsntfs_volume_t *volume )
 {
-	uint16_t utf16_path[ 6 ]                     = { '\\', '$', 'M', 'F', 'T', 0 };
+	uint8_t utf8_path[ 6 ]                       = { '\\', '$', 'M', 'F', 'T', 0 };
 	libcerror_error_t *error                     = NULL;
 	libfsntfs_directory_entry_t *directory_entry = NULL;
 	libfsntfs_mft_entry_t *mft_entry             = NULL;
@@ -2590,9 +2842,9 @@ int fsntfs_test_internal_volume_get_mft_and_directory_entry_by_utf16_path(
 
 	/* Test regular cases
 	 */
-	result = libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf16_path(
+	result = libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf8_path(
 	          (libfsntfs_internal_volume_t *) volume,
-	          utf16_path,
+	          utf8_path,
 	          5,
 	          &mft_entry,
 	          &directory_entry,
@@ -2634,9 +2886,9 @@ int fsntfs_test_internal_volume_get_mft_and_directory_entry_by_utf16_path(
 
 	/* Test error cases
 	 */
-	result = libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf16_path(
+	result = libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf8_path(
 	          NULL,
-	          utf16_path,
+	          utf8_path,
 	          5,
 	          &mft_entry,
 	          &directory_entry,
@@ -2654,7 +2906,7 @@ int fsntfs_test_internal_volume_get_mft_and_directory_entry_by_utf16_path(
 	libcerror_error_free(
 	 &error );
 
-	result = libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf16_path(
+	result = libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf8_path(
 	          (libfsntfs_internal_volume_t *) volume,
 	          NULL,
 	          5,
@@ -2674,9 +2926,9 @@ int fsntfs_test_internal_volume_get_mft_and_directory_entry_by_utf16_path(
 	libcerror_error_free(
 	 &error );
 
-	result = libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf16_path(
+	result = libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf8_path(
 	          (libfsntfs_internal_volume_t *) volume,
-	          utf16_path,
+	          utf8_path,
 	          (size_t) SSIZE_MAX + 1,
 	          &mft_entry,
 	          &directory_entry,
@@ -2694,9 +2946,9 @@ int fsntfs_test_internal_volume_get_mft_and_directory_entry_by_utf16_path(
 	libcerror_error_free(
 	 &error );
 
-	result = libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf16_path(
+	result = libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf8_path(
 	          (libfsntfs_internal_volume_t *) volume,
-	          utf16_path,
+	          utf8_path,
 	          5,
 	          NULL,
 	          &directory_entry,
@@ -2714,9 +2966,9 @@ int fsntfs_test_internal_volume_get_mft_and_directory_entry_by_utf16_path(
 	libcerror_error_free(
 	 &error );
 
-	result = libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf16_path(
+	result = libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf8_path(
 	          (libfsntfs_internal_volume_t *) volume,
-	          utf16_path,
+	          utf8_path,
 	          5,
 	          &mft_entry,
 	          NULL,
@@ -2736,9 +2988,9 @@ int fsntfs_test_internal_volume_get_mft_and_directory_entry_by_utf16_path(
 
 	directory_entry = (libfsntfs_directory_entry_t *) 0x12345678UL;
 
-	result = libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf16_path(
+	result = libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf8_path(
 	          (libfsntfs_internal_volume_t *) volume,
-	          utf16_path,
+	          utf8_path,
 	          5,
 	          &mft_entry,
 	          NULL,
@@ -2777,22 +3029,22 @@ on_error:
 
 #endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
 
-/* Tests the libfsntfs_volume_get_file_entry_by_utf16_path function
+/* Tests the libfsntfs_volume_get_file_entry_by_utf8_path function
  * Returns 1 if successful or 0 if not
  */
-int fsntfs_test_volume_get_file_entry_by_utf16_path(
+int fsntfs_test_volume_get_file_entry_by_utf8_path(
      libfsntfs_volume_t *volume )
 {
-	uint16_t utf16_path[ 6 ]           = { '\\', '$', 'M', 'F', 'T', 0 };
+	uint8_t utf8_path[ 6 ]             = { '\\', '$', 'M', 'F', 'T', 0 };
 	libcerror_error_t *error           = NULL;
 	libfsntfs_file_entry_t *file_entry = NULL;
 	int result                         = 0;
 
 	/* Test regular cases
 	 */
-	result = libfsntfs_volume_get_file_entry_by_utf16_path(
+	result = libfsntfs_volume_get_file_entry_by_utf8_path(
 	          volume,
-	          utf16_path,
+	          utf8_path,
 	          5,
 	          &file_entry,
 	          &error );
@@ -2829,10 +3081,1312 @@ int fsntfs_test_volume_get_file_entry_by_utf16_path(
 
 	/* Test error cases
 	 */
-	result = libfsntfs_volume_get_file_entry_by_utf16_path(
+	result = libfsntfs_volume_get_file_entry_by_utf8_path(
+	          NULL,
+	          utf8_path,
+	          5,
+	          &file_entry,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "file_entry",
+	 file_entry );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_volume_get_file_entry_by_utf8_path(
+	          volume,
+	          NULL,
+	          5,
+	          &file_entry,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "file_entry",
+	 file_entry );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_volume_get_file_entry_by_utf8_path(
+	          volume,
+	          utf8_path,
+	          5,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "file_entry",
+	 file_entry );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	file_entry = (libfsntfs_file_entry_t *) 0x12345678UL;
+
+	result = libfsntfs_volume_get_file_entry_by_utf8_path(
+	          volume,
+	          utf8_path,
+	          5,
+	          &file_entry,
+	          &error );
+
+	file_entry = NULL;
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "file_entry",
+	 file_entry );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_entry != NULL )
+	{
+		libfsntfs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+
+/* Tests the libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf16_path function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_internal_volume_get_mft_and_directory_entry_by_utf16_path(
+     libfsntfs_volume_t *volume )
+{
+	uint16_t utf16_path[ 6 ]                     = { '\\', '$', 'M', 'F', 'T', 0 };
+	libcerror_error_t *error                     = NULL;
+	libfsntfs_directory_entry_t *directory_entry = NULL;
+	libfsntfs_mft_entry_t *mft_entry             = NULL;
+	int result                                   = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf16_path(
+	          (libfsntfs_internal_volume_t *) volume,
+	          utf16_path,
+	          5,
+	          &mft_entry,
+	          &directory_entry,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "mft_entry",
+	 mft_entry );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_directory_entry_free(
+	          &directory_entry,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf16_path(
+	          NULL,
+	          utf16_path,
+	          5,
+	          &mft_entry,
+	          &directory_entry,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf16_path(
+	          (libfsntfs_internal_volume_t *) volume,
+	          NULL,
+	          5,
+	          &mft_entry,
+	          &directory_entry,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf16_path(
+	          (libfsntfs_internal_volume_t *) volume,
+	          utf16_path,
+	          (size_t) SSIZE_MAX + 1,
+	          &mft_entry,
+	          &directory_entry,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf16_path(
+	          (libfsntfs_internal_volume_t *) volume,
+	          utf16_path,
+	          5,
+	          NULL,
+	          &directory_entry,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf16_path(
+	          (libfsntfs_internal_volume_t *) volume,
+	          utf16_path,
+	          5,
+	          &mft_entry,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	directory_entry = (libfsntfs_directory_entry_t *) 0x12345678UL;
+
+	result = libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf16_path(
+	          (libfsntfs_internal_volume_t *) volume,
+	          utf16_path,
+	          5,
+	          &mft_entry,
+	          NULL,
+	          &error );
+
+	directory_entry = NULL;
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_entry != NULL )
+	{
+		libfsntfs_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
+
+/* Tests the libfsntfs_volume_get_file_entry_by_utf16_path function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_volume_get_file_entry_by_utf16_path(
+     libfsntfs_volume_t *volume )
+{
+	uint16_t utf16_path[ 6 ]           = { '\\', '$', 'M', 'F', 'T', 0 };
+	libcerror_error_t *error           = NULL;
+	libfsntfs_file_entry_t *file_entry = NULL;
+	int result                         = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_volume_get_file_entry_by_utf16_path(
+	          volume,
+	          utf16_path,
+	          5,
+	          &file_entry,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_entry",
+	 file_entry );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_file_entry_free(
+	          &file_entry,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "file_entry",
+	 file_entry );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_volume_get_file_entry_by_utf16_path(
+	          NULL,
+	          utf16_path,
+	          5,
+	          &file_entry,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "file_entry",
+	 file_entry );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_volume_get_file_entry_by_utf16_path(
+	          volume,
+	          NULL,
+	          5,
+	          &file_entry,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "file_entry",
+	 file_entry );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_volume_get_file_entry_by_utf16_path(
+	          volume,
+	          utf16_path,
+	          5,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "file_entry",
+	 file_entry );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	file_entry = (libfsntfs_file_entry_t *) 0x12345678UL;
+
+	result = libfsntfs_volume_get_file_entry_by_utf16_path(
+	          volume,
+	          utf16_path,
+	          5,
+	          &file_entry,
+	          &error );
+
+	file_entry = NULL;
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_entry != NULL )
+	{
+		libfsntfs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_volume_get_root_directory function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_volume_get_root_directory(
+     libfsntfs_volume_t *volume )
+{
+	libcerror_error_t *error               = NULL;
+	libfsntfs_file_entry_t *root_directory = 0;
+	int result                             = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_volume_get_root_directory(
+	          volume,
+	          &root_directory,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "root_directory",
+	 root_directory );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_file_entry_free(
+	          &root_directory,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "root_directory",
+	 root_directory );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_volume_get_root_directory(
+	          NULL,
+	          &root_directory,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "root_directory",
+	 root_directory );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_volume_get_root_directory(
+	          volume,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "root_directory",
+	 root_directory );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( root_directory != NULL )
+	{
+		libfsntfs_file_entry_free(
+		 &root_directory,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_volume_get_usn_change_journal function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_volume_get_usn_change_journal(
+     libfsntfs_volume_t *volume )
+{
+	libcerror_error_t *error                           = NULL;
+	libfsntfs_usn_change_journal_t *usn_change_journal = 0;
+	int result                                         = 0;
+	int usn_change_journal_is_set                      = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_volume_get_usn_change_journal(
+	          volume,
+	          &usn_change_journal,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	usn_change_journal_is_set = result;
+
+	if( usn_change_journal_is_set != 0 )
+	{
+		FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+		 "usn_change_journal",
+		 usn_change_journal );
+
+		result = libfsntfs_usn_change_journal_free(
+		          &usn_change_journal,
+		          &error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSNTFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libfsntfs_volume_get_usn_change_journal(
+	          NULL,
+	          &usn_change_journal,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "usn_change_journal",
+	 usn_change_journal );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( usn_change_journal_is_set != 0 )
+	{
+		result = libfsntfs_volume_get_usn_change_journal(
+		          volume,
+		          NULL,
+		          &error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FSNTFS_TEST_ASSERT_IS_NULL(
+		 "usn_change_journal",
+		 usn_change_journal );
+
+		FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( usn_change_journal != NULL )
+	{
+		libfsntfs_usn_change_journal_free(
+		 &usn_change_journal,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The maximum number of changed MFT entry indexes that are compared
+ */
+#define FSNTFS_TEST_VOLUME_MAXIMUM_NUMBER_OF_CHANGED_MFT_ENTRIES	256
+
+typedef struct fsntfs_test_volume_changed_mft_entries fsntfs_test_volume_changed_mft_entries_t;
+
+/* The MFT entry indexes passed to the libfsntfs_volume_get_changed_mft_entries callback
+ */
+struct fsntfs_test_volume_changed_mft_entries
+{
+	/* The first MFT entry indexes
+	 */
+	uint64_t mft_entry_indexes[ FSNTFS_TEST_VOLUME_MAXIMUM_NUMBER_OF_CHANGED_MFT_ENTRIES ];
+
+	/* The number of MFT entry indexes
+	 */
+	int number_of_mft_entry_indexes;
+};
+
+/* Callback function for the libfsntfs_volume_get_changed_mft_entries test
+ * Returns 1 to continue
+ */
+int fsntfs_test_volume_changed_mft_entry_callback(
+     uint64_t mft_entry_index,
+     void *callback_data )
+{
+	fsntfs_test_volume_changed_mft_entries_t *changed_mft_entries = NULL;
+
+	changed_mft_entries = (fsntfs_test_volume_changed_mft_entries_t *) callback_data;
+
+	if( changed_mft_entries->number_of_mft_entry_indexes < FSNTFS_TEST_VOLUME_MAXIMUM_NUMBER_OF_CHANGED_MFT_ENTRIES )
+	{
+		changed_mft_entries->mft_entry_indexes[ changed_mft_entries->number_of_mft_entry_indexes ] = mft_entry_index;
+	}
+	changed_mft_entries->number_of_mft_entry_indexes += 1;
+
+	return( 1 );
+}
+
+/* Tests the libfsntfs_volume_get_changed_mft_entries function
+ * The changed MFT entries are compared against the file references of the USN records
+ * read from the USN change journal of the volume
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_volume_get_changed_mft_entries(
+     libfsntfs_volume_t *volume )
+{
+	uint8_t usn_record_data[ 4096 ];
+
+	fsntfs_test_volume_changed_mft_entries_t changed_mft_entries;
+	fsntfs_test_volume_changed_mft_entries_t expected_mft_entries;
+
+	libcerror_error_t *error                           = NULL;
+	libfsntfs_usn_change_journal_t *usn_change_journal = NULL;
+	uint8_t *expected_mft_entries_bitmap               = NULL;
+	size64_t journal_size                              = 0;
+	ssize_t read_count                                 = 0;
+	off64_t first_update_sequence_number               = 0;
+	off64_t last_update_sequence_number                = 0;
+	uint64_t file_reference                            = 0;
+	uint64_t mft_entry_index                           = 0;
+	uint64_t next_update_sequence_number               = 0;
+	uint64_t number_of_mft_entries                     = 0;
+	uint8_t mft_entry_bit                              = 0;
+	int entry_index                                    = 0;
+	int number_of_entries                              = 0;
+	int result                                         = 0;
+	int usn_change_journal_is_available                = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 &changed_mft_entries,
+	 0,
+	 sizeof( fsntfs_test_volume_changed_mft_entries_t ) );
+
+	memory_set(
+	 &expected_mft_entries,
+	 0,
+	 sizeof( fsntfs_test_volume_changed_mft_entries_t ) );
+
+	result = libfsntfs_volume_get_number_of_file_entries(
+	          volume,
+	          &number_of_mft_entries,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	usn_change_journal_is_available = libfsntfs_volume_get_usn_change_journal(
+	                                   volume,
+	                                   &usn_change_journal,
+	                                   &error );
+
+	FSNTFS_TEST_ASSERT_NOT_EQUAL_INT(
+	 "usn_change_journal_is_available",
+	 usn_change_journal_is_available,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( usn_change_journal_is_available == 0 )
+	{
+		/* Test that the changes are not available without an USN change journal
+		 */
+		result = libfsntfs_volume_get_changed_mft_entries(
+		          volume,
+		          0,
+		          &fsntfs_test_volume_changed_mft_entry_callback,
+		          &changed_mft_entries,
+		          &next_update_sequence_number,
+		          &error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		FSNTFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "changed_mft_entries.number_of_mft_entry_indexes",
+		 changed_mft_entries.number_of_mft_entry_indexes,
+		 0 );
+	}
+	else
+	{
+		/* Determine the expected MFT entries from the USN records that follow
+		 * the first available update sequence number
+		 */
+		expected_mft_entries_bitmap = (uint8_t *) memory_allocate(
+		                                           (size_t) ( number_of_mft_entries / 8 ) + 1 );
+
+		FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+		 "expected_mft_entries_bitmap",
+		 expected_mft_entries_bitmap );
+
+		memory_set(
+		 expected_mft_entries_bitmap,
+		 0,
+		 (size_t) ( number_of_mft_entries / 8 ) + 1 );
+
+		result = libfsntfs_usn_change_journal_seek_usn(
+		          usn_change_journal,
+		          0,
+		          &error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSNTFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsntfs_usn_change_journal_get_offset(
+		          usn_change_journal,
+		          &first_update_sequence_number,
+		          &error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSNTFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		do
+		{
+			read_count = libfsntfs_usn_change_journal_read_usn_record(
+			              usn_change_journal,
+			              usn_record_data,
+			              4096,
+			              &error );
+
+			FSNTFS_TEST_ASSERT_NOT_EQUAL_SSIZE(
+			 "read_count",
+			 read_count,
+			 (ssize_t) -1 );
+
+			FSNTFS_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			if( read_count == 0 )
+			{
+				break;
+			}
+			FSNTFS_TEST_ASSERT_GREATER_THAN_INT(
+			 "read_count",
+			 (int) read_count,
+			 16 );
+
+			byte_stream_copy_to_uint64_little_endian(
+			 &( usn_record_data[ 8 ] ),
+			 file_reference );
+
+			mft_entry_index = file_reference & 0xffffffffffffUL;
+
+			if( mft_entry_index >= number_of_mft_entries )
+			{
+				continue;
+			}
+			mft_entry_bit = (uint8_t) ( 1 << ( mft_entry_index % 8 ) );
+
+			if( ( expected_mft_entries_bitmap[ mft_entry_index / 8 ] & mft_entry_bit ) != 0 )
+			{
+				continue;
+			}
+			expected_mft_entries_bitmap[ mft_entry_index / 8 ] |= mft_entry_bit;
+
+			fsntfs_test_volume_changed_mft_entry_callback(
+			 mft_entry_index,
+			 &expected_mft_entries );
+		}
+		while( read_count > 0 );
+
+		memory_free(
+		 expected_mft_entries_bitmap );
+
+		expected_mft_entries_bitmap = NULL;
+
+		result = libfsntfs_usn_change_journal_get_offset(
+		          usn_change_journal,
+		          &last_update_sequence_number,
+		          &error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSNTFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsntfs_usn_change_journal_get_size(
+		          usn_change_journal,
+		          &journal_size,
+		          &error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSNTFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test regular cases
+		 */
+		result = libfsntfs_volume_get_changed_mft_entries(
+		          volume,
+		          (uint64_t) first_update_sequence_number,
+		          &fsntfs_test_volume_changed_mft_entry_callback,
+		          &changed_mft_entries,
+		          &next_update_sequence_number,
+		          &error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSNTFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "changed_mft_entries.number_of_mft_entry_indexes",
+		 changed_mft_entries.number_of_mft_entry_indexes,
+		 expected_mft_entries.number_of_mft_entry_indexes );
+
+		FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+		 "next_update_sequence_number",
+		 next_update_sequence_number,
+		 (uint64_t) last_update_sequence_number );
+
+		number_of_entries = changed_mft_entries.number_of_mft_entry_indexes;
+
+		if( number_of_entries > FSNTFS_TEST_VOLUME_MAXIMUM_NUMBER_OF_CHANGED_MFT_ENTRIES )
+		{
+			number_of_entries = FSNTFS_TEST_VOLUME_MAXIMUM_NUMBER_OF_CHANGED_MFT_ENTRIES;
+		}
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+			 "changed_mft_entries.mft_entry_indexes[ entry_index ]",
+			 changed_mft_entries.mft_entry_indexes[ entry_index ],
+			 expected_mft_entries.mft_entry_indexes[ entry_index ] );
+		}
+		/* Test that there are no changes since the next update sequence number
+		 */
+		changed_mft_entries.number_of_mft_entry_indexes = 0;
+
+		result = libfsntfs_volume_get_changed_mft_entries(
+		          volume,
+		          next_update_sequence_number,
+		          &fsntfs_test_volume_changed_mft_entry_callback,
+		          &changed_mft_entries,
+		          &next_update_sequence_number,
+		          &error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSNTFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "changed_mft_entries.number_of_mft_entry_indexes",
+		 changed_mft_entries.number_of_mft_entry_indexes,
+		 0 );
+
+		FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+		 "next_update_sequence_number",
+		 next_update_sequence_number,
+		 (uint64_t) last_update_sequence_number );
+
+		/* Test that the changes are not available for an update sequence number
+		 * beyond the end of the USN change journal
+		 */
+		result = libfsntfs_volume_get_changed_mft_entries(
+		          volume,
+		          (uint64_t) journal_size + 8,
+		          &fsntfs_test_volume_changed_mft_entry_callback,
+		          &changed_mft_entries,
+		          &next_update_sequence_number,
+		          &error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		FSNTFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "changed_mft_entries.number_of_mft_entry_indexes",
+		 changed_mft_entries.number_of_mft_entry_indexes,
+		 0 );
+
+		result = libfsntfs_usn_change_journal_free(
+		          &usn_change_journal,
+		          &error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSNTFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libfsntfs_volume_get_changed_mft_entries(
+	          NULL,
+	          0,
+	          &fsntfs_test_volume_changed_mft_entry_callback,
+	          &changed_mft_entries,
+	          &next_update_sequence_number,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( expected_mft_entries_bitmap != NULL )
+	{
+		memory_free(
+		 expected_mft_entries_bitmap );
+	}
+	if( usn_change_journal != NULL )
+	{
+		libfsntfs_usn_change_journal_free(
+		 &usn_change_journal,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_volume_build_name_index and libfsntfs_volume_search_name_index_utf8 functions
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_volume_search_name_index_utf8(
+     libfsntfs_volume_t *volume )
+{
+	uint64_t file_references[ 8 ];
+
+	libcerror_error_t *error      = NULL;
+	uint64_t mft_entry_index      = 0;
+	int number_of_file_references = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_volume_build_name_index(
+	          volume,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_volume_search_name_index_utf8(
+	          volume,
+	          (uint8_t *) "$mft",
+	          4,
+	          LIBFSNTFS_NAME_SEARCH_TYPE_SUBSTRING,
+	          file_references,
+	          8,
+	          &number_of_file_references,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_file_references",
+	 number_of_file_references,
+	 0 );
+
+	mft_entry_index = file_references[ 0 ] & 0x0000ffffffffffffUL;
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "mft_entry_index",
+	 mft_entry_index,
+	 (uint64_t) 0 );
+
+	result = libfsntfs_volume_search_name_index_utf8(
+	          volume,
+	          (uint8_t *) "$*",
+	          2,
+	          LIBFSNTFS_NAME_SEARCH_TYPE_GLOB,
+	          NULL,
+	          0,
+	          &number_of_file_references,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_file_references",
+	 number_of_file_references,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_volume_build_name_index(
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_volume_search_name_index_utf8(
+	          NULL,
+	          (uint8_t *) "$mft",
+	          4,
+	          LIBFSNTFS_NAME_SEARCH_TYPE_SUBSTRING,
+	          file_references,
+	          8,
+	          &number_of_file_references,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_volume_get_file_entry_by_object_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_volume_get_file_entry_by_object_identifier(
+     libfsntfs_volume_t *volume )
+{
+	uint8_t guid_data[ 16 ] = {
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+	libcerror_error_t *error           = NULL;
+	libfsntfs_file_entry_t *file_entry = NULL;
+	int result                         = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_volume_get_file_entry_by_object_identifier(
+	          volume,
+	          guid_data,
+	          16,
+	          &file_entry,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( result != 0 )
+	{
+		FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+		 "file_entry",
+		 file_entry );
+
+		result = libfsntfs_file_entry_free(
+		          &file_entry,
+		          &error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSNTFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libfsntfs_volume_get_file_entry_by_object_identifier(
 	          NULL,
-	          utf16_path,
-	          5,
+	          guid_data,
+	          16,
 	          &file_entry,
 	          &error );
 
@@ -2841,10 +4395,6 @@ int fsntfs_test_volume_get_file_entry_by_utf16_path(
 	 result,
 	 -1 );
 
-	FSNTFS_TEST_ASSERT_IS_NULL(
-	 "file_entry",
-	 file_entry );
-
 	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2852,10 +4402,10 @@ int fsntfs_test_volume_get_file_entry_by_utf16_path(
 	libcerror_error_free(
 	 &error );
 
-	result = libfsntfs_volume_get_file_entry_by_utf16_path(
+	result = libfsntfs_volume_get_file_entry_by_object_identifier(
 	          volume,
 	          NULL,
-	          5,
+	          16,
 	          &file_entry,
 	          &error );
 
@@ -2864,10 +4414,6 @@ int fsntfs_test_volume_get_file_entry_by_utf16_path(
 	 result,
 	 -1 );
 
-	FSNTFS_TEST_ASSERT_IS_NULL(
-	 "file_entry",
-	 file_entry );
-
 	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2875,11 +4421,11 @@ int fsntfs_test_volume_get_file_entry_by_utf16_path(
 	libcerror_error_free(
 	 &error );
 
-	result = libfsntfs_volume_get_file_entry_by_utf16_path(
+	result = libfsntfs_volume_get_file_entry_by_object_identifier(
 	          volume,
-	          utf16_path,
-	          5,
-	          NULL,
+	          guid_data,
+	          8,
+	          &file_entry,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
@@ -2887,10 +4433,6 @@ int fsntfs_test_volume_get_file_entry_by_utf16_path(
 	 result,
 	 -1 );
 
-	FSNTFS_TEST_ASSERT_IS_NULL(
-	 "file_entry",
-	 file_entry );
-
 	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2898,17 +4440,13 @@ int fsntfs_test_volume_get_file_entry_by_utf16_path(
 	libcerror_error_free(
 	 &error );
 
-	file_entry = (libfsntfs_file_entry_t *) 0x12345678UL;
-
-	result = libfsntfs_volume_get_file_entry_by_utf16_path(
+	result = libfsntfs_volume_get_file_entry_by_object_identifier(
 	          volume,
-	          utf16_path,
-	          5,
-	          &file_entry,
+	          guid_data,
+	          16,
+	          NULL,
 	          &error );
 
-	file_entry = NULL;
-
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -2938,21 +4476,24 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfsntfs_volume_get_root_directory function
+/* Tests the libfsntfs_volume_get_number_of_reparse_points and libfsntfs_volume_get_reparse_point_by_index functions
  * Returns 1 if successful or 0 if not
  */
-int fsntfs_test_volume_get_root_directory(
+int fsntfs_test_volume_get_reparse_point_by_index(
      libfsntfs_volume_t *volume )
 {
-	libcerror_error_t *error               = NULL;
-	libfsntfs_file_entry_t *root_directory = 0;
-	int result                             = 0;
+	libcerror_error_t *error     = NULL;
+	uint64_t file_reference      = 0;
+	uint32_t tag                 = 0;
+	int number_of_reparse_points = 0;
+	int reparse_point_index      = 0;
+	int result                   = 0;
 
 	/* Test regular cases
 	 */
-	result = libfsntfs_volume_get_root_directory(
+	result = libfsntfs_volume_get_number_of_reparse_points(
 	          volume,
-	          &root_directory,
+	          &number_of_reparse_points,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
@@ -2960,36 +4501,52 @@ int fsntfs_test_volume_get_root_directory(
 	 result,
 	 1 );
 
-	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
-	 "root_directory",
-	 root_directory );
-
 	FSNTFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfsntfs_file_entry_free(
-	          &root_directory,
+	for( reparse_point_index = 0;
+	     reparse_point_index < number_of_reparse_points;
+	     reparse_point_index++ )
+	{
+		result = libfsntfs_volume_get_reparse_point_by_index(
+		          volume,
+		          reparse_point_index,
+		          &tag,
+		          &file_reference,
+		          &error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSNTFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libfsntfs_volume_get_number_of_reparse_points(
+	          NULL,
+	          &number_of_reparse_points,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	FSNTFS_TEST_ASSERT_IS_NULL(
-	 "root_directory",
-	 root_directory );
+	 -1 );
 
-	FSNTFS_TEST_ASSERT_IS_NULL(
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libfsntfs_volume_get_root_directory(
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_volume_get_number_of_reparse_points(
+	          volume,
 	          NULL,
-	          &root_directory,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
@@ -2997,10 +4554,6 @@ int fsntfs_test_volume_get_root_directory(
 	 result,
 	 -1 );
 
-	FSNTFS_TEST_ASSERT_IS_NULL(
-	 "root_directory",
-	 root_directory );
-
 	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -3008,9 +4561,11 @@ int fsntfs_test_volume_get_root_directory(
 	libcerror_error_free(
 	 &error );
 
-	result = libfsntfs_volume_get_root_directory(
-	          volume,
+	result = libfsntfs_volume_get_reparse_point_by_index(
 	          NULL,
+	          0,
+	          &tag,
+	          &file_reference,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
@@ -3018,9 +4573,24 @@ int fsntfs_test_volume_get_root_directory(
 	 result,
 	 -1 );
 
-	FSNTFS_TEST_ASSERT_IS_NULL(
-	 "root_directory",
-	 root_directory );
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_volume_get_reparse_point_by_index(
+	          volume,
+	          number_of_reparse_points,
+	          &tag,
+	          &file_reference,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -3037,31 +4607,34 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( root_directory != NULL )
-	{
-		libfsntfs_file_entry_free(
-		 &root_directory,
-		 NULL );
-	}
 	return( 0 );
 }
 
-/* Tests the libfsntfs_volume_get_usn_change_journal function
+/* Tests the libfsntfs_volume_get_quota_owner_identifier_by_sid and libfsntfs_volume_get_quota_by_owner_identifier functions
  * Returns 1 if successful or 0 if not
  */
-int fsntfs_test_volume_get_usn_change_journal(
+int fsntfs_test_volume_get_quota_by_owner_identifier(
      libfsntfs_volume_t *volume )
 {
-	libcerror_error_t *error                           = NULL;
-	libfsntfs_usn_change_journal_t *usn_change_journal = 0;
-	int result                                         = 0;
-	int usn_change_journal_is_set                      = 0;
+	/* S-1-5-18
+	 */
+	uint8_t sid_data[ 12 ] = {
+		0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x12, 0x00, 0x00, 0x00 };
+
+	libcerror_error_t *error  = NULL;
+	uint64_t bytes_used       = 0;
+	uint64_t hard_limit       = 0;
+	uint64_t warning_limit    = 0;
+	uint32_t owner_identifier = 0;
+	int result                = 0;
 
 	/* Test regular cases
 	 */
-	result = libfsntfs_volume_get_usn_change_journal(
+	result = libfsntfs_volume_get_quota_owner_identifier_by_sid(
 	          volume,
-	          &usn_change_journal,
+	          sid_data,
+	          12,
+	          &owner_identifier,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_NOT_EQUAL_INT(
@@ -3073,22 +4646,20 @@ int fsntfs_test_volume_get_usn_change_journal(
 	 "error",
 	 error );
 
-	usn_change_journal_is_set = result;
-
-	if( usn_change_journal_is_set != 0 )
+	if( result != 0 )
 	{
-		FSNTFS_TEST_ASSERT_IS_NOT_NULL(
-		 "usn_change_journal",
-		 usn_change_journal );
-
-		result = libfsntfs_usn_change_journal_free(
-		          &usn_change_journal,
+		result = libfsntfs_volume_get_quota_by_owner_identifier(
+		          volume,
+		          owner_identifier,
+		          &bytes_used,
+		          &warning_limit,
+		          &hard_limit,
 		          &error );
 
-		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		FSNTFS_TEST_ASSERT_NOT_EQUAL_INT(
 		 "result",
 		 result,
-		 1 );
+		 -1 );
 
 		FSNTFS_TEST_ASSERT_IS_NULL(
 		 "error",
@@ -3096,9 +4667,11 @@ int fsntfs_test_volume_get_usn_change_journal(
 	}
 	/* Test error cases
 	 */
-	result = libfsntfs_volume_get_usn_change_journal(
+	result = libfsntfs_volume_get_quota_owner_identifier_by_sid(
 	          NULL,
-	          &usn_change_journal,
+	          sid_data,
+	          12,
+	          &owner_identifier,
 	          &error );
 
 	FSNTFS_TEST_ASSERT_EQUAL_INT(
@@ -3106,9 +4679,24 @@ int fsntfs_test_volume_get_usn_change_journal(
 	 result,
 	 -1 );
 
-	FSNTFS_TEST_ASSERT_IS_NULL(
-	 "usn_change_journal",
-	 usn_change_journal );
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_volume_get_quota_owner_identifier_by_sid(
+	          volume,
+	          NULL,
+	          12,
+	          &owner_identifier,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -3117,29 +4705,65 @@ int fsntfs_test_volume_get_usn_change_journal(
 	libcerror_error_free(
 	 &error );
 
-	if( usn_change_journal_is_set != 0 )
-	{
-		result = libfsntfs_volume_get_usn_change_journal(
-		          volume,
-		          NULL,
-		          &error );
+	result = libfsntfs_volume_get_quota_owner_identifier_by_sid(
+	          volume,
+	          sid_data,
+	          12,
+	          NULL,
+	          &error );
 
-		FSNTFS_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		FSNTFS_TEST_ASSERT_IS_NULL(
-		 "usn_change_journal",
-		 usn_change_journal );
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		FSNTFS_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_volume_get_quota_by_owner_identifier(
+	          NULL,
+	          0x100,
+	          &bytes_used,
+	          &warning_limit,
+	          &hard_limit,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_volume_get_quota_by_owner_identifier(
+	          volume,
+	          0x100,
+	          NULL,
+	          &warning_limit,
+	          &hard_limit,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
 
-		libcerror_error_free(
-		 &error );
-	}
 	return( 1 );
 
 on_error:
@@ -3148,12 +4772,6 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( usn_change_journal != NULL )
-	{
-		libfsntfs_usn_change_journal_free(
-		 &usn_change_journal,
-		 NULL );
-	}
 	return( 0 );
 }
 
@@ -3345,6 +4963,11 @@ int main(
 		 fsntfs_test_volume_open_close,
 		 source );
 
+		FSNTFS_TEST_RUN_WITH_ARGS(
+		 "libfsntfs_volume_close_with_pending_async_reads",
+		 fsntfs_test_volume_close_with_pending_async_reads,
+		 source );
+
 		/* TODO: add tests for libfsntfs_internal_volume_open_read */
 
 		/* TODO: add tests for libfsntfs_internal_volume_read_bitmap */
@@ -3373,6 +4996,11 @@ int main(
 		 "error",
 		 error );
 
+		FSNTFS_TEST_RUN_WITH_ARGS(
+		 "libfsntfs_volume_clone",
+		 fsntfs_test_volume_clone,
+		 volume );
+
 		FSNTFS_TEST_RUN_WITH_ARGS(
 		 "libfsntfs_volume_signal_abort",
 		 fsntfs_test_volume_signal_abort,
@@ -3402,6 +5030,16 @@ int main(
 		 fsntfs_test_volume_get_index_entry_size,
 		 volume );
 
+		FSNTFS_TEST_RUN_WITH_ARGS(
+		 "libfsntfs_volume_get_statistics",
+		 fsntfs_test_volume_get_statistics,
+		 volume );
+
+		FSNTFS_TEST_RUN_WITH_ARGS(
+		 "libfsntfs_volume_read_file_entries_data",
+		 fsntfs_test_volume_read_file_entries_data,
+		 volume );
+
 		FSNTFS_TEST_RUN_WITH_ARGS(
 		 "libfsntfs_volume_get_utf8_name_size",
 		 fsntfs_test_volume_get_utf8_name_size,
@@ -3477,6 +5115,31 @@ int main(
 		 fsntfs_test_volume_get_usn_change_journal,
 		 volume );
 
+		FSNTFS_TEST_RUN_WITH_ARGS(
+		 "libfsntfs_volume_get_changed_mft_entries",
+		 fsntfs_test_volume_get_changed_mft_entries,
+		 volume );
+
+		FSNTFS_TEST_RUN_WITH_ARGS(
+		 "libfsntfs_volume_search_name_index_utf8",
+		 fsntfs_test_volume_search_name_index_utf8,
+		 volume );
+
+		FSNTFS_TEST_RUN_WITH_ARGS(
+		 "libfsntfs_volume_get_file_entry_by_object_identifier",
+		 fsntfs_test_volume_get_file_entry_by_object_identifier,
+		 volume );
+
+		FSNTFS_TEST_RUN_WITH_ARGS(
+		 "libfsntfs_volume_get_reparse_point_by_index",
+		 fsntfs_test_volume_get_reparse_point_by_index,
+		 volume );
+
+		FSNTFS_TEST_RUN_WITH_ARGS(
+		 "libfsntfs_volume_get_quota_by_owner_identifier",
+		 fsntfs_test_volume_get_quota_by_owner_identifier,
+		 volume );
+
 		/* Clean up
 		 */
 		result = fsntfs_test_volume_close_source(
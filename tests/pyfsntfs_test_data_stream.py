@@ -0,0 +1,469 @@
+#!/usr/bin/env python
+#
+# Python-bindings data stream type test script
+#
+# Copyright (C) 2010-2020, Joachim Metz <joachim.metz@gmail.com>
+#
+# Refer to AUTHORS for acknowledgements.
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+import argparse
+import io
+import os
+import sys
+import unittest
+
+import pyfsntfs
+
+
+class DataRangeFileObject(object):
+  """File-like object that maps an in-file data range."""
+
+  def __init__(self, path, range_offset, range_size):
+    """Initializes a file-like object.
+
+    Args:
+      path (str): path of the file that contains the data range.
+      range_offset (int): offset where the data range starts.
+      range_size (int): size of the data range starts, or None to indicate
+          the range should continue to the end of the parent file-like object.
+    """
+    super(DataRangeFileObject, self).__init__()
+    self._current_offset = 0
+    self._file_object = open(path, "rb")
+    self._range_offset = range_offset
+    self._range_size = range_size
+
+  def __enter__(self):
+    """Enters a with statement."""
+    return self
+
+  def __exit__(self, unused_type, unused_value, unused_traceback):
+    """Exits a with statement."""
+    return
+
+  def close(self):
+    """Closes the file-like object."""
+    if self._file_object:
+      self._file_object.close()
+      self._file_object = None
+
+  def get_offset(self):
+    """Retrieves the current offset into the file-like object.
+
+    Returns:
+      int: current offset in the data range.
+    """
+    return self._current_offset
+
+  def get_size(self):
+    """Retrieves the size of the file-like object.
+
+    Returns:
+      int: size of the data range.
+    """
+    return self._range_size
+
+  def read(self, size=None):
+    """Reads a byte string from the file-like object at the current offset.
+
+    The function will read a byte string of the specified size or
+    all of the remaining data if no size was specified.
+
+    Args:
+      size (Optional[int]): number of bytes to read, where None is all
+          remaining data.
+
+    Returns:
+      bytes: data read.
+
+    Raises:
+      IOError: if the read failed.
+    """
+    if (self._range_offset < 0 or
+        (self._range_size is not None and self._range_size < 0)):
+      raise IOError("Invalid data range.")
+
+    if self._current_offset < 0:
+      raise IOError(
+          "Invalid current offset: {0:d} value less than zero.".format(
+              self._current_offset))
+
+    if (self._range_size is not None and
+        self._current_offset >= self._range_size):
+      return b""
+
+    if size is None:
+      size = self._range_size
+    if self._range_size is not None and self._current_offset + size > self._range_size:
+      size = self._range_size - self._current_offset
+
+    self._file_object.seek(
+        self._range_offset + self._current_offset, os.SEEK_SET)
+
+    data = self._file_object.read(size)
+
+    self._current_offset += len(data)
+
+    return data
+
+  def seek(self, offset, whence=os.SEEK_SET):
+    """Seeks to an offset within the file-like object.
+
+    Args:
+      offset (int): offset to seek to.
+      whence (Optional(int)): value that indicates whether offset is an absolute
+          or relative position within the file.
+
+    Raises:
+      IOError: if the seek failed.
+    """
+    if self._current_offset < 0:
+      raise IOError(
+          "Invalid current offset: {0:d} value less than zero.".format(
+              self._current_offset))
+
+    if whence == os.SEEK_CUR:
+      offset += self._current_offset
+    elif whence == os.SEEK_END:
+      offset += self._range_size
+    elif whence != os.SEEK_SET:
+      raise IOError("Unsupported whence.")
+    if offset < 0:
+      raise IOError("Invalid offset value less than zero.")
+
+    self._current_offset = offset
+
+
+class DataStreamTypeTests(unittest.TestCase):
+  """Tests the data stream type."""
+
+  def test_read_buffer(self):
+    """Tests the read_buffer function."""
+    if not unittest.source:
+      raise unittest.SkipTest("missing source")
+
+    with DataRangeFileObject(
+        unittest.source, unittest.offset or 0, None) as file_object:
+
+      fsntfs_volume = pyfsntfs.volume()
+      fsntfs_volume.open_file_object(file_object)
+
+      # The $Secure metadata file stores the security descriptors
+      # in the $SDS alternate data stream.
+      file_entry = fsntfs_volume.get_file_entry_by_path("\\$Secure")
+      self.assertIsNotNone(file_entry)
+
+      data_stream = file_entry.get_alternate_data_stream_by_name("$SDS")
+      if data_stream is None:
+        raise unittest.SkipTest("missing $SDS data stream")
+
+      size = data_stream.get_size()
+
+      if size < 4096:
+        raise unittest.SkipTest("data stream data too small")
+
+      data_stream.seek_offset(0, os.SEEK_SET)
+
+      data = data_stream.read_buffer(size=4096)
+      self.assertIsNotNone(data)
+      self.assertEqual(len(data), 4096)
+      self.assertEqual(data_stream.get_offset(), 4096)
+
+      fsntfs_volume.close()
+
+  def test_readinto(self):
+    """Tests the readinto function."""
+    if not unittest.source:
+      raise unittest.SkipTest("missing source")
+
+    with DataRangeFileObject(
+        unittest.source, unittest.offset or 0, None) as file_object:
+
+      fsntfs_volume = pyfsntfs.volume()
+      fsntfs_volume.open_file_object(file_object)
+
+      # The $Secure metadata file stores the security descriptors
+      # in the $SDS alternate data stream.
+      file_entry = fsntfs_volume.get_file_entry_by_path("\\$Secure")
+      self.assertIsNotNone(file_entry)
+
+      data_stream = file_entry.get_alternate_data_stream_by_name("$SDS")
+      if data_stream is None:
+        raise unittest.SkipTest("missing $SDS data stream")
+
+      size = data_stream.get_size()
+
+      if size < 8192:
+        raise unittest.SkipTest("data stream data too small")
+
+      expected_data = data_stream.read_buffer_at_offset(8192, 0)
+
+      # Test reading into a bytearray.
+      data_stream.seek_offset(0, os.SEEK_SET)
+
+      buffer = bytearray(4096)
+      read_count = data_stream.readinto(buffer)
+      self.assertEqual(read_count, 4096)
+      self.assertEqual(bytes(buffer), expected_data[:4096])
+      self.assertEqual(data_stream.get_offset(), 4096)
+
+      # Test reading into a memoryview of part of a bytearray.
+      buffer = bytearray(8192)
+      buffer_view = memoryview(buffer)[1024:5120]
+
+      read_count = data_stream.readinto(buffer_view)
+      self.assertEqual(read_count, 4096)
+      self.assertEqual(bytes(buffer[1024:5120]), expected_data[4096:8192])
+      self.assertEqual(bytes(buffer[:1024]), b"\x00" * 1024)
+      self.assertEqual(bytes(buffer[5120:]), b"\x00" * 3072)
+      self.assertEqual(data_stream.get_offset(), 8192)
+
+      # Test reading at the end of the data.
+      data_stream.seek_offset(0, os.SEEK_END)
+
+      read_count = data_stream.readinto(bytearray(4096))
+      self.assertEqual(read_count, 0)
+
+      # Test reading into a read-only buffer.
+      with self.assertRaises(BufferError):
+        data_stream.readinto(b"\x00" * 4096)
+
+      fsntfs_volume.close()
+
+  def test_readinto_at_offset(self):
+    """Tests the readinto_at_offset function."""
+    if not unittest.source:
+      raise unittest.SkipTest("missing source")
+
+    with DataRangeFileObject(
+        unittest.source, unittest.offset or 0, None) as file_object:
+
+      fsntfs_volume = pyfsntfs.volume()
+      fsntfs_volume.open_file_object(file_object)
+
+      # The $Secure metadata file stores the security descriptors
+      # in the $SDS alternate data stream.
+      file_entry = fsntfs_volume.get_file_entry_by_path("\\$Secure")
+      self.assertIsNotNone(file_entry)
+
+      data_stream = file_entry.get_alternate_data_stream_by_name("$SDS")
+      if data_stream is None:
+        raise unittest.SkipTest("missing $SDS data stream")
+
+      size = data_stream.get_size()
+
+      if size < 8192:
+        raise unittest.SkipTest("data stream data too small")
+
+      expected_data = data_stream.read_buffer_at_offset(8192, 0)
+
+      # Test reading into a bytearray.
+      buffer = bytearray(4096)
+      read_count = data_stream.readinto_at_offset(buffer, 4096)
+      self.assertEqual(read_count, 4096)
+      self.assertEqual(bytes(buffer), expected_data[4096:8192])
+
+      # Test reading into a memoryview.
+      buffer = bytearray(4096)
+      read_count = data_stream.readinto_at_offset(memoryview(buffer), 512)
+      self.assertEqual(read_count, 4096)
+      self.assertEqual(bytes(buffer), expected_data[512:4608])
+
+      # Test reading a buffer that extends beyond the end of the data.
+      buffer = bytearray(4096)
+      read_count = data_stream.readinto_at_offset(buffer, size - 512)
+      self.assertEqual(read_count, 512)
+
+      # Test reading beyond the end of the data.
+      read_count = data_stream.readinto_at_offset(bytearray(4096), size + 512)
+      self.assertEqual(read_count, 0)
+
+      with self.assertRaises(IOError):
+        data_stream.readinto_at_offset(bytearray(4096), -1)
+
+      with self.assertRaises(BufferError):
+        data_stream.readinto_at_offset(b"\x00" * 4096, 0)
+
+      fsntfs_volume.close()
+
+  def test_readall(self):
+    """Tests the readall function."""
+    if not unittest.source:
+      raise unittest.SkipTest("missing source")
+
+    with DataRangeFileObject(
+        unittest.source, unittest.offset or 0, None) as file_object:
+
+      fsntfs_volume = pyfsntfs.volume()
+      fsntfs_volume.open_file_object(file_object)
+
+      # The $Secure metadata file stores the security descriptors
+      # in the $SDS alternate data stream.
+      file_entry = fsntfs_volume.get_file_entry_by_path("\\$Secure")
+      self.assertIsNotNone(file_entry)
+
+      data_stream = file_entry.get_alternate_data_stream_by_name("$SDS")
+      if data_stream is None:
+        raise unittest.SkipTest("missing $SDS data stream")
+
+      size = data_stream.get_size()
+
+      data_stream.seek_offset(0, os.SEEK_SET)
+
+      data = data_stream.readall()
+      self.assertEqual(len(data), size)
+      self.assertEqual(data_stream.get_offset(), size)
+
+      # Test reading the remaining data.
+      offset = size // 2
+      data_stream.seek_offset(offset, os.SEEK_SET)
+
+      remaining_data = data_stream.readall()
+      self.assertEqual(remaining_data, data[offset:])
+
+      # Test reading at the end of the data.
+      remaining_data = data_stream.readall()
+      self.assertEqual(remaining_data, b"")
+
+      fsntfs_volume.close()
+
+  def test_seek(self):
+    """Tests the seek function."""
+    if not unittest.source:
+      raise unittest.SkipTest("missing source")
+
+    with DataRangeFileObject(
+        unittest.source, unittest.offset or 0, None) as file_object:
+
+      fsntfs_volume = pyfsntfs.volume()
+      fsntfs_volume.open_file_object(file_object)
+
+      # The $Secure metadata file stores the security descriptors
+      # in the $SDS alternate data stream.
+      file_entry = fsntfs_volume.get_file_entry_by_path("\\$Secure")
+      self.assertIsNotNone(file_entry)
+
+      data_stream = file_entry.get_alternate_data_stream_by_name("$SDS")
+      if data_stream is None:
+        raise unittest.SkipTest("missing $SDS data stream")
+
+      size = data_stream.get_size()
+
+      if size < 1024:
+        raise unittest.SkipTest("data stream data too small")
+
+      offset = data_stream.seek(512)
+      self.assertEqual(offset, 512)
+      self.assertEqual(data_stream.tell(), 512)
+
+      offset = data_stream.seek(256, os.SEEK_CUR)
+      self.assertEqual(offset, 768)
+      self.assertEqual(data_stream.tell(), 768)
+
+      offset = data_stream.seek(-512, os.SEEK_END)
+      self.assertEqual(offset, size - 512)
+      self.assertEqual(data_stream.tell(), size - 512)
+
+      offset = data_stream.seek(size + 512, os.SEEK_SET)
+      self.assertEqual(offset, size + 512)
+
+      offset = data_stream.seek(0)
+      self.assertEqual(offset, 0)
+
+      with self.assertRaises(IOError):
+        data_stream.seek(-1, os.SEEK_SET)
+
+      with self.assertRaises(IOError):
+        data_stream.seek(0, 99)
+
+      fsntfs_volume.close()
+
+  def test_buffered_reader(self):
+    """Tests wrapping the data stream in io.BufferedReader."""
+    if not unittest.source:
+      raise unittest.SkipTest("missing source")
+
+    with DataRangeFileObject(
+        unittest.source, unittest.offset or 0, None) as file_object:
+
+      fsntfs_volume = pyfsntfs.volume()
+      fsntfs_volume.open_file_object(file_object)
+
+      # The $Secure metadata file stores the security descriptors
+      # in the $SDS alternate data stream.
+      file_entry = fsntfs_volume.get_file_entry_by_path("\\$Secure")
+      self.assertIsNotNone(file_entry)
+
+      data_stream = file_entry.get_alternate_data_stream_by_name("$SDS")
+      if data_stream is None:
+        raise unittest.SkipTest("missing $SDS data stream")
+
+      size = data_stream.get_size()
+
+      if size < 8192:
+        raise unittest.SkipTest("data stream data too small")
+
+      expected_data = data_stream.read_buffer_at_offset(8192, 0)
+
+      data_stream.seek_offset(0, os.SEEK_SET)
+
+      self.assertTrue(data_stream.readable())
+      self.assertTrue(data_stream.seekable())
+      self.assertFalse(data_stream.writable())
+      self.assertFalse(data_stream.closed)
+
+      buffered_reader = io.BufferedReader(data_stream, buffer_size=1024)
+
+      data = buffered_reader.read(100)
+      self.assertEqual(data, expected_data[:100])
+
+      data = buffered_reader.read(2000)
+      self.assertEqual(data, expected_data[100:2100])
+      self.assertEqual(buffered_reader.tell(), 2100)
+
+      offset = buffered_reader.seek(4096)
+      self.assertEqual(offset, 4096)
+
+      data = buffered_reader.read(4096)
+      self.assertEqual(data, expected_data[4096:8192])
+
+      offset = buffered_reader.seek(-100, os.SEEK_END)
+      self.assertEqual(offset, size - 100)
+
+      data = buffered_reader.read()
+      self.assertEqual(len(data), 100)
+
+      fsntfs_volume.close()
+
+
+if __name__ == "__main__":
+  argument_parser = argparse.ArgumentParser()
+
+  argument_parser.add_argument(
+      "-o", "--offset", dest="offset", action="store", default=None,
+      type=int, help="offset of the source file.")
+
+  argument_parser.add_argument(
+      "source", nargs="?", action="store", metavar="PATH",
+      default=None, help="path of the source file.")
+
+  options, unknown_options = argument_parser.parse_known_args()
+  unknown_options.insert(0, sys.argv[0])
+
+  setattr(unittest, "offset", options.offset)
+  setattr(unittest, "source", options.source)
+
+  unittest.main(argv=unknown_options, verbosity=2)
@@ -22,6 +22,7 @@
 import argparse
 import os
 import sys
+import threading
 import unittest
 
 import pyfsntfs
@@ -146,6 +147,53 @@ class DataRangeFileObject(object):
     self._current_offset = offset
 
 
+class PatchedDataRangeFileObject(DataRangeFileObject):
+  """File-like object that maps an in-file data range with patched data."""
+
+  def __init__(self, path, range_offset, range_size, patches):
+    """Initializes a file-like object.
+
+    Args:
+      path (str): path of the file that contains the data range.
+      range_offset (int): offset where the data range starts.
+      range_size (int): size of the data range starts, or None to indicate
+          the range should continue to the end of the parent file-like object.
+      patches (list[tuple[int, bytes]]): offsets in the data range and
+          the data that replaces the data at these offsets.
+    """
+    super(PatchedDataRangeFileObject, self).__init__(
+        path, range_offset, range_size)
+    self._patches = patches
+
+  def read(self, size=None):
+    """Reads a byte string from the file-like object at the current offset.
+
+    Args:
+      size (Optional[int]): number of bytes to read, where None is all
+          remaining data.
+
+    Returns:
+      bytes: data read.
+
+    Raises:
+      IOError: if the read failed.
+    """
+    read_offset = self._current_offset
+
+    data = super(PatchedDataRangeFileObject, self).read(size=size)
+
+    for patch_offset, patch_data in self._patches:
+      start_offset = max(patch_offset, read_offset)
+      end_offset = min(patch_offset + len(patch_data), read_offset + len(data))
+      if start_offset < end_offset:
+        data = b"".join([
+            data[:start_offset - read_offset],
+            patch_data[start_offset - patch_offset:end_offset - patch_offset],
+            data[end_offset - read_offset:]])
+
+    return data
+
+
 class VolumeTypeTests(unittest.TestCase):
   """Tests the volume type."""
 
@@ -369,6 +417,23 @@ class VolumeTypeTests(unittest.TestCase):
 
       fsntfs_volume.close()
 
+  def test_get_statistics(self):
+    """Tests the get_statistics function."""
+    if not unittest.source:
+      raise unittest.SkipTest("missing source")
+
+    with DataRangeFileObject(
+        unittest.source, unittest.offset or 0, None) as file_object:
+
+      fsntfs_volume = pyfsntfs.volume()
+      fsntfs_volume.open_file_object(file_object)
+
+      statistics = fsntfs_volume.get_statistics()
+      self.assertIsNotNone(statistics)
+      self.assertIn("mft_entries_read", statistics)
+
+      fsntfs_volume.close()
+
   def test_get_number_of_file_entries(self):
     """Tests the get_number_of_file_entries function and number_of_file_entries property."""
     if not unittest.source:
@@ -421,6 +486,171 @@ class VolumeTypeTests(unittest.TestCase):
 
       fsntfs_volume.close()
 
+  def test_iter_mft_records(self):
+    """Tests the iter_mft_records function."""
+    if not unittest.source:
+      raise unittest.SkipTest("missing source")
+
+    with DataRangeFileObject(
+        unittest.source, unittest.offset or 0, None) as file_object:
+
+      fsntfs_volume = pyfsntfs.volume()
+      fsntfs_volume.open_file_object(file_object)
+
+      number_of_file_entries = fsntfs_volume.get_number_of_file_entries()
+
+      with self.assertRaises(ValueError):
+        fsntfs_volume.iter_mft_records(batch_size=0)
+
+      batches = list(fsntfs_volume.iter_mft_records(batch_size=16))
+      self.assertNotEqual(batches, [])
+
+      # Every batch but the last contains batch size records.
+      for batch in batches[:-1]:
+        self.assertEqual(len(batch), 16)
+
+      self.assertGreater(len(batches[-1]), 0)
+      self.assertLessEqual(len(batches[-1]), 16)
+
+      records = [record for batch in batches for record in batch]
+
+      # The records are in MFT entry order and empty MFT entries are skipped.
+      mft_entry_indexes = [record[0] for record in records]
+      self.assertEqual(mft_entry_indexes, sorted(set(mft_entry_indexes)))
+
+      for mft_entry_index in range(min(number_of_file_entries, 256)):
+        file_entry = fsntfs_volume.get_file_entry(mft_entry_index)
+        self.assertEqual(
+            file_entry.is_empty(), mft_entry_index not in mft_entry_indexes)
+
+      for record in records:
+        self.assertEqual(len(record), 15)
+
+        mft_entry_index = record[0]
+        if mft_entry_index >= 256:
+          break
+
+        file_entry = fsntfs_volume.get_file_entry(mft_entry_index)
+
+        self.assertEqual(record[1], file_entry.file_reference >> 48)
+        self.assertEqual(record[2], file_entry.is_allocated())
+
+        if record[3] is not None:
+          self.assertEqual(record[3], file_entry.file_attribute_flags)
+
+        if record[5] is not None:
+          self.assertIsInstance(record[5], str)
+
+        self.assertIsInstance(record[6], int)
+
+        for value in record[7:]:
+          if value is not None:
+            self.assertIsInstance(value, int)
+
+      # The $MFT metadata file is MFT entry 0.
+      self.assertEqual(records[0][0], 0)
+      self.assertEqual(records[0][1], 1)
+      self.assertEqual(records[0][5], "$MFT")
+
+      # The default batch size contains all records of a small volume.
+      batches = list(fsntfs_volume.iter_mft_records())
+      if number_of_file_entries <= 1024:
+        self.assertEqual(len(batches), 1)
+        self.assertEqual(batches[0], records)
+
+      fsntfs_volume.close()
+
+  def test_iter_mft_records_with_error(self):
+    """Tests the iter_mft_records function with a corrupted MFT entry."""
+    if not unittest.source:
+      raise unittest.SkipTest("missing source")
+
+    if not os.path.isfile(unittest.source):
+      raise unittest.SkipTest("source not a regular file")
+
+    with DataRangeFileObject(
+        unittest.source, unittest.offset or 0, None) as file_object:
+
+      fsntfs_volume = pyfsntfs.volume()
+      fsntfs_volume.open_file_object(file_object)
+
+      mft_entry_size = fsntfs_volume.get_mft_entry_size()
+
+      records = [
+          record for batch in fsntfs_volume.iter_mft_records()
+          for record in batch]
+
+      # Only corrupt base records, since reading a base record also reads
+      # the extension records of its attribute list.
+      mft_entry_indexes = []
+      for record in records:
+        if record[0] < 16:
+          continue
+        file_entry = fsntfs_volume.get_file_entry(record[0])
+        if not file_entry.get_base_record_file_reference():
+          mft_entry_indexes.append(record[0])
+
+      mft_file_entry = fsntfs_volume.get_file_entry(0)
+      mft_extents = [
+          mft_file_entry.get_extent(extent_index)
+          for extent_index in range(mft_file_entry.get_number_of_extents())]
+
+      fsntfs_volume.close()
+
+    # Corrupt the first and second non-empty MFT entries after the metadata
+    # files, where the signature "BAAD" marks an MFT entry as empty and an
+    # unsupported signature makes reading the MFT entry fail.
+    if len(mft_entry_indexes) < 3:
+      raise unittest.SkipTest("source has too few MFT entries")
+
+    bad_mft_entry_index = mft_entry_indexes[0]
+    corrupted_mft_entry_index = mft_entry_indexes[1]
+
+    patches = []
+    for mft_entry_index, signature in (
+        (bad_mft_entry_index, b"BAAD"),
+        (corrupted_mft_entry_index, b"XXXX")):
+      data_offset = mft_entry_index * mft_entry_size
+      for extent_offset, extent_size, _ in mft_extents:
+        if data_offset < extent_size:
+          patches.append((extent_offset + data_offset, signature))
+          break
+        data_offset -= extent_size
+
+    self.assertEqual(len(patches), 2)
+
+    with PatchedDataRangeFileObject(
+        unittest.source, unittest.offset or 0, None, patches) as file_object:
+
+      fsntfs_volume = pyfsntfs.volume()
+      fsntfs_volume.open_file_object(file_object)
+
+      mft_records = fsntfs_volume.iter_mft_records(batch_size=len(records))
+
+      # The records read before the corrupted MFT entry are returned first.
+      batch = next(mft_records)
+      expected_records = [
+          record for record in records
+          if record[0] < corrupted_mft_entry_index and
+          record[0] != bad_mft_entry_index]
+      self.assertEqual(batch, expected_records)
+
+      # The next batch starts with the corrupted MFT entry and fails.
+      with self.assertRaises(IOError):
+        next(mft_records)
+
+      # The iteration continues after the corrupted MFT entry.
+      batch = next(mft_records)
+      expected_records = [
+          record for record in records
+          if record[0] > corrupted_mft_entry_index]
+      self.assertEqual(batch, expected_records)
+
+      with self.assertRaises(StopIteration):
+        next(mft_records)
+
+      fsntfs_volume.close()
+
   def test_get_root_directory(self):
     """Tests the get_root_directory function and root_directory property."""
     if not unittest.source:
@@ -456,6 +686,72 @@ class VolumeTypeTests(unittest.TestCase):
 
       fsntfs_volume.close()
 
+  def test_clone(self):
+    """Tests the clone function."""
+    if not unittest.source:
+      raise unittest.SkipTest("missing source")
+
+    if unittest.offset:
+      raise unittest.SkipTest("source defines offset")
+
+    fsntfs_volume = pyfsntfs.volume()
+    fsntfs_volume.open(unittest.source)
+
+    number_of_file_entries = fsntfs_volume.get_number_of_file_entries()
+
+    def _ReadFileEntries(fsntfs_volume_clone, results):
+      """Reads file entries from a volume clone."""
+      for file_entry_index in range(min(number_of_file_entries, 32)):
+        file_entry = fsntfs_volume_clone.get_file_entry(file_entry_index)
+        results.append(file_entry.file_reference)
+
+      fsntfs_volume_clone.close()
+
+    threads = []
+    thread_results = []
+    for _ in range(4):
+      results = []
+      thread = threading.Thread(
+          target=_ReadFileEntries, args=(fsntfs_volume.clone(), results))
+      thread.start()
+      threads.append(thread)
+      thread_results.append(results)
+
+    for thread in threads:
+      thread.join()
+
+    for results in thread_results[1:]:
+      self.assertEqual(results, thread_results[0])
+
+    fsntfs_volume.close()
+
+    with self.assertRaises(IOError):
+      fsntfs_volume.clone()
+
+  def test_clone_file_object(self):
+    """Tests the clone function on a volume opened using a file-like object."""
+    if not unittest.source:
+      raise unittest.SkipTest("missing source")
+
+    if not os.path.isfile(unittest.source):
+      raise unittest.SkipTest("source not a regular file")
+
+    with DataRangeFileObject(
+        unittest.source, unittest.offset or 0, None) as file_object:
+
+      fsntfs_volume = pyfsntfs.volume()
+      fsntfs_volume.open_file_object(file_object)
+
+      # Clones would share the offset of the file-like object.
+      with self.assertRaises(IOError):
+        fsntfs_volume.clone()
+
+      # The volume remains usable after the failed clone.
+      file_entry = fsntfs_volume.get_file_entry(0)
+      self.assertIsNotNone(file_entry)
+
+      fsntfs_volume.close()
+
 
 if __name__ == "__main__":
   argument_parser = argparse.ArgumentParser()